@@ -636,6 +636,11 @@ void zen_BinaryEntityBuilder_emitInvokeDynamic(zen_BinaryEntityBuilder_t* builde
  */
 void zen_BinaryEntityBuilder_emitInvokeStatic(zen_BinaryEntityBuilder_t* builder, uint16_t index);
 
+/**
+ * @memberof BinaryEntityBuilder
+ */
+void zen_BinaryEntityBuilder_emitInvokeOperator(zen_BinaryEntityBuilder_t* builder, uint8_t operator0);
+
 /* Jump */
 
 /**
@@ -855,6 +860,11 @@ void zen_BinaryEntityBuilder_emitLoadCPR(zen_BinaryEntityBuilder_t* builder, uin
  */
 void zen_BinaryEntityBuilder_emitWideLoadCPR(zen_BinaryEntityBuilder_t* builder, uint16_t index);
 
+/**
+ * @memberof BinaryEntityBuilder
+ */
+void zen_BinaryEntityBuilder_emitLoadLiteral(zen_BinaryEntityBuilder_t* builder, uint16_t index);
+
 /**
  * @memberof BinaryEntityBuilder
  */
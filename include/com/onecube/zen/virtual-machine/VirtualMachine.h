@@ -27,13 +27,52 @@
 
 #include <com/onecube/zen/virtual-machine/ExceptionManager.h>
 #include <com/onecube/zen/virtual-machine/VirtualMachineConfiguration.h>
+#include <com/onecube/zen/virtual-machine/object/Array.h>
 #include <com/onecube/zen/virtual-machine/object/Class.h>
+#include <com/onecube/zen/virtual-machine/object/ClassTable.h>
+#include <com/onecube/zen/virtual-machine/object/FieldHandle.h>
 #include <com/onecube/zen/virtual-machine/object/Function.h>
 #include <com/onecube/zen/virtual-machine/object/NativeFunction.h>
-#include <com/onecube/zen/virtual-machine/object/ObjectArray.h>
+#include <com/onecube/zen/virtual-machine/object/NativeFunctionTable.h>
 #include <com/onecube/zen/virtual-machine/loader/ClassLoader.h>
+#include <com/onecube/zen/virtual-machine/memory/MemoryManager.h>
 #include <com/onecube/zen/virtual-machine/processor/Interpreter.h>
 
+/*******************************************************************************
+ * CoreClasses                                                                 *
+ *******************************************************************************/
+
+/**
+ * The classes of the core library which the virtual machine instantiates or
+ * recognizes on its own, along with their constructors and the offsets of
+ * their fields. They are resolved once, when the virtual machine starts, so
+ * that the internal paths compare class pointers and access fields directly
+ * instead of looking them up by name.
+ *
+ * A class which cannot be loaded is left null. In such a case, the internal
+ * paths look the class up by name, which reports the failure.
+ *
+ * @class CoreClasses
+ * @ingroup zen_virtual_machine_native
+ * @author Samuel Rowe
+ * @since zen 1.0
+ */
+struct zen_CoreClasses_t {
+    zen_Class_t* m_integerClass;
+    zen_Function_t* m_integerConstructor;
+    zen_FieldHandle_t m_integerValue;
+    zen_Class_t* m_booleanClass;
+    zen_Function_t* m_booleanConstructor;
+    zen_FieldHandle_t m_booleanValue;
+    zen_Class_t* m_stringClass;
+    zen_Class_t* m_arrayClass;
+};
+
+/**
+ * @memberof CoreClasses
+ */
+typedef struct zen_CoreClasses_t zen_CoreClasses_t;
+
 /*******************************************************************************
  * VirtualMachine                                                              *
  *******************************************************************************/
@@ -48,8 +87,22 @@ struct zen_VirtualMachine_t {
     jtk_Logger_t* m_logger;
     zen_VirtualMachineConfiguration_t* m_configuration;
     zen_ClassLoader_t* m_classLoader;
+    /* The headers of the objects store the indexes of their classes in this
+     * table.
+     */
+    zen_ClassTable_t* m_classTable;
     zen_Interpreter_t* m_interpreter;
-    jtk_HashMap_t* m_nativeFunctions;
+    /* The native functions of the default libraries, which are resolved
+     * through a perfect hash table.
+     */
+    zen_NativeFunctionTable_t* m_nativeFunctions;
+    zen_MemoryManager_t* m_memoryManager;
+    /* The only instances of the Boolean class, indexed by their values. They
+     * are created when first requested and live as long as the virtual
+     * machine.
+     */
+    zen_Object_t* m_booleans[2];
+    zen_CoreClasses_t m_coreClasses;
 };
 
 /**
@@ -77,17 +130,62 @@ void zen_VirtualMachine_delete(zen_VirtualMachine_t* virtualMachine);
 
 // Array
 
-zen_ObjectArray_t* zen_VirtualMachine_newObjectArray(
+/**
+ * Creates an array with the specified type of elements and length. All the
+ * elements are initialized to zero, or `null` in case of references.
+ *
+ * @return The new array, or `NULL` if the length is invalid, in which case an
+ *         exception is raised.
+ * @memberof VirtualMachine
+ */
+zen_Object_t* zen_VirtualMachine_newArray(zen_VirtualMachine_t* virtualMachine,
+    zen_Type_t type, int32_t length);
+
+/**
+ * Creates an array of references to arrays, recursively, one level for every
+ * specified length. The arrays of the last dimension hold `null` references.
+ *
+ * @memberof VirtualMachine
+ */
+zen_Object_t* zen_VirtualMachine_newMultidimensionalArray(
+    zen_VirtualMachine_t* virtualMachine, const int32_t* lengths, int32_t dimensions);
+
+/**
+ * Creates a reference array, which holds the specified objects.
+ *
+ * @memberof VirtualMachine
+ */
+zen_Object_t* zen_VirtualMachine_newObjectArray(
     zen_VirtualMachine_t* virtualMachine, void** objects, int32_t size);
 
-zen_ObjectArray_t* zen_VirtualMachine_newByteArray(
+/**
+ * Creates a byte array, which holds a copy of the specified bytes.
+ *
+ * @memberof VirtualMachine
+ */
+zen_Object_t* zen_VirtualMachine_newByteArray(
     zen_VirtualMachine_t* virtualMachine, int8_t* bytes, int32_t size);
 
 // Boolean
 
+/**
+ * Returns the shared instance of the Boolean class that represents the
+ * specified value. Boolean objects are immutable, therefore, a new instance
+ * is never allocated after the first request.
+ *
+ * @memberof VirtualMachine
+ */
 zen_Object_t* zen_VirtualMachine_newBoolean(zen_VirtualMachine_t* virtualMachine,
     bool value);
 
+/**
+ * Returns the value of the specified instance of the Boolean class.
+ *
+ * @memberof VirtualMachine
+ */
+bool zen_VirtualMachine_getBooleanValue(zen_VirtualMachine_t* virtualMachine,
+    zen_Object_t* boolean);
+
 // Context
 
 /**
@@ -107,6 +205,15 @@ zen_Class_t* zen_VirtualMachine_getClass(zen_VirtualMachine_t* context, const ui
 zen_Class_t* zen_VirtualMachine_getClassEx(zen_VirtualMachine_t* context,
     const uint8_t* descriptor, int32_t descriptorSize, int32_t* descriptorHashCode);
 
+/**
+ * Resolves the core classes, their constructors and the offsets of their
+ * fields. It is invoked when the virtual machine starts, after the default
+ * libraries are loaded.
+ *
+ * @memberof VirtualMachine
+ */
+void zen_VirtualMachine_loadCoreClasses(zen_VirtualMachine_t* virtualMachine);
+
 /* Clear */
 
 bool zen_VirtualMachine_isClear(zen_VirtualMachine_t* virtualMachine);
@@ -120,25 +227,90 @@ void zen_VirtualMachine_setObjectField(zen_VirtualMachine_t* virtualMachine,
 zen_Object_t* zen_VirtualMachine_getObjectField(zen_VirtualMachine_t* virtualMachine,
     zen_Object_t* object, uint8_t* fieldName, int32_t fieldNameSize);
 
+/**
+ * Resolves the field with the specified name in the class with the specified
+ * descriptor. Native code should resolve the fields it accesses once, and
+ * access them through the handles, instead of looking them up by name on
+ * every access.
+ *
+ * @return `true` if the field was resolved; otherwise, `false`, in which case
+ *         an exception is raised.
+ * @memberof VirtualMachine
+ */
+bool zen_VirtualMachine_resolveFieldHandle(zen_VirtualMachine_t* virtualMachine,
+    zen_FieldHandle_t* handle, const uint8_t* classDescriptor, int32_t classDescriptorSize,
+    const uint8_t* fieldName, int32_t fieldNameSize);
+
+/**
+ * Stores the specified value in a primitive field of the specified object,
+ * which is truncated to the size of the field. A value stored in a floating
+ * point field is converted.
+ *
+ * @memberof VirtualMachine
+ */
+void zen_VirtualMachine_setIntegerField(zen_VirtualMachine_t* virtualMachine,
+    zen_Object_t* object, const uint8_t* fieldName, int32_t fieldNameSize,
+    int64_t value);
+
+/**
+ * Loads the value of a primitive field of the specified object. A value
+ * loaded from a floating point field is converted.
+ *
+ * @memberof VirtualMachine
+ */
+int64_t zen_VirtualMachine_getIntegerField(zen_VirtualMachine_t* virtualMachine,
+    zen_Object_t* object, const uint8_t* fieldName, int32_t fieldNameSize);
+
+/**
+ * @memberof VirtualMachine
+ */
+void zen_VirtualMachine_setDecimalField(zen_VirtualMachine_t* virtualMachine,
+    zen_Object_t* object, const uint8_t* fieldName, int32_t fieldNameSize,
+    double value);
+
+/**
+ * @memberof VirtualMachine
+ */
+double zen_VirtualMachine_getDecimalField(zen_VirtualMachine_t* virtualMachine,
+    zen_Object_t* object, const uint8_t* fieldName, int32_t fieldNameSize);
+
 // Integer
 
+/**
+ * Creates an instance of the `zen.core.Integer` class. If the value fits in
+ * a small integer, no memory is allocated.
+ */
 zen_Object_t* zen_VirtualMachine_newInteger(zen_VirtualMachine_t* virtualMachine,
     int64_t value);
 
+/**
+ * Returns the value of the specified instance of the `zen.core.Integer`
+ * class, which may be a small integer.
+ */
+int64_t zen_VirtualMachine_getIntegerValue(zen_VirtualMachine_t* virtualMachine,
+    zen_Object_t* integer);
+
 // Libraries
 
+/**
+ * Builds the table of the native functions provided by the default
+ * libraries. The table is immutable once built.
+ *
+ * @memberof VirtualMachine
+ */
 void zen_VirtualMachine_loadDefaultLibraries(zen_VirtualMachine_t* virtualMachine);
 
 void zen_VirtualMachine_unloadLibraries(zen_VirtualMachine_t* virtualMachine);
 
 // Native Function
 
-zen_NativeFunction_t* zen_VirtualMachine_registerNativeFunction(
-    zen_VirtualMachine_t* virtualMachine, const uint8_t* className,
-    int32_t classNameSize, const uint8_t* functionName, int32_t functionNameSize,
-    const uint8_t* functionDescriptor, int32_t functionDescriptorSize,
-    zen_NativeFunction_InvokeFunction_t function);
-
+/**
+ * Finds the native function that implements the specified function.
+ *
+ * @return The native function, or `NULL` if no native function matches the
+ *         class name, the function name and the descriptor.
+ * @memberof VirtualMachine
+ */
 zen_NativeFunction_t* zen_VirtualMachine_getNativeFunction(
     zen_VirtualMachine_t* virtualMachine, const uint8_t* className,
     int32_t classNameSize, const uint8_t* functionName,
@@ -183,8 +355,23 @@ void zen_VirtualMachine_raiseFunctionNotFoundException(zen_VirtualMachine_t* vir
 void zen_VirtualMachine_raiseUnknownFieldException(zen_VirtualMachine_t* virtualMachine,
     const uint8_t* fieldDescriptor, int32_t fieldDescriptorSize);
 
+void zen_VirtualMachine_raiseUnknownOperatorException(zen_VirtualMachine_t* virtualMachine,
+    const uint8_t* functionName, int32_t functionNameSize);
+
 void zen_VirtualMachine_raiseNullReferenceException(zen_VirtualMachine_t* virtualMachine);
 
+void zen_VirtualMachine_raiseClassCastException(zen_VirtualMachine_t* virtualMachine);
+
+void zen_VirtualMachine_raiseStackOverflowException(zen_VirtualMachine_t* virtualMachine);
+
+void zen_VirtualMachine_raiseInvalidArrayIndexException(zen_VirtualMachine_t* virtualMachine,
+    int32_t index);
+
+void zen_VirtualMachine_raiseInvalidArraySizeException(zen_VirtualMachine_t* virtualMachine,
+    int32_t size);
+
+void zen_VirtualMachine_raiseInvalidStringSizeException(zen_VirtualMachine_t* virtualMachine);
+
 // Shutdown
 
 void zen_VirtualMachine_shutDown(zen_VirtualMachine_t* virtualMachine);
@@ -200,6 +387,23 @@ zen_Function_t* zen_VirtualMachine_getStaticFunction(zen_VirtualMachine_t* virtu
 // String
 
 zen_Object_t* zen_VirtualMachine_getEmptyString(zen_VirtualMachine_t* virtualMachine);
+
+/**
+ * Allocates a string of the specified size, whose bytes are zero. The caller
+ * should fill the bytes before the string is seen by the program, because the
+ * contents of a string are immutable afterwards.
+ *
+ * @memberof VirtualMachine
+ */
+zen_Object_t* zen_VirtualMachine_allocateString(zen_VirtualMachine_t* virtualMachine,
+    int32_t size);
+
+/**
+ * Creates a string, which holds a copy of the specified UTF-8 bytes. If the
+ * size is negative, the bytes are terminated by a null character.
+ *
+ * @memberof VirtualMachine
+ */
 zen_Object_t* zen_VirtualMachine_newStringFromUtf8(zen_VirtualMachine_t* virtualMachine,
     const uint8_t* string, int32_t size);
 zen_Object_t* zen_VirtualMachine_newString(zen_VirtualMachine_t* virtualMachine,
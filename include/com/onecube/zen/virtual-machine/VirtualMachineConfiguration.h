@@ -39,6 +39,34 @@ struct zen_VirtualMachineConfiguration_t {
     jtk_ArrayList_t* m_entityDirectories;
     jtk_HashMap_t* m_variables;
     jtk_LogLevel_t m_logLevel;
+    /* Determines whether the statistics collected by the interpreter are
+     * printed when the virtual machine shuts down.
+     */
+    bool m_printStatistics;
+    /* The number of bytes that may be allocated on the heap before the
+     * garbage collector is invoked for the first time.
+     */
+    uint64_t m_heapBudget;
+    /* The number of bytes reserved for the new generation, where objects are
+     * allocated until they survive a minor collection.
+     */
+    uint64_t m_nurserySize;
+    /* The number of threads that mark and sweep the old generation. If it is
+     * zero, a thread is created for every processor.
+     */
+    int32_t m_garbageCollectorThreadCount;
+    /* The target maximum pause time, in milliseconds. If it is positive, the
+     * old generation is collected incrementally, in slices that should not
+     * exceed the pause time. If it is zero, the major collections stop the
+     * world.
+     */
+    int32_t m_maximumPauseTime;
+    /* The number of bytes of address space reserved for the heap when the
+     * virtual machine starts. The heap never grows beyond it.
+     */
+    uint64_t m_maximumHeapSize;
+    /* Determines whether the heap is backed by transparent huge pages. */
+    bool m_hugePages;
 };
 
 /**
@@ -46,6 +74,15 @@ struct zen_VirtualMachineConfiguration_t {
  */
 typedef struct zen_VirtualMachineConfiguration_t zen_VirtualMachineConfiguration_t;
 
+/* The default heap budget, that is, 64 megabytes. */
+#define ZEN_VIRTUAL_MACHINE_CONFIGURATION_DEFAULT_HEAP_BUDGET (64 * 1024 * 1024)
+
+/* The default size of the new generation, that is, 4 megabytes. */
+#define ZEN_VIRTUAL_MACHINE_CONFIGURATION_DEFAULT_NURSERY_SIZE (4 * 1024 * 1024)
+
+/* The default maximum size of the heap, that is, 1 gigabyte. */
+#define ZEN_VIRTUAL_MACHINE_CONFIGURATION_DEFAULT_MAXIMUM_HEAP_SIZE (1024 * 1024 * 1024)
+
 /* Constructor */
 
 /**
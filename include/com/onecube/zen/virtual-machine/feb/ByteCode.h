@@ -33,7 +33,8 @@
  *******************************************************************************/
 
 /* NOTE: Please update the "Instruction.c" file if enumerations are added or
- * removed from this file.
+ * removed from this file. The dispatch table of the interpreter, found in
+ * "Interpreter.c", should be updated, too.
  */
 
 /**
@@ -5310,17 +5311,18 @@ enum zen_ByteCode_t {
     /**
      * Store a value in an instance field.
      *
-     * Pops the arguments from the operand stack. The value is stored in the
-     * instance field.
+     * Pops the instance reference from the operand stack. The value is stored
+     * in the instance field and left on the operand stack, because an
+     * assignment evaluates to the assigned value.
      *
      * [Format]
      * store_instance_field index0 index1
      *
      * [Operand Stack]
      * Before
-     *     ..., instance_reference, value
+     *     ..., value, instance_reference
      * After
-     *     ...
+     *     ..., value
      *
      * [Arguments]
      * index0
@@ -5348,8 +5350,9 @@ enum zen_ByteCode_t {
     /**
      * Store a value in a static field.
      *
-     * Pops the argument from the stack. The value is stored in the static
-     * field.
+     * The value on top of the operand stack is stored in the static field. It
+     * is left on the operand stack, because an assignment evaluates to the
+     * assigned value.
      *
      * [Format]
      * store_static_field index0 index1
@@ -5358,7 +5361,7 @@ enum zen_ByteCode_t {
      * Before
      *     ..., value
      * After
-     *     ...
+     *     ..., value
      *
      * [Arguments]
      * index0
@@ -5582,6 +5585,82 @@ enum zen_ByteCode_t {
      * Extend the argument length of an instruction.
      */
     ZEN_BYTE_CODE_WIDE,
+
+    /* Operator */
+
+    /**
+     * Apply a binary operator to two objects.
+     *
+     * The operator is implemented by a static function of the class of the
+     * first operand, which accepts both the operands. For example, `+` is
+     * implemented by the `add` function. The function is resolved when the
+     * instruction is executed for the first time with a given pair of operand
+     * classes. Subsequent executions with the same pair of classes reuse the
+     * resolved function.
+     *
+     * Unlike invoking `ZenKernel.evaluate()`, the operator is encoded in the
+     * instruction. Therefore, no string is loaded or compared to determine
+     * the target function.
+     *
+     * [Format]
+     * invoke_operator operator
+     *
+     * [Arguments]
+     * operator
+     *     An unsigned byte, which is one of the values of the `zen_Operator_t`
+     *     enumeration.
+     *
+     * [Operand Stack]
+     * Before
+     *     ..., operand1, operand2
+     * After
+     *     ..., result
+     *
+     * [Operands]
+     * operand1
+     *     The first operand, whose class implements the operator.
+     * operand2
+     *     The second operand.
+     * result
+     *     The result of the function that implements the operator.
+     *
+     * [Exceptions]
+     * UnknownOperatorException
+     *     If the class of the first operand does not implement the operator.
+     */
+    ZEN_BYTE_CODE_INVOKE_OPERATOR,
+
+    /* Literal */
+
+    /**
+     * Load the literal object that a constant pool entry denotes.
+     *
+     * An integer entry denotes an instance of the `zen.core.Integer` class
+     * and a string entry denotes an instance of the `zen.core.String` class.
+     * The object is materialized when the instruction is executed for the
+     * first time. Subsequent executions push the same object. Unlike
+     * `load_cpr`, which pushes integer entries as primitive values, the
+     * result is always a reference.
+     *
+     * [Format]
+     * load_literal index
+     *
+     * [Operand Stack]
+     * Before
+     *     ...
+     * After
+     *     ..., value
+     *
+     * [Arguments]
+     * index
+     *     An unsigned 16-bit integer which indicates the index of the
+     *     item in the constant pool.
+     *
+     * [Operands]
+     * value
+     *     The literal object denoted by the item.
+     */
+    ZEN_BYTE_CODE_LOAD_LITERAL,
 };
 
 typedef enum zen_ByteCode_t zen_ByteCode_t;
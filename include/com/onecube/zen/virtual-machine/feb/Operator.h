@@ -0,0 +1,83 @@
+/*
+ * Copyright 2018-2020 Samuel Rowe
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Monday, October 19, 2020
+
+#ifndef COM_ONECUBE_ZEN_VIRTUAL_MACHINE_FEB_OPERATOR_H
+#define COM_ONECUBE_ZEN_VIRTUAL_MACHINE_FEB_OPERATOR_H
+
+#include <com/onecube/zen/Configuration.h>
+
+/*******************************************************************************
+ * Operator                                                                    *
+ *******************************************************************************/
+
+/**
+ * The binary operators that are encoded as the immediate operand of the
+ * invoke_operator instruction. The values are part of the binary entity
+ * format. Therefore, new operators should be appended.
+ *
+ * @class Operator
+ * @ingroup zen_vm_feb
+ * @author Samuel Rowe
+ * @since zen 1.0
+ */
+enum zen_Operator_t {
+    ZEN_OPERATOR_ADD = 0,
+    ZEN_OPERATOR_SUBTRACT = 1,
+    ZEN_OPERATOR_MULTIPLY = 2,
+    ZEN_OPERATOR_DIVIDE = 3,
+    ZEN_OPERATOR_REMAINDER = 4,
+    ZEN_OPERATOR_EQUAL = 5,
+    ZEN_OPERATOR_NOT_EQUAL = 6,
+    ZEN_OPERATOR_GREATER = 7,
+    ZEN_OPERATOR_GREATER_OR_EQUAL = 8,
+    ZEN_OPERATOR_LESSER = 9,
+    ZEN_OPERATOR_LESSER_OR_EQUAL = 10
+};
+
+/**
+ * @memberof Operator
+ */
+typedef enum zen_Operator_t zen_Operator_t;
+
+/* The number of operators. */
+#define ZEN_OPERATOR_COUNT 11
+
+/* Symbol */
+
+/**
+ * Maps the specified symbol, as it appears in the source code, to an
+ * operator.
+ *
+ * @return The operator, or -1 if the symbol is not handled by the
+ *         invoke_operator instruction.
+ * @memberof Operator
+ */
+int32_t zen_Operator_fromSymbol(const uint8_t* symbol, int32_t symbolSize);
+
+/* Function Name */
+
+/**
+ * Returns the name of the static function that implements the specified
+ * operator. The function is looked up in the class of the first operand.
+ *
+ * @return The name of the function, or `NULL` if the operator is invalid.
+ * @memberof Operator
+ */
+const uint8_t* zen_Operator_getFunctionName(int32_t operator0, int32_t* size);
+
+#endif /* COM_ONECUBE_ZEN_VIRTUAL_MACHINE_FEB_OPERATOR_H */
@@ -20,24 +20,111 @@
 #define COM_ONECUBE_ZEN_VIRTUAL_MACHINE_MEMORY_MEMORY_MANAGER_H
 
 #include <com/onecube/zen/Configuration.h>
-#include <com/onecube/zen/virtual-machine/memory/allocator/Allocator.h>
-#include <com/onecube/zen/virtual-machine/memory/allocator/AllocationFlag.h>
+#include <com/onecube/zen/virtual-machine/memory/ObjectType.h>
 #include <com/onecube/zen/virtual-machine/memory/allocator/AlignmentConstraint.h>
+#include <com/onecube/zen/virtual-machine/memory/allocator/SegregatedFitsAllocator.h>
 #include <com/onecube/zen/virtual-machine/memory/collector/GarbageCollectionType.h>
 #include <com/onecube/zen/virtual-machine/memory/collector/GarbageCollectionReason.h>
-#include <com/onecube/zen/virtual-machine/memory/collector/GarbageCollectionListener.h>
-#include <com/onecube/zen/virtual-machine/memory/collector/GarbageCollectionFlag.h>
+#include <com/onecube/zen/virtual-machine/memory/collector/GarbageCollector.h>
+#include <com/onecube/zen/virtual-machine/memory/heap/Heap.h>
 #include <com/onecube/zen/virtual-machine/memory/heap/NewGeneration.h>
-#include <com/onecube/zen/virtual-machine/memory/heap/OldGeneration.h>
-#include <com/onecube/zen/virtual-machine/memory/heap/ImmortalGeneration.h>
 
 /*******************************************************************************
  * MemoryManager                                                               *
  *******************************************************************************/
 
+/* The number of handles that the handle stack can hold before it grows. */
+#define ZEN_MEMORY_MANAGER_DEFAULT_HANDLE_CAPACITY 64
+
+/* The pre-write barrier should be invoked before the reference stored in the
+ * specified slot is overwritten. While the old generation is marked
+ * incrementally, the overwritten reference is shaded.
+ */
+#define ZEN_MEMORY_MANAGER_PRE_WRITE_BARRIER(manager, slot) \
+    do { \
+        if ((manager)->m_collector->m_marking) { \
+            zen_GarbageCollector_shade((manager)->m_collector, *((uintptr_t*)(slot))); \
+        } \
+    } \
+    while (false)
+
+/* The write barrier should be invoked after a reference to the specified
+ * value is stored in the specified object.
+ */
+#define ZEN_MEMORY_MANAGER_WRITE_BARRIER(manager, object, value) \
+    do { \
+        if (ZEN_NEW_GENERATION_CONTAINS((manager)->m_newGeneration, value) && \
+            !ZEN_NEW_GENERATION_CONTAINS((manager)->m_newGeneration, object)) { \
+            ZEN_MEMORY_BLOCK_DIRTY_CARD(object); \
+        } \
+    } \
+    while (false)
+
+/* Allocates an object of the specified size from the specified allocation
+ * buffer, which belongs to the current thread. The pointer bump is inlined
+ * into the caller. The slow path, which refills the buffer or allocates in
+ * the old generation, is taken only when the buffer is exhausted. The
+ * allocated memory is cleared.
+ */
+#define ZEN_MEMORY_MANAGER_ALLOCATE_LOCAL(manager, buffer, size, result) \
+    do { \
+        ZEN_NEW_GENERATION_ALLOCATE_LOCAL((manager)->m_newGeneration, buffer, size, result); \
+        if ((result) == NULL) { \
+            (result) = zen_MemoryManager_allocateLocal(manager, buffer, size); \
+        } \
+    } \
+    while (false)
+
+/* Determines whether the program should stop at the next safepoint, that is,
+ * a backward branch or a function invocation, and invoke
+ * zen_MemoryManager_safepoint().
+ */
+#define ZEN_MEMORY_MANAGER_IS_SAFEPOINT_REQUESTED(manager) ((manager)->m_safepointRequested)
+
 /**
- * Each heap generation receives its own system allocator, private allocator
- * and a garbage collector.
+ * The memory manager allocates objects in the new generation and reclaims
+ * them with a generational garbage collector. Objects that survive a minor
+ * collection are promoted to the old generation, which is allocated by a
+ * segregated-fits allocator. Objects too large for the new generation are
+ * allocated directly in the old generation.
+ *
+ * A minor collection is triggered when the new generation is exhausted. A
+ * major collection is triggered when the old generation grows beyond the
+ * current threshold. Initially, the threshold is the heap budget specified in
+ * the configuration of the virtual machine. After every major collection,
+ * the threshold is adjusted to twice the size of the surviving objects, but
+ * never below the budget. Therefore, programs with large live sets are not
+ * collected over and over again.
+ *
+ * Both generations are carved from the regions of a heap, whose address
+ * range is reserved when the memory manager is created. Its size is the
+ * maximum size of the heap. If the old generation cannot grow because the
+ * heap is exhausted, a major collection is performed at once, regardless of
+ * the threshold. After every major collection, the memory of the surplus free
+ * regions is returned to the system.
+ *
+ * If a maximum pause time is specified, a major collection is performed
+ * incrementally instead. When the old generation grows beyond the threshold,
+ * the marking begins and a marking slice is requested whenever the program
+ * takes the slow path of allocation. The program performs the slice at the
+ * next safepoint, within the maximum pause time. If the old generation grows
+ * to twice the threshold before the marking completes, the program allocates
+ * faster than the marking progresses, and the marking is completed at once.
+ *
+ * Every store of a reference into a field of an object should be followed by
+ * the write barrier, which dirties the card of an old object that refers to a
+ * young object. Otherwise, a minor collection would miss the young object.
+ * Likewise, it should be preceded by the pre-write barrier. Otherwise, an
+ * incremental marking would miss the object whose reference was overwritten.
+ *
+ * Every interpreter thread registers an allocation buffer with the memory
+ * manager. Objects are allocated from the buffer without synchronization,
+ * and only refilling the buffer acquires a lock.
+ *
+ * Native code holds references to objects in C variables, which the garbage
+ * collector cannot see. Such objects should be pushed on the handle stack
+ * before native code allocates. The handles are popped in bulk, by restoring
+ * the size of the handle stack remembered before the handles were pushed.
  *
  * @class MemoryManager
  * @ingroup zen_mms
@@ -45,22 +132,20 @@
  * @since zen 1.0
  */
 struct zen_MemoryManager_t {
-    zen_ImmortalGeneration_t* m_immortalGeneration;
-
+    zen_Heap_t* m_heap;
     zen_NewGeneration_t* m_newGeneration;
-
-    zen_OldGeneration_t* m_oldGeneration;
-
-    /*
-    zen_SegregatedFitsAllocator_t* m_segregatedFitsAllocator1;
-    zen_SegregatedFitsAllocator_t* m_segregatedFitsAllocator2;
-    zen_SequentialAllocator_t* m_sequentialAllocator;
-
-
-    zen_MarkSweepGarbageCollector_t* m_markSweepGarbageCollector;
-    zen_MarkCompactGarbageCollector_t* m_markCompactGarbageCollector;
-    zen_CopyingGarbageCollector_t* m_copyingGarbageCollector;
-    */
+    zen_SegregatedFitsAllocator_t* m_allocator;
+    zen_GarbageCollector_t* m_collector;
+    uint64_t m_heapBudget;
+    uint64_t m_threshold;
+    /* The maximum pause time of an incremental collection, in milliseconds.
+     * If it is zero, the major collections stop the world.
+     */
+    int32_t m_maximumPauseTime;
+    bool m_safepointRequested;
+    zen_Object_t** m_handles;
+    int32_t m_handleCount;
+    int32_t m_handleCapacity;
 };
 
 /**
@@ -71,9 +156,28 @@ typedef struct zen_MemoryManager_t zen_MemoryManager_t;
 /* Constructor */
 
 /**
+ * @param heapBudget
+ *        The number of bytes that may be allocated before the first
+ *        major collection is triggered.
+ * @param nurserySize
+ *        The number of bytes reserved for the new generation.
+ * @param collectorThreadCount
+ *        The number of threads that mark and sweep the old generation. If it
+ *        is not positive, a thread is created for every processor.
+ * @param maximumPauseTime
+ *        The maximum pause time of an incremental collection, in
+ *        milliseconds. If it is zero, the major collections stop the world.
+ * @param maximumHeapSize
+ *        The number of bytes reserved for the heap, which holds both the
+ *        generations.
+ * @param hugePages
+ *        Determines whether the heap should be backed by transparent huge
+ *        pages.
  * @memberof MemoryManager
  */
-zen_MemoryManager_t* zen_MemoryManager_new();
+zen_MemoryManager_t* zen_MemoryManager_new(zen_VirtualMachine_t* virtualMachine,
+    uint64_t heapBudget, uint64_t nurserySize, int32_t collectorThreadCount,
+    int32_t maximumPauseTime, uint64_t maximumHeapSize, bool hugePages);
 
 /* Destructor */
 
@@ -85,6 +189,11 @@ void zen_MemoryManager_delete(zen_MemoryManager_t* manager);
 /* Allocate */
 
 /**
+ * Allocates an object of the specified size. The allocated memory is
+ * cleared. A collection may be triggered before the memory is allocated.
+ * Therefore, the callers should ensure that the objects they refer to are
+ * reachable from the roots.
+ *
  * @memberof MemoryManager
  */
 uint8_t* zen_MemoryManager_allocate(zen_MemoryManager_t* manager, uint32_t size);
@@ -95,26 +204,88 @@ uint8_t* zen_MemoryManager_allocate(zen_MemoryManager_t* manager, uint32_t size)
 uint8_t* zen_MemoryManager_allocateEx(zen_MemoryManager_t* manager, uint32_t size,
     zen_AlignmentConstraint_t alignmentConstraint, int32_t flags);
 
+/**
+ * The slow path of `ZEN_MEMORY_MANAGER_ALLOCATE_LOCAL`, which should be
+ * preferred. A collection may be triggered before the memory is allocated.
+ *
+ * @memberof MemoryManager
+ */
+uint8_t* zen_MemoryManager_allocateLocal(zen_MemoryManager_t* manager,
+    zen_AllocationBuffer_t* buffer, uint32_t size);
+
+/* Allocation Buffer */
+
+/**
+ * @memberof MemoryManager
+ */
+void zen_MemoryManager_addAllocationBuffer(zen_MemoryManager_t* manager,
+    zen_AllocationBuffer_t* buffer);
+
+/**
+ * @memberof MemoryManager
+ */
+void zen_MemoryManager_removeAllocationBuffer(zen_MemoryManager_t* manager,
+    zen_AllocationBuffer_t* buffer);
+
 /* Collect */
 
 /**
+ * Performs a collection of the specified type. A minor collection is
+ * escalated to a major collection when the old generation has grown beyond
+ * the threshold.
+ *
  * @memberof MemoryManager
  */
 void zen_MemoryManager_collect(zen_MemoryManager_t* manager,
     zen_GarbageCollectionType_t type, zen_GarbageCollectionReason_t reason);
 
+/* Safepoint */
+
+/**
+ * Performs the work requested at a safepoint, namely, a slice of an
+ * incremental marking. It should be invoked only when
+ * `ZEN_MEMORY_MANAGER_IS_SAFEPOINT_REQUESTED` evaluates to `true`.
+ *
+ * @memberof MemoryManager
+ */
+void zen_MemoryManager_safepoint(zen_MemoryManager_t* manager);
+
+/* Handle */
+
+/**
+ * @return The number of handles on the handle stack, which should be passed
+ *         to zen_MemoryManager_popHandles() once the handles are no longer
+ *         necessary.
+ * @memberof MemoryManager
+ */
+int32_t zen_MemoryManager_getHandleCount(zen_MemoryManager_t* manager);
+
+/**
+ * @memberof MemoryManager
+ */
+void zen_MemoryManager_pushHandle(zen_MemoryManager_t* manager, zen_Object_t* object);
+
+/**
+ * Pops the handles that were pushed after the handle stack had the specified
+ * number of handles.
+ *
+ * @memberof MemoryManager
+ */
+void zen_MemoryManager_popHandles(zen_MemoryManager_t* manager, int32_t handleCount);
+
+/* Object Type */
+
 /**
  * @memberof MemoryManager
  */
-void zen_MemoryManager_collectEx(zen_MemoryManager_t* manager,
-    zen_GarbageCollectionType_t type, zen_GarbageCollectionReason_t reason,
-    zen_GarbageCollectionListener_t* listener, int32_t flags);
+void zen_MemoryManager_setObjectType(zen_MemoryManager_t* manager,
+    zen_Object_t* object, zen_ObjectType_t type);
 
-/* Deallocate */
+/* Statistics */
 
 /**
  * @memberof MemoryManager
  */
-void zen_MemoryManager_deallocate(zen_MemoryManager_t* manager, uint8_t* pointer);
+void zen_MemoryManager_printStatistics(zen_MemoryManager_t* manager);
 
 #endif /* COM_ONECUBE_ZEN_VIRTUAL_MACHINE_MEMORY_MEMORY_MANAGER_H */
\ No newline at end of file
@@ -33,6 +33,12 @@ enum zen_ObjectType_t {
     ZEN_OBJECT_TYPE_PRIMITIVE_ARRAY = 0,
     ZEN_OBJECT_TYPE_REFERENCE_ARRAY = 1,
     ZEN_OBJECT_TYPE_AGGREGATE_OBJECT = 2,
+    ZEN_OBJECT_TYPE_STRING = 3
 };
 
+/**
+ * @memberof ObjectType
+ */
+typedef enum zen_ObjectType_t zen_ObjectType_t;
+
 #endif /* COM_ONECUBE_ZEN_VIRTUAL_MACHINE_MEMORY_OBJECT_TYPE_H */
\ No newline at end of file
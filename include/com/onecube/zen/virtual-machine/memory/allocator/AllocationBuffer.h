@@ -25,13 +25,36 @@
  * AllocationBuffer                                                            *
  *******************************************************************************/
 
+/* The number of bytes carved for an allocation buffer when it is refilled,
+ * that is, 32 kilobytes.
+ */
+#define ZEN_ALLOCATION_BUFFER_SIZE (32 * 1024)
+
+/* Bumps the free pointer of the specified allocation buffer. Evaluates to
+ * the allocated memory, or `NULL` if the buffer cannot hold the specified
+ * number of bytes. The size is evaluated more than once.
+ */
+#define ZEN_ALLOCATION_BUFFER_ALLOCATE(buffer, size) \
+    ((((buffer)->m_limit - (buffer)->m_free) >= (size))? \
+        (((buffer)->m_free += (size)) - (size)) : NULL)
+
 /**
+ * An allocation buffer, also known as a thread local allocation buffer, is a
+ * chunk of memory carved from a region shared by all the threads. It is
+ * owned by a single thread, which allocates objects by bumping its free
+ * pointer without any synchronization. Only carving a new chunk, when the
+ * buffer is exhausted, requires synchronization.
+ *
+ * An empty buffer has both the pointers set to `NULL`.
+ *
  * @class AllocationBuffer
  * @ingroup zen_mms_allocator
  * @author Samuel Rowe
  * @since zen 1.0
  */
 struct zen_AllocationBuffer_t {
+    uint8_t* m_free;
+    uint8_t* m_limit;
 };
 
 /**
@@ -39,17 +62,4 @@ struct zen_AllocationBuffer_t {
  */
 typedef struct zen_AllocationBuffer_t zen_AllocationBuffer_t;
 
-#endif /* COM_ONECUBE_ZEN_VIRTUAL_MACHINE_MEMORY_ALLOCATOR_ALLOCATION_BUFFER_H */
-
-zen_Object_t* zen_AllocationBuffer_allocate(zen_AllocationBuffer_t* buffer,
-    int32_t headerSize, int32_t bodySize) {
-    jtk_Assert_assertObject(buffer, "The specified allocation buffer is null.");
-
-    int8_t* result = NULL;
-    int8_t* newFree = allocator->m_free + (headerSize + bodySize);
-    if (newFree <= buffer->m_limit) {
-        result = allocator->m_free;
-        buffer->m_free = newFree;
-    }
-    return result;
-}
\ No newline at end of file
+#endif /* COM_ONECUBE_ZEN_VIRTUAL_MACHINE_MEMORY_ALLOCATOR_ALLOCATION_BUFFER_H */
\ No newline at end of file
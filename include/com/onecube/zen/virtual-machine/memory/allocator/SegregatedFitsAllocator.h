@@ -1,12 +1,12 @@
 /*
  * Copyright 2018-2020 Samuel Rowe
- * 
+ *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
- * 
+ *
  *     http://www.apache.org/licenses/LICENSE-2.0
- * 
+ *
  * Unless required by applicable law or agreed to in writing, software
  * distributed under the License is distributed on an "AS IS" BASIS,
  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
@@ -19,12 +19,111 @@
 #ifndef COM_ONECUBE_ZEN_VIRTUAL_MACHINE_MEMORY_ALLOCATOR_SEGREGATED_FITS_ALLOCATOR_H
 #define COM_ONECUBE_ZEN_VIRTUAL_MACHINE_MEMORY_ALLOCATOR_SEGREGATED_FITS_ALLOCATOR_H
 
-#include <jtk/memory/VirtualMemory.h>
-
 #include <com/onecube/zen/Configuration.h>
-#include <com/onecube/zen/virtual-machine/memory/allocator/Allocator.h>
-#include <com/onecube/zen/virtual-machine/memory/allocator/SegregatedFitsAllocatorMode.h>
+#include <com/onecube/zen/virtual-machine/memory/ObjectType.h>
 #include <com/onecube/zen/virtual-machine/memory/allocator/SizeClass.h>
+#include <com/onecube/zen/virtual-machine/memory/heap/Heap.h>
+
+/*******************************************************************************
+ * MemoryBlock                                                                 *
+ *******************************************************************************/
+
+/* The size of the memory blocks that are divided into the cells of a size
+ * class. Every memory block is aligned to this size, so that the block which
+ * contains an object can be found by masking the address of the object.
+ */
+#define ZEN_MEMORY_BLOCK_SIZE (64 * 1024)
+
+/* A memory block is divided into cards of 512 bytes. A card is dirtied when
+ * a reference to a young object is stored in an object that begins within
+ * the card.
+ */
+#define ZEN_MEMORY_BLOCK_CARD_SHIFT 9
+#define ZEN_MEMORY_BLOCK_CARD_SIZE (1 << ZEN_MEMORY_BLOCK_CARD_SHIFT)
+#define ZEN_MEMORY_BLOCK_CARD_COUNT (ZEN_MEMORY_BLOCK_SIZE / ZEN_MEMORY_BLOCK_CARD_SIZE)
+
+#define ZEN_MEMORY_BLOCK_CARD_CLEAN 0
+#define ZEN_MEMORY_BLOCK_CARD_DIRTY 1
+
+/* The card table is stored at the beginning of a memory block, before the
+ * cells.
+ */
+#define ZEN_MEMORY_BLOCK_HEADER_SIZE ZEN_MEMORY_BLOCK_CARD_COUNT
+
+#define ZEN_MEMORY_BLOCK_GET_BASE(object) \
+    ((uint8_t*)((uintptr_t)(object) & ~((uintptr_t)ZEN_MEMORY_BLOCK_SIZE - 1)))
+
+#define ZEN_MEMORY_BLOCK_GET_CARD_INDEX(object) \
+    ((int32_t)(((uintptr_t)(object) & ((uintptr_t)ZEN_MEMORY_BLOCK_SIZE - 1)) >> ZEN_MEMORY_BLOCK_CARD_SHIFT))
+
+/* Dirties the card of an object allocated by a segregated-fits allocator.
+ * It is the fast path of the write barrier, therefore, it neither locates
+ * the block descriptor nor validates the object.
+ */
+#define ZEN_MEMORY_BLOCK_DIRTY_CARD(object) \
+    (ZEN_MEMORY_BLOCK_GET_BASE(object)[ZEN_MEMORY_BLOCK_GET_CARD_INDEX(object)] = \
+        ZEN_MEMORY_BLOCK_CARD_DIRTY)
+
+/* The cell is occupied by an object. */
+#define ZEN_MEMORY_BLOCK_CELL_ALLOCATED (1 << 0)
+
+/* The cell was found to be reachable by the garbage collector. */
+#define ZEN_MEMORY_BLOCK_CELL_MARKED (1 << 1)
+
+/* The type of the object that occupies a cell is stored in the flags of the
+ * cell, above the allocated and marked bits.
+ */
+#define ZEN_MEMORY_BLOCK_CELL_TYPE_SHIFT 2
+#define ZEN_MEMORY_BLOCK_CELL_TYPE_MASK (0x3 << ZEN_MEMORY_BLOCK_CELL_TYPE_SHIFT)
+
+#define ZEN_MEMORY_BLOCK_GET_CELL_TYPE(flags) \
+    ((zen_ObjectType_t)(((flags) & ZEN_MEMORY_BLOCK_CELL_TYPE_MASK) >> ZEN_MEMORY_BLOCK_CELL_TYPE_SHIFT))
+
+/**
+ * A memory block is a contiguous region of memory, which is divided into
+ * cells of the same size. Every cell has a byte of flags, which is stored
+ * outside the block. The flags indicate whether the cell is allocated, whether
+ * it was marked by the garbage collector and the type of the object that
+ * occupies it. Free cells are linked together through their first word.
+ *
+ * The memory of a block begins with its card table, which is followed by
+ * the cells. The card of an object is identified by the address of the
+ * object alone, which keeps the write barrier cheap.
+ *
+ * An object that is larger than the largest size class occupies a block of
+ * its own, which has exactly one cell. Since the cell begins within the first
+ * card, such blocks use only the first entry of their card tables.
+ *
+ * @class MemoryBlock
+ * @ingroup zen_virtualMachine_memory_allocator
+ * @author Samuel Rowe
+ * @since zen 1.0
+ */
+struct zen_MemoryBlock_t {
+    /* The beginning of the memory of the block, which is also the card
+     * table.
+     */
+    uint8_t* m_cards;
+    uint8_t* m_cells;
+    int32_t m_cellSize;
+    int32_t m_cellCount;
+    int32_t m_freeCount;
+    uint8_t* m_freeList;
+    uint8_t* m_flags;
+    /* The index of the size class, or -1 for a large object. */
+    int32_t m_sizeClass;
+    /* The next block of the size class with at least one free cell. */
+    zen_MemoryBlock_t* m_nextAvailable;
+    /* The first region of the run that the block occupies. */
+    zen_Region_t* m_region;
+};
+
+/* Cell */
+
+/**
+ * @memberof MemoryBlock
+ */
+int32_t zen_MemoryBlock_getCellIndex(zen_MemoryBlock_t* block, const uint8_t* cell);
 
 /*******************************************************************************
  * SegregatedFitsAllocator                                                     *
@@ -57,31 +156,29 @@
  * Each allocator may have a different balance factor. It is fixed, that is,
  * does not change after creation.
  *
- * A segregated-fits allocator with a balance factor of `k` has `k + 1`
- * free-lists. The last free-list is used to allocate large objects which
- * do not fit in any of the size classes.
- *
  * The size of a free cell, represented as `cellSize`, is limited
  * to `sizeClass[i - 1] < cellSize <= sizeClass[i]`. We assume that
- * `sizeClass[-1] = 0` and `sizeClass[k] = JTK_INTEGER_MAX`. The allocator
- * tries to *round up* a given request size, represented as `requestSize`,
- * to the nearest size class, represented as `sizeClass[i]`, such that
- * `cellSize <= sizeClass[i]`. Although this does not apply to cell sizes
- * larger than `sizeClass[k - 1]`, in which case the last free list is used.
- *
- * The last free list, represented as `freeList[k]`, may use a free-list
- * algorithm such as first-fit, next-fit, and best-fit. As of version 1.0,
- * it uses a first-fit allocator backed by a cartesian tree. Usually, large
- * objects are less frequently allocated. Even if that's not the case,
- * segregated-fits allocator should be more efficient than normal free-list
- * allocators.
+ * `sizeClass[-1] = 0`. The allocator *rounds up* a given request size,
+ * represented as `requestSize`, to the nearest size class, represented as
+ * `sizeClass[i]`, such that `requestSize <= sizeClass[i]`.
+ *
+ * Requests larger than `sizeClass[k - 1]` are not served from the size
+ * classes. Usually, large objects are less frequently allocated. Therefore,
+ * each large object is given a memory block of its own, which is returned to
+ * the system as soon as the object is swept.
  *
  * The size classes are evenly distributed. The user may provide only the
  * balance factor, but not class sizes. An arbitrary class size, represented as
  * `sizeClass[i]`, is calculated with the formula `sizeClass[i] = sizeClass[0] + c * i`,
  * where `c > 0`. We assume, `sizeClass[0] = 8` and `c = 8` and `k = 16`.
  * This gives us size classes as multiples of eight, from `8` to `128`.
- * The first-fit allocator is used for request sizes greater than `128`.
+ *
+ * The memory blocks are carved from runs of regions of the heap, and every
+ * region of a run refers to the block that occupies it. The garbage collector
+ * finds out whether an arbitrary word refers to an object allocated by the
+ * allocator by looking up the region that contains the word. All the memory
+ * blocks are also kept in an array sorted by their addresses, which are swept
+ * in order.
  *
  * Please refer "The Garbage Collection Handbook" by Richard Jones, Antony
  * Hosking and Eliot Moss for more information. The algorithm described above
@@ -122,13 +219,19 @@ struct zen_SegregatedFitsAllocator_t {
      */
     int8_t m_balanceFactor;
 
-    int32_t* m_sizeClasses;
+    zen_SizeClass_t* m_sizeClasses;
 
-    void** m_freeListAllocators;
+    zen_Heap_t* m_heap;
 
-    zen_Allocator_t* m_allocator;
+    /* The memory blocks, sorted by the addresses of their cells. */
+    zen_MemoryBlock_t** m_blocks;
+    int32_t m_blockCount;
+    int32_t m_blockCapacity;
 
-    zen_SegregatedFitsAllocatorMode_t m_mode;
+    /* The number of bytes occupied by allocated cells. */
+    uint64_t m_usedSize;
+    /* The number of bytes reserved by the memory blocks. */
+    uint64_t m_reservedSize;
 };
 
 /**
@@ -136,4 +239,111 @@ struct zen_SegregatedFitsAllocator_t {
  */
 typedef struct zen_SegregatedFitsAllocator_t zen_SegregatedFitsAllocator_t;
 
+/**
+ * Invoked for every object that is swept. The finalizer should release the
+ * resources owned by the object, but it should not allocate.
+ *
+ * @memberof SegregatedFitsAllocator
+ */
+typedef void (*zen_SegregatedFitsAllocator_FinalizeFunction_t)(void* context,
+    uint8_t* object, zen_ObjectType_t type);
+
+/* Constructor */
+
+/**
+ * @param heap
+ *        The heap whose regions hold the memory blocks.
+ * @memberof SegregatedFitsAllocator
+ */
+zen_SegregatedFitsAllocator_t* zen_SegregatedFitsAllocator_new(zen_Heap_t* heap,
+    int32_t balanceFactor);
+
+/* Destructor */
+
+/**
+ * @memberof SegregatedFitsAllocator
+ */
+void zen_SegregatedFitsAllocator_delete(zen_SegregatedFitsAllocator_t* allocator);
+
+/* Allocate */
+
+/**
+ * Allocates a cell of at least the specified size. The cell is cleared,
+ * that is, all its bits are initialized to 0.
+ *
+ * @return The allocated cell, or `NULL` if the heap is exhausted.
+ * @memberof SegregatedFitsAllocator
+ */
+uint8_t* zen_SegregatedFitsAllocator_allocate(zen_SegregatedFitsAllocator_t* allocator,
+    int32_t size, zen_ObjectType_t type);
+
+/* Cell */
+
+/**
+ * Finds the memory block that contains the allocated cell that begins at
+ * the specified address.
+ *
+ * @param index
+ *        The index of the cell in the block is stored here, if the cell
+ *        is found.
+ * @return The memory block, or `NULL` if the specified address is not the
+ *         beginning of an allocated cell.
+ * @memberof SegregatedFitsAllocator
+ */
+zen_MemoryBlock_t* zen_SegregatedFitsAllocator_findCell(zen_SegregatedFitsAllocator_t* allocator,
+    const void* address, int32_t* index);
+
+/**
+ * @memberof SegregatedFitsAllocator
+ */
+void zen_SegregatedFitsAllocator_setType(zen_SegregatedFitsAllocator_t* allocator,
+    const void* object, zen_ObjectType_t type);
+
+/* Size Class */
+
+/**
+ * @return The index of the size class that the specified size is rounded up
+ *         to, or the balance factor if the size is larger than all the size
+ *         classes.
+ * @memberof SegregatedFitsAllocator
+ */
+int32_t zen_SegregatedFitsAllocator_findSizeClass(zen_SegregatedFitsAllocator_t* allocator,
+    int32_t size);
+
+/* Sweep */
+
+/**
+ * Deallocates the cells which are allocated but not marked, and clears the
+ * marks of the remaining cells. Memory blocks without allocated cells are
+ * returned to the system.
+ *
+ * @return The number of bytes that were deallocated.
+ * @memberof SegregatedFitsAllocator
+ */
+uint64_t zen_SegregatedFitsAllocator_sweep(zen_SegregatedFitsAllocator_t* allocator,
+    zen_SegregatedFitsAllocator_FinalizeFunction_t finalize, void* context);
+
+/**
+ * Sweeps the cells of the memory block at the specified index, rebuilding
+ * its free list. Distinct blocks may be swept by distinct threads at the
+ * same time, provided the finalizer is thread safe. The sweep should be
+ * completed with zen_SegregatedFitsAllocator_finishSweep().
+ *
+ * @return The number of bytes that were deallocated.
+ * @memberof SegregatedFitsAllocator
+ */
+uint64_t zen_SegregatedFitsAllocator_sweepBlock(zen_SegregatedFitsAllocator_t* allocator,
+    int32_t index, zen_SegregatedFitsAllocator_FinalizeFunction_t finalize, void* context);
+
+/**
+ * Returns the empty memory blocks to the system and rebuilds the lists of
+ * available blocks, once every block has been swept.
+ *
+ * @param freedSize
+ *        The total number of bytes deallocated by the swept blocks.
+ * @memberof SegregatedFitsAllocator
+ */
+void zen_SegregatedFitsAllocator_finishSweep(zen_SegregatedFitsAllocator_t* allocator,
+    uint64_t freedSize);
+
 #endif /* COM_ONECUBE_ZEN_VIRTUAL_MACHINE_MEMORY_ALLOCATOR_SEGREGATED_FITS_ALLOCATOR_H */
\ No newline at end of file
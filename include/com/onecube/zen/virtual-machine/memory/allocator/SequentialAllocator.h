@@ -20,10 +20,7 @@
 #define COM_ONECUBE_ZEN_VIRTUAL_MACHINE_MEMORY_ALLOCATOR_SEQUENTIAL_ALLOCATOR_H
 
 #include <com/onecube/zen/Configuration.h>
-
-#include <jtk/collection/list/SinglyLinkedList.h>
-#include <jtk/concurrent/lock/Mutex.h>
-#include <jtk/system/Allocator.h>
+#include <com/onecube/zen/virtual-machine/memory/allocator/AllocationBuffer.h>
 
 /*******************************************************************************
  * SequentialAllocator                                                         *
@@ -50,6 +47,11 @@
  * The disadvantages of this allocator is as follows:
  * - It is less suitable than free-list allocation for non-moving collectors.
  * - It causes fragmentation unless compaction is done.
+ *
+ * The allocator is not synchronized. When multiple threads allocate from the
+ * same memory chunk, each thread should carve an allocation buffer from the
+ * allocator, while holding a lock owned by the user of the allocator. The
+ * objects are then allocated from the buffer without any synchronization.
  * 
  * Please refer "The Garbage Collection Handbook" by Richard Jones, Antony
  * Hosking and Eliot Moss for more information. The algorithm described above
@@ -91,9 +93,6 @@ struct zen_SequentialAllocator_t {
      * this allocator.
      */
     uint8_t* m_free;
-    
-    jtk_SinglyLinkedList_t* m_allocationBuffers;
-    jtk_Mutex_t* m_allocationBuffersMutex;
 };
 
 /**
@@ -106,34 +105,62 @@ typedef struct zen_SequentialAllocator_t zen_SequentialAllocator_t;
 /**
  * @memberof SequentialAllocator
  */
-zen_SequentialAllocator_t* zen_SequentialAllocator_new(jtk_Allocator_t* allocator, uint8_t* start,
-    uint8_t* end);
+zen_SequentialAllocator_t* zen_SequentialAllocator_new(uint8_t* start, uint8_t* limit);
 
 /* Destructor */
 
 /**
  * @memberof SequentialAllocator
  */
-void zen_SequentialAllocator_delete(jtk_Allocator_t* allocator,
-    zen_SequentialAllocator_t* sequentialAllocator);
+void zen_SequentialAllocator_delete(zen_SequentialAllocator_t* allocator);
 
 /* Allocator */
 
 /**
+ * Allocates the specified number of bytes by bumping the free pointer. The
+ * memory is not cleared.
+ *
+ * @return The allocated memory, or `NULL` if the memory chunk is exhausted.
+ * @memberof SequentialAllocator
+ */
+uint8_t* zen_SequentialAllocator_allocate(zen_SequentialAllocator_t* allocator, int32_t size);
+
+/* Reset */
+
+/**
+ * Assigns a new memory chunk to the allocator. The free pointer is moved to
+ * the start of the chunk.
+ *
  * @memberof SequentialAllocator
  */
-int8_t* zen_SequentialAllocator_allocate(zen_SequentialAllocator_t* allocator, int32_t headerSize, int32_t bodySize);
+void zen_SequentialAllocator_reset(zen_SequentialAllocator_t* allocator, uint8_t* start,
+    uint8_t* limit);
 
 /* Allocation Buffer */
 
 /**
+ * Carves a chunk of `ZEN_ALLOCATION_BUFFER_SIZE` bytes, or whatever remains
+ * of the memory chunk of the allocator, for the specified allocation buffer.
+ * The memory that remains in the buffer is abandoned. The memory is not
+ * cleared.
+ *
+ * @param minimumSize
+ *        The number of bytes the buffer should hold at least.
+ * @return `true` if the buffer was refilled; `false` if the memory chunk of
+ *         the allocator is exhausted.
  * @memberof SequentialAllocator
  */
-zen_AllocationBuffer_t* zen_SequentialAllocator_makeAllocationBuffer(zen_SequentialAllocator_t* allocator);
+bool zen_SequentialAllocator_makeAllocationBuffer(zen_SequentialAllocator_t* allocator,
+    zen_AllocationBuffer_t* buffer, int32_t minimumSize);
 
 /**
+ * Empties the specified allocation buffer. The memory that remains in the
+ * buffer is returned to the allocator if the buffer was the last chunk
+ * carved.
+ *
  * @memberof SequentialAllocator
  */
-void zen_SequentialAllocator_mergeAllocationBuffer(zen_SequentialAllocator_t* allocator, zen_AllocationBuffer_t* buffer);
+void zen_SequentialAllocator_mergeAllocationBuffer(zen_SequentialAllocator_t* allocator,
+    zen_AllocationBuffer_t* buffer);
 
 #endif /* COM_ONECUBE_ZEN_VIRTUAL_MACHINE_MEMORY_ALLOCATOR_SEQUENTIAL_ALLOCATOR_H */
\ No newline at end of file
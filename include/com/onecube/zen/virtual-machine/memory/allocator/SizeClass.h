@@ -19,10 +19,34 @@
 #ifndef COM_ONECUBE_ZEN_VIRTUAL_MACHINE_MEMORY_ALLOCATOR_SIZE_CLASS_H
 #define COM_ONECUBE_ZEN_VIRTUAL_MACHINE_MEMORY_ALLOCATOR_SIZE_CLASS_H
 
+#include <com/onecube/zen/Configuration.h>
+
+// Forward References
+
+typedef struct zen_MemoryBlock_t zen_MemoryBlock_t;
+
 /*******************************************************************************
  * SizeClass                                                                   *
  *******************************************************************************/
 
+/**
+ * A size class owns the memory blocks whose cells are of the same size.
+ * The blocks which have at least one free cell are linked together, so that
+ * an allocation request never inspects a full block.
+ *
+ * @class SizeClass
+ * @ingroup zen_virtualMachine_memory_allocator
+ * @author Samuel Rowe
+ * @since zen 1.0
+ */
+struct zen_SizeClass_t {
+    int32_t m_cellSize;
+    zen_MemoryBlock_t* m_availableBlocks;
+};
 
+/**
+ * @memberof SizeClass
+ */
+typedef struct zen_SizeClass_t zen_SizeClass_t;
 
 #endif /* COM_ONECUBE_ZEN_VIRTUAL_MACHINE_MEMORY_ALLOCATOR_SIZE_CLASS_H */
\ No newline at end of file
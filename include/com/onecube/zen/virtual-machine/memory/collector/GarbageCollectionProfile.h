@@ -27,7 +27,17 @@
  * GarbageCollectionProfile                                                    *
  *******************************************************************************/
 
+/* The number of recent pauses remembered by a profile. */
+#define ZEN_GARBAGE_COLLECTION_PROFILE_PAUSE_HISTORY_SIZE 64
+
 /**
+ * A profile describes the garbage collections performed so far. Besides the
+ * most recent collection, it records the pauses, that is, the intervals
+ * during which the program was stopped for the garbage collector. A stop-the-
+ * world collection is a single pause, whereas an incremental collection is
+ * spread across many short pauses. The durations are measured in
+ * microseconds.
+ *
  * @class GarbageCollectionProfile
  * @ingroup zen_vm_memory_collector
  * @author Samuel Rowe
@@ -38,8 +48,14 @@ struct zen_GarbageCollectionProfile_t {
     zen_GarbageCollectionType_t m_type;
     uint64_t m_memoryFreePreviously;
     uint64_t m_memoryUsedPreviously;
+    uint64_t m_memoryFreeCurrently;
+    uint64_t m_memoryUsedCurrently;
     uint64_t m_duration;
-    
+    /* The most recent pauses, which are stored in a circular buffer. */
+    uint64_t m_pauses[ZEN_GARBAGE_COLLECTION_PROFILE_PAUSE_HISTORY_SIZE];
+    int32_t m_pauseCount;
+    uint64_t m_totalPauseTime;
+    uint64_t m_maximumPauseTime;
 };
 
 /**
@@ -47,16 +63,39 @@ struct zen_GarbageCollectionProfile_t {
  */
 typedef struct zen_GarbageCollectionProfile_t zen_GarbageCollectionProfile_t;
 
+/* Constructor */
+
+/**
+ * @memberof GarbageCollectionProfile
+ */
 zen_GarbageCollectionProfile_t* zen_GarbageCollectionProfile_new(
-    zen_GarbageCollectionReason_t m_reason, zen_GarbageCollectionType_t type,
+    zen_GarbageCollectionReason_t reason, zen_GarbageCollectionType_t type,
     uint64_t memoryFreePreviously, uint64_t memoryUsedPreviously);
 
 /**
  * @memberof GarbageCollectionProfile
  */
 zen_GarbageCollectionProfile_t* zen_GarbageCollectionProfile_newEx(
-    zen_GarbageCollectionReason_t m_reason, zen_GarbageCollectionType_t type,
+    zen_GarbageCollectionReason_t reason, zen_GarbageCollectionType_t type,
     uint64_t memoryFreePreviously, uint64_t memoryUsedPreviously,
     uint64_t memoryFreeCurrently, uint64_t memoryUsedCurrently, uint64_t duration);
 
+/* Destructor */
+
+/**
+ * @memberof GarbageCollectionProfile
+ */
+void zen_GarbageCollectionProfile_delete(zen_GarbageCollectionProfile_t* profile);
+
+/* Pause */
+
+/**
+ * Records a pause of the specified duration, in microseconds, caused by a
+ * collection of the specified type.
+ *
+ * @memberof GarbageCollectionProfile
+ */
+void zen_GarbageCollectionProfile_recordPause(zen_GarbageCollectionProfile_t* profile,
+    zen_GarbageCollectionType_t type, uint64_t duration);
+
 #endif /* COM_ONECUBE_ZEN_VIRTUAL_MACHINE_MEMORY_COLLECTOR_GARBAGE_COLLECTION_PROFILE_H */
\ No newline at end of file
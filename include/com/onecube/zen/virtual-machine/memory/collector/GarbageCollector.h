@@ -19,16 +19,114 @@
 #ifndef COM_ONECUBE_ZEN_VIRTUAL_MACHINE_MEMORY_COLLECTOR_COLLECTOR_H
 #define COM_ONECUBE_ZEN_VIRTUAL_MACHINE_MEMORY_COLLECTOR_COLLECTOR_H
 
+#include <pthread.h>
+
 #include <com/onecube/zen/Configuration.h>
+#include <com/onecube/zen/virtual-machine/memory/allocator/SegregatedFitsAllocator.h>
+#include <com/onecube/zen/virtual-machine/memory/collector/GarbageCollectionProfile.h>
+#include <com/onecube/zen/virtual-machine/memory/collector/GarbageCollectionType.h>
+#include <com/onecube/zen/virtual-machine/memory/collector/WorkStealingDeque.h>
 #include <com/onecube/zen/virtual-machine/memory/heap/NewGeneration.h>
-#include <com/onecube/zen/virtual-machine/memory/heap/OldGeneration.h>
-#include <com/onecube/zen/virtual-machine/memory/heap/ImmortalGeneration.h>
+
+// Forward References
+
+typedef struct zen_VirtualMachine_t zen_VirtualMachine_t;
+typedef struct zen_Class_t zen_Class_t;
+typedef struct zen_Object_t zen_Object_t;
+typedef struct zen_GarbageCollector_t zen_GarbageCollector_t;
+typedef struct zen_ClassTable_t zen_ClassTable_t;
+
+/*******************************************************************************
+ * GarbageCollectorWorker                                                      *
+ *******************************************************************************/
+
+/**
+ * A worker marks and sweeps a share of the old generation during a major
+ * collection. The first worker is the thread that requested the collection,
+ * whereas the other workers are threads that wait for the next collection.
+ *
+ * @class GarbageCollectorWorker
+ * @ingroup zen_vm_memory_collector
+ * @author Samuel Rowe
+ * @since zen 1.0
+ */
+struct zen_GarbageCollectorWorker_t {
+    zen_GarbageCollector_t* m_collector;
+    int32_t m_index;
+    pthread_t m_thread;
+    /* The grey objects discovered by the worker, which the other workers
+     * may steal.
+     */
+    zen_WorkStealingDeque_t* m_deque;
+    /* The state of the generator that picks the victims of stealing. */
+    uint32_t m_random;
+    uint64_t m_freedSize;
+};
+
+/**
+ * @memberof GarbageCollectorWorker
+ */
+typedef struct zen_GarbageCollectorWorker_t zen_GarbageCollectorWorker_t;
 
 /*******************************************************************************
  * GarbageCollector                                                            *
  *******************************************************************************/
 
+/* The number of workers is limited to this value, regardless of the number
+ * of processors.
+ */
+#define ZEN_GARBAGE_COLLECTOR_MAXIMUM_WORKER_COUNT 64
+
 /**
+ * The garbage collector is a stop-the-world generational collector. The new
+ * generation is collected by copying the surviving objects into the old
+ * generation, which is known as a minor collection. The old generation is
+ * allocated by a segregated-fits allocator and collected by marking and
+ * sweeping, which is known as a major collection. A major collection always
+ * begins with a minor collection.
+ *
+ * The roots are the slots of the local variable arrays and operand stacks on
+ * the invocation stack, the literal objects resolved by the loaded classes,
+ * the static fields of the loaded classes, the shared instances owned by the
+ * virtual machine, the exception being thrown and the handles created by
+ * native code. The slots of a stack frame
+ * do not record whether they hold a reference. Therefore, every slot is
+ * considered as a candidate and is accepted only if the heap confirms that it
+ * is the beginning of an object. The handles are treated likewise, because
+ * native code may push raw values along with references. Such ambiguous roots
+ * cannot be updated, therefore, the young objects they refer to are pinned
+ * instead of being copied. Objects on the heap are traced precisely, using
+ * the offsets of the reference fields recorded by their classes. The elements
+ * of a reference array are stored inline, after its length, and traced
+ * likewise. Strings and primitive arrays hold no references.
+ *
+ * The old objects which refer to young objects are found through the card
+ * tables of the memory blocks, which are dirtied by the write barrier. Thus, a
+ * minor collection visits the roots, the dirty cards and the surviving
+ * objects, but never the dead objects.
+ *
+ * The grey objects are pushed on an explicit stack, instead of being traced
+ * recursively, so that long chains of objects do not overflow the native
+ * stack.
+ *
+ * A major collection marks and sweeps the old generation with a pool of
+ * workers. Every worker pushes the grey objects it discovers on its own
+ * work-stealing deque, and steals from the other workers when its deque is
+ * empty. The mark bits are set with an atomic operation, so that an object
+ * is traced by exactly one worker. The memory blocks are swept in chunks,
+ * which the workers claim one after another.
+ *
+ * Alternatively, the old generation may be marked incrementally, in slices
+ * that are interleaved with the execution of the program. The roots are
+ * marked when the marking begins, and the slices trace the grey objects
+ * until a time budget expires. The program may overwrite a reference to an
+ * unmarked object in the meantime, therefore, the write barrier shades the
+ * overwritten reference. Such a snapshot-at-the-beginning barrier guarantees
+ * that every object reachable when the marking began is marked. The objects
+ * promoted or allocated in the old generation during the marking are marked
+ * as they are allocated. When no grey objects remain, the old generation is
+ * swept within the last slice.
+ *
  * @class GarbageCollector
  * @ingroup zen_vm_memory_collector
  * @author Samuel Rowe
@@ -37,25 +135,122 @@
 struct zen_GarbageCollector_t {
     int64_t m_lastCollectionTime;
     int64_t m_totalCollectionTime;
+    zen_VirtualMachine_t* m_virtualMachine;
+    zen_SegregatedFitsAllocator_t* m_allocator;
+    zen_NewGeneration_t* m_newGeneration;
+    uint8_t** m_markStack;
+    int32_t m_markStackSize;
+    int32_t m_markStackCapacity;
+    /* The young objects pinned by the last minor collection. */
+    uint8_t** m_pinnedObjects;
+    int32_t m_pinnedObjectCount;
+    int32_t m_pinnedObjectCapacity;
+    int32_t m_collectionCount;
+    uint64_t m_freedSize;
+    int64_t m_totalMinorCollectionTime;
+    int32_t m_minorCollectionCount;
+    uint64_t m_promotedSize;
+    zen_GarbageCollectorWorker_t* m_workers;
+    int32_t m_workerCount;
+    /* The mutex guards the phase, the epoch and the number of pending
+     * workers. The workers wait for the epoch to change, which announces a
+     * new phase.
+     */
+    pthread_mutex_t m_mutex;
+    pthread_cond_t m_phaseCondition;
+    pthread_cond_t m_completionCondition;
+    int32_t m_phase;
+    int32_t m_epoch;
+    int32_t m_pendingWorkerCount;
+    /* The number of workers that found no work to steal. */
+    int32_t m_idleWorkerCount;
+    /* The index of the next memory block to sweep. */
+    int32_t m_sweepCursor;
+    /* Determines whether an incremental marking is in progress. */
+    bool m_marking;
+    zen_GarbageCollectionProfile_t* m_profile;
+    /* The object headers store the indexes of their classes in this table. */
+    zen_ClassTable_t* m_classTable;
 };
 
+/* Constructor */
+
 /**
+ * @param classTable
+ *        The class table of the virtual machine, through which the classes of
+ *        the objects are found.
+ * @param workerCount
+ *        The number of threads that mark and sweep the old generation,
+ *        including the thread that requests a collection. If it is not
+ *        positive, a worker is created for every processor.
  * @memberof GarbageCollector
  */
-typedef struct zen_GarbageCollector_t zen_GarbageCollector_t;
+zen_GarbageCollector_t* zen_GarbageCollector_new(zen_VirtualMachine_t* virtualMachine,
+    zen_ClassTable_t* classTable, zen_SegregatedFitsAllocator_t* allocator,
+    zen_NewGeneration_t* newGeneration, int32_t workerCount);
 
-/* Constructor */
+/* Destructor */
 
 /**
  * @memberof GarbageCollector
  */
-zen_GarbageCollector_t* zen_GarbageCollector_new();
+void zen_GarbageCollector_delete(zen_GarbageCollector_t* collector);
 
-/* Destructor */
+/* Collect */
+
+/**
+ * Performs a minor or a major collection.
+ *
+ * @param handles
+ *        The objects referred by native code, which are treated as roots.
+ * @return The number of bytes that were reclaimed from the old generation.
+ *         A minor collection reclaims the new generation as a whole, without
+ *         counting the bytes.
+ * @memberof GarbageCollector
+ */
+uint64_t zen_GarbageCollector_collect(zen_GarbageCollector_t* collector,
+    zen_GarbageCollectionType_t type, zen_Object_t** handles, int32_t handleCount);
+
+/* Incremental Collection */
+
+/**
+ * Begins an incremental major collection. The new generation is collected
+ * and the roots are marked.
+ *
+ * @param handles
+ *        The objects referred by native code, which are treated as roots.
+ * @memberof GarbageCollector
+ */
+void zen_GarbageCollector_startMarking(zen_GarbageCollector_t* collector,
+    zen_Object_t** handles, int32_t handleCount);
+
+/**
+ * Traces the grey objects until the specified budget, in microseconds,
+ * expires. If no grey objects remain, the old generation is swept and the
+ * incremental collection ends.
+ *
+ * @return `true` if the incremental collection ended; otherwise, `false`.
+ * @memberof GarbageCollector
+ */
+bool zen_GarbageCollector_markIncrementally(zen_GarbageCollector_t* collector,
+    int64_t budget);
+
+/**
+ * Marks the object referred by the specified value, unless it is already
+ * marked. It is the slow path of the write barrier, which is taken only
+ * while an incremental marking is in progress.
+ *
+ * @memberof GarbageCollector
+ */
+void zen_GarbageCollector_shade(zen_GarbageCollector_t* collector, uintptr_t value);
 
 /**
+ * Marks an object allocated in the old generation while an incremental
+ * marking is in progress. Such an object is not traced.
+ *
  * @memberof GarbageCollector
  */
-void zen_GarbageCollector_delete(zen_GarbageCollector_t* planet);
+void zen_GarbageCollector_markAllocated(zen_GarbageCollector_t* collector,
+    const void* object);
 
 #endif /* COM_ONECUBE_ZEN_VIRTUAL_MACHINE_MEMORY_COLLECTOR_COLLECTOR_H */
\ No newline at end of file
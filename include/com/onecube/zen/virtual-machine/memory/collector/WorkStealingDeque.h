@@ -0,0 +1,149 @@
+/*
+ * Copyright 2018-2020 Samuel Rowe
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Saturday, November 07, 2020
+
+#ifndef COM_ONECUBE_ZEN_VIRTUAL_MACHINE_MEMORY_COLLECTOR_WORK_STEALING_DEQUE_H
+#define COM_ONECUBE_ZEN_VIRTUAL_MACHINE_MEMORY_COLLECTOR_WORK_STEALING_DEQUE_H
+
+#include <com/onecube/zen/Configuration.h>
+
+/*******************************************************************************
+ * WorkStealingDequeArray                                                      *
+ *******************************************************************************/
+
+/* The number of entries that a deque can hold before it grows. It should be
+ * a power of two.
+ */
+#define ZEN_WORK_STEALING_DEQUE_DEFAULT_CAPACITY 1024
+
+/**
+ * The circular array that holds the entries of a deque. When a deque grows,
+ * the old array is retired, rather than deallocated, because a thief may
+ * still be reading from it.
+ *
+ * @class WorkStealingDequeArray
+ * @ingroup zen_vm_memory_collector
+ * @author Samuel Rowe
+ * @since zen 1.0
+ */
+struct zen_WorkStealingDequeArray_t {
+    uint8_t** m_values;
+    int64_t m_capacity;
+    struct zen_WorkStealingDequeArray_t* m_previous;
+};
+
+/**
+ * @memberof WorkStealingDequeArray
+ */
+typedef struct zen_WorkStealingDequeArray_t zen_WorkStealingDequeArray_t;
+
+/*******************************************************************************
+ * WorkStealingDeque                                                           *
+ *******************************************************************************/
+
+/**
+ * A work-stealing deque is owned by a single thread, which pushes and takes
+ * entries at the bottom end, like a stack. The other threads steal entries
+ * from the top end, when they run out of work. The owner synchronizes with
+ * the thieves only when the deque holds a single entry.
+ *
+ * Please refer "Dynamic Circular Work-Stealing Deque" by David Chase and
+ * Yossi Lev, and "Correct and Efficient Work-Stealing for Weak Memory
+ * Models" by Nhat Minh Lê, Antoniu Pop, Albert Cohen and Francesco Zappa
+ * Nardelli for more information.
+ *
+ * @class WorkStealingDeque
+ * @ingroup zen_vm_memory_collector
+ * @author Samuel Rowe
+ * @since zen 1.0
+ */
+struct zen_WorkStealingDeque_t {
+    int64_t m_top;
+    int64_t m_bottom;
+    zen_WorkStealingDequeArray_t* m_array;
+};
+
+/**
+ * @memberof WorkStealingDeque
+ */
+typedef struct zen_WorkStealingDeque_t zen_WorkStealingDeque_t;
+
+/* Constructor */
+
+/**
+ * @memberof WorkStealingDeque
+ */
+zen_WorkStealingDeque_t* zen_WorkStealingDeque_new();
+
+/* Destructor */
+
+/**
+ * @memberof WorkStealingDeque
+ */
+void zen_WorkStealingDeque_delete(zen_WorkStealingDeque_t* deque);
+
+/* Empty */
+
+/**
+ * @memberof WorkStealingDeque
+ */
+bool zen_WorkStealingDeque_isEmpty(zen_WorkStealingDeque_t* deque);
+
+/* Push */
+
+/**
+ * Pushes the specified entry at the bottom of the deque. Only the owner of
+ * the deque may invoke this function.
+ *
+ * @memberof WorkStealingDeque
+ */
+void zen_WorkStealingDeque_push(zen_WorkStealingDeque_t* deque, uint8_t* value);
+
+/* Take */
+
+/**
+ * Removes the entry at the bottom of the deque. Only the owner of the deque
+ * may invoke this function.
+ *
+ * @return The entry, or `NULL` if the deque is empty.
+ * @memberof WorkStealingDeque
+ */
+uint8_t* zen_WorkStealingDeque_take(zen_WorkStealingDeque_t* deque);
+
+/* Steal */
+
+/**
+ * Removes the entry at the top of the deque. Any thread may invoke this
+ * function.
+ *
+ * @return The entry, or `NULL` if the deque is empty or another thread
+ *         removed the entry first.
+ * @memberof WorkStealingDeque
+ */
+uint8_t* zen_WorkStealingDeque_steal(zen_WorkStealingDeque_t* deque);
+
+/* Reset */
+
+/**
+ * Deallocates the retired arrays. It should be invoked only when no thread
+ * is stealing from the deque.
+ *
+ * @memberof WorkStealingDeque
+ */
+void zen_WorkStealingDeque_reset(zen_WorkStealingDeque_t* deque);
+
+#endif /* COM_ONECUBE_ZEN_VIRTUAL_MACHINE_MEMORY_COLLECTOR_WORK_STEALING_DEQUE_H */
@@ -19,17 +19,59 @@
 #ifndef COM_ONECUBE_ZEN_VIRTUAL_MACHINE_MEMORY_HEAP_HEAP_H
 #define COM_ONECUBE_ZEN_VIRTUAL_MACHINE_MEMORY_HEAP_HEAP_H
 
+#include <com/onecube/zen/Configuration.h>
+#include <com/onecube/zen/virtual-machine/memory/heap/Region.h>
+
 /*******************************************************************************
  * Heap                                                                        *
  *******************************************************************************/
 
+/* Determines whether the specified address lies within the address range
+ * reserved by the heap. It is cheap enough for the barriers.
+ */
+#define ZEN_HEAP_CONTAINS(heap, address) \
+    (((uintptr_t)(address) - (uintptr_t)(heap)->m_start) < (heap)->m_size)
+
+/* Evaluates to the descriptor of the region that contains the specified
+ * address, which should lie within the heap.
+ */
+#define ZEN_HEAP_GET_REGION(heap, address) \
+    (&(heap)->m_regions[((uintptr_t)(address) - (uintptr_t)(heap)->m_start) >> ZEN_REGION_SHIFT])
+
 /**
+ * The heap reserves a single contiguous address range when the virtual
+ * machine starts, which is divided into regions of a fixed size. The new
+ * generation and the memory blocks of the old generation are carved from
+ * runs of regions. Therefore, whether an arbitrary word refers into the heap
+ * is determined by comparing it against the bounds of the range, and the
+ * region it refers to is found by indexing the table of regions.
+ *
+ * The address range is reserved without any access, which costs no memory.
+ * A region is committed, that is, made accessible, when it is handed out
+ * for the first time. A region that is released remains committed, so that
+ * it can be handed out again cheaply. After a major collection, the memory
+ * of the surplus free regions is returned to the system, which reclaims the
+ * memory that was needed only during a spike of allocation.
+ *
+ * The regions are handed out beginning with the lowest address, which keeps
+ * the committed part of the heap compact. Optionally, the heap may be backed
+ * by transparent huge pages, which reduces the misses in the translation
+ * lookaside buffer for large heaps.
+ *
  * @class Heap
  * @ingroup zen_heap
  * @author Samuel Rowe
  * @since zen 1.0
  */
 struct zen_Heap_t {
+    uint8_t* m_start;
+    uintptr_t m_size;
+    zen_Region_t* m_regions;
+    int32_t m_regionCount;
+    int32_t m_usedRegionCount;
+    int32_t m_committedRegionCount;
+    /* No free region exists below this index. */
+    int32_t m_freeRegionHint;
 };
 
 /**
@@ -40,9 +82,18 @@ typedef struct zen_Heap_t zen_Heap_t;
 /* Constructor */
 
 /**
+ * Reserves the address range of the heap.
+ *
+ * @param size
+ *        The number of bytes to reserve, which is the maximum size of the
+ *        heap. It is rounded up to a multiple of the region size.
+ * @param hugePages
+ *        Determines whether the heap should be backed by transparent huge
+ *        pages, where the system supports them.
+ * @return A new heap, or `NULL` if the address range could not be reserved.
  * @memberof Heap
  */
-zen_Heap_t* zen_Heap_new();
+zen_Heap_t* zen_Heap_new(uint64_t size, bool hugePages);
 
 /* Destructor */
 
@@ -54,8 +105,32 @@ void zen_Heap_delete(zen_Heap_t* heap);
 /* Allocate */
 
 /**
+ * Hands out a run of contiguous regions, which are committed if necessary.
+ * The regions that were never committed, or whose memory was returned to the
+ * system, are cleared. The other regions may hold stale data.
+ *
+ * @return The first region of the run, or `NULL` if the heap is exhausted.
+ * @memberof Heap
+ */
+zen_Region_t* zen_Heap_allocateRegions(zen_Heap_t* heap, int32_t count);
+
+/**
+ * Releases the run of regions that begins with the specified region. The
+ * regions remain committed until the heap is trimmed.
+ *
+ * @memberof Heap
+ */
+void zen_Heap_releaseRegions(zen_Heap_t* heap, zen_Region_t* region);
+
+/* Trim */
+
+/**
+ * Returns the memory of the free regions to the system, except the
+ * specified number of committed free regions, which are retained for
+ * future allocations.
+ *
  * @memberof Heap
  */
-void* zen_Heap_allocate(zen_Heap_t* heap, zen_Allocator_t* allocator);
+void zen_Heap_trim(zen_Heap_t* heap, int32_t retainedCount);
 
 #endif /* COM_ONECUBE_ZEN_VIRTUAL_MACHINE_MEMORY_HEAP_HEAP_H */
\ No newline at end of file
@@ -19,26 +19,140 @@
 #ifndef COM_ONECUBE_ZEN_VIRTUAL_MACHINE_MEMORY_HEAP_NEW_GENERATION_H
 #define COM_ONECUBE_ZEN_VIRTUAL_MACHINE_MEMORY_HEAP_NEW_GENERATION_H
 
+#include <jtk/concurrent/lock/Mutex.h>
+
 #include <com/onecube/zen/Configuration.h>
-#include <com/onecube/zen/virtual-machine/memory/heap/Region.h>
+#include <com/onecube/zen/virtual-machine/memory/ObjectType.h>
+#include <com/onecube/zen/virtual-machine/memory/allocator/AllocationBuffer.h>
 #include <com/onecube/zen/virtual-machine/memory/allocator/SegregatedFitsAllocator.h>
+#include <com/onecube/zen/virtual-machine/memory/allocator/SequentialAllocator.h>
+#include <com/onecube/zen/virtual-machine/memory/heap/Heap.h>
 
 /*******************************************************************************
  * NewGeneration                                                               *
  *******************************************************************************/
 
+/* Objects begin at multiples of a granule, that is, 8 bytes. */
+#define ZEN_NEW_GENERATION_GRANULE_SHIFT 3
+#define ZEN_NEW_GENERATION_GRANULE_SIZE (1 << ZEN_NEW_GENERATION_GRANULE_SHIFT)
+
+/* The new generation is divided into pages of 4 kilobytes. A page is the
+ * unit of pinning.
+ */
+#define ZEN_NEW_GENERATION_PAGE_SHIFT 12
+#define ZEN_NEW_GENERATION_PAGE_SIZE (1 << ZEN_NEW_GENERATION_PAGE_SHIFT)
+
+/* Objects larger than a page are allocated in the old generation. */
+#define ZEN_NEW_GENERATION_MAXIMUM_OBJECT_SIZE ZEN_NEW_GENERATION_PAGE_SIZE
+
+/* The entries of the object map use the same layout as the flags of a cell
+ * in a memory block. An entry records whether an object begins at the
+ * granule, whether the object is pinned and the type of the object.
+ */
+#define ZEN_NEW_GENERATION_OBJECT_START ZEN_MEMORY_BLOCK_CELL_ALLOCATED
+#define ZEN_NEW_GENERATION_OBJECT_PINNED ZEN_MEMORY_BLOCK_CELL_MARKED
+
+/* The page was handed to the sequential allocator since the last collection. */
+#define ZEN_NEW_GENERATION_PAGE_USED (1 << 0)
+/* The page holds a pinned object, therefore, it cannot be reused. */
+#define ZEN_NEW_GENERATION_PAGE_PINNED (1 << 1)
+
+#define ZEN_NEW_GENERATION_CONTAINS(generation, address) \
+    (((uintptr_t)(address) - (uintptr_t)(generation)->m_start) < (generation)->m_size)
+
+/* Evaluates to the entry of the object map for the specified address, which
+ * should be a granule within the new generation.
+ */
+#define ZEN_NEW_GENERATION_GET_OBJECT_FLAGS(generation, address) \
+    ((generation)->m_objectMap[((uintptr_t)(address) - (uintptr_t)(generation)->m_start) >> \
+        ZEN_NEW_GENERATION_GRANULE_SHIFT])
+
+/* Determines whether an arbitrary word refers to the beginning of an object
+ * in the new generation. Small integers and other raw values are rejected.
+ */
+#define ZEN_NEW_GENERATION_IS_OBJECT(generation, address) \
+    (ZEN_NEW_GENERATION_CONTAINS(generation, address) && \
+     (((uintptr_t)(address) & (ZEN_NEW_GENERATION_GRANULE_SIZE - 1)) == 0) && \
+     ((ZEN_NEW_GENERATION_GET_OBJECT_FLAGS(generation, address) & ZEN_NEW_GENERATION_OBJECT_START) != 0))
+
+/* The number of allocation buffers that can be registered before the array
+ * of allocation buffers grows.
+ */
+#define ZEN_NEW_GENERATION_DEFAULT_ALLOCATION_BUFFER_CAPACITY 4
+
+/* Allocates an object from an allocation buffer carved from the new
+ * generation. It is the fast path of allocation, which neither acquires a
+ * lock nor clears the memory, because the buffer was cleared when it was
+ * refilled. The result is `NULL` if the buffer cannot hold the object.
+ */
+#define ZEN_NEW_GENERATION_ALLOCATE_LOCAL(generation, buffer, size, result) \
+    do { \
+        int32_t alignedSize = ((size) + (ZEN_NEW_GENERATION_GRANULE_SIZE - 1)) & \
+            ~(ZEN_NEW_GENERATION_GRANULE_SIZE - 1); \
+        (result) = ZEN_ALLOCATION_BUFFER_ALLOCATE(buffer, alignedSize); \
+        if ((result) != NULL) { \
+            ZEN_NEW_GENERATION_GET_OBJECT_FLAGS(generation, result) = \
+                ZEN_NEW_GENERATION_OBJECT_START | \
+                (ZEN_OBJECT_TYPE_AGGREGATE_OBJECT << ZEN_MEMORY_BLOCK_CELL_TYPE_SHIFT); \
+        } \
+    } \
+    while (false)
+
 /**
+ * The new generation, also known as the nursery, is the space where objects
+ * are allocated. Most objects die young, therefore, the new generation is
+ * collected separately from the rest of the heap, by copying the surviving
+ * objects into the old generation. The cost of such a collection is
+ * proportional to the number of surviving objects, rather than the number of
+ * objects allocated.
+ *
+ * The new generation occupies a run of regions of the heap, which it holds
+ * until the virtual machine shuts down. Objects are allocated by bumping a
+ * pointer with a sequential allocator.
+ * Since the objects are not allocated in cells, the new generation maintains
+ * an object map with an entry for every granule, which tells whether an
+ * object begins there.
+ *
+ * Every thread allocates from its own allocation buffer, which is carved
+ * from the sequential allocator. Allocating from a buffer requires no
+ * synchronization, because distinct buffers never share a granule. The
+ * sequential allocator is guarded by a mutex, which is acquired only when a
+ * buffer is refilled and when an object is allocated without a buffer. The
+ * buffers are registered with the new generation, so that they can be
+ * emptied when a collection reclaims the memory they were carved from.
+ *
+ * The slots of the stack frames do not record whether they hold references.
+ * An object referred by such a slot cannot be moved, because the slot cannot
+ * be updated safely. Therefore, the collector pins such objects in place,
+ * along with the pages they occupy. A pinned page is skipped by the
+ * allocator until a later collection finds its objects unpinned.
+ *
+ * Please refer "Compacting Garbage Collection with Ambiguous Roots" by Joel
+ * F. Bartlett for more information on pinning objects referred by ambiguous
+ * roots.
+ *
  * @class NewGeneration
  * @ingroup zen_vm_memory_heap
  * @author Samuel Rowe
  * @since zen 1.0
  */
 struct zen_NewGeneration_t {
-    zen_Region_t* m_leftRegion;
-    zen_Region_t* m_middleRegion;
-    zen_Region_t* m_rightRegion;
-    
-    zen_SegregatedFitsAllocator_t* m_allocator;
+    zen_Heap_t* m_heap;
+    zen_Region_t* m_region;
+    uint8_t* m_start;
+    uintptr_t m_size;
+    zen_SequentialAllocator_t* m_allocator;
+    uint8_t* m_objectMap;
+    uint8_t* m_pageFlags;
+    int32_t m_pageCount;
+    /* The number of bytes handed out since the last collection, including
+     * the memory carved for allocation buffers.
+     */
+    uint64_t m_allocatedSize;
+    jtk_Mutex_t* m_mutex;
+    zen_AllocationBuffer_t** m_allocationBuffers;
+    int32_t m_allocationBufferCount;
+    int32_t m_allocationBufferCapacity;
 };
 
 /**
@@ -46,4 +160,104 @@ struct zen_NewGeneration_t {
  */
 typedef struct zen_NewGeneration_t zen_NewGeneration_t;
 
-#endif /* ZEN_MMS_HEAP_NEW_GENERATION_H */
\ No newline at end of file
+/* Constructor */
+
+/**
+ * @param heap
+ *        The heap whose regions hold the new generation.
+ * @param size
+ *        The number of bytes reserved for the new generation. It is rounded
+ *        down to a multiple of the page size.
+ * @return A new generation, or `NULL` if the heap cannot hold it.
+ * @memberof NewGeneration
+ */
+zen_NewGeneration_t* zen_NewGeneration_new(zen_Heap_t* heap, uint64_t size);
+
+/* Destructor */
+
+/**
+ * @memberof NewGeneration
+ */
+void zen_NewGeneration_delete(zen_NewGeneration_t* generation);
+
+/* Allocate */
+
+/**
+ * Allocates an object of the specified size. The allocated memory is
+ * cleared.
+ *
+ * @return The allocated object, or `NULL` if the new generation is
+ *         exhausted.
+ * @memberof NewGeneration
+ */
+uint8_t* zen_NewGeneration_allocate(zen_NewGeneration_t* generation, int32_t size);
+
+/* Allocation Buffer */
+
+/**
+ * Registers the specified allocation buffer, which is initially empty.
+ *
+ * @memberof NewGeneration
+ */
+void zen_NewGeneration_addAllocationBuffer(zen_NewGeneration_t* generation,
+    zen_AllocationBuffer_t* buffer);
+
+/**
+ * Unregisters the specified allocation buffer. The memory that remains in the
+ * buffer is returned to the new generation, if possible.
+ *
+ * @memberof NewGeneration
+ */
+void zen_NewGeneration_removeAllocationBuffer(zen_NewGeneration_t* generation,
+    zen_AllocationBuffer_t* buffer);
+
+/**
+ * Carves a new chunk for the specified allocation buffer, which can hold an
+ * object of the specified size at least. The chunk is cleared. It is the
+ * slow path of allocation.
+ *
+ * @return `true` if the buffer was refilled; `false` if the new generation is
+ *         exhausted.
+ * @memberof NewGeneration
+ */
+bool zen_NewGeneration_refillAllocationBuffer(zen_NewGeneration_t* generation,
+    zen_AllocationBuffer_t* buffer, int32_t size);
+
+/* Object Type */
+
+/**
+ * @memberof NewGeneration
+ */
+void zen_NewGeneration_setType(zen_NewGeneration_t* generation, const void* object,
+    zen_ObjectType_t type);
+
+/* Pin */
+
+/**
+ * Pins the specified object, along with the pages it occupies.
+ *
+ * @memberof NewGeneration
+ */
+void zen_NewGeneration_pin(zen_NewGeneration_t* generation, const void* object,
+    int32_t size);
+
+/* Collection */
+
+/**
+ * Unpins all the pages. It is invoked when a collection begins.
+ *
+ * @memberof NewGeneration
+ */
+void zen_NewGeneration_prepare(zen_NewGeneration_t* generation);
+
+/**
+ * Forgets all the objects, except the pinned objects, which are unpinned for
+ * the next collection. The pages that were not pinned are reused for
+ * allocation and the allocation buffers are emptied. It is invoked when a
+ * collection ends.
+ *
+ * @memberof NewGeneration
+ */
+void zen_NewGeneration_reset(zen_NewGeneration_t* generation);
+
+#endif /* COM_ONECUBE_ZEN_VIRTUAL_MACHINE_MEMORY_HEAP_NEW_GENERATION_H */
\ No newline at end of file
@@ -21,17 +21,53 @@
 
 #include <com/onecube/zen/Configuration.h>
 
+// Forward References
+
+typedef struct zen_MemoryBlock_t zen_MemoryBlock_t;
+
 /*******************************************************************************
  * Region                                                                      *
  *******************************************************************************/
 
+/* The heap is divided into regions of 64 kilobytes. A region is as large as
+ * a memory block of the segregated-fits allocator, and aligned likewise.
+ */
+#define ZEN_REGION_SHIFT 16
+#define ZEN_REGION_SIZE (1 << ZEN_REGION_SHIFT)
+
+/* The memory of the region is backed by the system. */
+#define ZEN_REGION_COMMITTED (1 << 0)
+/* The region belongs to a run of regions handed out by the heap. */
+#define ZEN_REGION_USED (1 << 1)
+
 /**
+ * A region is a fixed-size part of the address range reserved by the heap.
+ * The heap hands out runs of contiguous regions, which are usually a single
+ * region. Every region has a descriptor, which is found by the address alone.
+ *
+ * The descriptor of a region records the memory block allocated in it, whose
+ * cells are threaded into free lists, along with the number of bytes that
+ * survived the last major collection and the number of major collections the
+ * region survived.
+ *
  * @class Region
  * @ingroup zen_heap
  * @author Samuel Rowe
  * @since zen 1.0
  */
 struct zen_Region_t {
+    uint8_t* m_start;
+    uint8_t m_flags;
+    /* The number of regions in the run that begins with this region. It is
+     * zero for the other regions of the run.
+     */
+    int32_t m_length;
+    /* The memory block that occupies the run, or `NULL` if the run does not
+     * belong to the old generation.
+     */
+    zen_MemoryBlock_t* m_block;
+    uint64_t m_liveSize;
+    int32_t m_age;
 };
 
 /**
@@ -0,0 +1,92 @@
+/*
+ * Copyright 2018-2020 Samuel Rowe
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Thursday, November 12, 2020
+
+#ifndef COM_ONECUBE_ZEN_VIRTUAL_MACHINE_OBJECT_ARRAY_H
+#define COM_ONECUBE_ZEN_VIRTUAL_MACHINE_OBJECT_ARRAY_H
+
+#include <com/onecube/zen/Configuration.h>
+#include <com/onecube/zen/virtual-machine/feb/Type.h>
+#include <com/onecube/zen/virtual-machine/object/Object.h>
+
+/*******************************************************************************
+ * Array                                                                       *
+ *******************************************************************************/
+
+/**
+ * An array is a single object, whose elements are stored right after its
+ * length. The layout of an array in memory is shown below.
+ *
+ * | Object Header | Length (32 bits) | Element Type (8 bits) | Padding | Elements |
+ *
+ * The header refers to the `zen.core.Array` class, regardless of the type of
+ * the elements. The elements of a primitive array are stored unboxed, in as
+ * many bytes as their type requires, whereas the elements of a reference
+ * array are references. The elements begin at a multiple of 8 bytes,
+ * therefore, they are naturally aligned.
+ *
+ * Since the length and the elements are found at fixed offsets, an element is
+ * accessed without looking up the fields of the class.
+ */
+#define ZEN_ARRAY_LENGTH_OFFSET ZEN_OBJECT_HEADER_SIZE
+#define ZEN_ARRAY_ELEMENT_TYPE_OFFSET (ZEN_ARRAY_LENGTH_OFFSET + sizeof (int32_t))
+#define ZEN_ARRAY_ELEMENTS_OFFSET (ZEN_OBJECT_HEADER_SIZE + sizeof (uint64_t))
+
+/* The length is limited such that the size of the largest array, with 8-byte
+ * elements, fits in 32 bits.
+ */
+#define ZEN_ARRAY_MAXIMUM_LENGTH ((int32_t)((INT32_MAX - ZEN_ARRAY_ELEMENTS_OFFSET) / sizeof (uint64_t)))
+
+/* Evaluates to the length of the specified array, as an lvalue. */
+#define ZEN_ARRAY_LENGTH(array) \
+    (*((int32_t*)((uint8_t*)(array) + ZEN_ARRAY_LENGTH_OFFSET)))
+
+/* Evaluates to the type of the elements of the specified array, as an lvalue. */
+#define ZEN_ARRAY_ELEMENT_TYPE(array) \
+    (*((uint8_t*)(array) + ZEN_ARRAY_ELEMENT_TYPE_OFFSET))
+
+/* Evaluates to the first element of the specified array, as a pointer to the
+ * specified C type.
+ */
+#define ZEN_ARRAY_GET_ELEMENTS(array, type) \
+    ((type*)((uint8_t*)(array) + ZEN_ARRAY_ELEMENTS_OFFSET))
+
+/* Determines whether the specified index is within the bounds of the specified
+ * array. A negative index is rejected by the unsigned comparison.
+ */
+#define ZEN_ARRAY_IS_VALID_INDEX(array, index) \
+    ((uint32_t)(index) < (uint32_t)ZEN_ARRAY_LENGTH(array))
+
+/* Size */
+
+/**
+ * Returns the number of bytes occupied by an element of the specified type,
+ * or 0 if arrays of the type cannot be created.
+ *
+ * @memberof Array
+ */
+int32_t zen_Array_getElementSize(zen_Type_t type);
+
+/**
+ * Returns the number of bytes occupied by an array with the specified type
+ * of elements and length, including the header.
+ *
+ * @memberof Array
+ */
+int32_t zen_Array_getAllocationSize(zen_Type_t type, int32_t length);
+
+#endif /* COM_ONECUBE_ZEN_VIRTUAL_MACHINE_OBJECT_ARRAY_H */
@@ -29,6 +29,9 @@
 struct zen_VirtualMachine_t;
 typedef struct zen_VirtualMachine_t zen_VirtualMachine_t;
 
+struct zen_Object_t;
+typedef struct zen_Object_t zen_Object_t;
+
 /*******************************************************************************
  * Class                                                                       *
  *******************************************************************************/
@@ -40,6 +43,31 @@ struct zen_Overload_t {
     zen_Overload_t* m_next;
 };
 
+typedef struct zen_Class_t zen_Class_t;
+
+/**
+ * A constant pool entry that was resolved to the run-time structure it
+ * refers to. The entries are resolved when an instruction that refers to
+ * them is executed for the first time. The subsequent executions of the
+ * instruction load the resolved value directly.
+ *
+ * An entry that has not been resolved yet is null.
+ *
+ * String and integer constants resolve to the literal objects that they
+ * denote. A literal object is materialized once per constant pool entry and
+ * shared by every execution of the instructions that load it. Therefore,
+ * literal objects are immutable and must be treated as roots by the
+ * collector, for as long as the class is loaded.
+ */
+union zen_ResolvedEntry_t {
+    zen_Class_t* m_class;
+    zen_Function_t* m_function;
+    zen_Field_t* m_field;
+    zen_Object_t* m_object;
+};
+
+typedef union zen_ResolvedEntry_t zen_ResolvedEntry_t;
+
 /**
  * @class Class
  * @ingroup zen_virtualMachine_object
@@ -56,12 +84,39 @@ struct zen_Class_t {
     uint32_t m_memoryRequirement;
     zen_Function_t** m_functionTable;
     int32_t m_functionTableSize;
+    /* The resolved entries, indexed by the constant pool index. */
+    zen_ResolvedEntry_t* m_resolvedEntries;
+    /* The direct superclasses, in the order of declaration. Superclasses
+     * that cannot be found are left out.
+     */
+    zen_Class_t** m_superclasses;
+    int32_t m_superclassCount;
+    /* The virtual function table begins with the slots of the first
+     * superclass, which retain their indexes. The slots of the other
+     * superclasses and the functions introduced by this class follow.
+     */
+    zen_Function_t** m_virtualFunctionTable;
+    int32_t m_virtualFunctionTableSize;
+    /* The offsets of the fields that hold references, relative to the body of
+     * an instance. The garbage collector traces the instances of the class
+     * through them.
+     */
+    int32_t* m_referenceOffsets;
+    int32_t m_referenceOffsetCount;
+    /* The storage of the static fields declared by the class. The static
+     * fields that hold references are visited by the garbage collector as
+     * roots, through their offsets.
+     */
+    uint8_t* m_staticFields;
+    int32_t m_staticFieldsSize;
+    int32_t* m_staticReferenceOffsets;
+    int32_t m_staticReferenceOffsetCount;
+    /* The index of the class in the class table, which the headers of its
+     * instances store.
+     */
+    uint32_t m_index;
 };
 
-/**
- * @memberof Class
- */
-typedef struct zen_Class_t zen_Class_t;
 
 // Constructor
 
@@ -80,6 +135,16 @@ void zen_Class_delete(zen_Class_t* class0);
 
 // Field Index
 
+/**
+ * Finds the field with the specified name, which may be declared by the
+ * class or inherited from its superclasses.
+ *
+ * @return The field, or `NULL` if the class has no such field.
+ * @memberof Class
+ */
+zen_Field_t* zen_Class_findField(zen_Class_t* class0, const uint8_t* name,
+    int32_t nameSize);
+
 int32_t zen_Class_findFieldOffset(zen_Class_t* class0, const uint8_t* name,
     int32_t nameSize);
 
@@ -96,6 +161,77 @@ zen_Function_t* zen_Class_getInstanceFunction(zen_Class_t* class0,
     const uint8_t* name, int32_t nameSize,
     const uint8_t* descriptor, int32_t descriptorSize);
 
+// Virtual Function
+
+/**
+ * Finds the slot of the instance function with the specified name and
+ * descriptor in the virtual function table of the specified class. Unlike
+ * zen_Class_getInstanceFunction(), the functions inherited from the
+ * superclasses are considered.
+ *
+ * @return The index of the slot, or -1 if the class has no such function.
+ */
+int32_t zen_Class_findVirtualFunctionIndex(zen_Class_t* class0,
+    const uint8_t* name, int32_t nameSize,
+    const uint8_t* descriptor, int32_t descriptorSize);
+
+zen_Function_t* zen_Class_getVirtualFunction(zen_Class_t* class0,
+    const uint8_t* name, int32_t nameSize,
+    const uint8_t* descriptor, int32_t descriptorSize);
+
+// Subclass
+
+/**
+ * Determines whether the specified class is the same as or derives, directly
+ * or indirectly, from the specified superclass.
+ *
+ * @memberof Class
+ */
+bool zen_Class_isSubclass(zen_Class_t* class0, zen_Class_t* superclass);
+
+// Resolve
+
+/**
+ * Resolves the class referred by the constant pool entry at the specified
+ * index in the constant pool of the specified class.
+ *
+ * @return The resolved class, or null if the class could not be found.
+ */
+zen_Class_t* zen_Class_resolveClass(zen_VirtualMachine_t* virtualMachine,
+    zen_Class_t* class0, int32_t index);
+
+/**
+ * Resolves the static function or constructor referred by the constant pool
+ * entry at the specified index in the constant pool of the specified class.
+ *
+ * @return The resolved function, or null if the function could not be found.
+ */
+zen_Function_t* zen_Class_resolveFunction(zen_VirtualMachine_t* virtualMachine,
+    zen_Class_t* class0, int32_t index);
+
+/**
+ * Resolves the field referred by the constant pool entry at the specified
+ * index in the constant pool of the specified class.
+ *
+ * @return The resolved field, or null if the field could not be found.
+ */
+zen_Field_t* zen_Class_resolveField(zen_VirtualMachine_t* virtualMachine,
+    zen_Class_t* class0, int32_t index);
+
+/**
+ * Resolves the slot in the virtual function table that the instance function
+ * referred by the constant pool entry at the specified index occupies. The
+ * class named by the entry is the class that the compiler saw at the call
+ * site. It is resolved like any other class entry, therefore, failing to find
+ * it raises a ClassNotFoundException.
+ *
+ * @return The function that occupies the slot in the class named by the
+ *         entry, or null if the function could not be resolved. In the former
+ *         case, the index of the slot is stored in `virtualIndex`.
+ */
+zen_Function_t* zen_Class_resolveVirtualFunction(zen_VirtualMachine_t* virtualMachine,
+    zen_Class_t* class0, int32_t index, int32_t* virtualIndex);
+
 // Initialize
 
 void zen_Class_initialize(zen_VirtualMachine_t* virtualMachine, zen_Class_t* class0, zen_EntityFile_t* entityFile);
@@ -0,0 +1,95 @@
+/*
+ * Copyright 2018-2020 Samuel Rowe
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Monday, November 09, 2020
+
+#ifndef COM_ONECUBE_ZEN_VIRTUAL_MACHINE_OBJECT_CLASS_TABLE_H
+#define COM_ONECUBE_ZEN_VIRTUAL_MACHINE_OBJECT_CLASS_TABLE_H
+
+#include <com/onecube/zen/Configuration.h>
+
+// Forward References
+
+typedef struct zen_Class_t zen_Class_t;
+
+/*******************************************************************************
+ * ClassTable                                                                  *
+ *******************************************************************************/
+
+/* The number of classes that the class table can hold before it grows. */
+#define ZEN_CLASS_TABLE_DEFAULT_CAPACITY 64
+
+/* The index reserved for the absence of a class. A cleared object header
+ * refers to it.
+ */
+#define ZEN_CLASS_TABLE_INVALID_INDEX 0
+
+/* Evaluates to the class with the specified index. */
+#define ZEN_CLASS_TABLE_GET_CLASS(table, index) ((table)->m_classes[index])
+
+/**
+ * The class table assigns a 32-bit index to every class that is loaded.
+ * Object headers store the index of their class instead of a pointer to it,
+ * which keeps the headers compact. Classes are never unloaded, therefore, an
+ * index remains valid until the virtual machine is deleted.
+ *
+ * Every virtual machine owns a class table. Classes are added by the thread
+ * that loads them, whereas the garbage collector reads the table only while
+ * the world is stopped.
+ *
+ * @class ClassTable
+ * @ingroup zen_virtualMachine_object
+ * @author Samuel Rowe
+ * @since zen 1.0
+ */
+struct zen_ClassTable_t {
+    zen_Class_t** m_classes;
+    int32_t m_size;
+    int32_t m_capacity;
+};
+
+/**
+ * @memberof ClassTable
+ */
+typedef struct zen_ClassTable_t zen_ClassTable_t;
+
+/* Constructor */
+
+/**
+ * @memberof ClassTable
+ */
+zen_ClassTable_t* zen_ClassTable_new();
+
+/* Destructor */
+
+/**
+ * The classes in the table are not deleted, they belong to the class loader.
+ *
+ * @memberof ClassTable
+ */
+void zen_ClassTable_delete(zen_ClassTable_t* table);
+
+/* Add */
+
+/**
+ * Adds the specified class to the table.
+ *
+ * @return The index assigned to the class.
+ * @memberof ClassTable
+ */
+uint32_t zen_ClassTable_add(zen_ClassTable_t* table, zen_Class_t* class0);
+
+#endif /* COM_ONECUBE_ZEN_VIRTUAL_MACHINE_OBJECT_CLASS_TABLE_H */
@@ -21,6 +21,7 @@
 
 #include <com/onecube/zen/Configuration.h>
 #include <com/onecube/zen/virtual-machine/feb/FieldEntity.h>
+#include <com/onecube/zen/virtual-machine/object/FieldType.h>
 
 // Forward References
 
@@ -31,6 +32,12 @@ typedef struct zen_Class_t zen_Class_t;
  *******************************************************************************/
 
 /**
+ * A field describes a slot in the body of the instances of a class. The
+ * fields inherited from the superclasses are described by fields of their
+ * own, which belong to the inheriting class but refer to the declaring class.
+ * A static field describes a slot in the static storage of the declaring
+ * class, which is shared by the inheriting classes.
+ *
  * @class Field
  * @ingroup zen_virtualMachine_object
  * @author Samuel Rowe
@@ -41,9 +48,16 @@ struct zen_Field_t {
     int32_t m_nameSize;
     uint8_t* m_descriptor;
     int32_t m_descriptorSize;
+    /* The class that declares the field. */
     zen_Class_t* m_class;
+    /* The offset of the field, relative to the body of an instance, or the
+     * static storage of the declaring class. It is aligned to the size of the
+     * field.
+     */
     int32_t m_offset;
     zen_FieldEntity_t* m_entity;
+    zen_FieldType_t m_type;
+    int32_t m_size;
 };
 
 /**
@@ -56,8 +70,34 @@ typedef struct zen_Field_t zen_Field_t;
 zen_Field_t* zen_Field_new(zen_Class_t* class0, 
     zen_FieldEntity_t* fieldEntity, int32_t offset);
 
+/**
+ * Creates a copy of the specified field, which was inherited from a
+ * superclass, with a different offset.
+ *
+ * @memberof Field
+ */
+zen_Field_t* zen_Field_newInherited(zen_Field_t* field, int32_t offset);
+
 // Destructor
 
 void zen_Field_delete(zen_Field_t* field);
 
+// Type
+
+/**
+ * @return `true` if the specified field holds references; otherwise,
+ *         `false`.
+ * @memberof Field
+ */
+bool zen_Field_isReference(zen_Field_t* field);
+
+// Static
+
+/**
+ * @return `true` if the specified field belongs to its class, rather than the
+ *         instances of its class; otherwise, `false`.
+ * @memberof Field
+ */
+bool zen_Field_isStatic(zen_Field_t* field);
+
 #endif /* COM_ONECUBE_ZEN_VIRTUAL_MACHINE_OBJECT_FIELD_H */
\ No newline at end of file
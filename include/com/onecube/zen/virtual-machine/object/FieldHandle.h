@@ -0,0 +1,160 @@
+/*
+ * Copyright 2018-2020 Samuel Rowe
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Monday, November 16, 2020
+
+#ifndef COM_ONECUBE_ZEN_VIRTUAL_MACHINE_OBJECT_FIELD_HANDLE_H
+#define COM_ONECUBE_ZEN_VIRTUAL_MACHINE_OBJECT_FIELD_HANDLE_H
+
+#include <com/onecube/zen/Configuration.h>
+#include <com/onecube/zen/virtual-machine/object/FieldType.h>
+#include <com/onecube/zen/virtual-machine/object/Object.h>
+
+// Forward References
+
+typedef struct zen_Class_t zen_Class_t;
+
+/*******************************************************************************
+ * FieldHandle                                                                 *
+ *******************************************************************************/
+
+/* Evaluates to the address of the field referred by the specified handle in
+ * the specified object, as a pointer to the specified type.
+ */
+#define ZEN_FIELD_HANDLE_ADDRESS(handle, object, type) \
+    ((type*)((uint8_t*)(object) + ZEN_OBJECT_HEADER_SIZE + (handle)->m_offset))
+
+#define ZEN_FIELD_HANDLE_IS_RESOLVED(handle) ((handle)->m_class != NULL)
+
+/* The getters and setters neither check the type of the field nor the class
+ * of the object. The values of the fields are converted by the caller.
+ */
+
+#define ZEN_FIELD_HANDLE_GET_BOOLEAN(handle, object) \
+    (*ZEN_FIELD_HANDLE_ADDRESS(handle, object, uint8_t) != 0)
+#define ZEN_FIELD_HANDLE_GET_INT8(handle, object) \
+    (*ZEN_FIELD_HANDLE_ADDRESS(handle, object, int8_t))
+#define ZEN_FIELD_HANDLE_GET_INT16(handle, object) \
+    (*ZEN_FIELD_HANDLE_ADDRESS(handle, object, int16_t))
+#define ZEN_FIELD_HANDLE_GET_INT32(handle, object) \
+    (*ZEN_FIELD_HANDLE_ADDRESS(handle, object, int32_t))
+#define ZEN_FIELD_HANDLE_GET_INT64(handle, object) \
+    (*ZEN_FIELD_HANDLE_ADDRESS(handle, object, int64_t))
+#define ZEN_FIELD_HANDLE_GET_FLOAT(handle, object) \
+    (*ZEN_FIELD_HANDLE_ADDRESS(handle, object, float))
+#define ZEN_FIELD_HANDLE_GET_DOUBLE(handle, object) \
+    (*ZEN_FIELD_HANDLE_ADDRESS(handle, object, double))
+#define ZEN_FIELD_HANDLE_GET_REFERENCE(handle, object) \
+    (*ZEN_FIELD_HANDLE_ADDRESS(handle, object, zen_Object_t*))
+
+#define ZEN_FIELD_HANDLE_SET_BOOLEAN(handle, object, value) \
+    do { \
+        *ZEN_FIELD_HANDLE_ADDRESS(handle, object, uint8_t) = ((value) != 0); \
+    } \
+    while (false)
+
+#define ZEN_FIELD_HANDLE_SET_INT8(handle, object, value) \
+    do { \
+        *ZEN_FIELD_HANDLE_ADDRESS(handle, object, int8_t) = (int8_t)(value); \
+    } \
+    while (false)
+
+#define ZEN_FIELD_HANDLE_SET_INT16(handle, object, value) \
+    do { \
+        *ZEN_FIELD_HANDLE_ADDRESS(handle, object, int16_t) = (int16_t)(value); \
+    } \
+    while (false)
+
+#define ZEN_FIELD_HANDLE_SET_INT32(handle, object, value) \
+    do { \
+        *ZEN_FIELD_HANDLE_ADDRESS(handle, object, int32_t) = (int32_t)(value); \
+    } \
+    while (false)
+
+#define ZEN_FIELD_HANDLE_SET_INT64(handle, object, value) \
+    do { \
+        *ZEN_FIELD_HANDLE_ADDRESS(handle, object, int64_t) = (int64_t)(value); \
+    } \
+    while (false)
+
+#define ZEN_FIELD_HANDLE_SET_FLOAT(handle, object, value) \
+    do { \
+        *ZEN_FIELD_HANDLE_ADDRESS(handle, object, float) = (float)(value); \
+    } \
+    while (false)
+
+#define ZEN_FIELD_HANDLE_SET_DOUBLE(handle, object, value) \
+    do { \
+        *ZEN_FIELD_HANDLE_ADDRESS(handle, object, double) = (double)(value); \
+    } \
+    while (false)
+
+/* Stores a reference in the field, invoking the write barriers of the
+ * specified memory manager.
+ */
+#define ZEN_FIELD_HANDLE_SET_REFERENCE(manager, handle, object, value) \
+    do { \
+        zen_Object_t** slot = ZEN_FIELD_HANDLE_ADDRESS(handle, object, zen_Object_t*); \
+        ZEN_MEMORY_MANAGER_PRE_WRITE_BARRIER(manager, slot); \
+        *slot = (value); \
+        ZEN_MEMORY_MANAGER_WRITE_BARRIER(manager, object, value); \
+    } \
+    while (false)
+
+/**
+ * A field handle is the result of looking up a field by name, which is
+ * resolved once and used for every access thereafter. The getters and setters
+ * of a handle compile to a single load or store.
+ *
+ * A handle resolved against a class is valid for the instances of that class
+ * and the classes that inherit it as their first superclass, because such
+ * classes retain the offsets of the inherited fields. The members of a handle
+ * should not be accessed directly.
+ *
+ * @class FieldHandle
+ * @ingroup zen_virtualMachine_object
+ * @author Samuel Rowe
+ * @since zen 1.0
+ */
+struct zen_FieldHandle_t {
+    /* The class the handle was resolved against, or `NULL` if the handle is
+     * not resolved.
+     */
+    zen_Class_t* m_class;
+    /* The offset of the field, relative to the body of an instance. */
+    int32_t m_offset;
+    zen_FieldType_t m_type;
+};
+
+/**
+ * @memberof FieldHandle
+ */
+typedef struct zen_FieldHandle_t zen_FieldHandle_t;
+
+// Initialize
+
+/**
+ * Resolves the field with the specified name in the specified class. The
+ * fields inherited from the superclasses are found, too. If the field is not
+ * found, the handle is left unresolved.
+ *
+ * @return `true` if the field was found; otherwise, `false`.
+ * @memberof FieldHandle
+ */
+bool zen_FieldHandle_initialize(zen_FieldHandle_t* handle, zen_Class_t* class0,
+    const uint8_t* name, int32_t nameSize);
+
+#endif /* COM_ONECUBE_ZEN_VIRTUAL_MACHINE_OBJECT_FIELD_HANDLE_H */
@@ -0,0 +1,52 @@
+/*
+ * Copyright 2018-2020 Samuel Rowe
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Tuesday, November 10, 2020
+
+#ifndef COM_ONECUBE_ZEN_VIRTUAL_MACHINE_OBJECT_FIELD_TYPE_H
+#define COM_ONECUBE_ZEN_VIRTUAL_MACHINE_OBJECT_FIELD_TYPE_H
+
+/*******************************************************************************
+ * FieldType                                                                   *
+ *******************************************************************************/
+
+/**
+ * The type of the values stored in a field, which is derived from the
+ * descriptor of the field. The values of primitive fields are stored
+ * unboxed, in as many bytes as their type requires.
+ *
+ * @class FieldType
+ * @ingroup zen_virtualMachine_object
+ * @author Samuel Rowe
+ * @since zen 1.0
+ */
+enum zen_FieldType_t {
+    ZEN_FIELD_TYPE_BOOLEAN,
+    ZEN_FIELD_TYPE_BYTE,
+    ZEN_FIELD_TYPE_SHORT,
+    ZEN_FIELD_TYPE_INTEGER,
+    ZEN_FIELD_TYPE_LONG,
+    ZEN_FIELD_TYPE_FLOAT,
+    ZEN_FIELD_TYPE_DOUBLE,
+    ZEN_FIELD_TYPE_REFERENCE
+};
+
+/**
+ * @memberof FieldType
+ */
+typedef enum zen_FieldType_t zen_FieldType_t;
+
+#endif /* COM_ONECUBE_ZEN_VIRTUAL_MACHINE_OBJECT_FIELD_TYPE_H */
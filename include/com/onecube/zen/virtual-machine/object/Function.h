@@ -25,6 +25,8 @@
 #include <com/onecube/zen/virtual-machine/object/NativeFunction.h>
 #include <com/onecube/zen/virtual-machine/feb/attribute/Attribute.h>
 #include <com/onecube/zen/virtual-machine/feb/attribute/InstructionAttribute.h>
+#include <com/onecube/zen/virtual-machine/processor/InlineCache.h>
+#include <com/onecube/zen/virtual-machine/processor/Intrinsic.h>
 
 // Forward References
 
@@ -51,8 +53,41 @@ struct zen_Function_t {
     zen_Type_t m_returnType;
     int32_t* m_parameters;
     int32_t m_parameterCount;
+    /* The number of slots the arguments occupy on the operand stack of the
+     * caller, excluding the self reference. Every argument is passed as a
+     * reference.
+     */
+    int32_t m_argumentSlotCount;
+    /* Determines whether the arguments on the operand stack of the caller are
+     * laid out exactly like the local variables of the function, that is, all
+     * the parameters are references.
+     */
+    bool m_directArguments;
     zen_NativeFunction_t* m_nativeFunction;
+    /* The operation which the interpreter evaluates inline instead of
+     * invoking the native function, along with the operator it evaluates and
+     * the offset of the value field for the Integer and Boolean classes.
+     */
+    zen_Intrinsic_t m_intrinsic;
+    int32_t m_intrinsicOperator;
+    int32_t m_intrinsicValueOffset;
     zen_InstructionAttribute_t* m_instructionAttribute;
+    /* The caches of the sites in the function, indexed by the offset of the
+     * instruction. The instruction determines the type of the cache, that is,
+     * an inline cache for `invoke_virtual`, an operator cache for
+     * `invoke_operator` and a field cache for the field instructions. The
+     * table is allocated when a site is executed for the first time.
+     *
+     * The instructions are of variable length, therefore, the table has a
+     * slot for every byte of the instructions. A single table is shared by
+     * all the types of sites to limit this cost.
+     */
+    void** m_siteCaches;
+    /* The function that introduced the virtual function table slot occupied
+     * by this function. A function and the functions overriding it share the
+     * same root. It is null for static functions and constructors.
+     */
+    zen_Function_t* m_virtualRoot;
 };
 
 /**
@@ -73,4 +108,25 @@ void zen_Function_delete(zen_Function_t* function);
 
 bool zen_Function_isNative(zen_Function_t* function);
 
+// Static
+
+bool zen_Function_isStatic(zen_Function_t* function);
+
+// Site Cache
+
+/**
+ * Returns the cache of the site at the specified instruction offset. The
+ * cache is loaded inline, it is created out of line when the site is executed
+ * for the first time.
+ */
+#define ZEN_FUNCTION_GET_SITE_CACHE(function, offset) \
+    ((((function)->m_siteCaches != NULL) && ((function)->m_siteCaches[offset] != NULL))? \
+        (function)->m_siteCaches[offset] : zen_Function_createSiteCache(function, offset))
+
+/**
+ * Creates the cache of the site at the specified instruction offset, along
+ * with the table of site caches, if necessary.
+ */
+void* zen_Function_createSiteCache(zen_Function_t* function, int32_t offset);
+
 #endif /* COM_ONECUBE_ZEN_VIRTUAL_MACHINE_OBJECT_FUNCTION_H */
\ No newline at end of file
@@ -36,6 +36,32 @@ typedef struct zen_Object_t zen_Object_t;
 typedef zen_Object_t* (*zen_NativeFunction_InvokeFunction_t)(zen_VirtualMachine_t* virtualMachine, zen_Object_t* object, jtk_Array_t* arguments);
 
 /**
+ * The arguments are passed as a pointer to the references, whose number is
+ * fixed by the descriptor of the function.
+ *
+ * @memberof NativeFunction
+ */
+typedef zen_Object_t* (*zen_NativeFunction_FastInvokeFunction_t)(zen_VirtualMachine_t* virtualMachine, zen_Object_t* object, zen_Object_t** arguments);
+
+/* Determines whether the specified native function can be invoked without a
+ * stack frame.
+ */
+#define ZEN_NATIVE_FUNCTION_IS_FAST(function) ((function)->m_fastInvoke != NULL)
+
+/**
+ * A native function is implemented with one of two calling conventions.
+ *
+ * The general calling convention passes the arguments as an array, and the
+ * interpreter pushes a stack frame on behalf of the function. Such a
+ * function may invoke other functions or inspect the invocation stack.
+ *
+ * The fast calling convention is meant for leaf functions, which neither
+ * invoke functions written in Zen nor inspect the invocation stack, such as
+ * the operators of the primitive classes. The arguments are read off the
+ * operand stack into a local array, a stack frame is not pushed and the
+ * result is pushed straight on the operand stack of the caller. The number
+ * of arguments is checked when the function is linked.
+ *
  * @class NativeFunction
  * @ingroup zen_virtualMachine_object
  * @author Samuel Rowe
@@ -43,6 +69,8 @@ typedef zen_Object_t* (*zen_NativeFunction_InvokeFunction_t)(zen_VirtualMachine_
  */
 struct zen_NativeFunction_t {
     zen_NativeFunction_InvokeFunction_t m_invoke;
+    zen_NativeFunction_FastInvokeFunction_t m_fastInvoke;
+    int32_t m_parameterCount;
 };
 
 /**
@@ -0,0 +1,144 @@
+/*
+ * Copyright 2018-2020 Samuel Rowe
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Saturday, November 14, 2020
+
+#ifndef COM_ONECUBE_ZEN_VIRTUAL_MACHINE_OBJECT_NATIVE_FUNCTION_TABLE_H
+#define COM_ONECUBE_ZEN_VIRTUAL_MACHINE_OBJECT_NATIVE_FUNCTION_TABLE_H
+
+#include <com/onecube/zen/Configuration.h>
+#include <com/onecube/zen/virtual-machine/object/NativeFunction.h>
+
+/*******************************************************************************
+ * NativeFunctionEntry                                                         *
+ *******************************************************************************/
+
+/**
+ * Associates a native function with the descriptor of its class, its name
+ * and its descriptor.
+ *
+ * @class NativeFunctionEntry
+ * @ingroup zen_virtualMachine_object
+ * @author Samuel Rowe
+ * @since zen 1.0
+ */
+struct zen_NativeFunctionEntry_t {
+    const uint8_t* m_className;
+    int32_t m_classNameSize;
+    const uint8_t* m_name;
+    int32_t m_nameSize;
+    const uint8_t* m_descriptor;
+    int32_t m_descriptorSize;
+    zen_NativeFunction_t m_function;
+};
+
+/**
+ * @memberof NativeFunctionEntry
+ */
+typedef struct zen_NativeFunctionEntry_t zen_NativeFunctionEntry_t;
+
+/* Initializes an entry for a native function with the general calling
+ * convention. The strings should be literals.
+ */
+#define ZEN_NATIVE_FUNCTION_ENTRY(className, name, descriptor, invoke) \
+    { (const uint8_t*)(className), sizeof (className) - 1, \
+      (const uint8_t*)(name), sizeof (name) - 1, \
+      (const uint8_t*)(descriptor), sizeof (descriptor) - 1, \
+      { (zen_NativeFunction_InvokeFunction_t)(invoke), NULL, -1 } }
+
+/* Initializes an entry for a native function with the fast calling
+ * convention. The strings should be literals.
+ */
+#define ZEN_NATIVE_FUNCTION_FAST_ENTRY(className, name, descriptor, invoke, parameterCount) \
+    { (const uint8_t*)(className), sizeof (className) - 1, \
+      (const uint8_t*)(name), sizeof (name) - 1, \
+      (const uint8_t*)(descriptor), sizeof (descriptor) - 1, \
+      { NULL, (invoke), (parameterCount) } }
+
+/*******************************************************************************
+ * NativeFunctionTable                                                         *
+ *******************************************************************************/
+
+/**
+ * The native function table maps the functions declared as native to their
+ * implementations. The entries are compiled into the virtual machine as a
+ * static array, from which a perfect hash table is built when the virtual
+ * machine starts. Since the set of entries never changes afterwards, every
+ * key is assigned a slot of its own, and a lookup probes exactly one slot.
+ * A lookup neither allocates memory nor joins the strings of the key.
+ *
+ * The table is built with the hash and displace algorithm. The keys are
+ * distributed into buckets by a first hash. Starting with the largest
+ * bucket, every bucket is assigned the smallest displacement which moves
+ * all its keys to free slots, where the slot of a key is derived from a
+ * second hash and the displacement of its bucket.
+ *
+ * Please refer "Hash, displace, and compress" by Djamal Belazzougui, Fabiano
+ * C. Botelho and Martin Dietzfelbinger for more information.
+ *
+ * @class NativeFunctionTable
+ * @ingroup zen_virtualMachine_object
+ * @author Samuel Rowe
+ * @since zen 1.0
+ */
+struct zen_NativeFunctionTable_t {
+    zen_NativeFunctionEntry_t* m_entries;
+    int32_t m_entryCount;
+    /* The displacements of the buckets. */
+    uint32_t* m_displacements;
+    int32_t m_bucketCount;
+    /* The indexes of the entries assigned to the slots, or -1 if a slot is
+     * free.
+     */
+    int32_t* m_slots;
+    int32_t m_slotCount;
+};
+
+/**
+ * @memberof NativeFunctionTable
+ */
+typedef struct zen_NativeFunctionTable_t zen_NativeFunctionTable_t;
+
+/* Constructor */
+
+/**
+ * @param entries
+ *        The entries of the table, which should outlive it. Every entry
+ *        should have a distinct key.
+ * @memberof NativeFunctionTable
+ */
+zen_NativeFunctionTable_t* zen_NativeFunctionTable_new(zen_NativeFunctionEntry_t* entries,
+    int32_t entryCount);
+
+/* Destructor */
+
+/**
+ * @memberof NativeFunctionTable
+ */
+void zen_NativeFunctionTable_delete(zen_NativeFunctionTable_t* table);
+
+/* Find */
+
+/**
+ * @return The native function with the specified key, or `NULL` if the
+ *         table does not contain it.
+ * @memberof NativeFunctionTable
+ */
+zen_NativeFunction_t* zen_NativeFunctionTable_find(zen_NativeFunctionTable_t* table,
+    const uint8_t* className, int32_t classNameSize, const uint8_t* name,
+    int32_t nameSize, const uint8_t* descriptor, int32_t descriptorSize);
+
+#endif /* COM_ONECUBE_ZEN_VIRTUAL_MACHINE_OBJECT_NATIVE_FUNCTION_TABLE_H */
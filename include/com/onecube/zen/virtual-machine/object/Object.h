@@ -21,16 +21,107 @@
 
 #include <com/onecube/zen/Configuration.h>
 #include <com/onecube/zen/virtual-machine/object/Class.h>
+#include <com/onecube/zen/virtual-machine/object/ClassTable.h>
 
 /*******************************************************************************
  * Object                                                                      *
  *******************************************************************************/
 
+/**
+ * The layout of the object in memory is shown below.
+ * | Object Header | Object Body |
+ *
+ * The object header is constant, that is, the size is fixed based on the
+ * implementation of the virtual machine. On the other hand, the size of the
+ * object body is variable, contingent on both the implementation and the
+ * fields declared in the class whose instance the object is.
+ *
+ * [Object Header]
+ * The header is a single 64-bit word, regardless of the platform.
+ *
+ * | Class Index (32 bits) | Identity Hash (29 bits) | Locked | Hashed | Forwarded |
+ *
+ * The class index refers to an entry of the class table. The identity hash is
+ * computed when it is requested for the first time, which is recorded by the
+ * hashed bit. Until then, the hash bits are zero. The locked bit is reserved
+ * for the monitor of the object. The forwarded bit is set by the garbage
+ * collector when a young object is copied, in which case the rest of the
+ * header is the address of the copy. Since objects are aligned to 8 bytes,
+ * the address never overlaps the low bits.
+ *
+ * The body of an object begins right after the header, therefore, it is
+ * aligned to 8 bytes as well.
+ */
+#define ZEN_OBJECT_HEADER_SIZE sizeof (uint64_t)
+#define ZEN_OBJECT_HEADER_OFFSET 0
+
+#define ZEN_OBJECT_HEADER_FORWARDED ((uint64_t)1 << 0)
+#define ZEN_OBJECT_HEADER_HASHED ((uint64_t)1 << 1)
+#define ZEN_OBJECT_HEADER_LOCKED ((uint64_t)1 << 2)
+
+#define ZEN_OBJECT_HEADER_HASH_SHIFT 3
+#define ZEN_OBJECT_HEADER_HASH_MASK ((uint64_t)0x1FFFFFFF)
+#define ZEN_OBJECT_HEADER_CLASS_INDEX_SHIFT 32
+
+/* Evaluates to the header of the specified object, as an lvalue. */
+#define ZEN_OBJECT_HEADER(object) \
+    (*((uint64_t*)((uint8_t*)(object) + ZEN_OBJECT_HEADER_OFFSET)))
+
+/* Evaluates to the header of a new instance of the class with the specified
+ * index. The identity hash of the instance is not computed yet.
+ */
+#define ZEN_OBJECT_HEADER_NEW(classIndex) \
+    ((uint64_t)(classIndex) << ZEN_OBJECT_HEADER_CLASS_INDEX_SHIFT)
+
+#define ZEN_OBJECT_HEADER_GET_CLASS_INDEX(header) \
+    ((uint32_t)((header) >> ZEN_OBJECT_HEADER_CLASS_INDEX_SHIFT))
+
+#define ZEN_OBJECT_HEADER_GET_HASH(header) \
+    ((int32_t)(((header) >> ZEN_OBJECT_HEADER_HASH_SHIFT) & ZEN_OBJECT_HEADER_HASH_MASK))
+
+/* Evaluates to the class of the specified object, which should not be a
+ * small integer or a forwarded object.
+ */
+#define ZEN_OBJECT_GET_CLASS(table, object) \
+    ZEN_CLASS_TABLE_GET_CLASS(table, ZEN_OBJECT_HEADER_GET_CLASS_INDEX(ZEN_OBJECT_HEADER(object)))
+
+/* Small Integer */
+
+/**
+ * Integers that fit in a reference, less one bit, are not allocated. Instead,
+ * the value is stored in the reference itself, with the least significant
+ * bit set. The address of an object never has this bit set, because objects
+ * are aligned at least to the size of a pointer. A small integer has neither
+ * a header nor a body. It is an instance of the `zen.core.Integer` class,
+ * whose `value` field is implied by the reference.
+ *
+ * Integers are immutable and the identity hash of a reference is derived from
+ * the reference itself. Therefore, small integers never need to be boxed.
+ * Integers outside the range of small integers are allocated as usual.
+ */
+#define ZEN_OBJECT_SMALL_INTEGER_TAG ((uintptr_t)1)
+#define ZEN_OBJECT_SMALL_INTEGER_MIN ((int64_t)(INTPTR_MIN >> 1))
+#define ZEN_OBJECT_SMALL_INTEGER_MAX ((int64_t)(INTPTR_MAX >> 1))
+
+#define ZEN_OBJECT_IS_SMALL_INTEGER(object) \
+    ((((uintptr_t)(object)) & ZEN_OBJECT_SMALL_INTEGER_TAG) != 0)
+#define ZEN_OBJECT_FITS_SMALL_INTEGER(value) \
+    (((value) >= ZEN_OBJECT_SMALL_INTEGER_MIN) && ((value) <= ZEN_OBJECT_SMALL_INTEGER_MAX))
+#define ZEN_OBJECT_NEW_SMALL_INTEGER(value) \
+    ((zen_Object_t*)((((uintptr_t)(intptr_t)(value)) << 1) | ZEN_OBJECT_SMALL_INTEGER_TAG))
+#define ZEN_OBJECT_GET_SMALL_INTEGER(object) \
+    ((int64_t)(((intptr_t)(object)) >> 1))
+
 struct zen_Object_t {
 };
 
 typedef struct zen_Object_t zen_Object_t;
 
-zen_Class_t* zen_Object_getClass(zen_Object_t* object);
+/**
+ * Returns the class of the specified object. The class of a small integer is
+ * the Integer class of the specified virtual machine.
+ */
+zen_Class_t* zen_Object_getClass(zen_VirtualMachine_t* virtualMachine,
+    zen_Object_t* object);
 
 #endif /* COM_ONECUBE_ZEN_VIRTUAL_MACHINE_OBJECT_OBJECT_H */
\ No newline at end of file
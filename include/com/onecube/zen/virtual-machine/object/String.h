@@ -0,0 +1,92 @@
+/*
+ * Copyright 2018-2020 Samuel Rowe
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Friday, November 13, 2020
+
+#ifndef COM_ONECUBE_ZEN_VIRTUAL_MACHINE_OBJECT_STRING_H
+#define COM_ONECUBE_ZEN_VIRTUAL_MACHINE_OBJECT_STRING_H
+
+#include <com/onecube/zen/Configuration.h>
+#include <com/onecube/zen/virtual-machine/object/Object.h>
+
+/*******************************************************************************
+ * String                                                                      *
+ *******************************************************************************/
+
+/**
+ * A string is a single object, whose UTF-8 bytes are stored right after its
+ * size and hash. The layout of a string in memory is shown below.
+ *
+ * | Object Header | Size (32 bits) | Hash (32 bits) | Bytes |
+ *
+ * The header refers to the `zen.core.String` class. Strings are immutable,
+ * therefore, the hash of the contents is computed when it is requested for
+ * the first time and cached in the string. A hash of zero indicates that the
+ * hash was not computed yet.
+ *
+ * Since the size and the bytes are found at fixed offsets, a string is
+ * accessed without looking up the fields of the class.
+ */
+#define ZEN_STRING_SIZE_OFFSET ZEN_OBJECT_HEADER_SIZE
+#define ZEN_STRING_HASH_OFFSET (ZEN_STRING_SIZE_OFFSET + sizeof (int32_t))
+#define ZEN_STRING_BYTES_OFFSET (ZEN_OBJECT_HEADER_SIZE + sizeof (uint64_t))
+
+#define ZEN_STRING_MAXIMUM_SIZE ((int32_t)(INT32_MAX - ZEN_STRING_BYTES_OFFSET))
+
+/* Evaluates to the number of bytes in the specified string, as an lvalue. */
+#define ZEN_STRING_SIZE(string) \
+    (*((int32_t*)((uint8_t*)(string) + ZEN_STRING_SIZE_OFFSET)))
+
+/* Evaluates to the cached hash of the specified string, as an lvalue. */
+#define ZEN_STRING_HASH(string) \
+    (*((int32_t*)((uint8_t*)(string) + ZEN_STRING_HASH_OFFSET)))
+
+/* Evaluates to the first byte of the specified string. */
+#define ZEN_STRING_GET_BYTES(string) \
+    ((uint8_t*)(string) + ZEN_STRING_BYTES_OFFSET)
+
+/* Size */
+
+/**
+ * Returns the number of bytes occupied by a string with the specified number
+ * of bytes, including the header.
+ *
+ * @memberof String
+ */
+int32_t zen_String_getAllocationSize(int32_t size);
+
+/* Hash */
+
+/**
+ * Returns the hash of the contents of the specified string. The hash is
+ * computed with the FNV-1a algorithm when it is requested for the first time.
+ *
+ * @memberof String
+ */
+int32_t zen_String_getHash(zen_Object_t* string);
+
+/* Equality */
+
+/**
+ * Determines whether the specified strings have the same contents. The sizes
+ * and the cached hashes are compared before the bytes, therefore, most
+ * unequal strings are rejected without reading their bytes.
+ *
+ * @memberof String
+ */
+bool zen_String_isEqual(zen_Object_t* string1, zen_Object_t* string2);
+
+#endif /* COM_ONECUBE_ZEN_VIRTUAL_MACHINE_OBJECT_STRING_H */
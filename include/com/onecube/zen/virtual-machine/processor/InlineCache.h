@@ -0,0 +1,358 @@
+/*
+ * Copyright 2018-2020 Samuel Rowe
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Sunday, October 18, 2020
+
+#ifndef COM_ONECUBE_ZEN_VIRTUAL_MACHINE_PROCESSOR_INLINE_CACHE_H
+#define COM_ONECUBE_ZEN_VIRTUAL_MACHINE_PROCESSOR_INLINE_CACHE_H
+
+#include <com/onecube/zen/Configuration.h>
+
+// Forward References
+
+typedef struct zen_Class_t zen_Class_t;
+typedef struct zen_Function_t zen_Function_t;
+
+/*******************************************************************************
+ * InlineCache                                                                 *
+ *******************************************************************************/
+
+/* The number of receiver classes remembered by a call site before it is
+ * considered megamorphic.
+ */
+#define ZEN_INLINE_CACHE_CAPACITY 4
+
+/* The virtual index of a call site that has not been linked yet. */
+#define ZEN_INLINE_CACHE_UNLINKED -2
+
+/**
+ * When a call site is linked, the function it refers to is looked up in the
+ * class that the compiler saw at the call site. If found, the call site
+ * remembers the slot of the function in the virtual function table and the
+ * root of the slot. The function is then dispatched by loading the slot from
+ * the virtual function table of the receiver class. The root guards against
+ * receivers whose classes do not share the layout, which is possible because
+ * the language is dynamically typed. The virtual index of a call site that
+ * cannot use the virtual function table is -1.
+ *
+ * Otherwise, the inline cache remembers the functions that the call site
+ * dispatched to, keyed on the class of the receiver. The first entry is the
+ * monomorphic entry, which the interpreter checks without a function call.
+ * The remaining entries make the call site polymorphic. Once all the entries
+ * are occupied, the call site is megamorphic and further receiver classes are
+ * looked up in the megamorphic cache of the interpreter.
+ *
+ * @class InlineCache
+ * @ingroup zen_vm_processor
+ * @author Samuel Rowe
+ * @since zen 1.0
+ */
+struct zen_InlineCache_t {
+    int32_t m_virtualIndex;
+    zen_Function_t* m_virtualRoot;
+    zen_Class_t* m_classes[ZEN_INLINE_CACHE_CAPACITY];
+    zen_Function_t* m_functions[ZEN_INLINE_CACHE_CAPACITY];
+    int32_t m_size;
+};
+
+/**
+ * @memberof InlineCache
+ */
+typedef struct zen_InlineCache_t zen_InlineCache_t;
+
+/* Constructor */
+
+/**
+ * @memberof InlineCache
+ */
+zen_InlineCache_t* zen_InlineCache_new();
+
+/* Destructor */
+
+/**
+ * @memberof InlineCache
+ */
+void zen_InlineCache_delete(zen_InlineCache_t* inlineCache);
+
+/* Add */
+
+/**
+ * Remembers the specified function for the specified receiver class. If the
+ * inline cache is full, it remains unmodified.
+ *
+ * @return `true` if the entry was added; `false` if the call site is
+ *         megamorphic.
+ * @memberof InlineCache
+ */
+bool zen_InlineCache_add(zen_InlineCache_t* inlineCache, zen_Class_t* class0,
+    zen_Function_t* function);
+
+/* Function */
+
+/**
+ * Looks up the function remembered for the specified receiver class, skipping
+ * the monomorphic entry, which is checked by the interpreter itself.
+ *
+ * @return The remembered function, or `NULL` if the receiver class has not
+ *         been seen at the call site.
+ * @memberof InlineCache
+ */
+zen_Function_t* zen_InlineCache_getPolymorphicFunction(zen_InlineCache_t* inlineCache,
+    zen_Class_t* class0);
+
+/* Megamorphic */
+
+/**
+ * @memberof InlineCache
+ */
+bool zen_InlineCache_isMegamorphic(zen_InlineCache_t* inlineCache);
+
+/*******************************************************************************
+ * MegamorphicCache                                                            *
+ *******************************************************************************/
+
+/* The number of entries in the megamorphic cache. It must be a power of 2. */
+#define ZEN_MEGAMORPHIC_CACHE_SIZE 1024
+
+/**
+ * @class MegamorphicCacheEntry
+ * @ingroup zen_vm_processor
+ * @author Samuel Rowe
+ * @since zen 1.0
+ */
+struct zen_MegamorphicCacheEntry_t {
+    zen_Class_t* m_class;
+    const void* m_selector;
+    zen_Function_t* m_function;
+};
+
+/**
+ * @memberof MegamorphicCacheEntry
+ */
+typedef struct zen_MegamorphicCacheEntry_t zen_MegamorphicCacheEntry_t;
+
+/**
+ * The megamorphic cache is shared by all the call sites executed by an
+ * interpreter. It is a direct mapped table keyed on the receiver class and a
+ * selector, which identifies the name and the descriptor of the function.
+ * A colliding entry simply replaces the previous one.
+ *
+ * @class MegamorphicCache
+ * @ingroup zen_vm_processor
+ * @author Samuel Rowe
+ * @since zen 1.0
+ */
+struct zen_MegamorphicCache_t {
+    zen_MegamorphicCacheEntry_t m_entries[ZEN_MEGAMORPHIC_CACHE_SIZE];
+};
+
+/**
+ * @memberof MegamorphicCache
+ */
+typedef struct zen_MegamorphicCache_t zen_MegamorphicCache_t;
+
+/* Initialize */
+
+/**
+ * @memberof MegamorphicCache
+ */
+void zen_MegamorphicCache_initialize(zen_MegamorphicCache_t* cache);
+
+/* Function */
+
+/**
+ * @memberof MegamorphicCache
+ */
+zen_Function_t* zen_MegamorphicCache_getFunction(zen_MegamorphicCache_t* cache,
+    zen_Class_t* class0, const void* selector);
+
+/**
+ * @memberof MegamorphicCache
+ */
+void zen_MegamorphicCache_putFunction(zen_MegamorphicCache_t* cache,
+    zen_Class_t* class0, const void* selector, zen_Function_t* function);
+
+/*******************************************************************************
+ * OperatorCache                                                               *
+ *******************************************************************************/
+
+/* The number of operand class pairs remembered by an operator call site. */
+#define ZEN_OPERATOR_CACHE_CAPACITY 4
+
+/**
+ * @class OperatorIntrinsic
+ * @ingroup zen_vm_processor
+ * @author Samuel Rowe
+ * @since zen 1.0
+ */
+enum zen_OperatorIntrinsic_t {
+    ZEN_OPERATOR_INTRINSIC_NONE,
+    ZEN_OPERATOR_INTRINSIC_INTEGER,
+    ZEN_OPERATOR_INTRINSIC_STRING
+};
+
+/**
+ * @memberof OperatorIntrinsic
+ */
+typedef enum zen_OperatorIntrinsic_t zen_OperatorIntrinsic_t;
+
+/**
+ * Every `invoke_operator` call site has an operator cache, which remembers
+ * the functions that implement the operator, keyed on the classes of both
+ * the operands.
+ *
+ * The first entry is checked by the interpreter itself. If both the operands
+ * of the first entry are integers or strings, the call site is marked with an
+ * intrinsic. The interpreter evaluates integer operators inline, using the
+ * cached offset of the value field. Strings are compared inline, whereas the
+ * other string operators are handed over to the native function without a
+ * stack frame.
+ *
+ * @class OperatorCache
+ * @ingroup zen_vm_processor
+ * @author Samuel Rowe
+ * @since zen 1.0
+ */
+struct zen_OperatorCache_t {
+    zen_Class_t* m_classes1[ZEN_OPERATOR_CACHE_CAPACITY];
+    zen_Class_t* m_classes2[ZEN_OPERATOR_CACHE_CAPACITY];
+    zen_Function_t* m_functions[ZEN_OPERATOR_CACHE_CAPACITY];
+    int32_t m_size;
+    zen_OperatorIntrinsic_t m_intrinsic;
+    int32_t m_valueOffset;
+};
+
+/**
+ * @memberof OperatorCache
+ */
+typedef struct zen_OperatorCache_t zen_OperatorCache_t;
+
+/* Constructor */
+
+/**
+ * @memberof OperatorCache
+ */
+zen_OperatorCache_t* zen_OperatorCache_new();
+
+/* Destructor */
+
+/**
+ * @memberof OperatorCache
+ */
+void zen_OperatorCache_delete(zen_OperatorCache_t* operatorCache);
+
+/* Add */
+
+/**
+ * Remembers the specified function for the specified pair of operand classes.
+ * If the operator cache is full, it remains unmodified.
+ *
+ * @return `true` if the entry was added; `false` if the cache is full.
+ * @memberof OperatorCache
+ */
+bool zen_OperatorCache_add(zen_OperatorCache_t* operatorCache, zen_Class_t* class1,
+    zen_Class_t* class2, zen_Function_t* function);
+
+/* Function */
+
+/**
+ * @return The remembered function, or `NULL` if the pair of operand classes
+ *         has not been seen at the call site.
+ * @memberof OperatorCache
+ */
+zen_Function_t* zen_OperatorCache_getFunction(zen_OperatorCache_t* operatorCache,
+    zen_Class_t* class1, zen_Class_t* class2);
+
+/* Megamorphic */
+
+/**
+ * @memberof OperatorCache
+ */
+bool zen_OperatorCache_isMegamorphic(zen_OperatorCache_t* operatorCache);
+
+/*******************************************************************************
+ * FieldCache                                                                  *
+ *******************************************************************************/
+
+/**
+ * Every field access site has a field cache. An instance field site
+ * remembers the class of the last instance it accessed and the offset of the
+ * field in that class. The interpreter loads or stores the field directly if
+ * the class of the instance matches, and looks up the field by its name
+ * otherwise. A static field site remembers the address of the field in the
+ * static storage of the declaring class, which never changes once resolved.
+ *
+ * @class FieldCache
+ * @ingroup zen_vm_processor
+ * @author Samuel Rowe
+ * @since zen 1.0
+ */
+struct zen_FieldCache_t {
+    zen_Class_t* m_class;
+    int32_t m_offset;
+    uint8_t* m_address;
+};
+
+/**
+ * @memberof FieldCache
+ */
+typedef struct zen_FieldCache_t zen_FieldCache_t;
+
+/* Constructor */
+
+/**
+ * @memberof FieldCache
+ */
+zen_FieldCache_t* zen_FieldCache_new();
+
+/* Destructor */
+
+/**
+ * @memberof FieldCache
+ */
+void zen_FieldCache_delete(zen_FieldCache_t* fieldCache);
+
+/*******************************************************************************
+ * InlineCacheStatistics                                                       *
+ *******************************************************************************/
+
+/**
+ * @class InlineCacheStatistics
+ * @ingroup zen_vm_processor
+ * @author Samuel Rowe
+ * @since zen 1.0
+ */
+struct zen_InlineCacheStatistics_t {
+    uint64_t m_virtualTableHits;
+    uint64_t m_monomorphicHits;
+    uint64_t m_polymorphicHits;
+    uint64_t m_megamorphicHits;
+    uint64_t m_misses;
+    uint64_t m_operatorIntrinsicHits;
+    uint64_t m_operatorHits;
+    uint64_t m_operatorMisses;
+    /* The native calls evaluated inline by the interpreter. */
+    uint64_t m_intrinsicHits;
+    uint64_t m_fieldHits;
+    uint64_t m_fieldMisses;
+};
+
+/**
+ * @memberof InlineCacheStatistics
+ */
+typedef struct zen_InlineCacheStatistics_t zen_InlineCacheStatistics_t;
+
+#endif /* COM_ONECUBE_ZEN_VIRTUAL_MACHINE_PROCESSOR_INLINE_CACHE_H */
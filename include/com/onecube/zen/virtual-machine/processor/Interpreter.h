@@ -23,9 +23,11 @@
 #include <jtk/core/VariableArguments.h>
 
 #include <com/onecube/zen/Configuration.h>
+#include <com/onecube/zen/virtual-machine/memory/allocator/AllocationBuffer.h>
 #include <com/onecube/zen/virtual-machine/object/Class.h>
 #include <com/onecube/zen/virtual-machine/object/Function.h>
 #include <com/onecube/zen/virtual-machine/object/NativeFunction.h>
+#include <com/onecube/zen/virtual-machine/processor/InlineCache.h>
 #include <com/onecube/zen/virtual-machine/processor/InvocationStack.h>
 #include <com/onecube/zen/virtual-machine/processor/ProcessorThread.h>
 
@@ -54,6 +56,12 @@ struct zen_Interpreter_t {
     uint32_t m_state;
     zen_Object_t* m_exception;
     zen_StackFrame_t* m_handlerStackFrame;
+    zen_MegamorphicCache_t* m_megamorphicCache;
+    zen_InlineCacheStatistics_t m_inlineCacheStatistics;
+    /* The objects created by the interpreter are allocated from its own
+     * allocation buffer.
+     */
+    zen_AllocationBuffer_t m_allocationBuffer;
 };
 
 /**
@@ -95,12 +103,49 @@ void zen_Interpreter_invokeStaticFunctionEx(zen_Interpreter_t* interpreter,
 zen_Object_t* zen_Interpreter_invokeVirtualFunction(zen_Interpreter_t* interpreter,
     zen_Function_t* function, zen_Object_t* object, jtk_Array_t* arguments);
 
+/* Native Handles */
+
+/**
+ * Roots the specified self reference and arguments, which are about to be
+ * passed to a native function.
+ *
+ * @return The number of handles before the references were rooted, which
+ *         should be passed to zen_MemoryManager_popHandles() once the native
+ *         function returns.
+ */
+int32_t zen_Interpreter_pushNativeHandles(zen_Interpreter_t* interpreter,
+    zen_Object_t* self, jtk_Array_t* arguments);
+
+/* Invoke Fast Native Function */
+
+/**
+ * Invokes a native function which follows the fast calling convention. A
+ * stack frame is not pushed on behalf of the native function, therefore, an
+ * exception thrown by it is thrown from the stack frame of the caller. The
+ * self reference and the arguments are rooted for the duration of the
+ * invocation.
+ */
+zen_Object_t* zen_Interpreter_invokeFastNativeFunction(zen_Interpreter_t* interpreter,
+    zen_Function_t* function, zen_Object_t* self, zen_Object_t** arguments);
+
 /* Load Arguments */
 
 void zen_Interpreter_loadArguments(zen_Interpreter_t* interpreter,
     zen_Function_t* function, zen_LocalVariableArray_t* array,
     jtk_Array_t* arguments, bool instance);
 
+/* Unpack Arguments */
+
+/**
+ * Converts the arguments that were handed over from the operand stack of the
+ * caller, where every argument occupies a reference, to the local variables
+ * described by the parameters of the specified function. The conversion is
+ * performed in place. It is required only when a function has parameters
+ * that are not references.
+ */
+void zen_Interpreter_unpackArguments(zen_Interpreter_t* interpreter,
+    zen_Function_t* function, zen_LocalVariableArray_t* array, bool instance);
+
 /* Read */
 
 uint8_t zen_Interpreter_readByte(zen_Interpreter_t* interpreter);
@@ -110,4 +155,140 @@ uint16_t zen_Interpreter_readShort(zen_Interpreter_t* interpreter);
 
 bool zen_Interpreter_throw(zen_Interpreter_t* interpreter, zen_Object_t* exception);
 
+/* Stack Overflow */
+
+/**
+ * Throws a StackOverflowException, when the invocation stack of the specified
+ * interpreter cannot hold another stack frame. If the constructor of the
+ * exception overflows the reserve, too, the exception is thrown without being
+ * constructed.
+ */
+void zen_Interpreter_raiseStackOverflowException(zen_Interpreter_t* interpreter);
+
+/* Virtual Function */
+
+/**
+ * Links the `invoke_virtual` call site, which owns the specified inline cache,
+ * to a slot in the virtual function table. The call site is not linked when
+ * an exception is raised while resolving the function.
+ */
+void zen_Interpreter_linkVirtualCallSite(zen_Interpreter_t* interpreter,
+    zen_StackFrame_t* stackFrame, zen_InlineCache_t* inlineCache, int32_t index);
+
+/**
+ * Looks up the function invoked by the `invoke_virtual` instruction at the
+ * specified offset in the current function, when the receiver class missed the
+ * monomorphic entry of the inline cache of the call site.
+ */
+zen_Function_t* zen_Interpreter_lookupVirtualFunction(zen_Interpreter_t* interpreter,
+    zen_StackFrame_t* stackFrame, zen_InlineCache_t* inlineCache,
+    zen_Class_t* selfClass, int32_t index);
+
+/* Literal */
+
+/**
+ * Materializes the literal object denoted by the constant pool entry at the
+ * specified index, and remembers it in the resolved entries of the specified
+ * class. The literal objects are shared by all the executions of `load_cpr`
+ * and `load_literal` instructions that refer to the entry.
+ */
+zen_Object_t* zen_Interpreter_resolveLiteral(zen_Interpreter_t* interpreter,
+    zen_Class_t* class0, int32_t index);
+
+/* Operator */
+
+/**
+ * Evaluates the specified operator on the values of two integers. The result
+ * is an instance of the Integer class for arithmetic operators, and an
+ * instance of the Boolean class for relational operators.
+ */
+zen_Object_t* zen_Interpreter_evaluateIntegerOperator(zen_Interpreter_t* interpreter,
+    int32_t operator0, int64_t value1, int64_t value2);
+
+/* Intrinsic */
+
+/**
+ * Evaluates the intrinsic of the specified native function inline, if the
+ * self reference and the arguments are instances of the class that declares
+ * the function.
+ *
+ * @return `true` if the intrinsic was evaluated and the result was stored;
+ *         `false` if the native function should be invoked instead.
+ */
+bool zen_Interpreter_evaluateIntrinsic(zen_Interpreter_t* interpreter,
+    zen_Function_t* function, zen_Object_t* self, zen_Object_t** arguments,
+    zen_Object_t** result);
+
+/**
+ * Looks up the function that implements the operator of an `invoke_operator`
+ * call site, when the operand classes missed the first entry of its operator
+ * cache.
+ */
+zen_Function_t* zen_Interpreter_lookupOperatorFunction(zen_Interpreter_t* interpreter,
+    zen_OperatorCache_t* operatorCache, int32_t operator0, zen_Class_t* class1,
+    zen_Class_t* class2);
+
+/**
+ * Marks the specified operator cache with an intrinsic, if the function that
+ * implements the operator for the operands of the specified class is
+ * understood by the interpreter.
+ */
+void zen_Interpreter_linkOperatorIntrinsic(zen_Interpreter_t* interpreter,
+    zen_OperatorCache_t* operatorCache, zen_Class_t* class0, zen_Function_t* function);
+
+/* Field */
+
+/**
+ * Looks up the instance field referred by the constant pool entry at the
+ * specified index in the class of the specified instance, and remembers its
+ * offset in the field cache of the access site.
+ *
+ * @return `true` if the field was found; otherwise, `false`, in which case an
+ *         exception is raised.
+ */
+bool zen_Interpreter_linkInstanceField(zen_Interpreter_t* interpreter,
+    zen_StackFrame_t* stackFrame, zen_FieldCache_t* fieldCache, zen_Object_t* self,
+    int32_t index);
+
+/**
+ * Loads an instance field on behalf of a `load_instance_field` site, whose
+ * field cache was missed by the class of the instance.
+ *
+ * @return `true` if the field was loaded; otherwise, `false`, in which case an
+ *         exception is raised.
+ */
+bool zen_Interpreter_loadInstanceField(zen_Interpreter_t* interpreter,
+    zen_StackFrame_t* stackFrame, zen_FieldCache_t* fieldCache, zen_Object_t* self,
+    int32_t index, uintptr_t* value);
+
+/**
+ * Stores an instance field on behalf of a `store_instance_field` site, whose
+ * field cache was missed by the class of the instance.
+ *
+ * @return `true` if the field was stored; otherwise, `false`, in which case an
+ *         exception is raised.
+ */
+bool zen_Interpreter_storeInstanceField(zen_Interpreter_t* interpreter,
+    zen_StackFrame_t* stackFrame, zen_FieldCache_t* fieldCache, zen_Object_t* self,
+    int32_t index, uintptr_t value);
+
+/**
+ * Resolves the static field referred by the constant pool entry at the
+ * specified index, and remembers its address in the field cache of the
+ * access site.
+ *
+ * @return `true` if the field was resolved; otherwise, `false`, in which case
+ *         an exception is raised.
+ */
+bool zen_Interpreter_linkStaticField(zen_Interpreter_t* interpreter,
+    zen_StackFrame_t* stackFrame, zen_FieldCache_t* fieldCache, int32_t index);
+
+/* Statistics */
+
+/**
+ * Prints the statistics collected by the specified interpreter to the
+ * standard output stream.
+ */
+void zen_Interpreter_printStatistics(zen_Interpreter_t* interpreter);
+
 #endif /* COM_ONECUBE_ZEN_VIRTUAL_MACHINE_PROCESSOR_INTERPRETER_H */
\ No newline at end of file
@@ -0,0 +1,107 @@
+/*
+ * Copyright 2018-2020 Samuel Rowe
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Sunday, November 15, 2020
+
+#ifndef COM_ONECUBE_ZEN_VIRTUAL_MACHINE_PROCESSOR_INTRINSIC_H
+#define COM_ONECUBE_ZEN_VIRTUAL_MACHINE_PROCESSOR_INTRINSIC_H
+
+#include <com/onecube/zen/Configuration.h>
+
+/*******************************************************************************
+ * Intrinsic                                                                   *
+ *******************************************************************************/
+
+/**
+ * The native functions of the core classes which the interpreter evaluates
+ * inline, without invoking them. An intrinsic applies only when the operands
+ * are instances of the class that declares the native function. Otherwise,
+ * the native function is invoked as usual.
+ *
+ * @class Intrinsic
+ * @ingroup zen_vm_processor
+ * @author Samuel Rowe
+ * @since zen 1.0
+ */
+enum zen_Intrinsic_t {
+    ZEN_INTRINSIC_NONE,
+    /* An arithmetic or relational operator of the Integer class. */
+    ZEN_INTRINSIC_INTEGER,
+    /* An equality operator of the String class. */
+    ZEN_INTRINSIC_STRING,
+    /* The Boolean.getValue() function. */
+    ZEN_INTRINSIC_BOOLEAN_GET_VALUE
+};
+
+/**
+ * @memberof Intrinsic
+ */
+typedef enum zen_Intrinsic_t zen_Intrinsic_t;
+
+/*******************************************************************************
+ * IntrinsicEntry                                                              *
+ *******************************************************************************/
+
+/* Initializes an entry of the intrinsic table. The arguments should be string
+ * literals, so that their sizes are computed at compile time.
+ */
+#define ZEN_INTRINSIC_ENTRY(className, name, descriptor, intrinsic, operator0) \
+    { \
+        (const uint8_t*)(className), sizeof (className) - 1, \
+        (const uint8_t*)(name), sizeof (name) - 1, \
+        (const uint8_t*)(descriptor), sizeof (descriptor) - 1, \
+        (intrinsic), (operator0) \
+    }
+
+/**
+ * @class IntrinsicEntry
+ * @ingroup zen_vm_processor
+ * @author Samuel Rowe
+ * @since zen 1.0
+ */
+struct zen_IntrinsicEntry_t {
+    const uint8_t* m_className;
+    int32_t m_classNameSize;
+    const uint8_t* m_name;
+    int32_t m_nameSize;
+    const uint8_t* m_descriptor;
+    int32_t m_descriptorSize;
+    zen_Intrinsic_t m_intrinsic;
+    /* The operator evaluated by the intrinsic, or -1 if the intrinsic is not
+     * an operator.
+     */
+    int32_t m_operator;
+};
+
+/**
+ * @memberof IntrinsicEntry
+ */
+typedef struct zen_IntrinsicEntry_t zen_IntrinsicEntry_t;
+
+/* Find */
+
+/**
+ * Finds the intrinsic which replaces the specified native function.
+ *
+ * @return The entry of the intrinsic table, or `NULL` if the native function
+ *         is not an intrinsic.
+ * @memberof Intrinsic
+ */
+const zen_IntrinsicEntry_t* zen_Intrinsic_find(const uint8_t* className,
+    int32_t classNameSize, const uint8_t* name, int32_t nameSize,
+    const uint8_t* descriptor, int32_t descriptorSize);
+
+#endif /* COM_ONECUBE_ZEN_VIRTUAL_MACHINE_PROCESSOR_INTRINSIC_H */
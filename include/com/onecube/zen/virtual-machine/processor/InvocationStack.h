@@ -31,17 +31,47 @@
  * InvocationStack                                                             *
  *******************************************************************************/
 
+/* The maximum number of nested invocations on a thread. */
+#define ZEN_INVOCATION_STACK_DEFAULT_FRAME_CAPACITY 8192
+
+/* The number of 32-bit slots reserved for the local variable arrays and the
+ * operand stacks of a thread, that is, 1 MB.
+ */
+#define ZEN_INVOCATION_STACK_DEFAULT_SLOT_CAPACITY (256 * 1024)
+
+/* The number of stack frames and slots at the end of the invocation stack,
+ * which are set aside for creating a StackOverflowException and for the
+ * invocations made by native code.
+ */
+#define ZEN_INVOCATION_STACK_RESERVED_FRAME_COUNT 64
+#define ZEN_INVOCATION_STACK_RESERVED_SLOT_COUNT (16 * 1024)
+
 /**
+ * The invocation stack reserves memory for its stack frames and their slots
+ * once, when it is created. Pushing and popping a stack frame does not
+ * allocate.
+ *
+ * The local variable array of a stack frame begins where the operand stack
+ * of the previous stack frame ends. When the arguments are already on the
+ * operand stack of the caller, the local variable array of the callee
+ * overlaps them. Therefore, the arguments are never copied.
+ *
  * @class InvocationStack
  * @ingroup zen_vm_processor
  * @author Samuel Rowe
  * @since zen 1.0
  */
 struct zen_InvocationStack_t {
-    // TODO: Replace this with a singly-linked list.
-    jtk_DoublyLinkedList_t* m_stackFrames;
+    zen_StackFrame_t* m_stackFrames;
+    int32_t m_size;
+    int32_t m_capacity;
+    int32_t* m_slots;
+    int32_t m_slotCapacity;
+    /* The functions whose stack frames were popped while tracing. */
     jtk_DoublyLinkedList_t* m_trace;
     bool m_tracing;
+    /* Determines whether the invocation instructions may use the reserve. */
+    bool m_reserveEnabled;
 };
 
 /**
@@ -67,18 +97,53 @@ void zen_InvocationStack_delete(zen_InvocationStack_t* stack);
 
 bool zen_InvocationStack_isEmpty(zen_InvocationStack_t* invocationStack);
 
-/* Iterator */
+/* Reserve */
+
+/**
+ * Allows the invocation instructions to use the reserve, while an exception
+ * that reports an overflow is being created.
+ *
+ * @memberof InvocationStack
+ */
+void zen_InvocationStack_enableReserve(zen_InvocationStack_t* invocationStack);
+
+/**
+ * @memberof InvocationStack
+ */
+void zen_InvocationStack_disableReserve(zen_InvocationStack_t* invocationStack);
 
-jtk_Iterator_t* zen_InvocationStack_getIterator(zen_InvocationStack_t* invocationStack);
+/**
+ * @memberof InvocationStack
+ */
+bool zen_InvocationStack_isReserveEnabled(zen_InvocationStack_t* invocationStack);
 
 /* Stack Frame */
 
 /**
+ * Pushes a stack frame on behalf of native code, which may use the reserve.
+ *
+ * @return The new stack frame, or null if it does not fit even within the
+ *         reserve. In the latter case, the caller should raise a
+ *         StackOverflowException.
  * @memberof InvocationStack
  */
 zen_StackFrame_t* zen_InvocationStack_pushStackFrame(zen_InvocationStack_t* invocationStack,
     zen_Function_t* function);
 
+/**
+ * Pushes a stack frame whose local variable array overlaps the specified
+ * number of slots on top of the operand stack of the current stack frame.
+ * The slots are removed from the operand stack of the current stack frame
+ * and become the first local variables of the new stack frame.
+ *
+ * @return The new stack frame, or null if it does not fit outside the
+ *         reserve. In the latter case, the operand stack of the current stack
+ *         frame is left intact.
+ * @memberof InvocationStack
+ */
+zen_StackFrame_t* zen_InvocationStack_pushStackFrameEx(zen_InvocationStack_t* invocationStack,
+    zen_Function_t* function, int32_t argumentSlotCount);
+
 /**
  * @memberof InvocationStack
  */
@@ -89,6 +154,15 @@ void zen_InvocationStack_popStackFrame(zen_InvocationStack_t* stack);
  */
 zen_StackFrame_t* zen_InvocationStack_peekStackFrame(zen_InvocationStack_t* stack);
 
+/**
+ * Returns the stack frame at the specified depth. The bottom most stack frame
+ * is at index 0.
+ *
+ * @memberof InvocationStack
+ */
+zen_StackFrame_t* zen_InvocationStack_getStackFrame(zen_InvocationStack_t* stack,
+    int32_t index);
+
 /* Size */
 
 int32_t zen_InvocationStack_getSize(zen_InvocationStack_t* invocationStack);
@@ -62,6 +62,19 @@ zen_LocalVariableArray_t* zen_LocalVariableArray_new(int32_t size);
  */
 void zen_LocalVariableArray_delete(zen_LocalVariableArray_t* array);
 
+/* Initialize */
+
+/**
+ * Initializes a local variable array which uses the specified storage instead
+ * of allocating its own. The storage is owned by the caller and is not
+ * cleared. Therefore, a local variable array initialized this way should not
+ * be destroyed with zen_LocalVariableArray_delete().
+ *
+ * @memberof LocalVariableArray
+ */
+void zen_LocalVariableArray_initialize(zen_LocalVariableArray_t* array, int32_t* values,
+    int32_t size);
+
 /* Integer Value */
 
 /**
@@ -57,6 +57,19 @@ zen_OperandStack_t* zen_OperandStack_new(int32_t capacity);
  */
 void zen_OperandStack_delete(zen_OperandStack_t* operandStack);
 
+/* Initialize */
+
+/**
+ * Initializes an operand stack which uses the specified storage instead of
+ * allocating its own. The storage is owned by the caller. Therefore, an
+ * operand stack initialized this way should not be destroyed with
+ * zen_OperandStack_delete().
+ *
+ * @memberof OperandStack
+ */
+void zen_OperandStack_initialize(zen_OperandStack_t* operandStack, int32_t* values,
+    int32_t capacity);
+
 /* Available */
 
 /**
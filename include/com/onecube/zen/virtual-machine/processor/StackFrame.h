@@ -30,39 +30,63 @@
  * StackFrame                                                                  *
  *******************************************************************************/
 
+/* The operand stack size assumed for functions whose instruction attribute
+ * does not specify one. Native functions do not have an instruction attribute.
+ * Their operand stack only holds the values returned by the functions they
+ * invoke.
+ */
+#define ZEN_STACK_FRAME_DEFAULT_MAX_STACK_SIZE 10
+
 /**
  * @memberof StackFrame
  */
 typedef struct zen_StackFrame_t zen_StackFrame_t;
 
 /**
+ * A stack frame does not own any memory. Stack frames are stored contiguously
+ * by the invocation stack, and the local variable array and the operand stack
+ * of each stack frame are carved out of the slots that the invocation stack
+ * reserves for its thread.
+ *
  * @class StackFrame
  * @ingroup zen_vm_processor
  * @author Samuel Rowe
  * @since zen 1.0
  */
 struct zen_StackFrame_t {
-    zen_OperandStack_t* m_operandStack;
-    zen_LocalVariableArray_t* m_localVariableArray;
+    zen_OperandStack_t m_operandStack;
+    zen_LocalVariableArray_t m_localVariableArray;
     zen_Class_t* m_class;
     zen_Function_t* m_function;
     zen_InstructionAttribute_t* m_instructionAttribute;
     int32_t m_ip;
 };
 
-/* Constructor */
+/* Initialize */
 
 /**
+ * Initializes the specified stack frame for an invocation of the specified
+ * function. The local variable array begins at the specified slot and the
+ * operand stack immediately follows it. The sizes are taken from the
+ * instruction attribute of the function.
+ *
+ * The first argumentSlotCount slots already hold the arguments of the
+ * function. The local variable array is never smaller than the arguments.
+ *
  * @memberof StackFrame
  */
-zen_StackFrame_t* zen_StackFrame_new(zen_Function_t* function);
+void zen_StackFrame_initialize(zen_StackFrame_t* frame, zen_Function_t* function,
+    int32_t* slots, int32_t argumentSlotCount);
 
-/* Destructor */
+/* Slot Count */
 
 /**
+ * Returns the number of slots occupied by the local variable array and the
+ * operand stack of the specified stack frame.
+ *
  * @memberof StackFrame
  */
-void zen_StackFrame_delete(zen_StackFrame_t* frame);
+int32_t zen_StackFrame_getSlotCount(zen_StackFrame_t* frame);
 
 /* Class */
 
@@ -15,6 +15,7 @@
  */
 
 #include <stdio.h>
+#include <stdlib.h>
 
 #include <com/onecube/zen/virtual-machine/VirtualMachine.h>
 #include <com/onecube/zen/virtual-machine/VirtualMachineConfiguration.h>
@@ -116,6 +117,97 @@ int32_t zen_ZenVirtualMachine_main(char** arguments, int32_t length) {
                         invalidCommandLine = true;
                     }
                 }
+                else if (strcmp(arguments[i], "--stats") == 0) {
+                    configuration->m_printStatistics = true;
+                }
+                else if (strcmp(arguments[i], "--heap-budget") == 0) {
+                    if ((i + 1) < length) {
+                        i++;
+                        int32_t megabytes = atoi(arguments[i]);
+                        if (megabytes > 0) {
+                            configuration->m_heapBudget = (uint64_t)megabytes * 1024 * 1024;
+                        }
+                        else {
+                            printf("[error] Invalid heap budget '%s'\n", arguments[i]);
+                            invalidCommandLine = true;
+                        }
+                    }
+                    else {
+                        printf("[error] The `--heap-budget` flag expects argument specifying the heap budget in megabytes.");
+                        invalidCommandLine = true;
+                    }
+                }
+                else if (strcmp(arguments[i], "--nursery-size") == 0) {
+                    if ((i + 1) < length) {
+                        i++;
+                        int32_t megabytes = atoi(arguments[i]);
+                        if (megabytes > 0) {
+                            configuration->m_nurserySize = (uint64_t)megabytes * 1024 * 1024;
+                        }
+                        else {
+                            printf("[error] Invalid nursery size '%s'\n", arguments[i]);
+                            invalidCommandLine = true;
+                        }
+                    }
+                    else {
+                        printf("[error] The `--nursery-size` flag expects argument specifying the size of the new generation in megabytes.");
+                        invalidCommandLine = true;
+                    }
+                }
+                else if (strcmp(arguments[i], "--gc-threads") == 0) {
+                    if ((i + 1) < length) {
+                        i++;
+                        int32_t count = atoi(arguments[i]);
+                        if (count > 0) {
+                            configuration->m_garbageCollectorThreadCount = count;
+                        }
+                        else {
+                            printf("[error] Invalid number of garbage collector threads '%s'\n", arguments[i]);
+                            invalidCommandLine = true;
+                        }
+                    }
+                    else {
+                        printf("[error] The `--gc-threads` flag expects argument specifying the number of threads that collect the old generation.");
+                        invalidCommandLine = true;
+                    }
+                }
+                else if (strcmp(arguments[i], "--max-pause") == 0) {
+                    if ((i + 1) < length) {
+                        i++;
+                        int32_t milliseconds = atoi(arguments[i]);
+                        if (milliseconds > 0) {
+                            configuration->m_maximumPauseTime = milliseconds;
+                        }
+                        else {
+                            printf("[error] Invalid maximum pause time '%s'\n", arguments[i]);
+                            invalidCommandLine = true;
+                        }
+                    }
+                    else {
+                        printf("[error] The `--max-pause` flag expects argument specifying the maximum pause time of the garbage collector in milliseconds.");
+                        invalidCommandLine = true;
+                    }
+                }
+                else if (strcmp(arguments[i], "--max-heap-size") == 0) {
+                    if ((i + 1) < length) {
+                        i++;
+                        int32_t megabytes = atoi(arguments[i]);
+                        if (megabytes > 0) {
+                            configuration->m_maximumHeapSize = (uint64_t)megabytes * 1024 * 1024;
+                        }
+                        else {
+                            printf("[error] Invalid maximum heap size '%s'\n", arguments[i]);
+                            invalidCommandLine = true;
+                        }
+                    }
+                    else {
+                        printf("[error] The `--max-heap-size` flag expects argument specifying the maximum size of the heap in megabytes.");
+                        invalidCommandLine = true;
+                    }
+                }
+                else if (strcmp(arguments[i], "--huge-pages") == 0) {
+                    configuration->m_hugePages = true;
+                }
             }
             else {
                 mainClassDescriptor = arguments[i];
@@ -206,6 +298,11 @@ int32_t zen_ZenVirtualMachine_main(char** arguments, int32_t length) {
             printf("[debug] An exception was thrown.\n");
         }
 
+        if (configuration->m_printStatistics) {
+            zen_Interpreter_printStatistics(virtualMachine->m_interpreter);
+            zen_MemoryManager_printStatistics(virtualMachine->m_memoryManager);
+        }
+
         /* Wait for other threds to complete and tear down the virtual machine. */
         zen_VirtualMachine_shutDown(virtualMachine);
 
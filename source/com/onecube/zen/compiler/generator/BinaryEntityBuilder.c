@@ -1558,6 +1558,17 @@ void zen_BinaryEntityBuilder_emitInvokeStatic(zen_BinaryEntityBuilder_t* builder
     channel->m_bytes[channel->m_index++] = (index & 0x000000FF);
 }
 
+void zen_BinaryEntityBuilder_emitInvokeOperator(zen_BinaryEntityBuilder_t* builder, uint8_t operator0) {
+    jtk_Assert_assertObject(builder, "The specified builder is null.");
+    jtk_Assert_assertTrue(builder->m_activeChannelIndex >= 0, "Please activate a channel before emitting instructions.");
+
+    zen_DataChannel_t* channel = (zen_DataChannel_t*)jtk_ArrayList_getValue(builder->m_channels, builder->m_activeChannelIndex);
+    zen_DataChannel_requestCapacity(channel, 2);
+
+    channel->m_bytes[channel->m_index++] = ZEN_BYTE_CODE_INVOKE_OPERATOR; // Byte Code
+    channel->m_bytes[channel->m_index++] = operator0; // Operator
+}
+
 /* Jump */
 
 void zen_BinaryEntityBuilder_emitJump(zen_BinaryEntityBuilder_t* builder, uint16_t index) {
@@ -2022,6 +2033,18 @@ void zen_BinaryEntityBuilder_emitWideLoadCPR(zen_BinaryEntityBuilder_t* builder,
     channel->m_bytes[channel->m_index++] = (index & 0x000000FF);
 }
 
+void zen_BinaryEntityBuilder_emitLoadLiteral(zen_BinaryEntityBuilder_t* builder, uint16_t index) {
+    jtk_Assert_assertObject(builder, "The specified builder is null.");
+    jtk_Assert_assertTrue(builder->m_activeChannelIndex >= 0, "Please activate a channel before emitting instructions.");
+
+    zen_DataChannel_t* channel = (zen_DataChannel_t*)jtk_ArrayList_getValue(builder->m_channels, builder->m_activeChannelIndex);
+    zen_DataChannel_requestCapacity(channel, 3);
+
+    channel->m_bytes[channel->m_index++] = ZEN_BYTE_CODE_LOAD_LITERAL; // Byte Code
+    channel->m_bytes[channel->m_index++] = (index & 0x0000FF00) >> 8; // Index
+    channel->m_bytes[channel->m_index++] = (index & 0x000000FF);
+}
+
 void zen_BinaryEntityBuilder_emitLoadArraySize(zen_BinaryEntityBuilder_t* builder) {
     jtk_Assert_assertObject(builder, "The specified builder is null.");
     jtk_Assert_assertTrue(builder->m_activeChannelIndex >= 0, "Please activate a channel before emitting instructions.");
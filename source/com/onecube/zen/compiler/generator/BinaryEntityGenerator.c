@@ -37,6 +37,7 @@
 #include <com/onecube/zen/compiler/symbol-table/Scope.h>
 #include <com/onecube/zen/compiler/generator/BinaryEntityGenerator.h>
 #include <com/onecube/zen/virtual-machine/feb/EntityType.h>
+#include <com/onecube/zen/virtual-machine/feb/Operator.h>
 #include <com/onecube/zen/virtual-machine/feb/attribute/InstructionAttribute.h>
 #include <com/onecube/zen/virtual-machine/feb/attribute/PredefinedAttribute.h>
 
@@ -45,13 +46,11 @@ bool lhs = false;
 
 // Initialize
 
-#define ZEN_BINARY_ENTITY_GENERATOR_CPF_COUNT 6
+#define ZEN_BINARY_ENTITY_GENERATOR_CPF_COUNT 4
 #define ZEN_BINARY_ENTITY_GENERATOR_BOOLEAN_GET_VALUE 0
 #define ZEN_BINARY_ENTITY_GENERATOR_ZEN_KERNEL_EVALUATE 1
-#define ZEN_BINARY_ENTITY_GENERATOR_ZEN_KERNEL_STORE_FIELD 2
-#define ZEN_BINARY_ENTITY_GENERATOR_ZEN_KERNEL_INVOKE 3
-#define ZEN_BINARY_ENTITY_GENERATOR_ZEN_KERNEL_INVOKE_EX 4
-#define ZEN_BINARY_ENTITY_GENERATOR_ZEN_KERNEL_LOAD_FIELD 5
+#define ZEN_BINARY_ENTITY_GENERATOR_ZEN_KERNEL_INVOKE 2
+#define ZEN_BINARY_ENTITY_GENERATOR_ZEN_KERNEL_INVOKE_EX 3
 
 uint16_t zen_Symbol_findFunctionIndex(zen_ConstantPoolBuilder_t* builder,
     zen_Symbol_t* symbol,
@@ -96,18 +95,12 @@ void zen_BinaryEntityGenerator_initializeCPFCache(zen_BinaryEntityGenerator_t* g
     generator->m_cpfIndexes[ZEN_BINARY_ENTITY_GENERATOR_ZEN_KERNEL_EVALUATE] =
         zen_Symbol_findFunctionIndex(generator->m_constantPoolBuilder,
             zenKernelClass, "evaluate", 8, "(zen/core/Object):(zen/core/Object)(zen/core/Object)(zen/core/Object)", 69);
-    generator->m_cpfIndexes[ZEN_BINARY_ENTITY_GENERATOR_ZEN_KERNEL_STORE_FIELD] =
-        zen_Symbol_findFunctionIndex(generator->m_constantPoolBuilder,
-            zenKernelClass, "storeField", 10, "(zen/core/Object):(zen/core/Object)(zen/core/Object)(zen/core/Object)", 69);
     generator->m_cpfIndexes[ZEN_BINARY_ENTITY_GENERATOR_ZEN_KERNEL_INVOKE] =
         zen_Symbol_findFunctionIndex(generator->m_constantPoolBuilder,
             zenKernelClass, "invoke", 6, "(zen/core/Object):(zen/core/Object)(zen/core/Object)", 52);
     generator->m_cpfIndexes[ZEN_BINARY_ENTITY_GENERATOR_ZEN_KERNEL_INVOKE_EX] =
         zen_Symbol_findFunctionIndex(generator->m_constantPoolBuilder,
             zenKernelClass, "invokeEx", 8, "(zen/core/Object):(zen/core/Object)(zen/core/Object)@(zen/core/Object)", 70);
-    generator->m_cpfIndexes[ZEN_BINARY_ENTITY_GENERATOR_ZEN_KERNEL_LOAD_FIELD] =
-        zen_Symbol_findFunctionIndex(generator->m_constantPoolBuilder,
-            zenKernelClass, "loadField", 9, "(zen/core/Object):(zen/core/Object)(zen/core/Object)", 52);
 }
 
 // Constructor
@@ -1302,6 +1295,15 @@ void zen_BinaryEntityGenerator_onExitEmptyStatement(zen_ASTListener_t* astListen
 
 // variableDeclaration
 
+/* Static fields are flagged like static functions. The remaining modifiers
+ * are not recorded in the binary entity.
+ */
+static uint16_t zen_BinaryEntityGenerator_getFieldFlags(zen_Scope_t* classScope,
+    zen_Token_t* identifierToken) {
+    zen_Symbol_t* fieldSymbol = zen_Scope_resolve(classScope, identifierToken->m_text);
+    return (uint16_t)(fieldSymbol->m_modifiers & ZEN_MODIFIER_STATIC);
+}
+
 void zen_BinaryEntityGenerator_onEnterVariableDeclaration(zen_ASTListener_t* astListener, zen_ASTNode_t* node) {
     /* Retrieve the generator associated with the AST listener. */
     zen_BinaryEntityGenerator_t* generator = (zen_BinaryEntityGenerator_t*)astListener->m_context;
@@ -1331,7 +1333,8 @@ void zen_BinaryEntityGenerator_onEnterVariableDeclaration(zen_ASTListener_t* ast
          * a class member declaration.
          */
         if (zen_Scope_isClassScope(currentScope)) {
-            uint16_t flags = 0;
+            uint16_t flags = zen_BinaryEntityGenerator_getFieldFlags(currentScope,
+                identifierToken);
 
             /* Retrieve the constant pool index for the variable name. */
             uint16_t nameIndex = zen_ConstantPoolBuilder_getUtf8EntryIndexEx(
@@ -1450,7 +1453,8 @@ void zen_BinaryEntityGenerator_onEnterConstantDeclaration(zen_ASTListener_t* ast
          * a class member declaration.
          */
         if (zen_Scope_isClassScope(currentScope)) {
-            uint16_t flags = 0;
+            uint16_t flags = zen_BinaryEntityGenerator_getFieldFlags(currentScope,
+                identifierToken);
 
             /* Retrieve the constant pool index for the variable name. */
             uint16_t nameIndex = zen_ConstantPoolBuilder_getUtf8EntryIndexEx(
@@ -4797,22 +4801,33 @@ void zen_BinaryEntityGenerator_invokeEvaluate(zen_BinaryEntityGenerator_t* gener
     /* Retrieve the logger from the compiler. */
     jtk_Logger_t* logger = generator->m_compiler->m_logger;
 
-    // ZenKernel.evaluate(Object operand, String symbol)
-    // ZenKernel.evaluate(Object operand1, Object operand2, String symbol)
+    /* The binary operators known to the virtual machine are encoded in the
+     * invoke_operator instruction. This saves the interpreter from loading
+     * and matching the symbol every time the expression is evaluated.
+     */
+    int32_t operator0 = zen_Operator_fromSymbol(symbol, symbolSize);
+    if (operator0 >= 0) {
+        zen_BinaryEntityBuilder_emitInvokeOperator(generator->m_builder, (uint8_t)operator0);
+        jtk_Logger_debug(logger, "Emitted invoke_operator %d", operator0);
+    }
+    else {
+        // ZenKernel.evaluate(Object operand, String symbol)
+        // ZenKernel.evaluate(Object operand1, Object operand2, String symbol)
 
-    uint16_t symbolIndex = zen_ConstantPoolBuilder_getStringEntryIndexEx(
-        generator->m_constantPoolBuilder, symbol, symbolSize);
-    zen_BinaryEntityBuilder_emitLoadCPR(generator->m_builder, symbolIndex);
-    jtk_Logger_debug(logger, "Emitted load_cpr %d", symbolIndex);
+        uint16_t symbolIndex = zen_ConstantPoolBuilder_getStringEntryIndexEx(
+            generator->m_constantPoolBuilder, symbol, symbolSize);
+        zen_BinaryEntityBuilder_emitLoadCPR(generator->m_builder, symbolIndex);
+        jtk_Logger_debug(logger, "Emitted load_cpr %d", symbolIndex);
 
-    uint16_t evaluateIndex = generator->m_cpfIndexes[ZEN_BINARY_ENTITY_GENERATOR_ZEN_KERNEL_EVALUATE];
+        uint16_t evaluateIndex = generator->m_cpfIndexes[ZEN_BINARY_ENTITY_GENERATOR_ZEN_KERNEL_EVALUATE];
 
-    /* Invoke the static function to evaluate the expression. */
-    zen_BinaryEntityBuilder_emitInvokeStatic(generator->m_builder,
-        evaluateIndex);
+        /* Invoke the static function to evaluate the expression. */
+        zen_BinaryEntityBuilder_emitInvokeStatic(generator->m_builder,
+            evaluateIndex);
 
-    /* Log the emission of the invoke_static instruction. */
-    jtk_Logger_debug(logger, "Emitted invoke_static %d", evaluateIndex);
+        /* Log the emission of the invoke_static instruction. */
+        jtk_Logger_debug(logger, "Emitted invoke_static %d", evaluateIndex);
+    }
 }
 
 int64_t zen_Long_convert(const uint8_t* text, int32_t length, int32_t radix) {
@@ -5162,16 +5177,8 @@ void zen_BinaryEntityGenerator_loadInteger(zen_BinaryEntityGenerator_t* generato
 
 void zen_BinaryEntityGenerator_handleIntegerLiteral(zen_BinaryEntityGenerator_t* generator,
     zen_Token_t* token) {
-    const uint8_t* integerClassName = "zen/core/Integer";
-    int32_t integerClassNameSize = 16;
-    uint16_t integerClassIndex = zen_ConstantPoolBuilder_getClassEntryIndexEx(
-        generator->m_constantPoolBuilder, integerClassName,
-        integerClassNameSize);
-
-    /* Emit the new instruction. */
-    zen_BinaryEntityBuilder_emitNew(generator->m_builder, integerClassIndex);
-    /* Emit the duplicate instruction. */
-    zen_BinaryEntityBuilder_emitDuplicate(generator->m_builder);
+    /* Retrieve the logger from the compiler. */
+    jtk_Logger_t* logger = generator->m_compiler->m_logger;
 
     uint8_t* integerText = zen_Token_getText(token);
     int32_t actualIntegerLength = zen_Token_getLength(token);
@@ -5210,28 +5217,20 @@ void zen_BinaryEntityGenerator_handleIntegerLiteral(zen_BinaryEntityGenerator_t*
 
     int64_t value = zen_Long_convert(integerText, integerLength, radix);
 
-    // if (longLiteral) {
-        zen_BinaryEntityGenerator_loadLong(generator, value);
-    // }
-    // else {
-        // zen_BinaryEntityGenerator_loadInteger(generator, value);
-    // }
+    /* Integer literals are not constructed with the new and invoke_special
+     * instructions. Instead, the value is stored in the constant pool and
+     * the virtual machine materializes the integer object when the
+     * load_literal instruction is executed for the first time. Subsequent
+     * executions reuse the same object.
+     */
+    uint16_t longIndex = zen_ConstantPoolBuilder_getLongEntryIndex(
+        generator->m_constantPoolBuilder, value);
 
-    // TODO: Implement integer interning.
+    /* Emit the load_literal instruction. */
+    zen_BinaryEntityBuilder_emitLoadLiteral(generator->m_builder, longIndex);
 
-    const uint8_t* constructorName = "<initialize>";
-    int32_t constructorNameSize = 12;
-    // const uint8_t* constructorDescriptor = "v:i";
-    const uint8_t* constructorDescriptor = "v:(zen/core/Object)";
-    int32_t constructorDescriptorSize = 19;
-    uint16_t constructorIndex = zen_ConstantPoolBuilder_getFunctionEntryIndexEx(
-        generator->m_constantPoolBuilder, integerClassName,
-        integerClassNameSize, constructorDescriptor, constructorDescriptorSize,
-        constructorName, constructorNameSize, 0);
-
-    /* Invoke the constructor to initialize the new integer instance. */
-    zen_BinaryEntityBuilder_emitInvokeSpecial(generator->m_builder,
-        constructorIndex);
+    /* Log the emission of the instruction. */
+    jtk_Logger_debug(logger, "Emitted load_literal %d", longIndex);
 }
 
 void zen_BinaryEntityGenerator_handleStringLiteral(zen_BinaryEntityGenerator_t* generator,
@@ -5503,11 +5502,6 @@ void zen_BinaryEntityGenerator_handleDynamicAccess(zen_BinaryEntityGenerator_t*
     zen_ASTNode_t* identifier = memberAccessContext->m_identifier;
     zen_Token_t* identifierToken = (zen_Token_t*)identifier->m_context;
 
-    /* The name of the function/field to invoke/load. */
-    int32_t targetNameIndex = zen_ConstantPoolBuilder_getStringEntryIndexEx(
-        generator->m_constantPoolBuilder, identifierToken->m_text,
-        identifierToken->m_length);
-
     int32_t postfixPartCount = jtk_ArrayList_getSize(postfixParts);
     int32_t previousIndex = *index;
     if ((*index + 1) < postfixPartCount) {
@@ -5544,21 +5538,24 @@ void zen_BinaryEntityGenerator_handleDynamicAccess(zen_BinaryEntityGenerator_t*
      * reference.
      */
     if (previousIndex != *index) {
-        /* Push the name of the target function on the operand stack. */
-        zen_BinaryEntityBuilder_emitLoadCPR(generator->m_builder,
-            targetNameIndex);
+        /* The class of the parent is unknown at compile time. Therefore, the
+         * field reference names the Object class, and the interpreter looks
+         * up the field in the class of the instance.
+         */
+        uint16_t fieldIndex = zen_ConstantPoolBuilder_getFieldEntryIndexEx(
+            generator->m_constantPoolBuilder, "zen/core/Object", 15,
+            "(zen/core/Object)", 17, identifierToken->m_text,
+            identifierToken->m_length);
 
         if ((*index + 1 == postfixPartCount) && lhs) {
-            uint16_t storeFieldIndex = generator->m_cpfIndexes[ZEN_BINARY_ENTITY_GENERATOR_ZEN_KERNEL_STORE_FIELD];
-            zen_BinaryEntityBuilder_emitInvokeStatic(generator->m_builder, storeFieldIndex);
+            zen_BinaryEntityBuilder_emitStoreInstanceField(generator->m_builder, fieldIndex);
         }
         else {
             /* We may be generating instructions either for LHS or RHS,
              * but it does not matter because at this point a field or method
              * reference should be loaded.
              */
-            uint16_t loadFieldIndex = generator->m_cpfIndexes[ZEN_BINARY_ENTITY_GENERATOR_ZEN_KERNEL_LOAD_FIELD];
-            zen_BinaryEntityBuilder_emitInvokeStatic(generator->m_builder, loadFieldIndex);
+            zen_BinaryEntityBuilder_emitLoadInstanceField(generator->m_builder, fieldIndex);
         }
     }
 }
@@ -5569,17 +5566,23 @@ void zen_BinaryEntityGenerator_handleIdentifier(zen_BinaryEntityGenerator_t* gen
     zen_Token_t* identifierToken = (zen_Token_t*)identifier->m_context;
     zen_Scope_t* enclosingScope = zen_Symbol_getEnclosingScope(symbol);
 
-    uint16_t storeFieldIndex = generator->m_cpfIndexes[ZEN_BINARY_ENTITY_GENERATOR_ZEN_KERNEL_STORE_FIELD];
+    /* The field reference of a class member names the class that encloses
+     * the member.
+     */
+    uint16_t fieldIndex = 0;
+    if ((zen_Symbol_isVariable(symbol) || zen_Symbol_isConstant(symbol)) &&
+        zen_Scope_isClassScope(enclosingScope)) {
+        zen_ClassSymbol_t* classSymbol = &enclosingScope->m_symbol->m_context.m_asClass;
+        fieldIndex = zen_ConstantPoolBuilder_getFieldEntryIndexEx(
+            generator->m_constantPoolBuilder, classSymbol->m_descriptor,
+            classSymbol->m_descriptorSize, "(zen/core/Object)", 17,
+            identifierToken->m_text, identifierToken->m_length);
+    }
+
     if (zen_Symbol_isVariable(symbol) || zen_Symbol_isConstant(symbol)) {
         if (lhs) {
             if (zen_Scope_isClassScope(enclosingScope)) {
-                bool instance = !zen_Symbol_isStatic(symbol);
-
-                uint16_t identifierIndex = zen_ConstantPoolBuilder_getStringEntryIndexEx(
-                    generator->m_constantPoolBuilder, identifierToken->m_text,
-                    identifierToken->m_length);
-
-                if (instance) {
+                if (!zen_Symbol_isStatic(symbol)) {
                     /* The this reference is always stored at the zeroth position
                         * in the local variable array. Further, we assume that the
                         * class member and the expression being processed appear in
@@ -5587,24 +5590,14 @@ void zen_BinaryEntityGenerator_handleIdentifier(zen_BinaryEntityGenerator_t* gen
                         * this reference.
                         */
                     zen_BinaryEntityBuilder_emitLoadReference(generator->m_builder, 0);
-                    /* Load the name of the field. */
-                    zen_BinaryEntityBuilder_emitLoadCPR(generator->m_builder, identifierIndex);
-                    /* Invoke the ZenKernel.storeField() function to update
-                     * the field.
-                     */
-                    zen_BinaryEntityBuilder_emitInvokeStatic(generator->m_builder, storeFieldIndex);
+                    /* Store the value in the instance field. */
+                    zen_BinaryEntityBuilder_emitStoreInstanceField(generator->m_builder,
+                        fieldIndex);
                 }
                 else {
-                    /* Emit the `load_cpr` instruction to load the reference of the
-                        * class to which the static field belongs.
-                        */
-                    zen_BinaryEntityBuilder_emitLoadCPR(generator->m_builder, 0);
-                    /* Load the name of the field. */
-                    zen_BinaryEntityBuilder_emitLoadCPR(generator->m_builder, identifierIndex);
-                    /* Invoke the ZenKernel.storeField() function to update
-                    * the field.
-                    */
-                    zen_BinaryEntityBuilder_emitInvokeStatic(generator->m_builder, storeFieldIndex);
+                    /* Store the value in the static field. */
+                    zen_BinaryEntityBuilder_emitStoreStaticField(generator->m_builder,
+                        fieldIndex);
                 }
             }
             else if (zen_Scope_isLocalScope(enclosingScope)) {
@@ -5631,11 +5624,13 @@ void zen_BinaryEntityGenerator_handleIdentifier(zen_BinaryEntityGenerator_t* gen
                         */
                     zen_BinaryEntityBuilder_emitLoadReference(generator->m_builder, 0);
                     /* Load the instance field. */
-                    zen_BinaryEntityBuilder_emitLoadInstanceField(generator->m_builder, 0);
+                    zen_BinaryEntityBuilder_emitLoadInstanceField(generator->m_builder,
+                        fieldIndex);
                 }
                 else {
                     /* Load the static field. */
-                    zen_BinaryEntityBuilder_emitLoadStaticField(generator->m_builder, 0);
+                    zen_BinaryEntityBuilder_emitLoadStaticField(generator->m_builder,
+                        fieldIndex);
                 }
             }
             else if (zen_Scope_isLocalScope(enclosingScope) || zen_Scope_isFunctionScope(enclosingScope)) {
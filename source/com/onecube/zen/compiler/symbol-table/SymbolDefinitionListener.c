@@ -555,6 +555,25 @@ void zen_SymbolDefinitionListener_onExitStatementSuite(
     zen_SymbolTable_invalidateCurrentScope(listener->m_symbolTable);
 }
 
+/* The modifiers of a class member apply to all the variables and constants
+ * that it declares.
+ */
+static void zen_SymbolDefinitionListener_addMemberModifiers(zen_Symbol_t* symbol,
+    zen_ASTNode_t* declaration) {
+    if (declaration->m_parent->m_type == ZEN_AST_NODE_TYPE_CLASS_MEMBER) {
+        zen_ClassMemberContext_t* classMemberContext =
+            (zen_ClassMemberContext_t*)declaration->m_parent->m_context;
+        int32_t modifierCount = jtk_ArrayList_getSize(classMemberContext->m_modifiers);
+        int32_t i;
+        for (i = 0; i < modifierCount; i++) {
+            zen_ASTNode_t* modifier =
+                (zen_ASTNode_t*)jtk_ArrayList_getValue(classMemberContext->m_modifiers, i);
+            zen_Token_t* token = (zen_Token_t*)modifier->m_context;
+            zen_Symbol_addModifiers(symbol, zen_TokenType_toModifiers(token->m_type));
+        }
+    }
+}
+
 void zen_SymbolDefinitionListener_onEnterVariableDeclaration(
     zen_ASTListener_t* astListener, zen_ASTNode_t* node) {
     jtk_Assert_assertObject(astListener, "The specified AST listener is null.");
@@ -583,6 +602,7 @@ void zen_SymbolDefinitionListener_onEnterVariableDeclaration(
         else {
             zen_Symbol_t* symbol = zen_Symbol_forVariable(identifier,
                 listener->m_symbolTable->m_currentScope);
+            zen_SymbolDefinitionListener_addMemberModifiers(symbol, node);
             zen_SymbolTable_define(listener->m_symbolTable, symbol);
         }
     }
@@ -615,6 +635,7 @@ void zen_SymbolDefinitionListener_onEnterConstantDeclaration(
         }
         else {
             zen_Symbol_t* symbol = zen_Symbol_forConstant(identifier, listener->m_symbolTable->m_currentScope);
+            zen_SymbolDefinitionListener_addMemberModifiers(symbol, node);
             zen_SymbolTable_define(listener->m_symbolTable, symbol);
         }
     }
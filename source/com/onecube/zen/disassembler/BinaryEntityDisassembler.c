@@ -539,7 +539,8 @@ void zen_BinaryEntityDisassembler_disassembleInstructionAttribute(
                 case ZEN_BYTE_CODE_NEW:
                 case ZEN_BYTE_CODE_NEW_ARRAY_A:
                 case ZEN_BYTE_CODE_STORE_STATIC_FIELD:
-                case ZEN_BYTE_CODE_STORE_INSTANCE_FIELD: {
+                case ZEN_BYTE_CODE_STORE_INSTANCE_FIELD:
+                case ZEN_BYTE_CODE_LOAD_LITERAL: {
                     uint16_t index = (disassembler->m_bytes[disassembler->m_index++] << 8) | disassembler->m_bytes[disassembler->m_index++];
                     printf("index=%d", index);
                     break;
@@ -577,6 +578,11 @@ void zen_BinaryEntityDisassembler_disassembleInstructionAttribute(
                     break;
                 }
 
+                case ZEN_BYTE_CODE_INVOKE_OPERATOR: {
+                    printf("operator=%d", disassembler->m_bytes[disassembler->m_index++]);
+                    break;
+                }
+
                 case ZEN_BYTE_CODE_PUSH_S: {
                     uint16_t value = (disassembler->m_bytes[disassembler->m_index++] << 8) | disassembler->m_bytes[disassembler->m_index++];
                     printf("value=%d", value);
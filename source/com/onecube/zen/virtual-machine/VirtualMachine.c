@@ -16,43 +16,22 @@
 
 // Friday, June 08, 2018
 
+#include <string.h>
+
 #include <jtk/collection/array/Arrays.h>
 #include <jtk/core/VariableArguments.h>
 #include <jtk/core/CString.h>
 #include <jtk/core/StringBuilder.h>
-#include <jtk/core/CStringObjectAdapter.h>
 #include <jtk/log/ConsoleLogger.h>
 
 #include <com/onecube/zen/virtual-machine/ExceptionManager.h>
 #include <com/onecube/zen/virtual-machine/VirtualMachine.h>
 #include <com/onecube/zen/virtual-machine/processor/Interpreter.h>
+#include <com/onecube/zen/virtual-machine/object/Array.h>
+#include <com/onecube/zen/virtual-machine/object/String.h>
 #include <com/onecube/zen/virtual-machine/object/Class.h>
+#include <com/onecube/zen/virtual-machine/object/Object.h>
 
-/* Object */
-
-/**
- * The layout of the object in memory is shown below.
- * | Object Header | Object Body |
- *
- * The object header is constant, that is, the size is fixed based on the
- * implementation of the virtual machine. On the other hand, the size of the
- * object body is variable, contingent on both the implementation and the
- * fields declared in the class whose instance the object is.
- *
- * [Object Header]
- * struct jtk_ObjectHeader_t {
- *     uintptr_t m_class;       // Depends on the platform.
- *     uint32_t m_hashCode;     // 4 bytes
- * };
- */
-#define ZEN_OBJECT_HEADER_CLASS_SIZE sizeof (uintptr_t)
-#define ZEN_OBJECT_HEADER_HASH_CODE_SIZE sizeof (uint32_t)
-#define ZEN_OBJECT_HEADER_SIZE (ZEN_OBJECT_HEADER_CLASS_SIZE + \
-                               ZEN_OBJECT_HEADER_HASH_CODE_SIZE)
-#define ZEN_OBJECT_HEADER_CLASS_OFFSET 0
-#define ZEN_OBJECT_HEADER_HASH_CODE_OFFSET ZEN_OBJECT_HEADER_CLASS_SIZE
-
-zen_Class_t* zen_Object_getClass(zen_Object_t* object);
 bool zen_VirtualMachine_isInstance(zen_VirtualMachine_t* virtualMachine,
     zen_Object_t* object, const uint8_t* classDescriptor, int32_t classDescriptorSize);
 int32_t zen_VirtualMachine_getStringSize(zen_VirtualMachine_t* virtualMachine, zen_Object_t* string);
@@ -60,25 +39,52 @@ uint8_t* zen_VirtualMachine_getStringBytes(zen_VirtualMachine_t* virtualMachine,
 
 // Identity Hash
 
+/* The identity hash is derived from the address of the object when it is
+ * requested for the first time, and stored in the header. Therefore, it
+ * survives the object being moved by the garbage collector, and objects whose
+ * identity hash is never requested do not pay for it.
+ */
 int32_t zen_VirtualMachine_identityHash(zen_Object_t* object) {
-    if (sizeof (uintptr_t) == 4) {
-        return (int32_t)object;
-    }
-    else if (sizeof (uintptr_t) == 8) {
-        return (int32_t)((uintptr_t)object ^ ((uintptr_t)object >> 32));
+    uintptr_t address = (uintptr_t)object;
+    int32_t result = 0;
+    if (ZEN_OBJECT_IS_SMALL_INTEGER(object)) {
+        /* The identity hash of a small integer is derived from the reference
+         * itself.
+         */
+        result = (int32_t)(address ^ ((uint64_t)address >> 32));
     }
     else {
-        return (int32_t)((uintptr_t)object);
+        uint64_t header = ZEN_OBJECT_HEADER(object);
+        if ((header & ZEN_OBJECT_HEADER_HASHED) == 0) {
+            /* The low bits of an address are always zero. */
+            uint64_t hash = ((uint64_t)address >> ZEN_NEW_GENERATION_GRANULE_SHIFT) ^
+                ((uint64_t)address >> 32);
+            header |= ((hash & ZEN_OBJECT_HEADER_HASH_MASK) << ZEN_OBJECT_HEADER_HASH_SHIFT) |
+                ZEN_OBJECT_HEADER_HASHED;
+            ZEN_OBJECT_HEADER(object) = header;
+        }
+        result = ZEN_OBJECT_HEADER_GET_HASH(header);
     }
+    return result;
 }
 
 // ** Native Functions **
 
-zen_Class_t* zen_Object_getClass(zen_Object_t* object) {
+/* Small integers do not have a header. Their class is the Integer class of
+ * the core classes.
+ */
+zen_Class_t* zen_Object_getClass(zen_VirtualMachine_t* virtualMachine,
+    zen_Object_t* object) {
     jtk_Assert_assertObject(object, "The specified object is null.");
 
-    zen_Class_t** classField = ((uint8_t*)object + ZEN_OBJECT_HEADER_CLASS_OFFSET);
-    return *classField;
+    zen_Class_t* result = NULL;
+    if (ZEN_OBJECT_IS_SMALL_INTEGER(object)) {
+        result = virtualMachine->m_coreClasses.m_integerClass;
+    }
+    else {
+        result = ZEN_OBJECT_GET_CLASS(virtualMachine->m_classTable, object);
+    }
+    return result;
 }
 
 bool zen_VirtualMachine_isInstance(zen_VirtualMachine_t* virtualMachine,
@@ -86,36 +92,31 @@ bool zen_VirtualMachine_isInstance(zen_VirtualMachine_t* virtualMachine,
     int32_t classDescriptorSize) {
     zen_Class_t* class0 = zen_VirtualMachine_getClass(virtualMachine,
         classDescriptor, classDescriptorSize);
-    zen_Class_t** classField = ((uint8_t*)object + ZEN_OBJECT_HEADER_CLASS_OFFSET);
-    return *classField == class0;
+    return zen_Object_getClass(virtualMachine, object) == class0;
 }
 
-void zen_print(zen_VirtualMachine_t* virtualMachine, zen_Object_t* self,
-    jtk_Array_t* arguments) {
+zen_Object_t* zen_print(zen_VirtualMachine_t* virtualMachine, zen_Object_t* self,
+    zen_Object_t** arguments) {
 
-    zen_Object_t* argument = (zen_Object_t*)jtk_Array_getValue(arguments, 0);
+    zen_Object_t* argument = arguments[0];
+    zen_CoreClasses_t* coreClasses = &virtualMachine->m_coreClasses;
+    zen_Class_t* class0 = (argument != NULL)? zen_Object_getClass(virtualMachine, argument) : NULL;
 
-    if (zen_VirtualMachine_isInstance(virtualMachine, argument, "zen/core/String", 15)) {
+    if ((class0 != NULL) && (class0 == coreClasses->m_stringClass)) {
         zen_Object_t* format = argument;
-        zen_Object_t* array = zen_VirtualMachine_getObjectField(virtualMachine,
-            format, "value", 5);
-        uint8_t* values = (uint8_t*)zen_VirtualMachine_getObjectField(virtualMachine,
-            array, "values", 6);
-        int32_t size = (int32_t)zen_VirtualMachine_getObjectField(virtualMachine,
-            array, "size", 4);
+        uint8_t* values = zen_VirtualMachine_getStringBytes(virtualMachine, format);
+        int32_t size = zen_VirtualMachine_getStringSize(virtualMachine, format);
         fwrite(values, 1, size, stdout);
         puts("");
     }
-    else if (zen_VirtualMachine_isInstance(virtualMachine, argument, "zen/core/Integer", 16)) {
-        zen_Object_t* value = (zen_Object_t*)jtk_Array_getValue(arguments, 0);
-        int64_t value0 = (int64_t)zen_VirtualMachine_getObjectField(virtualMachine,
-            value, "value", 5);
+    else if ((class0 != NULL) && (class0 == coreClasses->m_integerClass)) {
+        zen_Object_t* value = arguments[0];
+        int64_t value0 = zen_VirtualMachine_getIntegerValue(virtualMachine, value);
         printf("%ld\n", value0);
     }
-    else if (zen_VirtualMachine_isInstance(virtualMachine, argument, "zen/core/Boolean", 16)) {
-        zen_Object_t* value = (zen_Object_t*)jtk_Array_getValue(arguments, 0);
-        int64_t value0 = (int64_t)zen_VirtualMachine_getObjectField(virtualMachine,
-            value, "value", 5);
+    else if ((class0 != NULL) && (class0 == coreClasses->m_booleanClass)) {
+        zen_Object_t* value = arguments[0];
+        int64_t value0 = (int64_t)zen_VirtualMachine_getBooleanValue(virtualMachine, value);
         printf("%s\n", value0? "true" : "false");
     }
     else {
@@ -123,6 +124,8 @@ void zen_print(zen_VirtualMachine_t* virtualMachine, zen_Object_t* self,
     }
 
     fflush(stdout);
+
+    return NULL;
 }
 
 zen_Object_t* zen_scanInteger(zen_VirtualMachine_t* virtualMachine, zen_Object_t* self,
@@ -165,66 +168,198 @@ zen_Object_t* zen_array(zen_VirtualMachine_t* virtualMachine,
     jtk_Assert_assertObject(virtualMachine, "The specified virtual machine is null.");
 
     zen_Object_t* size = arguments->m_values[0];
-    int32_t size0 = (int64_t)zen_VirtualMachine_getObjectField(virtualMachine,
-            size, "value", 5);
-    jtk_Array_t* values = jtk_Array_new(size0);
-    jtk_Array_fill(values, 0);
+    int32_t size0 = zen_VirtualMachine_getIntegerValue(virtualMachine, size);
 
-    zen_Object_t* result = zen_VirtualMachine_newObjectArray(virtualMachine,
-        values->m_values, values->m_size);
-
-    jtk_Array_delete(values);
+    return zen_VirtualMachine_newArray(virtualMachine, ZEN_TYPE_REFERENCE, size0);
+}
 
+/* Determines whether the element at the specified index can be accessed.
+ * Otherwise, an exception is raised.
+ */
+static bool zen_Array_checkIndex(zen_VirtualMachine_t* virtualMachine,
+    zen_Object_t* self, int32_t index) {
+    bool result = false;
+    if (self == NULL) {
+        zen_VirtualMachine_raiseNullReferenceException(virtualMachine);
+    }
+    else if (!ZEN_ARRAY_IS_VALID_INDEX(self, index)) {
+        zen_VirtualMachine_raiseInvalidArrayIndexException(virtualMachine, index);
+    }
+    else {
+        result = true;
+    }
     return result;
 }
 
+/* The elements of primitive arrays are boxed when they are read through the
+ * native functions. There is no class for boxed decimals yet, therefore,
+ * decimals are truncated to integers.
+ */
 zen_Object_t* zen_Array_getValue(zen_VirtualMachine_t* virtualMachine,
-    zen_Object_t* self, jtk_Array_t* arguments) {
-    zen_Object_t* index = arguments->m_values[0];
-    int32_t index0 = (int64_t)zen_VirtualMachine_getObjectField(virtualMachine,
-        index, "value", 5);
-    void** values = (void**)zen_VirtualMachine_getObjectField(virtualMachine, self, "values", 6);
-    return values[index0];
+    zen_Object_t* self, zen_Object_t** arguments) {
+    zen_Object_t* index = arguments[0];
+    int32_t index0 = zen_VirtualMachine_getIntegerValue(virtualMachine, index);
+
+    zen_Object_t* result = NULL;
+    if (zen_Array_checkIndex(virtualMachine, self, index0)) {
+        switch (ZEN_ARRAY_ELEMENT_TYPE(self)) {
+            case ZEN_TYPE_BOOLEAN: {
+                result = zen_VirtualMachine_newBoolean(virtualMachine,
+                    ZEN_ARRAY_GET_ELEMENTS(self, uint8_t)[index0] != 0);
+                break;
+            }
+
+            case ZEN_TYPE_CHARACTER: {
+                result = zen_VirtualMachine_newInteger(virtualMachine,
+                    ZEN_ARRAY_GET_ELEMENTS(self, uint16_t)[index0]);
+                break;
+            }
+
+            case ZEN_TYPE_INTEGER_8: {
+                result = zen_VirtualMachine_newInteger(virtualMachine,
+                    ZEN_ARRAY_GET_ELEMENTS(self, int8_t)[index0]);
+                break;
+            }
+
+            case ZEN_TYPE_INTEGER_16: {
+                result = zen_VirtualMachine_newInteger(virtualMachine,
+                    ZEN_ARRAY_GET_ELEMENTS(self, int16_t)[index0]);
+                break;
+            }
+
+            case ZEN_TYPE_INTEGER_32: {
+                result = zen_VirtualMachine_newInteger(virtualMachine,
+                    ZEN_ARRAY_GET_ELEMENTS(self, int32_t)[index0]);
+                break;
+            }
+
+            case ZEN_TYPE_INTEGER_64: {
+                result = zen_VirtualMachine_newInteger(virtualMachine,
+                    ZEN_ARRAY_GET_ELEMENTS(self, int64_t)[index0]);
+                break;
+            }
+
+            case ZEN_TYPE_DECIMAL_32: {
+                result = zen_VirtualMachine_newInteger(virtualMachine,
+                    (int64_t)ZEN_ARRAY_GET_ELEMENTS(self, float)[index0]);
+                break;
+            }
+
+            case ZEN_TYPE_DECIMAL_64: {
+                result = zen_VirtualMachine_newInteger(virtualMachine,
+                    (int64_t)ZEN_ARRAY_GET_ELEMENTS(self, double)[index0]);
+                break;
+            }
+
+            default: {
+                result = ZEN_ARRAY_GET_ELEMENTS(self, zen_Object_t*)[index0];
+                break;
+            }
+        }
+    }
+    return result;
 }
 
 zen_Object_t* zen_Array_getSize(zen_VirtualMachine_t* virtualMachine,
-    zen_Object_t* self, jtk_Array_t* arguments) {
-    int32_t size = (int64_t)zen_VirtualMachine_getObjectField(virtualMachine,
-        self, "size", 5);
-    return zen_VirtualMachine_newInteger(virtualMachine, size);
+    zen_Object_t* self, zen_Object_t** arguments) {
+    zen_Object_t* result = NULL;
+    if (self == NULL) {
+        zen_VirtualMachine_raiseNullReferenceException(virtualMachine);
+    }
+    else {
+        result = zen_VirtualMachine_newInteger(virtualMachine, ZEN_ARRAY_LENGTH(self));
+    }
+    return result;
 }
 
 zen_Object_t* zen_Array_setValue(zen_VirtualMachine_t* virtualMachine,
-    zen_Object_t* self, jtk_Array_t* arguments) {
-    zen_Object_t* index = arguments->m_values[0];
-    zen_Object_t* value = arguments->m_values[1];
-    int32_t index0 = (int64_t)zen_VirtualMachine_getObjectField(virtualMachine,
-        index, "value", 5);
-    void** values = (void**)zen_VirtualMachine_getObjectField(virtualMachine, self, "values", 6);
-    values[index0] = value;
+    zen_Object_t* self, zen_Object_t** arguments) {
+    zen_Object_t* index = arguments[0];
+    zen_Object_t* value = arguments[1];
+    int32_t index0 = zen_VirtualMachine_getIntegerValue(virtualMachine, index);
+
+    if (zen_Array_checkIndex(virtualMachine, self, index0)) {
+        zen_Type_t type = (zen_Type_t)ZEN_ARRAY_ELEMENT_TYPE(self);
+        if (type == ZEN_TYPE_REFERENCE) {
+            zen_Object_t** element = &ZEN_ARRAY_GET_ELEMENTS(self, zen_Object_t*)[index0];
+            ZEN_MEMORY_MANAGER_PRE_WRITE_BARRIER(virtualMachine->m_memoryManager, element);
+            *element = value;
+            /* The elements belong to the array, therefore, its card is dirtied. */
+            ZEN_MEMORY_MANAGER_WRITE_BARRIER(virtualMachine->m_memoryManager, self, value);
+        }
+        else if (type == ZEN_TYPE_BOOLEAN) {
+            /* The instances of the Boolean class are shared. */
+            ZEN_ARRAY_GET_ELEMENTS(self, uint8_t)[index0] =
+                (value == zen_VirtualMachine_newBoolean(virtualMachine, true));
+        }
+        else {
+            int64_t value0 = zen_VirtualMachine_getIntegerValue(virtualMachine, value);
+            switch (type) {
+                case ZEN_TYPE_CHARACTER: {
+                    ZEN_ARRAY_GET_ELEMENTS(self, uint16_t)[index0] = (uint16_t)value0;
+                    break;
+                }
+
+                case ZEN_TYPE_INTEGER_8: {
+                    ZEN_ARRAY_GET_ELEMENTS(self, int8_t)[index0] = (int8_t)value0;
+                    break;
+                }
+
+                case ZEN_TYPE_INTEGER_16: {
+                    ZEN_ARRAY_GET_ELEMENTS(self, int16_t)[index0] = (int16_t)value0;
+                    break;
+                }
+
+                case ZEN_TYPE_INTEGER_32: {
+                    ZEN_ARRAY_GET_ELEMENTS(self, int32_t)[index0] = (int32_t)value0;
+                    break;
+                }
+
+                case ZEN_TYPE_INTEGER_64: {
+                    ZEN_ARRAY_GET_ELEMENTS(self, int64_t)[index0] = value0;
+                    break;
+                }
+
+                case ZEN_TYPE_DECIMAL_32: {
+                    ZEN_ARRAY_GET_ELEMENTS(self, float)[index0] = (float)value0;
+                    break;
+                }
+
+                case ZEN_TYPE_DECIMAL_64: {
+                    ZEN_ARRAY_GET_ELEMENTS(self, double)[index0] = (double)value0;
+                    break;
+                }
+
+                default: {
+                    break;
+                }
+            }
+        }
+    }
 
     return self;
 }
 
 void zen_Integer_initialize(zen_VirtualMachine_t* virtualMachine,
     zen_Object_t* self, jtk_Array_t* arguments) {
-    const uint8_t* valueDescriptor = "value";
-    int32_t valueDescriptorSize = 5;
-
     zen_Object_t* value = (zen_Object_t*)jtk_Array_getValue(arguments, 0);
-    zen_VirtualMachine_setObjectField(virtualMachine, self, valueDescriptor,
-        valueDescriptorSize, value);
+    zen_FieldHandle_t* handle = &virtualMachine->m_coreClasses.m_integerValue;
+    if (ZEN_FIELD_HANDLE_IS_RESOLVED(handle) &&
+        (zen_Object_getClass(virtualMachine, self) == handle->m_class)) {
+        ZEN_FIELD_HANDLE_SET_REFERENCE(virtualMachine->m_memoryManager, handle, self, value);
+    }
+    else {
+        zen_VirtualMachine_setObjectField(virtualMachine, self, "value", 5, value);
+    }
 }
 
 zen_Object_t* zen_Integer_add(zen_VirtualMachine_t* virtualMachine,
-    zen_Object_t* self, jtk_Array_t* arguments) {
-    zen_Object_t* operand1 = (zen_Object_t*)jtk_Array_getValue(arguments, 0);
-    zen_Object_t* operand2 = (zen_Object_t*)jtk_Array_getValue(arguments, 1);
+    zen_Object_t* self, zen_Object_t** arguments) {
+    zen_Object_t* operand1 = arguments[0];
+    zen_Object_t* operand2 = arguments[1];
 
-    int64_t value1 = (int64_t)zen_VirtualMachine_getObjectField(virtualMachine,
-            operand1, "value", 5);
-    int64_t value2 = (int64_t)zen_VirtualMachine_getObjectField(virtualMachine,
-            operand2, "value", 5);
+    int64_t value1 = zen_VirtualMachine_getIntegerValue(virtualMachine, operand1);
+    int64_t value2 = zen_VirtualMachine_getIntegerValue(virtualMachine, operand2);
 
     zen_Object_t* result = zen_VirtualMachine_newInteger(virtualMachine, value1 + value2);
     // printf("%ld\n", value1 + value2);
@@ -233,14 +368,12 @@ zen_Object_t* zen_Integer_add(zen_VirtualMachine_t* virtualMachine,
 }
 
 zen_Object_t* zen_Integer_subtract(zen_VirtualMachine_t* virtualMachine,
-    zen_Object_t* self, jtk_Array_t* arguments) {
-    zen_Object_t* operand1 = (zen_Object_t*)jtk_Array_getValue(arguments, 0);
-    zen_Object_t* operand2 = (zen_Object_t*)jtk_Array_getValue(arguments, 1);
+    zen_Object_t* self, zen_Object_t** arguments) {
+    zen_Object_t* operand1 = arguments[0];
+    zen_Object_t* operand2 = arguments[1];
 
-    int64_t value1 = (int64_t)zen_VirtualMachine_getObjectField(virtualMachine,
-            operand1, "value", 5);
-    int64_t value2 = (int64_t)zen_VirtualMachine_getObjectField(virtualMachine,
-            operand2, "value", 5);
+    int64_t value1 = zen_VirtualMachine_getIntegerValue(virtualMachine, operand1);
+    int64_t value2 = zen_VirtualMachine_getIntegerValue(virtualMachine, operand2);
 
     zen_Object_t* result = zen_VirtualMachine_newInteger(virtualMachine, value1 - value2);
     // printf("%ld\n", value1 - value2);
@@ -249,14 +382,12 @@ zen_Object_t* zen_Integer_subtract(zen_VirtualMachine_t* virtualMachine,
 }
 
 zen_Object_t* zen_Integer_multiply(zen_VirtualMachine_t* virtualMachine,
-    zen_Object_t* self, jtk_Array_t* arguments) {
-    zen_Object_t* operand1 = (zen_Object_t*)jtk_Array_getValue(arguments, 0);
-    zen_Object_t* operand2 = (zen_Object_t*)jtk_Array_getValue(arguments, 1);
+    zen_Object_t* self, zen_Object_t** arguments) {
+    zen_Object_t* operand1 = arguments[0];
+    zen_Object_t* operand2 = arguments[1];
 
-    int64_t value1 = (int64_t)zen_VirtualMachine_getObjectField(virtualMachine,
-            operand1, "value", 5);
-    int64_t value2 = (int64_t)zen_VirtualMachine_getObjectField(virtualMachine,
-            operand2, "value", 5);
+    int64_t value1 = zen_VirtualMachine_getIntegerValue(virtualMachine, operand1);
+    int64_t value2 = zen_VirtualMachine_getIntegerValue(virtualMachine, operand2);
 
     zen_Object_t* result = zen_VirtualMachine_newInteger(virtualMachine, value1 * value2);
     // printf("%ld\n", value1 * value2);
@@ -265,14 +396,12 @@ zen_Object_t* zen_Integer_multiply(zen_VirtualMachine_t* virtualMachine,
 }
 
 zen_Object_t* zen_Integer_divide(zen_VirtualMachine_t* virtualMachine,
-    zen_Object_t* self, jtk_Array_t* arguments) {
-    zen_Object_t* operand1 = (zen_Object_t*)jtk_Array_getValue(arguments, 0);
-    zen_Object_t* operand2 = (zen_Object_t*)jtk_Array_getValue(arguments, 1);
+    zen_Object_t* self, zen_Object_t** arguments) {
+    zen_Object_t* operand1 = arguments[0];
+    zen_Object_t* operand2 = arguments[1];
 
-    int64_t value1 = (int64_t)zen_VirtualMachine_getObjectField(virtualMachine,
-            operand1, "value", 5);
-    int64_t value2 = (int64_t)zen_VirtualMachine_getObjectField(virtualMachine,
-            operand2, "value", 5);
+    int64_t value1 = zen_VirtualMachine_getIntegerValue(virtualMachine, operand1);
+    int64_t value2 = zen_VirtualMachine_getIntegerValue(virtualMachine, operand2);
 
     zen_Object_t* result = zen_VirtualMachine_newInteger(virtualMachine, value1 / value2);
     // printf("%ld\n", value1 / value2);
@@ -281,14 +410,12 @@ zen_Object_t* zen_Integer_divide(zen_VirtualMachine_t* virtualMachine,
 }
 
 zen_Object_t* zen_Integer_remainder(zen_VirtualMachine_t* virtualMachine,
-    zen_Object_t* self, jtk_Array_t* arguments) {
-    zen_Object_t* operand1 = (zen_Object_t*)jtk_Array_getValue(arguments, 0);
-    zen_Object_t* operand2 = (zen_Object_t*)jtk_Array_getValue(arguments, 1);
+    zen_Object_t* self, zen_Object_t** arguments) {
+    zen_Object_t* operand1 = arguments[0];
+    zen_Object_t* operand2 = arguments[1];
 
-    int64_t value1 = (int64_t)zen_VirtualMachine_getObjectField(virtualMachine,
-            operand1, "value", 5);
-    int64_t value2 = (int64_t)zen_VirtualMachine_getObjectField(virtualMachine,
-            operand2, "value", 5);
+    int64_t value1 = zen_VirtualMachine_getIntegerValue(virtualMachine, operand1);
+    int64_t value2 = zen_VirtualMachine_getIntegerValue(virtualMachine, operand2);
 
     zen_Object_t* result = zen_VirtualMachine_newInteger(virtualMachine, value1 % value2);
     // printf("%ld\n", value1 % value2);
@@ -297,84 +424,72 @@ zen_Object_t* zen_Integer_remainder(zen_VirtualMachine_t* virtualMachine,
 }
 
 zen_Object_t* zen_Integer_equals(zen_VirtualMachine_t* virtualMachine,
-    zen_Object_t* self, jtk_Array_t* arguments) {
-    zen_Object_t* operand1 = (zen_Object_t*)jtk_Array_getValue(arguments, 0);
-    zen_Object_t* operand2 = (zen_Object_t*)jtk_Array_getValue(arguments, 1);
+    zen_Object_t* self, zen_Object_t** arguments) {
+    zen_Object_t* operand1 = arguments[0];
+    zen_Object_t* operand2 = arguments[1];
 
-    int64_t value1 = (int64_t)zen_VirtualMachine_getObjectField(virtualMachine,
-            operand1, "value", 5);
-    int64_t value2 = (int64_t)zen_VirtualMachine_getObjectField(virtualMachine,
-            operand2, "value", 5);
+    int64_t value1 = zen_VirtualMachine_getIntegerValue(virtualMachine, operand1);
+    int64_t value2 = zen_VirtualMachine_getIntegerValue(virtualMachine, operand2);
     zen_Object_t* result = zen_VirtualMachine_newBoolean(virtualMachine, value1 == value2);
 
     return result;
 }
 
 zen_Object_t* zen_Integer_notEquals(zen_VirtualMachine_t* virtualMachine,
-    zen_Object_t* self, jtk_Array_t* arguments) {
-    zen_Object_t* operand1 = (zen_Object_t*)jtk_Array_getValue(arguments, 0);
-    zen_Object_t* operand2 = (zen_Object_t*)jtk_Array_getValue(arguments, 1);
+    zen_Object_t* self, zen_Object_t** arguments) {
+    zen_Object_t* operand1 = arguments[0];
+    zen_Object_t* operand2 = arguments[1];
 
-    int64_t value1 = (int64_t)zen_VirtualMachine_getObjectField(virtualMachine,
-            operand1, "value", 5);
-    int64_t value2 = (int64_t)zen_VirtualMachine_getObjectField(virtualMachine,
-            operand2, "value", 5);
+    int64_t value1 = zen_VirtualMachine_getIntegerValue(virtualMachine, operand1);
+    int64_t value2 = zen_VirtualMachine_getIntegerValue(virtualMachine, operand2);
     zen_Object_t* result = zen_VirtualMachine_newBoolean(virtualMachine, value1 != value2);
 
     return result;
 }
 
 zen_Object_t* zen_Integer_greater(zen_VirtualMachine_t* virtualMachine,
-    zen_Object_t* self, jtk_Array_t* arguments) {
-    zen_Object_t* operand1 = (zen_Object_t*)jtk_Array_getValue(arguments, 0);
-    zen_Object_t* operand2 = (zen_Object_t*)jtk_Array_getValue(arguments, 1);
+    zen_Object_t* self, zen_Object_t** arguments) {
+    zen_Object_t* operand1 = arguments[0];
+    zen_Object_t* operand2 = arguments[1];
 
-    int64_t value1 = (int64_t)zen_VirtualMachine_getObjectField(virtualMachine,
-            operand1, "value", 5);
-    int64_t value2 = (int64_t)zen_VirtualMachine_getObjectField(virtualMachine,
-            operand2, "value", 5);
+    int64_t value1 = zen_VirtualMachine_getIntegerValue(virtualMachine, operand1);
+    int64_t value2 = zen_VirtualMachine_getIntegerValue(virtualMachine, operand2);
     zen_Object_t* result = zen_VirtualMachine_newBoolean(virtualMachine, value1 > value2);
 
     return result;
 }
 
 zen_Object_t* zen_Integer_greaterOrEqual(zen_VirtualMachine_t* virtualMachine,
-    zen_Object_t* self, jtk_Array_t* arguments) {
-    zen_Object_t* operand1 = (zen_Object_t*)jtk_Array_getValue(arguments, 0);
-    zen_Object_t* operand2 = (zen_Object_t*)jtk_Array_getValue(arguments, 1);
+    zen_Object_t* self, zen_Object_t** arguments) {
+    zen_Object_t* operand1 = arguments[0];
+    zen_Object_t* operand2 = arguments[1];
 
-    int64_t value1 = (int64_t)zen_VirtualMachine_getObjectField(virtualMachine,
-            operand1, "value", 5);
-    int64_t value2 = (int64_t)zen_VirtualMachine_getObjectField(virtualMachine,
-            operand2, "value", 5);
+    int64_t value1 = zen_VirtualMachine_getIntegerValue(virtualMachine, operand1);
+    int64_t value2 = zen_VirtualMachine_getIntegerValue(virtualMachine, operand2);
     zen_Object_t* result = zen_VirtualMachine_newBoolean(virtualMachine, value1 >= value2);
 
     return result;
 }
 
 zen_Object_t* zen_Integer_lesser(zen_VirtualMachine_t* virtualMachine,
-    zen_Object_t* self, jtk_Array_t* arguments) {
-    zen_Object_t* operand1 = (zen_Object_t*)jtk_Array_getValue(arguments, 0);
-    zen_Object_t* operand2 = (zen_Object_t*)jtk_Array_getValue(arguments, 1);
+    zen_Object_t* self, zen_Object_t** arguments) {
+    zen_Object_t* operand1 = arguments[0];
+    zen_Object_t* operand2 = arguments[1];
 
-    int64_t value1 = (int64_t)zen_VirtualMachine_getObjectField(virtualMachine,
-            operand1, "value", 5);
-    int64_t value2 = (int64_t)zen_VirtualMachine_getObjectField(virtualMachine,
-            operand2, "value", 5);
+    int64_t value1 = zen_VirtualMachine_getIntegerValue(virtualMachine, operand1);
+    int64_t value2 = zen_VirtualMachine_getIntegerValue(virtualMachine, operand2);
     zen_Object_t* result = zen_VirtualMachine_newBoolean(virtualMachine, value1 < value2);
 
     return result;
 }
 
 zen_Object_t* zen_Integer_lesserOrEqual(zen_VirtualMachine_t* virtualMachine,
-    zen_Object_t* self, jtk_Array_t* arguments) {
-    zen_Object_t* operand1 = (zen_Object_t*)jtk_Array_getValue(arguments, 0);
-    zen_Object_t* operand2 = (zen_Object_t*)jtk_Array_getValue(arguments, 1);
+    zen_Object_t* self, zen_Object_t** arguments) {
+    zen_Object_t* operand1 = arguments[0];
+    zen_Object_t* operand2 = arguments[1];
 
-    int64_t value1 = (int64_t)zen_VirtualMachine_getObjectField(virtualMachine,
-            operand1, "value", 5);
-    int64_t value2 = (int64_t)zen_VirtualMachine_getObjectField(virtualMachine,
-            operand2, "value", 5);
+    int64_t value1 = zen_VirtualMachine_getIntegerValue(virtualMachine, operand1);
+    int64_t value2 = zen_VirtualMachine_getIntegerValue(virtualMachine, operand2);
     zen_Object_t* result = zen_VirtualMachine_newBoolean(virtualMachine, value1 <= value2);
 
     return result;
@@ -386,103 +501,103 @@ zen_Object_t* zen_Integer_lesserOrEqual(zen_VirtualMachine_t* virtualMachine,
 
 void zen_Boolean_initialize(zen_VirtualMachine_t* virtualMachine,
     zen_Object_t* self, jtk_Array_t* arguments) {
-    const uint8_t* valueDescriptor = "value";
-    int32_t valueDescriptorSize = 5;
-
     zen_Object_t* value = (zen_Object_t*)jtk_Array_getValue(arguments, 0);
-    zen_VirtualMachine_setObjectField(virtualMachine, self, valueDescriptor,
-        valueDescriptorSize, value);
+    zen_FieldHandle_t* handle = &virtualMachine->m_coreClasses.m_booleanValue;
+    if (ZEN_FIELD_HANDLE_IS_RESOLVED(handle) &&
+        (zen_Object_getClass(virtualMachine, self) == handle->m_class)) {
+        ZEN_FIELD_HANDLE_SET_REFERENCE(virtualMachine->m_memoryManager, handle, self, value);
+    }
+    else {
+        zen_VirtualMachine_setObjectField(virtualMachine, self, "value", 5, value);
+    }
 }
 
 zen_Object_t* zen_Boolean_getValue(zen_VirtualMachine_t* virtualMachine,
-    zen_Object_t* self, jtk_Array_t* arguments) {
-    return (int64_t)zen_VirtualMachine_getObjectField(virtualMachine,
-            self, "value", 5);
-}
-
-void zen_String_initialize(zen_VirtualMachine_t* virtualMachine,
-    zen_Object_t* self, jtk_Array_t* arguments) {
-    const uint8_t* valueDescriptor = "value";
-    int32_t valueDescriptorSize = 5;
-
-    zen_Object_t* value = (zen_Object_t*)jtk_Array_getValue(arguments, 0);
-    zen_VirtualMachine_setObjectField(virtualMachine, self, valueDescriptor,
-        valueDescriptorSize, value);
+    zen_Object_t* self, zen_Object_t** arguments) {
+    return (zen_Object_t*)(intptr_t)zen_VirtualMachine_getBooleanValue(virtualMachine, self);
 }
 
+/* The operands of the native functions are rooted and pinned as handles,
+ * therefore, their bytes can be copied after the result is allocated.
+ */
 zen_Object_t* zen_String_add(zen_VirtualMachine_t* virtualMachine,
-    zen_Object_t* self, jtk_Array_t* arguments) {
-    zen_Object_t* operand1 = (zen_Object_t*)jtk_Array_getValue(arguments, 0);
-    zen_Object_t* operand2 = (zen_Object_t*)jtk_Array_getValue(arguments, 1);
+    zen_Object_t* self, zen_Object_t** arguments) {
+    zen_Object_t* operand1 = arguments[0];
+    zen_Object_t* operand2 = arguments[1];
 
-    uint8_t* operand1Bytes = zen_VirtualMachine_getStringBytes(virtualMachine, operand1);
-    uint8_t* operand2Bytes = zen_VirtualMachine_getStringBytes(virtualMachine, operand2);
+    int32_t operand1Size = ZEN_STRING_SIZE(operand1);
+    int32_t operand2Size = ZEN_STRING_SIZE(operand2);
+    int64_t size = (int64_t)operand1Size + operand2Size;
 
-    int32_t operand1Size = zen_VirtualMachine_getStringSize(virtualMachine, operand1);
-    int32_t operand2Size = zen_VirtualMachine_getStringSize(virtualMachine, operand2);
-
-    // TODO: Implement a better algorithm.
-
-    int32_t resultSize;
-    uint8_t* string = jtk_CString_joinEx(operand1Bytes, operand1Size,
-        operand2Bytes, operand2Size, &resultSize);
-    zen_Object_t* result = zen_VirtualMachine_newStringFromUtf8(virtualMachine, string, resultSize);
-    jtk_CString_delete(string);
+    zen_Object_t* result = NULL;
+    if (size > ZEN_STRING_MAXIMUM_SIZE) {
+        zen_VirtualMachine_raiseInvalidStringSizeException(virtualMachine);
+    }
+    else {
+        /* The bytes of both the operands are copied straight into the result. */
+        result = zen_VirtualMachine_allocateString(virtualMachine, (int32_t)size);
+        if (result != NULL) {
+            uint8_t* bytes = ZEN_STRING_GET_BYTES(result);
+            memcpy(bytes, ZEN_STRING_GET_BYTES(operand1), operand1Size);
+            memcpy(bytes + operand1Size, ZEN_STRING_GET_BYTES(operand2), operand2Size);
+        }
+    }
 
     return result;
 }
 
 zen_Object_t* zen_String_multiply(zen_VirtualMachine_t* virtualMachine,
-    zen_Object_t* self, jtk_Array_t* arguments) {
-    zen_Object_t* string = (zen_Object_t*)jtk_Array_getValue(arguments, 0);
-    uint8_t* stringBytes = zen_VirtualMachine_getStringBytes(virtualMachine, string);
-    int32_t stringSize = zen_VirtualMachine_getStringSize(virtualMachine, string);
-
-    zen_Object_t* count = (zen_Object_t*)jtk_Array_getValue(arguments, 1);
-    int64_t value = (int64_t)zen_VirtualMachine_getObjectField(virtualMachine,
-            count, "value", 5);
-
-    jtk_StringBuilder_t* builder = jtk_StringBuilder_newWithCapacity(value * stringSize);
-    int32_t i;
-    for (i = 0; i < value; i++) {
-        jtk_StringBuilder_appendEx_z(builder, stringBytes, stringSize);
+    zen_Object_t* self, zen_Object_t** arguments) {
+    zen_Object_t* string = arguments[0];
+    int32_t stringSize = ZEN_STRING_SIZE(string);
+
+    zen_Object_t* count = arguments[1];
+    int64_t value = zen_VirtualMachine_getIntegerValue(virtualMachine, count);
+    if (value < 0) {
+        value = 0;
     }
 
-    zen_Object_t* result = zen_VirtualMachine_newStringFromUtf8(virtualMachine, builder->m_value, builder->m_size);
-    jtk_StringBuilder_delete(builder);
+    zen_Object_t* result = NULL;
+    /* The size of the result is checked before it is computed, because the
+     * product may not fit in 64 bits.
+     */
+    if ((stringSize > 0) && (value > (ZEN_STRING_MAXIMUM_SIZE / stringSize))) {
+        zen_VirtualMachine_raiseInvalidStringSizeException(virtualMachine);
+    }
+    else {
+        /* An empty string remains empty, however many times it is repeated. */
+        int32_t repetitions = (stringSize > 0)? (int32_t)value : 0;
+        result = zen_VirtualMachine_allocateString(virtualMachine, repetitions * stringSize);
+        if (result != NULL) {
+            uint8_t* bytes = ZEN_STRING_GET_BYTES(result);
+            int32_t i;
+            for (i = 0; i < repetitions; i++) {
+                memcpy(bytes + (i * stringSize), ZEN_STRING_GET_BYTES(string), stringSize);
+            }
+        }
+    }
 
     return result;
 }
 
 zen_Object_t* zen_String_equals(zen_VirtualMachine_t* virtualMachine,
-    zen_Object_t* self, jtk_Array_t* arguments) {
-    zen_Object_t* operand1 = (zen_Object_t*)jtk_Array_getValue(arguments, 0);
-    zen_Object_t* operand2 = (zen_Object_t*)jtk_Array_getValue(arguments, 1);
-
-    uint8_t* operand1Bytes = zen_VirtualMachine_getStringBytes(virtualMachine, operand1);
-    uint8_t* operand2Bytes = zen_VirtualMachine_getStringBytes(virtualMachine, operand2);
-
-    int32_t operand1Size = zen_VirtualMachine_getStringSize(virtualMachine, operand1);
-    int32_t operand2Size = zen_VirtualMachine_getStringSize(virtualMachine, operand2);
+    zen_Object_t* self, zen_Object_t** arguments) {
+    zen_Object_t* operand1 = arguments[0];
+    zen_Object_t* operand2 = arguments[1];
 
     zen_Object_t* result = zen_VirtualMachine_newBoolean(virtualMachine,
-        jtk_CString_equals(operand1Bytes, operand1Size, operand2Bytes, operand2Size));
+        zen_String_isEqual(operand1, operand2));
 
     return result;
 }
 
 zen_Object_t* zen_String_notEquals(zen_VirtualMachine_t* virtualMachine,
-    zen_Object_t* self, jtk_Array_t* arguments) {    zen_Object_t* operand1 = (zen_Object_t*)jtk_Array_getValue(arguments, 0);
-    zen_Object_t* operand2 = (zen_Object_t*)jtk_Array_getValue(arguments, 1);
-
-    uint8_t* operand1Bytes = zen_VirtualMachine_getStringBytes(virtualMachine, operand1);
-    uint8_t* operand2Bytes = zen_VirtualMachine_getStringBytes(virtualMachine, operand2);
-
-    int32_t operand1Size = zen_VirtualMachine_getStringSize(virtualMachine, operand1);
-    int32_t operand2Size = zen_VirtualMachine_getStringSize(virtualMachine, operand2);
+    zen_Object_t* self, zen_Object_t** arguments) {
+    zen_Object_t* operand1 = arguments[0];
+    zen_Object_t* operand2 = arguments[1];
 
     zen_Object_t* result = zen_VirtualMachine_newBoolean(virtualMachine,
-        !jtk_CString_equals(operand1Bytes, operand1Size, operand2Bytes, operand2Size));
+        !zen_String_isEqual(operand1, operand2));
 
     return result;
 }
@@ -493,20 +608,17 @@ int32_t zen_String_getSize(zen_VirtualMachine_t* virtualMachine,
 }
 
 int32_t zen_VirtualMachine_getStringSize(zen_VirtualMachine_t* virtualMachine, zen_Object_t* string) {
-    zen_Object_t* array = zen_VirtualMachine_getObjectField(virtualMachine, string, "value", 5);
-    return (int32_t)zen_VirtualMachine_getObjectField(virtualMachine, array, "size", 4);
+    return ZEN_STRING_SIZE(string);
 }
 
 uint8_t* zen_VirtualMachine_getStringBytes(zen_VirtualMachine_t* virtualMachine, zen_Object_t* string) {
-    zen_Object_t* array = zen_VirtualMachine_getObjectField(virtualMachine, string, "value", 5);
-    uint8_t* bytes = zen_VirtualMachine_getObjectField(virtualMachine, array, "values", 6);
-    return bytes;
+    return ZEN_STRING_GET_BYTES(string);
 }
 
 uint8_t* zen_ByteArray_toCString(zen_VirtualMachine_t* virtualMachine,
     zen_Object_t* array, int32_t* resultSize) {
-    uint8_t* bytes = zen_VirtualMachine_getObjectField(virtualMachine, array, "values", 6);
-    int32_t size = (int32_t)zen_VirtualMachine_getObjectField(virtualMachine, array, "size", 4);
+    uint8_t* bytes = ZEN_ARRAY_GET_ELEMENTS(array, uint8_t);
+    int32_t size = ZEN_ARRAY_LENGTH(array);
 
     if (resultSize != NULL) {
         *resultSize = size;
@@ -517,8 +629,13 @@ uint8_t* zen_ByteArray_toCString(zen_VirtualMachine_t* virtualMachine,
 
 uint8_t* zen_String_toCString(zen_VirtualMachine_t* virtualMachine,
     zen_Object_t* string, int32_t* resultSize) {
-    zen_Object_t* value = zen_VirtualMachine_getObjectField(virtualMachine, string, "value", 5);
-    return zen_ByteArray_toCString(virtualMachine, value, resultSize);
+    int32_t size = ZEN_STRING_SIZE(string);
+
+    if (resultSize != NULL) {
+        *resultSize = size;
+    }
+
+    return jtk_CString_newEx(ZEN_STRING_GET_BYTES(string), size);
 }
 
 zen_Object_t* zen_ZenKernel_invoke(zen_VirtualMachine_t* virtualMachine,
@@ -529,7 +646,7 @@ zen_Object_t* zen_ZenKernel_invoke(zen_VirtualMachine_t* virtualMachine,
     int32_t nameSize;
     uint8_t* name0 = zen_String_toCString(virtualMachine, name, &nameSize);
 
-    zen_Class_t* targetClass = zen_Object_getClass(object);
+    zen_Class_t* targetClass = zen_Object_getClass(virtualMachine, object);
     // TODO: Change getStaticFunction() to getVirtualFunction()
     zen_Function_t* function = zen_VirtualMachine_getStaticFunction(virtualMachine,
         targetClass, name0, nameSize, "(zen/core/Object):v", 19);
@@ -539,23 +656,33 @@ zen_Object_t* zen_ZenKernel_invoke(zen_VirtualMachine_t* virtualMachine,
     return zen_Interpreter_invokeVirtualFunction(virtualMachine->m_interpreter, function, object, NULL);
 }
 
+/* The arguments of the target function are passed in a reference array,
+ * whose elements are handed to the interpreter in place, without copying
+ * them. The array itself is rooted by the native handles of the caller.
+ */
+static void zen_ZenKernel_wrapArguments(zen_Object_t* array, jtk_Array_t* result) {
+    result->m_values = ZEN_ARRAY_GET_ELEMENTS(array, void*);
+    result->m_size = ZEN_ARRAY_LENGTH(array);
+}
+
 zen_Object_t* zen_ZenKernel_invokeEx(zen_VirtualMachine_t* virtualMachine,
     zen_Object_t* class0, jtk_Array_t* arguments){
     zen_Object_t* object = (zen_Object_t*)jtk_Array_getValue(arguments, 0);
     zen_Object_t* targetFunctionName = (zen_Object_t*)jtk_Array_getValue(arguments, 1);
-    jtk_Array_t* targetArguments = (jtk_Array_t*)jtk_Array_getValue(arguments, 2);
+    jtk_Array_t targetArguments;
+    zen_ZenKernel_wrapArguments((zen_Object_t*)jtk_Array_getValue(arguments, 2), &targetArguments);
 
     jtk_StringBuilder_t* builder = jtk_StringBuilder_new();
     jtk_StringBuilder_appendEx_z(builder, "(zen/core/Object):", 18);
     int32_t i;
-    int32_t parameterCount = jtk_Array_getSize(targetArguments);
+    int32_t parameterCount = targetArguments.m_size;
     for (i = 0; i < parameterCount; i++) {
         jtk_StringBuilder_appendEx_z(builder, "(zen/core/Object)", 17);
     }
 
     int32_t targetFunctionDescriptorSize;
     uint8_t* targetFunctionDescriptor = jtk_StringBuilder_toCString(builder, &targetFunctionDescriptorSize);
-    zen_Class_t* targetClass = zen_Object_getClass(object);
+    zen_Class_t* targetClass = zen_Object_getClass(virtualMachine, object);
     int32_t targetFunctionName0Size;
     uint8_t* targetFunctionName0 = zen_String_toCString(virtualMachine, targetFunctionName, &targetFunctionName0Size);
 
@@ -568,15 +695,16 @@ zen_Object_t* zen_ZenKernel_invokeEx(zen_VirtualMachine_t* virtualMachine,
 
 
     return zen_Interpreter_invokeVirtualFunction(virtualMachine->m_interpreter, targetFunction,
-        object, targetArguments);
+        object, &targetArguments);
 }
 
 zen_Object_t* zen_ZenKernel_invokeStaticEx(zen_VirtualMachine_t* virtualMachine,
     zen_Object_t* class0, jtk_Array_t* arguments) {
     zen_Object_t* entity = (zen_Object_t*)jtk_Array_getValue(arguments, 0);
     zen_Object_t* targetFunctionName = (zen_Object_t*)jtk_Array_getValue(arguments, 1);
-    jtk_Array_t* targetArguments = (jtk_Array_t*)jtk_Array_getValue(arguments, 2);
-    int32_t argumentCount = jtk_Array_getSize(targetArguments);
+    jtk_Array_t targetArguments;
+    zen_ZenKernel_wrapArguments((zen_Object_t*)jtk_Array_getValue(arguments, 2), &targetArguments);
+    int32_t argumentCount = targetArguments.m_size;
 
     /*
     jtk_StringBuilder_t* builder = jtk_StringBuilder_new();
@@ -614,7 +742,7 @@ zen_Object_t* zen_ZenKernel_invokeStaticEx(zen_VirtualMachine_t* virtualMachine,
     jtk_CString_delete(entity0);
 
     return zen_Interpreter_invokeStaticFunction(virtualMachine->m_interpreter, targetFunction,
-        targetArguments);
+        &targetArguments);
 }
 
 /*
@@ -688,7 +816,7 @@ zen_Object_t* zen_ZenKernel_evaluate(zen_VirtualMachine_t* virtualMachine,
 
     uint8_t* symbolBytes = zen_VirtualMachine_getStringBytes(virtualMachine, symbol);
     int32_t symbolSize = zen_VirtualMachine_getStringSize(virtualMachine, symbol);
-    zen_Class_t* targetClass = zen_Object_getClass(operand1);
+    zen_Class_t* targetClass = zen_Object_getClass(virtualMachine, operand1);
 
     int32_t targetFunctionNameSize = -1;
     uint8_t* targetFunctionName = NULL;
@@ -784,7 +912,8 @@ zen_Object_t* zen_ZenKernel_evaluate(zen_VirtualMachine_t* virtualMachine,
     return result;
 }
 
-// `this.j = 1` translates to `ZenKernel.storeField(new Integer(1), this, "j")`
+// `ZenKernel.storeField(value, self, "j")` stores a field whose name is known
+// only at run time. Member access is compiled to the field instructions.
 zen_Object_t* zen_ZenKernel_storeField(zen_VirtualMachine_t* virtualMachine,
     zen_Object_t* class0, jtk_Array_t* arguments) {
     zen_Object_t* value = (zen_Object_t*)jtk_Array_getValue(arguments, 0);
@@ -822,15 +951,22 @@ zen_Object_t* zen_ZenKernel_loadField(zen_VirtualMachine_t* virtualMachine,
 zen_VirtualMachine_t* zen_VirtualMachine_new(zen_VirtualMachineConfiguration_t* configuration) {
     jtk_Assert_assertObject(configuration, "The specified virtual machine configuration is null.");
 
-    jtk_ObjectAdapter_t* stringObjectAdapter = jtk_CStringObjectAdapter_getInstance();
     jtk_Iterator_t* entityDirectoryIterator = jtk_ArrayList_getIterator(configuration->m_entityDirectories);
 
     zen_VirtualMachine_t* virtualMachine = zen_Memory_allocate(zen_VirtualMachine_t, 1);
     virtualMachine->m_configuration = configuration;
+    /* The collector and the class loader refer to the class table. */
+    virtualMachine->m_classTable = zen_ClassTable_new();
+    virtualMachine->m_memoryManager = zen_MemoryManager_new(virtualMachine,
+        configuration->m_heapBudget, configuration->m_nurserySize,
+        configuration->m_garbageCollectorThreadCount, configuration->m_maximumPauseTime,
+        configuration->m_maximumHeapSize, configuration->m_hugePages);
     virtualMachine->m_classLoader = zen_ClassLoader_new(virtualMachine, entityDirectoryIterator);
-    virtualMachine->m_interpreter = zen_Interpreter_new(NULL, virtualMachine, NULL);
-    virtualMachine->m_nativeFunctions = jtk_HashMap_newEx(stringObjectAdapter, NULL,
-        JTK_HASH_MAP_DEFAULT_CAPACITY, JTK_HASH_MAP_DEFAULT_LOAD_FACTOR);
+    virtualMachine->m_interpreter = zen_Interpreter_new(virtualMachine->m_memoryManager,
+        virtualMachine, NULL);
+    virtualMachine->m_nativeFunctions = NULL;
+    virtualMachine->m_booleans[0] = NULL;
+    virtualMachine->m_booleans[1] = NULL;
 #ifdef JTK_LOGGER_DISABLE
     virtualMachine->m_logger = NULL;
 #else
@@ -839,6 +975,10 @@ zen_VirtualMachine_t* zen_VirtualMachine_new(zen_VirtualMachineConfiguration_t*
 #endif
 
     zen_VirtualMachine_loadDefaultLibraries(virtualMachine);
+    /* The native functions of the core classes are bound when the classes are
+     * loaded. Therefore, the core classes are loaded after the libraries.
+     */
+    zen_VirtualMachine_loadCoreClasses(virtualMachine);
 
     return virtualMachine;
 }
@@ -850,46 +990,125 @@ void zen_VirtualMachine_delete(zen_VirtualMachine_t* virtualMachine) {
 
     zen_VirtualMachine_unloadLibraries(virtualMachine);
 
+    zen_MemoryManager_delete(virtualMachine->m_memoryManager);
     zen_ClassLoader_delete(virtualMachine->m_classLoader);
+    zen_ClassTable_delete(virtualMachine->m_classTable);
     jtk_Memory_deallocate(virtualMachine);
 }
 
 // Array
 
-zen_ObjectArray_t* zen_VirtualMachine_newByteArray(
-    zen_VirtualMachine_t* virtualMachine, int8_t* bytes, int32_t size) {
-    const uint8_t* arrayDescriptor = "zen/core/Array";
-    int32_t arrayDescriptorSize = 14;
-    const uint8_t* constructorDescriptor = "v:v";
-    int32_t constructorDescriptorSize = 3;
+/* Arrays do not invoke a constructor. */
+zen_Object_t* zen_VirtualMachine_newArray(zen_VirtualMachine_t* virtualMachine,
+    zen_Type_t type, int32_t length) {
+    jtk_Assert_assertObject(virtualMachine, "The specified virtual machine is null.");
 
-    zen_Object_t* result = zen_VirtualMachine_newObjectEx(virtualMachine,
-        arrayDescriptor, arrayDescriptorSize, constructorDescriptor,
-        constructorDescriptorSize, NULL);
-    uint8_t* values = jtk_Arrays_clone_b(bytes, size);
+    zen_Class_t* arrayClass = virtualMachine->m_coreClasses.m_arrayClass;
+    if (arrayClass == NULL) {
+        arrayClass = zen_VirtualMachine_getClass(virtualMachine, "zen/core/Array", 14);
+    }
 
-    zen_VirtualMachine_setObjectField(virtualMachine, result, "values", 6, values);
-    // TODO: Change setObjectField to setIntegerField!
-    zen_VirtualMachine_setObjectField(virtualMachine, result, "size", 4, size);
+    zen_Object_t* result = NULL;
+    if ((length < 0) || (length > ZEN_ARRAY_MAXIMUM_LENGTH) ||
+        (zen_Array_getElementSize(type) == 0)) {
+        zen_VirtualMachine_raiseInvalidArraySizeException(virtualMachine, length);
+    }
+    else if (arrayClass != NULL) {
+        /* The allocation is clean, therefore, the elements are initialized
+         * to zero. The allocation may trigger a collection.
+         */
+        zen_MemoryManager_t* manager = virtualMachine->m_memoryManager;
+        uint8_t* memory;
+        ZEN_MEMORY_MANAGER_ALLOCATE_LOCAL(manager,
+            &virtualMachine->m_interpreter->m_allocationBuffer,
+            zen_Array_getAllocationSize(type, length), memory);
+        result = (zen_Object_t*)memory;
+        ZEN_OBJECT_HEADER(result) = ZEN_OBJECT_HEADER_NEW(arrayClass->m_index);
+        ZEN_ARRAY_LENGTH(result) = length;
+        ZEN_ARRAY_ELEMENT_TYPE(result) = (uint8_t)type;
+        /* Only the elements of a reference array are traced by the garbage
+         * collector.
+         */
+        zen_MemoryManager_setObjectType(manager, result, (type == ZEN_TYPE_REFERENCE)?
+            ZEN_OBJECT_TYPE_REFERENCE_ARRAY : ZEN_OBJECT_TYPE_PRIMITIVE_ARRAY);
+    }
 
     return result;
 }
 
-zen_ObjectArray_t* zen_VirtualMachine_newObjectArray(
+zen_Object_t* zen_VirtualMachine_newMultidimensionalArray(
+    zen_VirtualMachine_t* virtualMachine, const int32_t* lengths, int32_t dimensions) {
+    jtk_Assert_assertObject(virtualMachine, "The specified virtual machine is null.");
+    jtk_Assert_assertObject(lengths, "The specified lengths are null.");
+    jtk_Assert_assertTrue(dimensions > 0, "The specified number of dimensions is invalid.");
+
+    zen_Object_t* result = zen_VirtualMachine_newArray(virtualMachine,
+        ZEN_TYPE_REFERENCE, lengths[0]);
+    if ((result != NULL) && (dimensions > 1)) {
+        /* The array should survive the allocation of its elements. A handle
+         * pins the array, therefore, it is not moved either.
+         */
+        zen_MemoryManager_t* manager = virtualMachine->m_memoryManager;
+        int32_t handleCount = zen_MemoryManager_getHandleCount(manager);
+        zen_MemoryManager_pushHandle(manager, result);
+
+        zen_Object_t** elements = ZEN_ARRAY_GET_ELEMENTS(result, zen_Object_t*);
+        int32_t i;
+        for (i = 0; (i < lengths[0]) && (result != NULL); i++) {
+            zen_Object_t* element = zen_VirtualMachine_newMultidimensionalArray(
+                virtualMachine, lengths + 1, dimensions - 1);
+            if (element != NULL) {
+                elements[i] = element;
+                ZEN_MEMORY_MANAGER_WRITE_BARRIER(manager, result, element);
+            }
+            else {
+                /* An exception was raised by the allocation of the element. */
+                result = NULL;
+            }
+        }
+
+        zen_MemoryManager_popHandles(manager, handleCount);
+    }
+
+    return result;
+}
+
+zen_Object_t* zen_VirtualMachine_newByteArray(
+    zen_VirtualMachine_t* virtualMachine, int8_t* bytes, int32_t size) {
+    zen_Object_t* result = zen_VirtualMachine_newArray(virtualMachine,
+        ZEN_TYPE_INTEGER_8, size);
+    /* The bytes are copied straight into the array. */
+    if ((result != NULL) && (size > 0)) {
+        memcpy(ZEN_ARRAY_GET_ELEMENTS(result, int8_t), bytes, size);
+    }
+
+    return result;
+}
+
+zen_Object_t* zen_VirtualMachine_newObjectArray(
     zen_VirtualMachine_t* virtualMachine, void** objects, int32_t size) {
-    const uint8_t* arrayDescriptor = "zen/core/Array";
-    int32_t arrayDescriptorSize = 14;
-    const uint8_t* constructorDescriptor = "v:v";
-    int32_t constructorDescriptorSize = 3;
+    /* The objects should survive the allocation of the array. */
+    zen_MemoryManager_t* manager = virtualMachine->m_memoryManager;
+    int32_t handleCount = zen_MemoryManager_getHandleCount(manager);
+    int32_t i;
+    for (i = 0; i < size; i++) {
+        zen_MemoryManager_pushHandle(manager, (zen_Object_t*)objects[i]);
+    }
 
-    zen_Object_t* result = zen_VirtualMachine_newObjectEx(virtualMachine,
-        arrayDescriptor, arrayDescriptorSize, constructorDescriptor,
-        constructorDescriptorSize, NULL);
-    uint8_t* values = jtk_Arrays_clone_v(objects, size);
+    zen_Object_t* result = zen_VirtualMachine_newArray(virtualMachine,
+        ZEN_TYPE_REFERENCE, size);
+    zen_MemoryManager_popHandles(manager, handleCount);
 
-    zen_VirtualMachine_setObjectField(virtualMachine, result, "values", 6, values);
-    // TODO: Change setObjectField to setIntegerField!
-    zen_VirtualMachine_setObjectField(virtualMachine, result, "size", 4, size);
+    if (result != NULL) {
+        zen_Object_t** elements = ZEN_ARRAY_GET_ELEMENTS(result, zen_Object_t*);
+        for (i = 0; i < size; i++) {
+            elements[i] = (zen_Object_t*)objects[i];
+            /* The array is allocated in the old generation when it does not
+             * fit in the new generation, whereas the elements may be young.
+             */
+            ZEN_MEMORY_MANAGER_WRITE_BARRIER(manager, result, objects[i]);
+        }
+    }
 
     return result;
 }
@@ -900,23 +1119,43 @@ zen_Object_t* zen_VirtualMachine_newBoolean(zen_VirtualMachine_t* virtualMachine
     bool value) {
     jtk_Assert_assertObject(virtualMachine, "The specified virtual machine is null.");
 
-    zen_Interpreter_t* interpreter = virtualMachine->m_interpreter;
-
-    const uint8_t* booleanClassDescriptor = "zen/core/Boolean";
-    int32_t booleanClassDescriptorSize = 16;
-    const uint8_t* booleanConstructorDescriptor = "v:(zen/core/Object)";
-    int32_t booleanConstructorDescriptorSize = 19;
-
-    jtk_Array_t* arguments = jtk_Array_new(1);
-    jtk_Array_setValue(arguments, 0, (void*)(int64_t)value);
+    int32_t index = value? 1 : 0;
+    zen_Object_t* result = virtualMachine->m_booleans[index];
+    if (result == NULL) {
+        void* values[1] = { (void*)(int64_t)index };
+        jtk_Array_t arguments;
+        arguments.m_values = values;
+        arguments.m_size = 1;
+
+        zen_Function_t* constructor = virtualMachine->m_coreClasses.m_booleanConstructor;
+        if (constructor != NULL) {
+            result = zen_VirtualMachine_makeObjectEx(virtualMachine, constructor, &arguments);
+        }
+        else {
+            result = zen_VirtualMachine_newObjectEx(virtualMachine, "zen/core/Boolean", 16,
+                "v:(zen/core/Object)", 19, &arguments);
+        }
+        virtualMachine->m_booleans[index] = result;
+    }
 
-    zen_Object_t* result = zen_VirtualMachine_newObjectEx(interpreter->m_virtualMachine,
-        booleanClassDescriptor, booleanClassDescriptorSize, booleanConstructorDescriptor,
-        booleanConstructorDescriptorSize, arguments);
+    return result;
+}
 
-    jtk_Array_delete(arguments);
+bool zen_VirtualMachine_getBooleanValue(zen_VirtualMachine_t* virtualMachine,
+    zen_Object_t* boolean) {
+    jtk_Assert_assertObject(virtualMachine, "The specified virtual machine is null.");
 
-    return result;
+    zen_FieldHandle_t* handle = &virtualMachine->m_coreClasses.m_booleanValue;
+    int64_t value;
+    if ((boolean != NULL) && !ZEN_OBJECT_IS_SMALL_INTEGER(boolean) &&
+        ZEN_FIELD_HANDLE_IS_RESOLVED(handle) &&
+        (zen_Object_getClass(virtualMachine, boolean) == handle->m_class)) {
+        value = (int64_t)ZEN_FIELD_HANDLE_GET_REFERENCE(handle, boolean);
+    }
+    else {
+        value = (int64_t)zen_VirtualMachine_getObjectField(virtualMachine, boolean, "value", 5);
+    }
+    return value != 0;
 }
 
 // Class
@@ -951,6 +1190,40 @@ zen_Class_t* zen_VirtualMachine_getClass(zen_VirtualMachine_t* virtualMachine,
     return class0;
 }
 
+/* The classes are looked up without raising an exception, because the core
+ * classes may be unavailable, for example, when the core library is being
+ * built.
+ */
+void zen_VirtualMachine_loadCoreClasses(zen_VirtualMachine_t* virtualMachine) {
+    jtk_Assert_assertObject(virtualMachine, "The specified virtual machine is null.");
+
+    zen_ClassLoader_t* classLoader = virtualMachine->m_classLoader;
+    zen_CoreClasses_t* coreClasses = &virtualMachine->m_coreClasses;
+
+    coreClasses->m_integerClass = zen_ClassLoader_findClass(classLoader, "zen/core/Integer", 16);
+    coreClasses->m_integerConstructor = NULL;
+    coreClasses->m_integerValue.m_class = NULL;
+    if (coreClasses->m_integerClass != NULL) {
+        coreClasses->m_integerConstructor = zen_Class_getConstructor(coreClasses->m_integerClass,
+            "v:(zen/core/Object)", 19);
+        zen_FieldHandle_initialize(&coreClasses->m_integerValue, coreClasses->m_integerClass,
+            "value", 5);
+    }
+
+    coreClasses->m_booleanClass = zen_ClassLoader_findClass(classLoader, "zen/core/Boolean", 16);
+    coreClasses->m_booleanConstructor = NULL;
+    coreClasses->m_booleanValue.m_class = NULL;
+    if (coreClasses->m_booleanClass != NULL) {
+        coreClasses->m_booleanConstructor = zen_Class_getConstructor(coreClasses->m_booleanClass,
+            "v:(zen/core/Object)", 19);
+        zen_FieldHandle_initialize(&coreClasses->m_booleanValue, coreClasses->m_booleanClass,
+            "value", 5);
+    }
+
+    coreClasses->m_stringClass = zen_ClassLoader_findClass(classLoader, "zen/core/String", 15);
+    coreClasses->m_arrayClass = zen_ClassLoader_findClass(classLoader, "zen/core/Array", 14);
+}
+
 // Clear
 
 bool zen_VirtualMachine_isClear(zen_VirtualMachine_t* virtualMachine) {
@@ -1025,18 +1298,28 @@ void zen_VirtualMachine_setObjectField(zen_VirtualMachine_t* virtualMachine,
     if (object == NULL) {
         zen_VirtualMachine_raiseNullReferenceException(virtualMachine);
     }
+    else if (ZEN_OBJECT_IS_SMALL_INTEGER(object)) {
+        /* Small integers are immutable. */
+        zen_VirtualMachine_raiseUnknownFieldException(virtualMachine, fieldDescriptor,
+            fieldDescriptorSize);
+    }
     else {
-        zen_Class_t* class0 = *((zen_Class_t**)((uint8_t*)object + ZEN_OBJECT_HEADER_CLASS_OFFSET));
-        int32_t offset = zen_Class_findFieldOffset(class0, fieldDescriptor, fieldDescriptorSize);
-        if (offset < 0) {
+        zen_Class_t* class0 = zen_Object_getClass(virtualMachine, object);
+        zen_Field_t* field0 = zen_Class_findField(class0, fieldDescriptor, fieldDescriptorSize);
+        /* The primitive fields are accessed through the typed accessors. */
+        if ((field0 == NULL) || !zen_Field_isReference(field0)) {
             zen_VirtualMachine_raiseUnknownFieldException(virtualMachine, fieldDescriptor,
                 fieldDescriptorSize);
         }
         else {
-            *((zen_Object_t**)((uint8_t*)object + ZEN_OBJECT_HEADER_SIZE + offset)) = value;
+            zen_Object_t** field = (zen_Object_t**)((uint8_t*)object + ZEN_OBJECT_HEADER_SIZE +
+                field0->m_offset);
+            ZEN_MEMORY_MANAGER_PRE_WRITE_BARRIER(virtualMachine->m_memoryManager, field);
+            *field = value;
+            ZEN_MEMORY_MANAGER_WRITE_BARRIER(virtualMachine->m_memoryManager, object, value);
             // memcpy((uint8_t*)object + ZEN_OBJECT_HEADER_SIZE + offset, &value, sizeof (zen_Object_t*));
         }
-        // hexDump(NULL, object, class0->m_memoryRequirement + ZEN_OBJECT_HEADER_CLASS_SIZE);
+        // hexDump(NULL, object, class0->m_memoryRequirement + ZEN_OBJECT_HEADER_SIZE);
     }
 }
 
@@ -1048,225 +1331,444 @@ zen_Object_t* zen_VirtualMachine_getObjectField(zen_VirtualMachine_t* virtualMac
     if (object == NULL) {
         zen_VirtualMachine_raiseNullReferenceException(virtualMachine);
     }
+    else if (ZEN_OBJECT_IS_SMALL_INTEGER(object)) {
+        /* The value of a small integer is stored in the reference itself. */
+        if (jtk_CString_equals(fieldName, fieldNameSize, "value", 5)) {
+            result = (zen_Object_t*)(intptr_t)ZEN_OBJECT_GET_SMALL_INTEGER(object);
+        }
+        else {
+            zen_VirtualMachine_raiseUnknownFieldException(virtualMachine, fieldName,
+                fieldNameSize);
+        }
+    }
     else {
-        zen_Class_t** classField = (zen_Class_t**)((uint8_t*)object + ZEN_OBJECT_HEADER_CLASS_OFFSET);
-        zen_Class_t* class0 = *classField;
-        int32_t offset = zen_Class_findFieldOffset(class0, fieldName, fieldNameSize);
-        if (offset < 0) {
+        zen_Class_t* class0 = zen_Object_getClass(virtualMachine, object);
+        zen_Field_t* field = zen_Class_findField(class0, fieldName, fieldNameSize);
+        if ((field == NULL) || !zen_Field_isReference(field)) {
             zen_VirtualMachine_raiseUnknownFieldException(virtualMachine, fieldName,
                 fieldNameSize);
         }
         else {
-            result = *((zen_Object_t**)((uint8_t*)object + ZEN_OBJECT_HEADER_SIZE + offset));
+            result = *((zen_Object_t**)((uint8_t*)object + ZEN_OBJECT_HEADER_SIZE + field->m_offset));
         }
-        // hexDump(NULL, object, class0->m_memoryRequirement + ZEN_OBJECT_HEADER_CLASS_SIZE);
+        // hexDump(NULL, object, class0->m_memoryRequirement + ZEN_OBJECT_HEADER_SIZE);
     }
 
     return result;
 }
 
-// Integer
+bool zen_VirtualMachine_resolveFieldHandle(zen_VirtualMachine_t* virtualMachine,
+    zen_FieldHandle_t* handle, const uint8_t* classDescriptor, int32_t classDescriptorSize,
+    const uint8_t* fieldName, int32_t fieldNameSize) {
+    jtk_Assert_assertObject(virtualMachine, "The specified virtual machine is null.");
+    jtk_Assert_assertObject(handle, "The specified field handle is null.");
 
-zen_Object_t* zen_VirtualMachine_newInteger(zen_VirtualMachine_t* virtualMachine,
+    bool result = false;
+    handle->m_class = NULL;
+    zen_Class_t* class0 = zen_VirtualMachine_getClass(virtualMachine, classDescriptor,
+        classDescriptorSize);
+    if (class0 != NULL) {
+        result = zen_FieldHandle_initialize(handle, class0, fieldName, fieldNameSize);
+        if (!result) {
+            zen_VirtualMachine_raiseUnknownFieldException(virtualMachine, fieldName,
+                fieldNameSize);
+        }
+    }
+
+    return result;
+}
+
+/* Finds the primitive field with the specified name. An exception is raised
+ * if the object is null or a small integer, or if no such field exists.
+ */
+static zen_Field_t* zen_VirtualMachine_findPrimitiveField(zen_VirtualMachine_t* virtualMachine,
+    zen_Object_t* object, const uint8_t* fieldName, int32_t fieldNameSize) {
+    zen_Field_t* result = NULL;
+    if (object == NULL) {
+        zen_VirtualMachine_raiseNullReferenceException(virtualMachine);
+    }
+    else {
+        if (!ZEN_OBJECT_IS_SMALL_INTEGER(object)) {
+            result = zen_Class_findField(zen_Object_getClass(virtualMachine, object),
+                fieldName, fieldNameSize);
+            if ((result != NULL) && zen_Field_isReference(result)) {
+                result = NULL;
+            }
+        }
+
+        if (result == NULL) {
+            zen_VirtualMachine_raiseUnknownFieldException(virtualMachine, fieldName,
+                fieldNameSize);
+        }
+    }
+    return result;
+}
+
+void zen_VirtualMachine_setIntegerField(zen_VirtualMachine_t* virtualMachine,
+    zen_Object_t* object, const uint8_t* fieldName, int32_t fieldNameSize,
     int64_t value) {
     jtk_Assert_assertObject(virtualMachine, "The specified virtual machine is null.");
 
-    zen_Interpreter_t* interpreter = virtualMachine->m_interpreter;
+    zen_Field_t* field = zen_VirtualMachine_findPrimitiveField(virtualMachine, object,
+        fieldName, fieldNameSize);
+    if (field != NULL) {
+        uint8_t* address = (uint8_t*)object + ZEN_OBJECT_HEADER_SIZE + field->m_offset;
+        switch (field->m_type) {
+            case ZEN_FIELD_TYPE_BOOLEAN: {
+                *((uint8_t*)address) = (value != 0);
+                break;
+            }
 
-    const uint8_t* integerClassDescriptor = "zen/core/Integer";
-    int32_t integerClassDescriptorSize = 16;
-    const uint8_t* integerConstructorDescriptor = "v:(zen/core/Object)";
-    int32_t integerConstructorDescriptorSize = 19;
+            case ZEN_FIELD_TYPE_BYTE: {
+                *((int8_t*)address) = (int8_t)value;
+                break;
+            }
+
+            case ZEN_FIELD_TYPE_SHORT: {
+                *((int16_t*)address) = (int16_t)value;
+                break;
+            }
+
+            case ZEN_FIELD_TYPE_INTEGER: {
+                *((int32_t*)address) = (int32_t)value;
+                break;
+            }
+
+            case ZEN_FIELD_TYPE_LONG: {
+                *((int64_t*)address) = value;
+                break;
+            }
 
-    jtk_Array_t* arguments = jtk_Array_new(1);
-    jtk_Array_setValue(arguments, 0, value);
+            case ZEN_FIELD_TYPE_FLOAT: {
+                *((float*)address) = (float)value;
+                break;
+            }
+
+            case ZEN_FIELD_TYPE_DOUBLE: {
+                *((double*)address) = (double)value;
+                break;
+            }
 
-    zen_Object_t* result = zen_VirtualMachine_newObjectEx(interpreter->m_virtualMachine,
-        integerClassDescriptor, integerClassDescriptorSize, integerConstructorDescriptor,
-        integerConstructorDescriptorSize, arguments);
+            default: {
+                break;
+            }
+        }
+    }
+}
 
-    jtk_Array_delete(arguments);
+int64_t zen_VirtualMachine_getIntegerField(zen_VirtualMachine_t* virtualMachine,
+    zen_Object_t* object, const uint8_t* fieldName, int32_t fieldNameSize) {
+    jtk_Assert_assertObject(virtualMachine, "The specified virtual machine is null.");
+
+    int64_t result = 0;
+    zen_Field_t* field = zen_VirtualMachine_findPrimitiveField(virtualMachine, object,
+        fieldName, fieldNameSize);
+    if (field != NULL) {
+        uint8_t* address = (uint8_t*)object + ZEN_OBJECT_HEADER_SIZE + field->m_offset;
+        switch (field->m_type) {
+            case ZEN_FIELD_TYPE_BOOLEAN: {
+                result = *((uint8_t*)address);
+                break;
+            }
+
+            case ZEN_FIELD_TYPE_BYTE: {
+                result = *((int8_t*)address);
+                break;
+            }
+
+            case ZEN_FIELD_TYPE_SHORT: {
+                result = *((int16_t*)address);
+                break;
+            }
+
+            case ZEN_FIELD_TYPE_INTEGER: {
+                result = *((int32_t*)address);
+                break;
+            }
+
+            case ZEN_FIELD_TYPE_LONG: {
+                result = *((int64_t*)address);
+                break;
+            }
+
+            case ZEN_FIELD_TYPE_FLOAT: {
+                result = (int64_t)*((float*)address);
+                break;
+            }
 
+            case ZEN_FIELD_TYPE_DOUBLE: {
+                result = (int64_t)*((double*)address);
+                break;
+            }
+
+            default: {
+                break;
+            }
+        }
+    }
     return result;
 }
 
-// Libraries
+void zen_VirtualMachine_setDecimalField(zen_VirtualMachine_t* virtualMachine,
+    zen_Object_t* object, const uint8_t* fieldName, int32_t fieldNameSize,
+    double value) {
+    jtk_Assert_assertObject(virtualMachine, "The specified virtual machine is null.");
 
-// TODO: registerNativeFunction() should accept full class descriptor not just the name!
-void zen_VirtualMachine_loadDefaultLibraries(zen_VirtualMachine_t* virtualMachine) {
+    zen_Field_t* field = zen_VirtualMachine_findPrimitiveField(virtualMachine, object,
+        fieldName, fieldNameSize);
+    if (field != NULL) {
+        uint8_t* address = (uint8_t*)object + ZEN_OBJECT_HEADER_SIZE + field->m_offset;
+        if (field->m_type == ZEN_FIELD_TYPE_FLOAT) {
+            *((float*)address) = (float)value;
+        }
+        else if (field->m_type == ZEN_FIELD_TYPE_DOUBLE) {
+            *((double*)address) = value;
+        }
+        else {
+            zen_VirtualMachine_setIntegerField(virtualMachine, object, fieldName,
+                fieldNameSize, (int64_t)value);
+        }
+    }
+}
+
+double zen_VirtualMachine_getDecimalField(zen_VirtualMachine_t* virtualMachine,
+    zen_Object_t* object, const uint8_t* fieldName, int32_t fieldNameSize) {
     jtk_Assert_assertObject(virtualMachine, "The specified virtual machine is null.");
 
-    /*
-     * TODO: Should we associate native functions with their respective classes?
-     * As of now, only the classes are associated with the native functions.
-     * In other words, there exists a unidirectional relationship between classes
-     * and native functions, with the class owning the native function.
+    double result = 0.0;
+    zen_Field_t* field = zen_VirtualMachine_findPrimitiveField(virtualMachine, object,
+        fieldName, fieldNameSize);
+    if (field != NULL) {
+        uint8_t* address = (uint8_t*)object + ZEN_OBJECT_HEADER_SIZE + field->m_offset;
+        if (field->m_type == ZEN_FIELD_TYPE_FLOAT) {
+            result = *((float*)address);
+        }
+        else if (field->m_type == ZEN_FIELD_TYPE_DOUBLE) {
+            result = *((double*)address);
+        }
+        else {
+            result = (double)zen_VirtualMachine_getIntegerField(virtualMachine, object,
+                fieldName, fieldNameSize);
+        }
+    }
+    return result;
+}
+
+// Integer
+
+zen_Object_t* zen_VirtualMachine_newInteger(zen_VirtualMachine_t* virtualMachine,
+    int64_t value) {
+    jtk_Assert_assertObject(virtualMachine, "The specified virtual machine is null.");
+
+    zen_CoreClasses_t* coreClasses = &virtualMachine->m_coreClasses;
+
+    /* The class of small integers should be known before a small integer
+     * escapes to code that may ask for it.
      */
+    zen_Object_t* result = NULL;
+    if (ZEN_OBJECT_FITS_SMALL_INTEGER(value) && (coreClasses->m_integerClass != NULL)) {
+        result = ZEN_OBJECT_NEW_SMALL_INTEGER(value);
+    }
+    else {
+        void* values[1] = { (void*)(intptr_t)value };
+        jtk_Array_t arguments;
+        arguments.m_values = values;
+        arguments.m_size = 1;
+
+        if (coreClasses->m_integerConstructor != NULL) {
+            result = zen_VirtualMachine_makeObjectEx(virtualMachine,
+                coreClasses->m_integerConstructor, &arguments);
+        }
+        else {
+            result = zen_VirtualMachine_newObjectEx(virtualMachine, "zen/core/Integer", 16,
+                "v:(zen/core/Object)", 19, &arguments);
+        }
+    }
 
-    // Object Array.setValue(Object index, Object value)
-    zen_VirtualMachine_registerNativeFunction(virtualMachine, "Array", 5,
-        "setValue", 8, "(zen/core/Object):(zen/core/Object)(zen/core/Object)", 52, zen_Array_setValue);
+    return result;
+}
 
-    // Object Array.getValue(Object index, Object value)
-    zen_VirtualMachine_registerNativeFunction(virtualMachine, "Array", 5,
-        "getValue", 8, "(zen/core/Object):(zen/core/Object)", 35, zen_Array_getValue);
+int64_t zen_VirtualMachine_getIntegerValue(zen_VirtualMachine_t* virtualMachine,
+    zen_Object_t* integer) {
+    jtk_Assert_assertObject(virtualMachine, "The specified virtual machine is null.");
 
-    // Object Array.getValue()
-    zen_VirtualMachine_registerNativeFunction(virtualMachine, "Array", 5,
-        "getSize", 7, "(zen/core/Object):v", 19, zen_Array_getSize);
+    zen_FieldHandle_t* handle = &virtualMachine->m_coreClasses.m_integerValue;
+    int64_t result;
+    if (ZEN_OBJECT_IS_SMALL_INTEGER(integer)) {
+        result = ZEN_OBJECT_GET_SMALL_INTEGER(integer);
+    }
+    else if ((integer != NULL) && ZEN_FIELD_HANDLE_IS_RESOLVED(handle) &&
+        (zen_Object_getClass(virtualMachine, integer) == handle->m_class)) {
+        result = (int64_t)ZEN_FIELD_HANDLE_GET_REFERENCE(handle, integer);
+    }
+    else {
+        result = (int64_t)zen_VirtualMachine_getObjectField(virtualMachine, integer, "value", 5);
+    }
+    return result;
+}
 
+// Libraries
 
-    // Object Test.print(Object format)
-    zen_VirtualMachine_registerNativeFunction(virtualMachine, "zen/core/ZenKernel", 18,
-        "print", 5, "(zen/core/Object):(zen/core/Object)", 35, zen_print);
+/* The native functions of the default libraries. The functions which neither
+ * invoke functions written in Zen nor inspect the invocation stack use the
+ * fast calling convention.
+ */
+static zen_NativeFunctionEntry_t zen_VirtualMachine_defaultNativeFunctions[] = {
+    // Object Array.setValue(Object index, Object value)
+    ZEN_NATIVE_FUNCTION_FAST_ENTRY("zen/core/Array", "setValue",
+        "(zen/core/Object):(zen/core/Object)(zen/core/Object)", zen_Array_setValue, 2),
+
+    // Object Array.getValue(Object index)
+    ZEN_NATIVE_FUNCTION_FAST_ENTRY("zen/core/Array", "getValue",
+        "(zen/core/Object):(zen/core/Object)", zen_Array_getValue, 1),
+
+    // Object Array.getSize()
+    ZEN_NATIVE_FUNCTION_FAST_ENTRY("zen/core/Array", "getSize",
+        "(zen/core/Object):v", zen_Array_getSize, 0),
+
+    // Object ZenKernel.print(Object format)
+    ZEN_NATIVE_FUNCTION_FAST_ENTRY("zen/core/ZenKernel", "print",
+        "(zen/core/Object):(zen/core/Object)", zen_print, 1),
 
     // Object Test.print(Object format)
-    zen_VirtualMachine_registerNativeFunction(virtualMachine, "Test", 4,
-        "print", 5, "(zen/core/Object):(zen/core/Object)", 35, zen_print);
+    ZEN_NATIVE_FUNCTION_FAST_ENTRY("Test", "print",
+        "(zen/core/Object):(zen/core/Object)", zen_print, 1),
 
     // Object Test.array(size)
-    zen_VirtualMachine_registerNativeFunction(virtualMachine, "Test", 4,
-        "array", 5, "(zen/core/Object):(zen/core/Object)", 35, zen_array);
+    ZEN_NATIVE_FUNCTION_ENTRY("Test", "array",
+        "(zen/core/Object):(zen/core/Object)", zen_array),
 
     // Object Test.scanInteger()
-    zen_VirtualMachine_registerNativeFunction(virtualMachine, "Test", 4,
-        "scanInteger", 11, "(zen/core/Object):v", 19, zen_scanInteger);
+    ZEN_NATIVE_FUNCTION_ENTRY("Test", "scanInteger",
+        "(zen/core/Object):v", zen_scanInteger),
 
-    // Object Test.scanInteger()
-    zen_VirtualMachine_registerNativeFunction(virtualMachine, "Test", 4,
-        "random", 6, "(zen/core/Object):v", 19, zen_random);
+    // Object Test.random()
+    ZEN_NATIVE_FUNCTION_ENTRY("Test", "random",
+        "(zen/core/Object):v", zen_random),
 
     // Object Test.range(Object start, Object stop)
-    zen_VirtualMachine_registerNativeFunction(virtualMachine, "Test", 4,
-        "range", 5, "(zen/core/Object):(zen/core/Object)(zen/core/Object)", 52, zen_range);
+    ZEN_NATIVE_FUNCTION_ENTRY("Test", "range",
+        "(zen/core/Object):(zen/core/Object)(zen/core/Object)", zen_range),
 
     // Object ZenKernel.invoke(Object object, Object name)
-    zen_VirtualMachine_registerNativeFunction(virtualMachine, "zen/core/ZenKernel", 18,
-        "invoke", 6, "(zen/core/Object):(zen/core/Object)(zen/core/Object)",
-        52, zen_ZenKernel_invoke);
+    ZEN_NATIVE_FUNCTION_ENTRY("zen/core/ZenKernel", "invoke",
+        "(zen/core/Object):(zen/core/Object)(zen/core/Object)", zen_ZenKernel_invoke),
 
     // Object ZenKernel.invokeEx(Object object, Object name, Object ... arguments)
-    zen_VirtualMachine_registerNativeFunction(virtualMachine, "zen/core/ZenKernel", 18,
-        "invokeEx", 8, "(zen/core/Object):(zen/core/Object)(zen/core/Object)@(zen/core/Object)",
-        70, zen_ZenKernel_invokeEx);
+    ZEN_NATIVE_FUNCTION_ENTRY("zen/core/ZenKernel", "invokeEx",
+        "(zen/core/Object):(zen/core/Object)(zen/core/Object)@(zen/core/Object)",
+        zen_ZenKernel_invokeEx),
 
     // Object ZenKernel.invokeStatic(Object className, Object functionName, Object ... arguments)
-    zen_VirtualMachine_registerNativeFunction(virtualMachine, "zen/core/ZenKernel", 18,
-        "invokeStatic", 12, "(zen/core/Object):(zen/core/Object)(zen/core/Object)",
-        52, zen_ZenKernel_invokeStatic);
+    ZEN_NATIVE_FUNCTION_ENTRY("zen/core/ZenKernel", "invokeStatic",
+        "(zen/core/Object):(zen/core/Object)(zen/core/Object)", zen_ZenKernel_invokeStatic),
 
     // Object ZenKernel.invokeStaticEx(Object className, Object functionName, Object ... arguments)
-    zen_VirtualMachine_registerNativeFunction(virtualMachine, "zen/core/ZenKernel", 18,
-        "invokeStaticEx", 14, "(zen/core/Object):(zen/core/Object)(zen/core/Object)@(zen/core/Object)",
-        70, zen_ZenKernel_invokeStaticEx);
+    ZEN_NATIVE_FUNCTION_ENTRY("zen/core/ZenKernel", "invokeStaticEx",
+        "(zen/core/Object):(zen/core/Object)(zen/core/Object)@(zen/core/Object)",
+        zen_ZenKernel_invokeStaticEx),
 
     // Object ZenKernel.evaluate(Object operator, Object operand1, Object operand2)
-    zen_VirtualMachine_registerNativeFunction(virtualMachine, "zen/core/ZenKernel", 18,
-        "evaluate", 8, "(zen/core/Object):(zen/core/Object)(zen/core/Object)(zen/core/Object)",
-        69, zen_ZenKernel_evaluate);
+    ZEN_NATIVE_FUNCTION_ENTRY("zen/core/ZenKernel", "evaluate",
+        "(zen/core/Object):(zen/core/Object)(zen/core/Object)(zen/core/Object)",
+        zen_ZenKernel_evaluate),
 
     // Object ZenKernel.storeField(Object value, Object self, Object name)
-    zen_VirtualMachine_registerNativeFunction(virtualMachine, "zen/core/ZenKernel", 18,
-        "storeField", 10, "(zen/core/Object):(zen/core/Object)(zen/core/Object)(zen/core/Object)",
-        69, zen_ZenKernel_storeField);
+    ZEN_NATIVE_FUNCTION_ENTRY("zen/core/ZenKernel", "storeField",
+        "(zen/core/Object):(zen/core/Object)(zen/core/Object)(zen/core/Object)",
+        zen_ZenKernel_storeField),
 
     // Object ZenKernel.loadField(Object self, Object name)
-    zen_VirtualMachine_registerNativeFunction(virtualMachine, "zen/core/ZenKernel", 18,
-        "loadField", 9, "(zen/core/Object):(zen/core/Object)(zen/core/Object)",
-        52, zen_ZenKernel_loadField);
-
-    // void String.new(value)
-    zen_VirtualMachine_registerNativeFunction(virtualMachine, "zen/core/String", 15,
-        "<initialize>", 12, "v:(zen/core/Object)", 19, zen_String_initialize);
+    ZEN_NATIVE_FUNCTION_ENTRY("zen/core/ZenKernel", "loadField",
+        "(zen/core/Object):(zen/core/Object)(zen/core/Object)", zen_ZenKernel_loadField),
 
     // String String.add(value1, value2)
-    zen_VirtualMachine_registerNativeFunction(virtualMachine, "zen/core/String", 15,
-        "add", 3, "(zen/core/Object):(zen/core/Object)(zen/core/Object)", 52, zen_String_add);
+    ZEN_NATIVE_FUNCTION_FAST_ENTRY("zen/core/String", "add",
+        "(zen/core/Object):(zen/core/Object)(zen/core/Object)", zen_String_add, 2),
 
     // String String.multiply(string, count)
-    zen_VirtualMachine_registerNativeFunction(virtualMachine, "zen/core/String", 15,
-        "multiply", 8, "(zen/core/Object):(zen/core/Object)(zen/core/Object)", 52, zen_String_multiply);
+    ZEN_NATIVE_FUNCTION_FAST_ENTRY("zen/core/String", "multiply",
+        "(zen/core/Object):(zen/core/Object)(zen/core/Object)", zen_String_multiply, 2),
 
-    // Boolean String.equals(string, count)
-    zen_VirtualMachine_registerNativeFunction(virtualMachine, "zen/core/String", 15,
-        "equals", 6, "(zen/core/Object):(zen/core/Object)(zen/core/Object)", 52, zen_String_equals);
+    // Boolean String.equals(string1, string2)
+    ZEN_NATIVE_FUNCTION_FAST_ENTRY("zen/core/String", "equals",
+        "(zen/core/Object):(zen/core/Object)(zen/core/Object)", zen_String_equals, 2),
 
-    // Boolean String.notEquals(string, count)
-    zen_VirtualMachine_registerNativeFunction(virtualMachine, "zen/core/String", 15,
-        "notEquals", 9, "(zen/core/Object):(zen/core/Object)(zen/core/Object)", 52, zen_String_notEquals);
+    // Boolean String.notEquals(string1, string2)
+    ZEN_NATIVE_FUNCTION_FAST_ENTRY("zen/core/String", "notEquals",
+        "(zen/core/Object):(zen/core/Object)(zen/core/Object)", zen_String_notEquals, 2),
 
     // void Integer.new(value)
-    zen_VirtualMachine_registerNativeFunction(virtualMachine, "zen/core/Integer", 16,
-        "<initialize>", 12, "v:(zen/core/Object)", 19, zen_Integer_initialize);
+    ZEN_NATIVE_FUNCTION_ENTRY("zen/core/Integer", "<initialize>",
+        "v:(zen/core/Object)", zen_Integer_initialize),
 
     // Integer Integer.add(value1, value2)
-    zen_VirtualMachine_registerNativeFunction(virtualMachine, "zen/core/Integer", 16,
-        "add", 3, "(zen/core/Object):(zen/core/Object)(zen/core/Object)", 52, zen_Integer_add);
+    ZEN_NATIVE_FUNCTION_FAST_ENTRY("zen/core/Integer", "add",
+        "(zen/core/Object):(zen/core/Object)(zen/core/Object)", zen_Integer_add, 2),
 
     // Integer Integer.subtract(value1, value2)
-    zen_VirtualMachine_registerNativeFunction(virtualMachine, "zen/core/Integer", 16,
-        "subtract", 8, "(zen/core/Object):(zen/core/Object)(zen/core/Object)", 52, zen_Integer_subtract);
+    ZEN_NATIVE_FUNCTION_FAST_ENTRY("zen/core/Integer", "subtract",
+        "(zen/core/Object):(zen/core/Object)(zen/core/Object)", zen_Integer_subtract, 2),
 
     // Integer Integer.multiply(value1, value2)
-    zen_VirtualMachine_registerNativeFunction(virtualMachine, "zen/core/Integer", 16,
-        "multiply", 8, "(zen/core/Object):(zen/core/Object)(zen/core/Object)", 52, zen_Integer_multiply);
+    ZEN_NATIVE_FUNCTION_FAST_ENTRY("zen/core/Integer", "multiply",
+        "(zen/core/Object):(zen/core/Object)(zen/core/Object)", zen_Integer_multiply, 2),
 
     // Integer Integer.divide(value1, value2)
-    zen_VirtualMachine_registerNativeFunction(virtualMachine, "zen/core/Integer", 16,
-        "divide", 6, "(zen/core/Object):(zen/core/Object)(zen/core/Object)", 52, zen_Integer_divide);
+    ZEN_NATIVE_FUNCTION_FAST_ENTRY("zen/core/Integer", "divide",
+        "(zen/core/Object):(zen/core/Object)(zen/core/Object)", zen_Integer_divide, 2),
 
     // Integer Integer.remainder(value1, value2)
-    zen_VirtualMachine_registerNativeFunction(virtualMachine, "zen/core/Integer", 16,
-        "remainder", 9, "(zen/core/Object):(zen/core/Object)(zen/core/Object)", 52, zen_Integer_remainder);
+    ZEN_NATIVE_FUNCTION_FAST_ENTRY("zen/core/Integer", "remainder",
+        "(zen/core/Object):(zen/core/Object)(zen/core/Object)", zen_Integer_remainder, 2),
 
     // Boolean Integer.equals(value1, value2)
-    zen_VirtualMachine_registerNativeFunction(virtualMachine, "zen/core/Integer", 16,
-        "equals", 6, "(zen/core/Object):(zen/core/Object)(zen/core/Object)", 52, zen_Integer_equals);
+    ZEN_NATIVE_FUNCTION_FAST_ENTRY("zen/core/Integer", "equals",
+        "(zen/core/Object):(zen/core/Object)(zen/core/Object)", zen_Integer_equals, 2),
 
     // Boolean Integer.notEquals(value1, value2)
-    zen_VirtualMachine_registerNativeFunction(virtualMachine, "zen/core/Integer", 16,
-        "notEquals", 9, "(zen/core/Object):(zen/core/Object)(zen/core/Object)", 52, zen_Integer_notEquals);
+    ZEN_NATIVE_FUNCTION_FAST_ENTRY("zen/core/Integer", "notEquals",
+        "(zen/core/Object):(zen/core/Object)(zen/core/Object)", zen_Integer_notEquals, 2),
 
     // Boolean Integer.greater(value1, value2)
-    zen_VirtualMachine_registerNativeFunction(virtualMachine, "zen/core/Integer", 16,
-        "greater", 7, "(zen/core/Object):(zen/core/Object)(zen/core/Object)", 52, zen_Integer_greater);
+    ZEN_NATIVE_FUNCTION_FAST_ENTRY("zen/core/Integer", "greater",
+        "(zen/core/Object):(zen/core/Object)(zen/core/Object)", zen_Integer_greater, 2),
 
     // Boolean Integer.greaterOrEqual(value1, value2)
-    zen_VirtualMachine_registerNativeFunction(virtualMachine, "zen/core/Integer", 16,
-        "greaterOrEqual", 14, "(zen/core/Object):(zen/core/Object)(zen/core/Object)", 52, zen_Integer_greaterOrEqual);
+    ZEN_NATIVE_FUNCTION_FAST_ENTRY("zen/core/Integer", "greaterOrEqual",
+        "(zen/core/Object):(zen/core/Object)(zen/core/Object)", zen_Integer_greaterOrEqual, 2),
 
     // Boolean Integer.lesser(value1, value2)
-    zen_VirtualMachine_registerNativeFunction(virtualMachine, "zen/core/Integer", 16,
-        "lesser", 6, "(zen/core/Object):(zen/core/Object)(zen/core/Object)", 52, zen_Integer_lesser);
+    ZEN_NATIVE_FUNCTION_FAST_ENTRY("zen/core/Integer", "lesser",
+        "(zen/core/Object):(zen/core/Object)(zen/core/Object)", zen_Integer_lesser, 2),
 
     // Boolean Integer.lesserOrEqual(value1, value2)
-    zen_VirtualMachine_registerNativeFunction(virtualMachine, "zen/core/Integer", 16,
-        "lesserOrEqual", 13, "(zen/core/Object):(zen/core/Object)(zen/core/Object)", 52, zen_Integer_lesserOrEqual);
+    ZEN_NATIVE_FUNCTION_FAST_ENTRY("zen/core/Integer", "lesserOrEqual",
+        "(zen/core/Object):(zen/core/Object)(zen/core/Object)", zen_Integer_lesserOrEqual, 2),
 
     // void Boolean.new(value)
-    zen_VirtualMachine_registerNativeFunction(virtualMachine, "zen/core/Boolean", 16,
-        "<initialize>", 12, "v:(zen/core/Object)", 19, zen_Boolean_initialize);
+    ZEN_NATIVE_FUNCTION_ENTRY("zen/core/Boolean", "<initialize>",
+        "v:(zen/core/Object)", zen_Boolean_initialize),
 
     // boolean Boolean.getValue()
-    zen_VirtualMachine_registerNativeFunction(virtualMachine, "zen/core/Boolean", 16,
-        "getValue", 8, "(zen/core/Object):v", 19, zen_Boolean_getValue);
+    ZEN_NATIVE_FUNCTION_FAST_ENTRY("zen/core/Boolean", "getValue",
+        "(zen/core/Object):v", zen_Boolean_getValue, 0)
+};
 
+void zen_VirtualMachine_loadDefaultLibraries(zen_VirtualMachine_t* virtualMachine) {
+    jtk_Assert_assertObject(virtualMachine, "The specified virtual machine is null.");
 
-    // TODO: Unload native functions
+    int32_t entryCount = sizeof (zen_VirtualMachine_defaultNativeFunctions) /
+        sizeof (zen_NativeFunctionEntry_t);
+    virtualMachine->m_nativeFunctions = zen_NativeFunctionTable_new(
+        zen_VirtualMachine_defaultNativeFunctions, entryCount);
 }
 
 void zen_VirtualMachine_unloadLibraries(zen_VirtualMachine_t* virtualMachine) {
     jtk_Assert_assertObject(virtualMachine, "The specified virtual machine is null.");
 
-    jtk_Iterator_t* entryIterator = jtk_HashMap_getEntryIterator(virtualMachine->m_nativeFunctions);
-    while (jtk_Iterator_hasNext(entryIterator)) {
-        jtk_HashMapEntry_t* entry = (jtk_HashMapEntry_t*)jtk_Iterator_getNext(entryIterator);
-        uint8_t* key = (uint8_t*)jtk_HashMapEntry_getKey(entry);
-        zen_NativeFunction_t* value = (zen_NativeFunction_t*)jtk_HashMapEntry_getValue(entry);
-
-        jtk_CString_delete(key);
-        zen_NativeFunction_delete(value);
-    }
+    zen_NativeFunctionTable_delete(virtualMachine->m_nativeFunctions);
+    virtualMachine->m_nativeFunctions = NULL;
 }
 
 // Native Function
@@ -1281,54 +1783,9 @@ zen_NativeFunction_t* zen_VirtualMachine_getNativeFunction(
     jtk_Assert_assertObject(functionName, "The specified function name is null.");
     jtk_Assert_assertObject(functionDescriptor, "The specified function descriptor is null.");
 
-    const uint8_t* strings[] = {
-        className,
-        functionName,
-        functionDescriptor
-    };
-    int32_t sizes[] = {
-        classNameSize,
-        functionNameSize,
-        functionDescriptorSize
-    };
-    int32_t keySize;
-    uint8_t* key = jtk_CString_joinAll(strings, sizes, 3, &keySize);
-    zen_NativeFunction_t* result = (zen_NativeFunction_t*)jtk_HashMap_getValue(
-        virtualMachine->m_nativeFunctions, key);
-    jtk_CString_delete(key);
-
-    return result;
-}
-
-zen_NativeFunction_t* zen_VirtualMachine_registerNativeFunction(
-    zen_VirtualMachine_t* virtualMachine, const uint8_t* className,
-    int32_t classNameSize, const uint8_t* functionName, int32_t functionNameSize,
-    const uint8_t* functionDescriptor, int32_t functionDescriptorSize,
-    zen_NativeFunction_InvokeFunction_t function) {
-    jtk_Assert_assertObject(virtualMachine, "The specified virtual machine is null.");
-    jtk_Assert_assertObject(className, "The specified class name is null.");
-    jtk_Assert_assertTrue(classNameSize > 0, "The specified class name size is invalid.");
-    jtk_Assert_assertObject(functionName, "The specified function name is null.");
-    jtk_Assert_assertTrue(functionNameSize > 0, "The specified function name size is invalid.");
-    jtk_Assert_assertObject(functionDescriptor, "The specified function descriptor is null.");
-    jtk_Assert_assertTrue(functionDescriptorSize > 0, "The specified function descriptor size is invalid.");
-
-    zen_NativeFunction_t* nativeFunction = zen_NativeFunction_new(function);
-    const uint8_t* strings[] = {
-        className,
-        functionName,
-        functionDescriptor
-    };
-    int32_t sizes[] = {
-        classNameSize,
-        functionNameSize,
-        functionDescriptorSize
-    };
-    int32_t keySize;
-    uint8_t* key = jtk_CString_joinAll(strings, sizes, 3, &keySize);
-    jtk_HashMap_put(virtualMachine->m_nativeFunctions, key, nativeFunction);
-
-    return nativeFunction;
+    return zen_NativeFunctionTable_find(virtualMachine->m_nativeFunctions,
+        className, classNameSize, functionName, functionNameSize,
+        functionDescriptor, functionDescriptorSize);
 }
 
 // Object
@@ -1336,14 +1793,15 @@ zen_NativeFunction_t* zen_VirtualMachine_registerNativeFunction(
 zen_Object_t* zen_VirtualMachine_allocateObject(zen_VirtualMachine_t* virtualMachine,
     zen_Class_t* class0) {
     /* The allocation should be clean such that all the bits are initialized
-     * to 0.
+     * to 0. The allocation may trigger a collection.
      */
-    zen_Object_t* object = calloc(ZEN_OBJECT_HEADER_SIZE + class0->m_memoryRequirement, sizeof (uint8_t));
-    uintptr_t* classField = (uintptr_t*)((uint8_t*)object + ZEN_OBJECT_HEADER_CLASS_OFFSET);
-    int32_t* hashField = (int32_t*)((uint8_t*)object + ZEN_OBJECT_HEADER_HASH_CODE_OFFSET);
-
-    *classField = (uintptr_t)class0;
-    *hashField = zen_VirtualMachine_identityHash(object);
+    uint8_t* memory;
+    ZEN_MEMORY_MANAGER_ALLOCATE_LOCAL(virtualMachine->m_memoryManager,
+        &virtualMachine->m_interpreter->m_allocationBuffer,
+        ZEN_OBJECT_HEADER_SIZE + class0->m_memoryRequirement, memory);
+    zen_Object_t* object = (zen_Object_t*)memory;
+    /* The identity hash is computed on demand. */
+    ZEN_OBJECT_HEADER(object) = ZEN_OBJECT_HEADER_NEW(class0->m_index);
 
     return object;
 }
@@ -1353,17 +1811,28 @@ zen_Object_t* zen_VirtualMachine_makeObjectEx(zen_VirtualMachine_t* virtualMachi
     jtk_Assert_assertObject(virtualMachine, "The specified virtual machine is null.");
     jtk_Assert_assertObject(constructor, "The specified constructor is null.");
 
-    zen_Class_t* class0 = constructor->m_class;
-    /* The allocation should be clean such that all the bits are initialized
-     * to 0.
+    /* The arguments are held only by the caller. Therefore, they are rooted
+     * before the object is allocated. The object itself is rooted until the
+     * constructor returns.
      */
-    zen_Object_t* object = calloc(ZEN_OBJECT_HEADER_SIZE + class0->m_memoryRequirement, sizeof (uint8_t));
-    *(intptr_t*)((uint8_t*)object + ZEN_OBJECT_HEADER_CLASS_OFFSET) = (uintptr_t)class0;
-    *(int32_t*)((uint8_t*)object + ZEN_OBJECT_HEADER_HASH_CODE_OFFSET) = zen_VirtualMachine_identityHash(object);
+    zen_MemoryManager_t* manager = virtualMachine->m_memoryManager;
+    int32_t handleCount = zen_MemoryManager_getHandleCount(manager);
+    if (arguments != NULL) {
+        int32_t i;
+        for (i = 0; i < arguments->m_size; i++) {
+            zen_MemoryManager_pushHandle(manager, (zen_Object_t*)arguments->m_values[i]);
+        }
+    }
+
+    zen_Object_t* object = zen_VirtualMachine_allocateObject(virtualMachine,
+        constructor->m_class);
+    zen_MemoryManager_pushHandle(manager, object);
 
     zen_Interpreter_invokeConstructor(virtualMachine->m_interpreter, object,
         constructor, arguments);
 
+    zen_MemoryManager_popHandles(manager, handleCount);
+
     /* Chances are an exception may have been thrown in the constructor. Further,
      * a reference to the object may be stored somewhere by the constructor.
      * Therefore, the object should not be immediately deallocated. Let the garbage
@@ -1450,10 +1919,69 @@ void zen_VirtualMachine_raiseUnknownFieldException(zen_VirtualMachine_t* virtual
     raise(virtualMachine->m_interpreter, exception);
 }
 
+void zen_VirtualMachine_raiseUnknownOperatorException(zen_VirtualMachine_t* virtualMachine,
+    const uint8_t* functionName, int32_t functionNameSize) {
+    jtk_Assert_assertObject(virtualMachine, "The specified virtual machine is null.");
+    jtk_Assert_assertObject(functionName, "The specified function name is null.");
+
+    zen_Object_t* exception = zen_VirtualMachine_newObjectEx(virtualMachine,
+        "zen/core/UnknownOperatorException", 33, "v:v", 3, NULL);
+    raise(virtualMachine->m_interpreter, exception);
+}
+
 void zen_VirtualMachine_raiseNullReferenceException(zen_VirtualMachine_t* virtualMachine) {
     jtk_Assert_assertObject(virtualMachine, "The specified virtual machine is null.");
 
-    printf("[error] NullReferenceException was thrown!\n");
+    zen_Object_t* exception = zen_VirtualMachine_newObjectEx(virtualMachine,
+        "zen/core/NullReferenceException", 31, "v:v", 3, NULL);
+    raise(virtualMachine->m_interpreter, exception);
+}
+
+void zen_VirtualMachine_raiseClassCastException(zen_VirtualMachine_t* virtualMachine) {
+    jtk_Assert_assertObject(virtualMachine, "The specified virtual machine is null.");
+
+    zen_Object_t* exception = zen_VirtualMachine_newObjectEx(virtualMachine,
+        "zen/core/ClassCastException", 27, "v:v", 3, NULL);
+    raise(virtualMachine->m_interpreter, exception);
+}
+
+void zen_VirtualMachine_raiseStackOverflowException(zen_VirtualMachine_t* virtualMachine) {
+    jtk_Assert_assertObject(virtualMachine, "The specified virtual machine is null.");
+
+    zen_Object_t* exception = zen_VirtualMachine_newObjectEx(virtualMachine,
+        "zen/core/StackOverflowException", 31, "v:v", 3, NULL);
+    /* The constructor may overflow the reserve, in which case the exception
+     * that reports it is already being thrown.
+     */
+    if ((virtualMachine->m_interpreter->m_state & ZEN_INTERPRETER_STATE_EXCEPTION_THROWN) == 0) {
+        raise(virtualMachine->m_interpreter, exception);
+    }
+}
+
+void zen_VirtualMachine_raiseInvalidArrayIndexException(zen_VirtualMachine_t* virtualMachine,
+    int32_t index) {
+    jtk_Assert_assertObject(virtualMachine, "The specified virtual machine is null.");
+
+    zen_Object_t* exception = zen_VirtualMachine_newObjectEx(virtualMachine,
+        "zen/core/InvalidArrayIndexException", 35, "v:v", 3, NULL);
+    raise(virtualMachine->m_interpreter, exception);
+}
+
+void zen_VirtualMachine_raiseInvalidArraySizeException(zen_VirtualMachine_t* virtualMachine,
+    int32_t size) {
+    jtk_Assert_assertObject(virtualMachine, "The specified virtual machine is null.");
+
+    zen_Object_t* exception = zen_VirtualMachine_newObjectEx(virtualMachine,
+        "zen/core/InvalidArraySizeException", 34, "v:v", 3, NULL);
+    raise(virtualMachine->m_interpreter, exception);
+}
+
+void zen_VirtualMachine_raiseInvalidStringSizeException(zen_VirtualMachine_t* virtualMachine) {
+    jtk_Assert_assertObject(virtualMachine, "The specified virtual machine is null.");
+
+    zen_Object_t* exception = zen_VirtualMachine_newObjectEx(virtualMachine,
+        "zen/core/InvalidStringSizeException", 35, "v:v", 3, NULL);
+    raise(virtualMachine->m_interpreter, exception);
 }
 
 void zen_VirtualMachine_raiseClassNotFoundException(zen_VirtualMachine_t* virtualMachine,
@@ -1537,29 +2065,56 @@ zen_Object_t* zen_VirtualMachine_getEmptyString(zen_VirtualMachine_t* virtualMac
     return zen_VirtualMachine_newStringFromUtf8(virtualMachine, NULL, 0);
 }
 
-zen_Object_t* zen_VirtualMachine_newStringFromUtf8(zen_VirtualMachine_t* virtualMachine,
-    const uint8_t* string, int32_t size) {
+/* Strings do not invoke a constructor. */
+zen_Object_t* zen_VirtualMachine_allocateString(zen_VirtualMachine_t* virtualMachine,
+    int32_t size) {
     jtk_Assert_assertObject(virtualMachine, "The specified virtual machine is null.");
+    jtk_Assert_assertTrue((size >= 0) && (size <= ZEN_STRING_MAXIMUM_SIZE),
+        "The specified size is invalid.");
+
+    zen_Class_t* stringClass = virtualMachine->m_coreClasses.m_stringClass;
+    if (stringClass == NULL) {
+        stringClass = zen_VirtualMachine_getClass(virtualMachine, "zen/core/String", 15);
+    }
 
-    zen_Interpreter_t* interpreter = virtualMachine->m_interpreter;
-    zen_Object_t* array = zen_VirtualMachine_newByteArray(interpreter->m_virtualMachine,
-        string, size);
+    zen_Object_t* result = NULL;
+    if (stringClass != NULL) {
+        /* The allocation is clean, therefore, the hash is initially zero,
+         * that is, not computed. The allocation may trigger a collection.
+         */
+        zen_MemoryManager_t* manager = virtualMachine->m_memoryManager;
+        uint8_t* memory;
+        ZEN_MEMORY_MANAGER_ALLOCATE_LOCAL(manager,
+            &virtualMachine->m_interpreter->m_allocationBuffer,
+            zen_String_getAllocationSize(size), memory);
+        result = (zen_Object_t*)memory;
+        ZEN_OBJECT_HEADER(result) = ZEN_OBJECT_HEADER_NEW(stringClass->m_index);
+        ZEN_STRING_SIZE(result) = size;
+        /* A string holds no references, but its size is not determined by
+         * its class.
+         */
+        zen_MemoryManager_setObjectType(manager, result, ZEN_OBJECT_TYPE_STRING);
+    }
 
-    const uint8_t* stringClassDescriptor = "zen/core/String";
-    int32_t stringClassDescriptorSize = 15;
-    const uint8_t* stringConstructorDescriptor = "v:(zen/core/Object)";
-    int32_t stringConstructorDescriptorSize = 19;
+    return result;
+}
 
-    jtk_Array_t* arguments = jtk_Array_new(1);
-    jtk_Array_setValue(arguments, 0, array);
+zen_Object_t* zen_VirtualMachine_newStringFromUtf8(zen_VirtualMachine_t* virtualMachine,
+    const uint8_t* string, int32_t size) {
+    jtk_Assert_assertObject(virtualMachine, "The specified virtual machine is null.");
 
-    zen_Object_t* value = zen_VirtualMachine_newObjectEx(interpreter->m_virtualMachine,
-        stringClassDescriptor, stringClassDescriptorSize, stringConstructorDescriptor,
-        stringConstructorDescriptorSize, arguments);
+    /* A negative size indicates a null-terminated string. */
+    if (size < 0) {
+        size = (string != NULL)? (int32_t)strlen((const char*)string) : 0;
+    }
 
-    jtk_Array_delete(arguments);
+    /* The bytes are copied straight into the string. */
+    zen_Object_t* result = zen_VirtualMachine_allocateString(virtualMachine, size);
+    if ((result != NULL) && (size > 0)) {
+        memcpy(ZEN_STRING_GET_BYTES(result), string, size);
+    }
 
-    return value;
+    return result;
 }
 
 zen_Object_t* zen_VirtualMachine_newString(zen_VirtualMachine_t* virtualMachine,
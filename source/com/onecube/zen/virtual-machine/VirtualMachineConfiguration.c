@@ -33,6 +33,13 @@ zen_VirtualMachineConfiguration_t* zen_VirtualMachineConfiguration_new() {
     configuration->m_entityDirectories = jtk_ArrayList_new();
     configuration->m_variables = jtk_HashMap_new(stringObjectAdapter, stringObjectAdapter);
     configuration->m_logLevel = JTK_LOG_LEVEL_NONE;
+    configuration->m_printStatistics = false;
+    configuration->m_heapBudget = ZEN_VIRTUAL_MACHINE_CONFIGURATION_DEFAULT_HEAP_BUDGET;
+    configuration->m_nurserySize = ZEN_VIRTUAL_MACHINE_CONFIGURATION_DEFAULT_NURSERY_SIZE;
+    configuration->m_garbageCollectorThreadCount = 0;
+    configuration->m_maximumPauseTime = 0;
+    configuration->m_maximumHeapSize = ZEN_VIRTUAL_MACHINE_CONFIGURATION_DEFAULT_MAXIMUM_HEAP_SIZE;
+    configuration->m_hugePages = false;
 
     return configuration;
 }
@@ -174,8 +174,8 @@ zen_Instruction_t zen_Instruction_instructions[] = {
     { "load_af", ZEN_BYTE_CODE_LOAD_AF, 0, 2, 1 },
     { "load_ad", ZEN_BYTE_CODE_LOAD_AD, 0, 2, 1 },
     { "load_aa", ZEN_BYTE_CODE_LOAD_AA, 0, 2, 1 },
-    { "load_instance_field", ZEN_BYTE_CODE_LOAD_INSTANCE_FIELD, 0x0 /* Unknown */, 0x0 /* Unknown */, 0x0 /* Unknown */ },
-    { "load_static_field", ZEN_BYTE_CODE_LOAD_STATIC_FIELD, 0x0 /* Unknown */, 0x0 /* Unknown */, 0x0 /* Unknown */ },
+    { "load_instance_field", ZEN_BYTE_CODE_LOAD_INSTANCE_FIELD, 2, 1, 1 },
+    { "load_static_field", ZEN_BYTE_CODE_LOAD_STATIC_FIELD, 2, 0, 1 },
     { "load_cpr", ZEN_BYTE_CODE_LOAD_CPR, 1, 0, 1 },
     { "load_array_size", ZEN_BYTE_CODE_LOAD_ARRAY_SIZE, 0x0 /* Unknown */, 0x0 /* Unknown */, 0x0 /* Unknown */ },
 
@@ -282,8 +282,8 @@ zen_Instruction_t zen_Instruction_instructions[] = {
     { "store_af", ZEN_BYTE_CODE_STORE_AF, 0, 3, 0 },
     { "store_ad", ZEN_BYTE_CODE_STORE_AD, 0, 3, 0 },
     { "store_aa", ZEN_BYTE_CODE_STORE_AA, 0, 3, 0 },
-    { "store_instance_field", ZEN_BYTE_CODE_STORE_INSTANCE_FIELD, 2, 2, 0 },
-    { "store_static_field", ZEN_BYTE_CODE_STORE_STATIC_FIELD, 2, 1, 0 },
+    { "store_instance_field", ZEN_BYTE_CODE_STORE_INSTANCE_FIELD, 2, 2, 1 },
+    { "store_static_field", ZEN_BYTE_CODE_STORE_STATIC_FIELD, 2, 1, 1 },
 
     /* Subtract */
 
@@ -307,13 +307,21 @@ zen_Instruction_t zen_Instruction_instructions[] = {
 
     /* Wide */
 
-    { "wide", ZEN_BYTE_CODE_WIDE, 0, 0, 0 }
+    { "wide", ZEN_BYTE_CODE_WIDE, 0, 0, 0 },
+
+    /* Operator */
+
+    { "invoke_operator", ZEN_BYTE_CODE_INVOKE_OPERATOR, 1, 2, 1 },
+
+    /* Literal */
+
+    { "load_literal", ZEN_BYTE_CODE_LOAD_LITERAL, 2, 0, 1 }
 };
 
 bool zen_Instruction_verify() {
     int32_t i;
     bool result = true;
-    for (i = 0; i < (int32_t)ZEN_BYTE_CODE_WIDE; i++) {
+    for (i = 0; i <= (int32_t)ZEN_BYTE_CODE_LOAD_LITERAL; i++) {
         zen_Instruction_t* instruction = &zen_Instruction_instructions[i];
         if (instruction->m_byteCode != i) {
             fprintf(stderr, "[internal error] The instruction index and byte pair is invalid. "
@@ -0,0 +1,79 @@
+/*
+ * Copyright 2018-2020 Samuel Rowe
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Monday, October 19, 2020
+
+#include <jtk/core/CString.h>
+
+#include <com/onecube/zen/virtual-machine/feb/Operator.h>
+
+/*******************************************************************************
+ * Operator                                                                    *
+ *******************************************************************************/
+
+struct zen_OperatorDescriptor_t {
+    const uint8_t* m_symbol;
+    int32_t m_symbolSize;
+    const uint8_t* m_functionName;
+    int32_t m_functionNameSize;
+};
+
+typedef struct zen_OperatorDescriptor_t zen_OperatorDescriptor_t;
+
+/* The descriptors are indexed by the operator. */
+static const zen_OperatorDescriptor_t zen_Operator_descriptors[ZEN_OPERATOR_COUNT] = {
+    { "+", 1, "add", 3 },
+    { "-", 1, "subtract", 8 },
+    { "*", 1, "multiply", 8 },
+    { "/", 1, "divide", 6 },
+    { "%", 1, "remainder", 9 },
+    { "==", 2, "equals", 6 },
+    { "!=", 2, "notEquals", 9 },
+    { ">", 1, "greater", 7 },
+    { ">=", 2, "greaterOrEqual", 14 },
+    { "<", 1, "lesser", 6 },
+    { "<=", 2, "lesserOrEqual", 13 }
+};
+
+/* Symbol */
+
+int32_t zen_Operator_fromSymbol(const uint8_t* symbol, int32_t symbolSize) {
+    int32_t result = -1;
+    int32_t i;
+    for (i = 0; i < ZEN_OPERATOR_COUNT; i++) {
+        const zen_OperatorDescriptor_t* descriptor = &zen_Operator_descriptors[i];
+        if (jtk_CString_equals(descriptor->m_symbol, descriptor->m_symbolSize,
+            symbol, symbolSize)) {
+            result = i;
+            break;
+        }
+    }
+    return result;
+}
+
+/* Function Name */
+
+const uint8_t* zen_Operator_getFunctionName(int32_t operator0, int32_t* size) {
+    const uint8_t* result = NULL;
+    if ((operator0 >= 0) && (operator0 < ZEN_OPERATOR_COUNT)) {
+        const zen_OperatorDescriptor_t* descriptor = &zen_Operator_descriptors[operator0];
+        result = descriptor->m_functionName;
+        if (size != NULL) {
+            *size = descriptor->m_functionNameSize;
+        }
+    }
+    return result;
+}
@@ -0,0 +1,333 @@
+/*
+ * Copyright 2018-2020 Samuel Rowe
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Sunday, October 25, 2020
+
+#include <stdio.h>
+
+#include <jtk/core/Assert.h>
+
+#include <com/onecube/zen/virtual-machine/VirtualMachine.h>
+#include <com/onecube/zen/virtual-machine/memory/MemoryManager.h>
+
+/*******************************************************************************
+ * MemoryManager                                                               *
+ *******************************************************************************/
+
+/* Constructor */
+
+zen_MemoryManager_t* zen_MemoryManager_new(zen_VirtualMachine_t* virtualMachine,
+    uint64_t heapBudget, uint64_t nurserySize, int32_t collectorThreadCount,
+    int32_t maximumPauseTime, uint64_t maximumHeapSize, bool hugePages) {
+    zen_MemoryManager_t* manager = jtk_Memory_allocate(zen_MemoryManager_t, 1);
+    manager->m_heap = zen_Heap_new(maximumHeapSize, hugePages);
+    jtk_Assert_assertObject(manager->m_heap, "The heap could not be reserved.");
+    manager->m_newGeneration = zen_NewGeneration_new(manager->m_heap, nurserySize);
+    jtk_Assert_assertObject(manager->m_newGeneration, "The heap cannot hold the new generation.");
+    manager->m_allocator = zen_SegregatedFitsAllocator_new(manager->m_heap, 16);
+    manager->m_collector = zen_GarbageCollector_new(virtualMachine,
+        virtualMachine->m_classTable, manager->m_allocator, manager->m_newGeneration,
+        collectorThreadCount);
+    manager->m_heapBudget = heapBudget;
+    manager->m_threshold = heapBudget;
+    manager->m_maximumPauseTime = maximumPauseTime;
+    manager->m_safepointRequested = false;
+    manager->m_handles = jtk_Memory_allocate(zen_Object_t*, ZEN_MEMORY_MANAGER_DEFAULT_HANDLE_CAPACITY);
+    manager->m_handleCount = 0;
+    manager->m_handleCapacity = ZEN_MEMORY_MANAGER_DEFAULT_HANDLE_CAPACITY;
+
+    return manager;
+}
+
+/* Destructor */
+
+void zen_MemoryManager_delete(zen_MemoryManager_t* manager) {
+    jtk_Assert_assertObject(manager, "The specified memory manager is null.");
+
+    zen_GarbageCollector_delete(manager->m_collector);
+    zen_SegregatedFitsAllocator_delete(manager->m_allocator);
+    zen_NewGeneration_delete(manager->m_newGeneration);
+    zen_Heap_delete(manager->m_heap);
+    jtk_Memory_deallocate(manager->m_handles);
+    jtk_Memory_deallocate(manager);
+}
+
+/* Allocate */
+
+uint8_t* zen_MemoryManager_allocate(zen_MemoryManager_t* manager, uint32_t size) {
+    return zen_MemoryManager_allocateEx(manager, size, ZEN_ALIGNMENT_CONSTRAINT_DEFAULT, 0);
+}
+
+/* Leaves enough room for the surviving objects to double before the next
+ * major collection.
+ */
+static void zen_MemoryManager_updateThreshold(zen_MemoryManager_t* manager) {
+    uint64_t threshold = manager->m_allocator->m_usedSize * 2;
+    manager->m_threshold = (threshold > manager->m_heapBudget)? threshold : manager->m_heapBudget;
+}
+
+/* Adjusts the memory manager after a major collection. Only a quarter of
+ * the regions in use are retained for future allocations, the memory of the
+ * other free regions is returned to the system.
+ */
+static void zen_MemoryManager_finishMajor(zen_MemoryManager_t* manager) {
+    zen_MemoryManager_updateThreshold(manager);
+    zen_Heap_trim(manager->m_heap, manager->m_heap->m_usedRegionCount / 4);
+}
+
+/* Allocates an object in the old generation. A major collection is triggered
+ * if the old generation would grow beyond the threshold, or if the heap is
+ * exhausted.
+ */
+static uint8_t* zen_MemoryManager_allocateOld(zen_MemoryManager_t* manager,
+    uint32_t size) {
+    if (manager->m_allocator->m_usedSize + size > manager->m_threshold) {
+        zen_MemoryManager_collect(manager, ZEN_GARBAGE_COLLECTION_TYPE_MAJOR,
+            ZEN_GARBAGE_COLLECTION_REASON_NATIVE_REQUEST);
+    }
+    uint8_t* result = zen_SegregatedFitsAllocator_allocate(manager->m_allocator, size,
+        ZEN_OBJECT_TYPE_AGGREGATE_OBJECT);
+    if (result == NULL) {
+        /* An incremental marking cannot be awaited, therefore, the world is
+         * stopped. A marking in progress is completed by the collection.
+         */
+        zen_GarbageCollector_collect(manager->m_collector, ZEN_GARBAGE_COLLECTION_TYPE_MAJOR,
+            manager->m_handles, manager->m_handleCount);
+        zen_MemoryManager_finishMajor(manager);
+        result = zen_SegregatedFitsAllocator_allocate(manager->m_allocator, size,
+            ZEN_OBJECT_TYPE_AGGREGATE_OBJECT);
+    }
+
+    /* The objects allocated during an incremental marking are not traced,
+     * therefore, they are marked right away.
+     */
+    if ((result != NULL) && manager->m_collector->m_marking) {
+        zen_GarbageCollector_markAllocated(manager->m_collector, result);
+        manager->m_safepointRequested = true;
+    }
+
+    return result;
+}
+
+uint8_t* zen_MemoryManager_allocateEx(zen_MemoryManager_t* manager, uint32_t size,
+    zen_AlignmentConstraint_t alignmentConstraint, int32_t flags) {
+    jtk_Assert_assertObject(manager, "The specified memory manager is null.");
+
+    /* The granules of the new generation and the cells of the old generation
+     * are aligned to 64 bits, which satisfies all the alignment constraints
+     * that objects currently need.
+     */
+    uint8_t* result = NULL;
+    if (size <= ZEN_NEW_GENERATION_MAXIMUM_OBJECT_SIZE) {
+        result = zen_NewGeneration_allocate(manager->m_newGeneration, size);
+        if (result == NULL) {
+            zen_MemoryManager_collect(manager, ZEN_GARBAGE_COLLECTION_TYPE_MINOR,
+                ZEN_GARBAGE_COLLECTION_REASON_NATIVE_REQUEST);
+            result = zen_NewGeneration_allocate(manager->m_newGeneration, size);
+        }
+    }
+
+    /* Large objects, and objects that do not fit in a new generation crowded
+     * with pinned pages, are allocated in the old generation.
+     */
+    if (result == NULL) {
+        result = zen_MemoryManager_allocateOld(manager, size);
+    }
+
+    return result;
+}
+
+uint8_t* zen_MemoryManager_allocateLocal(zen_MemoryManager_t* manager,
+    zen_AllocationBuffer_t* buffer, uint32_t size) {
+    jtk_Assert_assertObject(manager, "The specified memory manager is null.");
+
+    zen_NewGeneration_t* generation = manager->m_newGeneration;
+    uint8_t* result = NULL;
+    if (size <= ZEN_NEW_GENERATION_MAXIMUM_OBJECT_SIZE) {
+        bool refilled = zen_NewGeneration_refillAllocationBuffer(generation, buffer, size);
+        if (!refilled) {
+            /* The collection empties the buffer. */
+            zen_MemoryManager_collect(manager, ZEN_GARBAGE_COLLECTION_TYPE_MINOR,
+                ZEN_GARBAGE_COLLECTION_REASON_NATIVE_REQUEST);
+            refilled = zen_NewGeneration_refillAllocationBuffer(generation, buffer, size);
+        }
+
+        if (refilled) {
+            ZEN_NEW_GENERATION_ALLOCATE_LOCAL(generation, buffer, size, result);
+
+            /* The marking advances with the allocation. */
+            manager->m_safepointRequested = manager->m_collector->m_marking;
+        }
+    }
+
+    if (result == NULL) {
+        result = zen_MemoryManager_allocateOld(manager, size);
+    }
+
+    return result;
+}
+
+/* Allocation Buffer */
+
+void zen_MemoryManager_addAllocationBuffer(zen_MemoryManager_t* manager,
+    zen_AllocationBuffer_t* buffer) {
+    jtk_Assert_assertObject(manager, "The specified memory manager is null.");
+
+    zen_NewGeneration_addAllocationBuffer(manager->m_newGeneration, buffer);
+}
+
+void zen_MemoryManager_removeAllocationBuffer(zen_MemoryManager_t* manager,
+    zen_AllocationBuffer_t* buffer) {
+    jtk_Assert_assertObject(manager, "The specified memory manager is null.");
+
+    zen_NewGeneration_removeAllocationBuffer(manager->m_newGeneration, buffer);
+}
+
+/* Collect */
+
+void zen_MemoryManager_collect(zen_MemoryManager_t* manager,
+    zen_GarbageCollectionType_t type, zen_GarbageCollectionReason_t reason) {
+    jtk_Assert_assertObject(manager, "The specified memory manager is null.");
+
+    zen_GarbageCollector_t* collector = manager->m_collector;
+    uint64_t usedSize = manager->m_allocator->m_usedSize;
+    bool deferred = false;
+    if (manager->m_maximumPauseTime > 0) {
+        if (!collector->m_marking) {
+            if ((type == ZEN_GARBAGE_COLLECTION_TYPE_MAJOR) || (usedSize > manager->m_threshold)) {
+                /* The new generation is collected before the marking begins. */
+                zen_GarbageCollector_startMarking(collector, manager->m_handles,
+                    manager->m_handleCount);
+                manager->m_safepointRequested = true;
+                deferred = true;
+            }
+        }
+        else if (usedSize > manager->m_threshold * 2) {
+            /* The program allocates faster than the marking progresses. */
+            type = ZEN_GARBAGE_COLLECTION_TYPE_MAJOR;
+        }
+        else if (type == ZEN_GARBAGE_COLLECTION_TYPE_MAJOR) {
+            /* The marking in progress completes the major collection. */
+            deferred = true;
+        }
+    }
+    /* The objects promoted by the previous minor collections may have pushed
+     * the old generation beyond the threshold.
+     */
+    else if ((type == ZEN_GARBAGE_COLLECTION_TYPE_MINOR) && (usedSize > manager->m_threshold)) {
+        type = ZEN_GARBAGE_COLLECTION_TYPE_MAJOR;
+    }
+
+    if (!deferred) {
+        zen_GarbageCollector_collect(collector, type, manager->m_handles,
+            manager->m_handleCount);
+
+        if (type == ZEN_GARBAGE_COLLECTION_TYPE_MAJOR) {
+            zen_MemoryManager_finishMajor(manager);
+        }
+    }
+}
+
+/* Safepoint */
+
+void zen_MemoryManager_safepoint(zen_MemoryManager_t* manager) {
+    jtk_Assert_assertObject(manager, "The specified memory manager is null.");
+
+    manager->m_safepointRequested = false;
+    if (manager->m_collector->m_marking) {
+        bool completed = zen_GarbageCollector_markIncrementally(manager->m_collector,
+            (int64_t)manager->m_maximumPauseTime * 1000);
+        if (completed) {
+            zen_MemoryManager_finishMajor(manager);
+        }
+    }
+}
+
+/* Handle */
+
+int32_t zen_MemoryManager_getHandleCount(zen_MemoryManager_t* manager) {
+    jtk_Assert_assertObject(manager, "The specified memory manager is null.");
+
+    return manager->m_handleCount;
+}
+
+void zen_MemoryManager_pushHandle(zen_MemoryManager_t* manager, zen_Object_t* object) {
+    jtk_Assert_assertObject(manager, "The specified memory manager is null.");
+
+    if (manager->m_handleCount == manager->m_handleCapacity) {
+        int32_t capacity = manager->m_handleCapacity * 2;
+        zen_Object_t** handles = jtk_Memory_allocate(zen_Object_t*, capacity);
+        int32_t i;
+        for (i = 0; i < manager->m_handleCount; i++) {
+            handles[i] = manager->m_handles[i];
+        }
+        jtk_Memory_deallocate(manager->m_handles);
+        manager->m_handles = handles;
+        manager->m_handleCapacity = capacity;
+    }
+    manager->m_handles[manager->m_handleCount++] = object;
+}
+
+void zen_MemoryManager_popHandles(zen_MemoryManager_t* manager, int32_t handleCount) {
+    jtk_Assert_assertObject(manager, "The specified memory manager is null.");
+    jtk_Assert_assertTrue(handleCount <= manager->m_handleCount, "The specified handle count is invalid.");
+
+    manager->m_handleCount = handleCount;
+}
+
+/* Object Type */
+
+void zen_MemoryManager_setObjectType(zen_MemoryManager_t* manager,
+    zen_Object_t* object, zen_ObjectType_t type) {
+    jtk_Assert_assertObject(manager, "The specified memory manager is null.");
+
+    if (ZEN_NEW_GENERATION_CONTAINS(manager->m_newGeneration, object)) {
+        zen_NewGeneration_setType(manager->m_newGeneration, object, type);
+    }
+    else {
+        zen_SegregatedFitsAllocator_setType(manager->m_allocator, object, type);
+    }
+}
+
+/* Statistics */
+
+void zen_MemoryManager_printStatistics(zen_MemoryManager_t* manager) {
+    jtk_Assert_assertObject(manager, "The specified memory manager is null.");
+
+    zen_GarbageCollector_t* collector = manager->m_collector;
+    zen_GarbageCollectionProfile_t* profile = collector->m_profile;
+    zen_SegregatedFitsAllocator_t* allocator = manager->m_allocator;
+    zen_Heap_t* heap = manager->m_heap;
+    printf("[statistics] garbage collector: %d minor collections, %lld us\n"
+        "[statistics]                       %d major collections, %lld us\n"
+        "[statistics]     promoted:           %llu bytes\n"
+        "[statistics]     freed:              %llu bytes\n"
+        "[statistics]     used:               %llu bytes\n"
+        "[statistics]     reserved:           %llu bytes\n"
+        "[statistics] heap:                 %llu bytes committed, %llu bytes reserved\n"
+        "[statistics]     pauses:             %d, %llu us maximum, %llu us average\n",
+        collector->m_minorCollectionCount, (long long)collector->m_totalMinorCollectionTime,
+        collector->m_collectionCount, (long long)collector->m_totalCollectionTime,
+        (unsigned long long)collector->m_promotedSize,
+        (unsigned long long)collector->m_freedSize,
+        (unsigned long long)allocator->m_usedSize,
+        (unsigned long long)allocator->m_reservedSize,
+        (unsigned long long)heap->m_committedRegionCount << ZEN_REGION_SHIFT,
+        (unsigned long long)heap->m_size,
+        profile->m_pauseCount, (unsigned long long)profile->m_maximumPauseTime,
+        (unsigned long long)((profile->m_pauseCount > 0)?
+            profile->m_totalPauseTime / profile->m_pauseCount : 0));
+}
@@ -1,12 +1,12 @@
 /*
  * Copyright 2018-2020 Samuel Rowe
- * 
+ *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
- * 
+ *
  *     http://www.apache.org/licenses/LICENSE-2.0
- * 
+ *
  * Unless required by applicable law or agreed to in writing, software
  * distributed under the License is distributed on an "AS IS" BASIS,
  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
@@ -16,245 +16,376 @@
 
 // Monday, September 10, 2018
 
+#include <string.h>
+
+#include <jtk/core/Assert.h>
+
 #include <com/onecube/zen/virtual-machine/memory/allocator/SegregatedFitsAllocator.h>
 
+/*******************************************************************************
+ * MemoryBlock                                                                 *
+ *******************************************************************************/
+
+/* Constructor */
+
+static zen_MemoryBlock_t* zen_MemoryBlock_new(zen_Heap_t* heap, int32_t cellSize,
+    int32_t cellCount, int32_t sizeClass) {
+    zen_MemoryBlock_t* block = NULL;
+
+    /* The regions are aligned to the size of a block, so that the card table
+     * can be reached by masking the address of an object.
+     */
+    uint64_t size = ZEN_MEMORY_BLOCK_HEADER_SIZE + ((uint64_t)cellSize * cellCount);
+    int32_t regionCount = (int32_t)((size + (ZEN_REGION_SIZE - 1)) >> ZEN_REGION_SHIFT);
+    zen_Region_t* region = zen_Heap_allocateRegions(heap, regionCount);
+    if (region != NULL) {
+        block = jtk_Memory_allocate(zen_MemoryBlock_t, 1);
+        block->m_cards = region->m_start;
+        block->m_cells = block->m_cards + ZEN_MEMORY_BLOCK_HEADER_SIZE;
+        block->m_cellSize = cellSize;
+        block->m_cellCount = cellCount;
+        block->m_freeCount = cellCount;
+        block->m_freeList = NULL;
+        block->m_flags = jtk_Memory_allocate(uint8_t, cellCount);
+        block->m_sizeClass = sizeClass;
+        block->m_nextAvailable = NULL;
+        block->m_region = region;
+        memset(block->m_cards, ZEN_MEMORY_BLOCK_CARD_CLEAN, ZEN_MEMORY_BLOCK_CARD_COUNT);
+
+        /* The free list is threaded in the order of the addresses, so that the
+         * cells are handed out sequentially.
+         */
+        int32_t i;
+        for (i = cellCount - 1; i >= 0; i--) {
+            uint8_t* cell = block->m_cells + (i * cellSize);
+            block->m_flags[i] = 0;
+            *((uint8_t**)cell) = block->m_freeList;
+            block->m_freeList = cell;
+        }
+
+        for (i = 0; i < regionCount; i++) {
+            region[i].m_block = block;
+        }
+    }
+
+    return block;
+}
+
+/* Destructor */
+
+static void zen_MemoryBlock_delete(zen_Heap_t* heap, zen_MemoryBlock_t* block) {
+    jtk_Memory_deallocate(block->m_flags);
+    zen_Heap_releaseRegions(heap, block->m_region);
+    jtk_Memory_deallocate(block);
+}
+
+/* Cell */
+
+int32_t zen_MemoryBlock_getCellIndex(zen_MemoryBlock_t* block, const uint8_t* cell) {
+    jtk_Assert_assertObject(block, "The specified memory block is null.");
+
+    int32_t result = -1;
+    if ((cell >= block->m_cells) &&
+        (cell < block->m_cells + ((intptr_t)block->m_cellSize * block->m_cellCount))) {
+        intptr_t offset = cell - block->m_cells;
+        if ((offset % block->m_cellSize) == 0) {
+            result = (int32_t)(offset / block->m_cellSize);
+        }
+    }
+    return result;
+}
+
 /*******************************************************************************
  * SegregatedFitsAllocator                                                     *
  *******************************************************************************/
 
 #define ZEN_SEGREGATED_FITS_ALLOCATOR_BASE_CLASS_SIZE 8
 #define ZEN_SEGREGATED_FITS_ALLOCATOR_SIZE_CLASS_FACTOR 8
+#define ZEN_SEGREGATED_FITS_ALLOCATOR_DEFAULT_BALANCE_FACTOR 16
+#define ZEN_SEGREGATED_FITS_ALLOCATOR_DEFAULT_BLOCK_CAPACITY 16
 
 /* Constructor */
 
-/* TODO:
- * The performance of the segregated-fits allocator can be enhanced with dynamic
- * insertion of size classes. Thus, not all objects are allocated from the general
- * free-lists allocator.
- */
+zen_SegregatedFitsAllocator_t* zen_SegregatedFitsAllocator_new(zen_Heap_t* heap,
+    int32_t balanceFactor) {
+    jtk_Assert_assertObject(heap, "The specified heap is null.");
 
-zen_SegregatedFitsAllocator_t* zen_SegregatedFitsAllocator_new(jtk_Allocator_t* allocator, uint8_t* chunk, int32_t size, int32_t balanceFactor) {
-    jtk_Assert_assertObject(allocator, "The specified allocator is null.");
-    jtk_Assert_assertObject(chunk, "The specified memory chunk is null.");
-    jtk_Assert_assertTrue(size > 0, "The specified memory chunk size is invalid.");
-    jtk_Assert_assertTrue(balanceFactor > 0, "The specified balance factor is invalid.");
-
-    zen_SegregatedFitsAllocator_t* segregatedFitsAllocator =
-        (zen_SegregatedFitsAllocator_t*)jtk_Allocator_allocate(
-            allocator, sizeof (zen_SegregatedFitsAllocator_t), 1);
-    segregatedFitsAllocator->m_balanceFactor = balanceFactor;
-    segregatedFitsAllocator->m_sizeClassesSize = balanceFactor + 1;
-    segregatedFitsAllocator->m_sizeClasses = jtk_Allocator_allocate(allocator, sizeof (int32_t), segregatedFitsAllocator->m_sizeClassesSize);
-    segregatedFitsAllocator->m_allocator = allocator;
-    segregatedFitsAllocator->m_freeListAllocators = ...;
-
-    zen_SegregatedFitsAllocator_initializeSizeClasses(segregatedFitsAllocator);
-
-    return segregatedFitsAllocator;
-}
+    if ((balanceFactor < 8) || (balanceFactor > 32)) {
+        balanceFactor = ZEN_SEGREGATED_FITS_ALLOCATOR_DEFAULT_BALANCE_FACTOR;
+    }
 
-/* Destructor */
+    zen_SegregatedFitsAllocator_t* allocator = jtk_Memory_allocate(zen_SegregatedFitsAllocator_t, 1);
+    allocator->m_balanceFactor = balanceFactor;
+    allocator->m_sizeClasses = jtk_Memory_allocate(zen_SizeClass_t, balanceFactor);
+    allocator->m_heap = heap;
+    allocator->m_blocks = jtk_Memory_allocate(zen_MemoryBlock_t*,
+        ZEN_SEGREGATED_FITS_ALLOCATOR_DEFAULT_BLOCK_CAPACITY);
+    allocator->m_blockCount = 0;
+    allocator->m_blockCapacity = ZEN_SEGREGATED_FITS_ALLOCATOR_DEFAULT_BLOCK_CAPACITY;
+    allocator->m_usedSize = 0;
+    allocator->m_reservedSize = 0;
 
-void zen_SegregatedFitsAllocator_delete(zen_SegregatedFitsAllocator_t* segregatedFitsAllocator) {
-    jtk_Assert_assertObject(segregatedFitsAllocator, "The specified segregated-fits allocator is null.");
+    int32_t i;
+    for (i = 0; i < balanceFactor; i++) {
+        zen_SizeClass_t* sizeClass = &allocator->m_sizeClasses[i];
+        sizeClass->m_cellSize = ZEN_SEGREGATED_FITS_ALLOCATOR_BASE_CLASS_SIZE +
+            (ZEN_SEGREGATED_FITS_ALLOCATOR_SIZE_CLASS_FACTOR * i);
+        sizeClass->m_availableBlocks = NULL;
+    }
 
-    jtk_Allocator_deallocate(segregatedFitsAllocator->m_allocator,
-        segregatedFitsAllocator->m_sizeClasses);
-    jtk_Allocator_deallocate(segregatedFitsAllocator->m_allocator, allocator);
+    return allocator;
 }
 
-/* Allocate */
+/* Destructor */
 
-uint8_t* zen_SegregatedFitsAllocator_allocateWithFirstFit(
-    zen_SegregatedFitsAllocator_t* allocator, int32_t headSize, int32_t bodySize) {
+void zen_SegregatedFitsAllocator_delete(zen_SegregatedFitsAllocator_t* allocator) {
     jtk_Assert_assertObject(allocator, "The specified allocator is null.");
 
-    uint8_t* result = NULL;
-    int32_t requestSize = headSize + bodySize;
-    int32_t sizeClass = zen_SegregatedFitsAllocator_findSizeClass(allocator, size);
-
     int32_t i;
-    for (i = sizeClass; i <= allocator->m_balanceFactor; i++) {
-        xjtk_Logger_debug(ZEN_SEGREGATED_FITS_ALLOCATOR_TAG, "Trying to allocate object from a first-fit allocator. (sizeClass = %d, headSize = %d, bodySize = %d)",
-            sizeClass, headSize, bodySize);
-
-        zen_FirstFitAllocator_t* firstFitAllocator =
-            (zen_FirstFitAllocator_t*)allocator->m_freeListAllocators[i];
-        result = zen_FirstFitAllocator_allocate(firstFitAllocator, headSize, bodySize);
-
-        if (result == NULL) {
-            /* At this point, the allocation request could not satisfied using 
-             * the first-fit allocator. The allocator will try again to
-             * allocate using the next first-fit allocator.
-             */
-            xjtk_Logger_debug(ZEN_SEGREGATED_FITS_ALLOCATOR_TAG, "Failed to allocate object from the first-fit allocator. The allocator will now try to satisfy the allocation request with the next general first-fit allocator, if any. (sizeClass = %d, headSize = %d, bodySize = %d)",
-                sizeClass, headSize, bodySize);
+    for (i = 0; i < allocator->m_blockCount; i++) {
+        zen_MemoryBlock_delete(allocator->m_heap, allocator->m_blocks[i]);
+    }
+    jtk_Memory_deallocate(allocator->m_blocks);
+    jtk_Memory_deallocate(allocator->m_sizeClasses);
+    jtk_Memory_deallocate(allocator);
+}
+
+/* Block */
+
+/* Finds the index of the last block whose cells begin at or before the
+ * specified address. If no such block exists, -1 is returned.
+ */
+static int32_t zen_SegregatedFitsAllocator_searchBlock(zen_SegregatedFitsAllocator_t* allocator,
+    const uint8_t* address) {
+    int32_t low = 0;
+    int32_t high = allocator->m_blockCount - 1;
+    int32_t result = -1;
+    while (low <= high) {
+        int32_t middle = low + ((high - low) / 2);
+        if (allocator->m_blocks[middle]->m_cells <= address) {
+            result = middle;
+            low = middle + 1;
         }
         else {
-            /* At this point, the allocation was completed succesfully using a
-             * first-fit allocator.
-             */
-            xjtk_Logger_debug(ZEN_SEGREGATED_FITS_ALLOCATOR_TAG, "Successfully allocated memory chunk from a specific first-fit allocator. (sizeClass = %d, headSize = %d, bodySize = %d)",
-                sizeClass, headSize, bodySize);
-            break;
+            high = middle - 1;
         }
     }
+    return result;
 }
 
-uint8_t* zen_SegregatedFitsAllocator_allocateWithBestFit(
-    zen_SegregatedFitsAllocator_t* allocator, int32_t headSize, int32_t bodySize) {
-    jtk_Assert_assertObject(allocator, "The specified allocator is null.");
-
-    uint8_t* result = NULL;
-    int32_t requestSize = headSize + bodySize;
-    int32_t sizeClass = zen_SegregatedFitsAllocator_findSizeClass(allocator, size);
+static void zen_SegregatedFitsAllocator_addBlock(zen_SegregatedFitsAllocator_t* allocator,
+    zen_MemoryBlock_t* block) {
+    if (allocator->m_blockCount == allocator->m_blockCapacity) {
+        int32_t capacity = allocator->m_blockCapacity * 2;
+        zen_MemoryBlock_t** blocks = jtk_Memory_allocate(zen_MemoryBlock_t*, capacity);
+        int32_t i;
+        for (i = 0; i < allocator->m_blockCount; i++) {
+            blocks[i] = allocator->m_blocks[i];
+        }
+        jtk_Memory_deallocate(allocator->m_blocks);
+        allocator->m_blocks = blocks;
+        allocator->m_blockCapacity = capacity;
+    }
 
+    /* Keep the blocks sorted by their addresses. */
+    int32_t index = zen_SegregatedFitsAllocator_searchBlock(allocator, block->m_cells) + 1;
     int32_t i;
-    for (i = sizeClass; i <= allocator->m_balanceFactor; i++) {
-        xjtk_Logger_debug(ZEN_SEGREGATED_FITS_ALLOCATOR_TAG, "Trying to allocate object from a best-fit allocator. (sizeClass = %d, headSize = %d, bodySize = %d)",
-            sizeClass, headSize, bodySize);
-
-        zen_BestFitAllocator_t* bestFitAllocator =
-            (zen_BestFitAllocator_t*)allocator->m_freeListAllocators[i];
-        result = zen_BestFitAllocator_allocate(bestFitAllocator, headSize, bodySize);
-
-        if (result == NULL) {
-            /* At this point, the allocation request could not satisfied using 
-             * the best-fit allocator. The allocator will try again to
-             * allocate using the next best-fit allocator.
-             */
-            xjtk_Logger_debug(ZEN_SEGREGATED_FITS_ALLOCATOR_TAG, "Failed to allocate object from the best-fit allocator. The allocator will now try to satisfy the allocation request with the next general best-fit allocator, if any. (sizeClass = %d, headSize = %d, bodySize = %d)",
-                sizeClass, headSize, bodySize);
-        }
-        else {
-            /* At this point, the allocation was completed succesfully using a
-             * best-fit allocator.
-             */
-            xjtk_Logger_debug(ZEN_SEGREGATED_FITS_ALLOCATOR_TAG, "Successfully allocated memory chunk from a specific best-fit allocator. (sizeClass = %d, headSize = %d, bodySize = %d)",
-                sizeClass, headSize, bodySize);
-            break;
-        }
+    for (i = allocator->m_blockCount; i > index; i--) {
+        allocator->m_blocks[i] = allocator->m_blocks[i - 1];
     }
+    allocator->m_blocks[index] = block;
+    allocator->m_blockCount++;
+
+    allocator->m_reservedSize += (uint64_t)block->m_cellSize * block->m_cellCount;
 }
 
+/* Allocate */
+
 uint8_t* zen_SegregatedFitsAllocator_allocate(zen_SegregatedFitsAllocator_t* allocator,
-    int32_t headSize, int32_t bodySize) {
+    int32_t size, zen_ObjectType_t type) {
     jtk_Assert_assertObject(allocator, "The specified allocator is null.");
 
-    uint8_t* result = NULL;
-    switch (allocator->m_mode) {
-        case ZEN_SEGREGATED_FITS_ALLOCATOR_MODE_FIRST_FIT: {
-            xjtk_Logger_debug(ZEN_SEGREGATED_FITS_ALLOCATOR_TAG, "Trying to satisfy allocation request using best-fit allocator. (headSize = %d, bodySize = %d)",
-                headSize, bodySize);
-
-            result = zen_SegregatedFitsAllocator_allocateWithFirstFit(allocator, headSize, bodySize);
+    int32_t index = zen_SegregatedFitsAllocator_findSizeClass(allocator, size);
+    zen_MemoryBlock_t* block = NULL;
+    if (index < allocator->m_balanceFactor) {
+        zen_SizeClass_t* sizeClass = &allocator->m_sizeClasses[index];
+        block = sizeClass->m_availableBlocks;
+        if (block == NULL) {
+            block = zen_MemoryBlock_new(allocator->m_heap, sizeClass->m_cellSize,
+                (ZEN_MEMORY_BLOCK_SIZE - ZEN_MEMORY_BLOCK_HEADER_SIZE) / sizeClass->m_cellSize,
+                index);
+            if (block != NULL) {
+                zen_SegregatedFitsAllocator_addBlock(allocator, block);
+                sizeClass->m_availableBlocks = block;
+            }
+        }
 
-            break;
+        /* A block that runs out of free cells is no longer available. */
+        if ((block != NULL) && (block->m_freeCount == 1)) {
+            sizeClass->m_availableBlocks = block->m_nextAvailable;
+            block->m_nextAvailable = NULL;
+        }
+    }
+    else {
+        /* Large objects are not served from the size classes. Each of them
+         * receives a block with a single cell.
+         */
+        int32_t cellSize = (size + (ZEN_SEGREGATED_FITS_ALLOCATOR_BASE_CLASS_SIZE - 1)) &
+            ~(ZEN_SEGREGATED_FITS_ALLOCATOR_BASE_CLASS_SIZE - 1);
+        block = zen_MemoryBlock_new(allocator->m_heap, cellSize, 1, -1);
+        if (block != NULL) {
+            zen_SegregatedFitsAllocator_addBlock(allocator, block);
         }
+    }
 
-        case ZEN_SEGREGATED_FITS_ALLOCATOR_MODE_BEST_FIT: {
-            xjtk_Logger_debug(ZEN_SEGREGATED_FITS_ALLOCATOR_TAG, "Trying to satisfy allocation request using best-fit allocator. (headSize = %d, bodySize = %d)",
-                headSize, bodySize);
+    uint8_t* result = NULL;
+    if (block != NULL) {
+        result = block->m_freeList;
+        block->m_freeList = *((uint8_t**)result);
+        block->m_freeCount--;
+        block->m_flags[zen_MemoryBlock_getCellIndex(block, result)] =
+            ZEN_MEMORY_BLOCK_CELL_ALLOCATED | (type << ZEN_MEMORY_BLOCK_CELL_TYPE_SHIFT);
+        memset(result, 0, block->m_cellSize);
+
+        allocator->m_usedSize += block->m_cellSize;
+    }
 
-            result = zen_SegregatedFitsAllocator_allocateWithBestFit(allocator, headSize, bodySize);
+    return result;
+}
 
-            break;
-        }
+/* Cell */
 
-        default: {
-            xjtk_Logger_debug(ZEN_SEGREGATED_FITS_ALLOCATOR_TAG, "Unknown segregated fits allocator mode encountered. (mode = %d, headSize = %d, bodySize = %d)",
-                allocator->m_mode, headSize, bodySize);
+zen_MemoryBlock_t* zen_SegregatedFitsAllocator_findCell(zen_SegregatedFitsAllocator_t* allocator,
+    const void* address, int32_t* index) {
+    jtk_Assert_assertObject(allocator, "The specified allocator is null.");
 
-            break;
+    zen_MemoryBlock_t* result = NULL;
+    zen_Heap_t* heap = allocator->m_heap;
+    zen_MemoryBlock_t* block = ZEN_HEAP_CONTAINS(heap, address)?
+        ZEN_HEAP_GET_REGION(heap, address)->m_block : NULL;
+    /* The regions of the new generation do not refer to a block. */
+    if (block != NULL) {
+        int32_t cellIndex = zen_MemoryBlock_getCellIndex(block, (const uint8_t*)address);
+        if ((cellIndex >= 0) &&
+            ((block->m_flags[cellIndex] & ZEN_MEMORY_BLOCK_CELL_ALLOCATED) != 0)) {
+            result = block;
+            *index = cellIndex;
         }
     }
-
     return result;
 }
 
+void zen_SegregatedFitsAllocator_setType(zen_SegregatedFitsAllocator_t* allocator,
+    const void* object, zen_ObjectType_t type) {
+    jtk_Assert_assertObject(allocator, "The specified allocator is null.");
+
+    int32_t index;
+    zen_MemoryBlock_t* block = zen_SegregatedFitsAllocator_findCell(allocator, object, &index);
+    if (block != NULL) {
+        block->m_flags[index] = (block->m_flags[index] & ~ZEN_MEMORY_BLOCK_CELL_TYPE_MASK) |
+            (type << ZEN_MEMORY_BLOCK_CELL_TYPE_SHIFT);
+    }
+}
+
 /* Size Class */
 
-int32_t zen_SegregatedFitsAllocator_getSizeClass(int32_t index) {
-    return ZEN_SEGREGATED_FITS_ALLOCATOR_INITIAL_SIZE_CLASS +
-        (ZEN_SEGREGATED_FITS_ALLOCATOR_SIZE_CLASS_FACTOR * index);
+int32_t zen_SegregatedFitsAllocator_findSizeClass(zen_SegregatedFitsAllocator_t* allocator,
+    int32_t size) {
+    jtk_Assert_assertObject(allocator, "The specified allocator is null.");
+
+    int32_t result = (size <= ZEN_SEGREGATED_FITS_ALLOCATOR_BASE_CLASS_SIZE)? 0 :
+        ((size - ZEN_SEGREGATED_FITS_ALLOCATOR_BASE_CLASS_SIZE +
+            (ZEN_SEGREGATED_FITS_ALLOCATOR_SIZE_CLASS_FACTOR - 1)) /
+            ZEN_SEGREGATED_FITS_ALLOCATOR_SIZE_CLASS_FACTOR);
+    return (result < allocator->m_balanceFactor)? result : allocator->m_balanceFactor;
 }
 
-void zen_SegregatedFitsAllocator_initializeSizeClasses(zen_SegregatedFitsAllocator_t*
-    allocator) {
-    jtk_Assert_assertObject(allocator, "The specified segregated-fits allocator is null.");
+/* Sweep */
 
+uint64_t zen_SegregatedFitsAllocator_sweep(zen_SegregatedFitsAllocator_t* allocator,
+    zen_SegregatedFitsAllocator_FinalizeFunction_t finalize, void* context) {
+    jtk_Assert_assertObject(allocator, "The specified allocator is null.");
+
+    uint64_t result = 0;
     int32_t i;
-    for (i = 0; i < allocator->m_balanceFactor; i++) {
-        allocator->m_sizeClasses[i] =
-            zen_SegregatedFitsAllocator_getSizeClass(i);
+    for (i = 0; i < allocator->m_blockCount; i++) {
+        result += zen_SegregatedFitsAllocator_sweepBlock(allocator, i, finalize, context);
     }
-    segregatedFitsAllocator->m_sizeClasses[i] = JTK_INTEGER_MAX_VALUE;
+    zen_SegregatedFitsAllocator_finishSweep(allocator, result);
+
+    return result;
 }
 
-zen_SizeClass_t* zen_SegregatedFitsAllocator_findSizeClass(
-    zen_SegregatedFitsAllocator_t* allocator, int32_t size) {
+uint64_t zen_SegregatedFitsAllocator_sweepBlock(zen_SegregatedFitsAllocator_t* allocator,
+    int32_t index, zen_SegregatedFitsAllocator_FinalizeFunction_t finalize, void* context) {
     jtk_Assert_assertObject(allocator, "The specified allocator is null.");
 
-    int32_t index = -1;
-    int32_t leftIndex = 0;
-    int32_t rightIndex = allocator->m_balanceFactor; /* Alternatively, `allocator->m_sizeClassesSize - 1` */
-    
-    /* The size of a free cell, represented by `size`, is limited to
-     * `classes[i - 1] < size <= classes[i]`. We assume that `classes[-1] = 0`
-     * and `classes[k] = JTK_INTEGER_MAX_VALUE`.
-     * The allocator has `balanceFactor + 1` free-lists, the last free-list
-     * is used to allocate large objects. All the free-lists are included
-     * when searching for a size class.
-     *
-     * Given the size classes are always sorted in ascending order, the allocator
-     * applies an algorithm based on the binary search algorithm. First, a regular
-     * binary search algorithm is performed, with the specified size as the key.
-     * If the specified size is not equal to a particular size class, the resulting
-     * index remains a negative integer. In which case, the left index is assumed
-     * as the size class.
-     */
-    while (leftIndex <= rightIndex) {
-        int32_t middleIndex = (uint32_t)(leftIndex + rightIndex) >> 1;
-
-        int32_t sizeClass = allocator->m_sizeClasses[middleIndex];
-        if (sizeClass < size) {
-            leftIndex = middleIndex + 1;
-        }
-        else if (sizeClass > size) {
-            rightIndex = middleIndex - 1;
+    uint64_t result = 0;
+    zen_MemoryBlock_t* block = allocator->m_blocks[index];
+    uint64_t liveSize = 0;
+    block->m_freeList = NULL;
+    block->m_freeCount = 0;
+    block->m_nextAvailable = NULL;
+
+    int32_t j;
+    for (j = block->m_cellCount - 1; j >= 0; j--) {
+        uint8_t* cell = block->m_cells + (j * block->m_cellSize);
+        uint8_t flags = block->m_flags[j];
+        if ((flags & ZEN_MEMORY_BLOCK_CELL_MARKED) != 0) {
+            block->m_flags[j] = flags & ~ZEN_MEMORY_BLOCK_CELL_MARKED;
+            liveSize += block->m_cellSize;
         }
         else {
-            result = middleIndex;
-            break;
+            if ((flags & ZEN_MEMORY_BLOCK_CELL_ALLOCATED) != 0) {
+                if (finalize != NULL) {
+                    finalize(context, cell, ZEN_MEMORY_BLOCK_GET_CELL_TYPE(flags));
+                }
+                block->m_flags[j] = 0;
+                result += block->m_cellSize;
+            }
+            *((uint8_t**)cell) = block->m_freeList;
+            block->m_freeList = cell;
+            block->m_freeCount++;
         }
     }
-    
-    return (result < 0)? leftIndex : result;
 
-    /* The following code segment implements a linear search algorithm.
-     * It was the original algorithm that the allocator used. It was replaced
-     * with a binary search algorithm to improve performance. Further, the algorithm
-     * has now evolved.
+    /* The region records the bytes that survived, and the number of major
+     * collections that the block survived.
      */
-//    int32_t index;
-//    for (index = 0; index < allocator->m_balanceFactor; index++) {
-//        if ((size > previous) && (size <= allocator->m_sizeClasses[index])) {
-//            /* The size class was found. We can terminate the loop now. */
-//            break;
-//        }
-//        else {
-//            /* The size class was not found. */
-//            previous = allocator->m_sizeClasses[index];
-//        }
-//    }
+    block->m_region->m_liveSize = liveSize;
+    block->m_region->m_age++;
+
+    return result;
 }
 
-struct zen_ObjectHeader_t {
-    uint8_t m_type;
-    void* m_typeReference;
-    union {
-        struct {
-            uint16_t m_length;
-        } m_array;
-    };
-};
\ No newline at end of file
+void zen_SegregatedFitsAllocator_finishSweep(zen_SegregatedFitsAllocator_t* allocator,
+    uint64_t freedSize) {
+    jtk_Assert_assertObject(allocator, "The specified allocator is null.");
+
+    /* The lists of available blocks are rebuilt from scratch. */
+    int32_t i;
+    for (i = 0; i < allocator->m_balanceFactor; i++) {
+        allocator->m_sizeClasses[i].m_availableBlocks = NULL;
+    }
+
+    int32_t blockCount = 0;
+    for (i = 0; i < allocator->m_blockCount; i++) {
+        zen_MemoryBlock_t* block = allocator->m_blocks[i];
+        if (block->m_freeCount == block->m_cellCount) {
+            /* Return the memory block to the system. */
+            allocator->m_reservedSize -= (uint64_t)block->m_cellSize * block->m_cellCount;
+            zen_MemoryBlock_delete(allocator->m_heap, block);
+        }
+        else {
+            if ((block->m_freeCount > 0) && (block->m_sizeClass >= 0)) {
+                zen_SizeClass_t* sizeClass = &allocator->m_sizeClasses[block->m_sizeClass];
+                block->m_nextAvailable = sizeClass->m_availableBlocks;
+                sizeClass->m_availableBlocks = block;
+            }
+            /* The order of the surviving blocks is preserved. */
+            allocator->m_blocks[blockCount++] = block;
+        }
+    }
+    allocator->m_blockCount = blockCount;
+    allocator->m_usedSize -= freedSize;
+}
\ No newline at end of file
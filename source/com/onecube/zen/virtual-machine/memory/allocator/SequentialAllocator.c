@@ -16,8 +16,9 @@
 
 // Tuesday, January 22, 2019
 
+#include <jtk/core/Assert.h>
+
 #include <com/onecube/zen/virtual-machine/memory/allocator/SequentialAllocator.h>
-#include <jtk/support/log/Logger.h>
 
 /*******************************************************************************
  * SequentialAllocator                                                         *
@@ -25,55 +26,84 @@
 
 /* Constructor */
 
-zen_SequentialAllocator_t* zen_SequentialAllocator_new(jtk_Allocator_t* allocator, int8_t* start,
-    int8_t* limit) {
-    jtk_Assert_assertObject(allocator, "The specified allocator is null.");
-    jtk_Assert_assertObject(start, "The specified pointer to the start of the memory chunk is null.");
-    jtk_Assert_assertObject(limit, "The specified pointer to the end of the memory chunk is null.");
-    
-    zen_SequentialAllocator_t* sequentialAllocator = (zen_SequentialAllocator_t*)jtk_Allocator_allocate(allocator, sizeof (zen_SequentialAllocator), 1);
-    sequentialAllocator->m_start = start;
-    sequentialAllocator->m_limit = limit;
-    sequentialAllocator->m_free = start;
-    
-    return sequentialAllocator;
+zen_SequentialAllocator_t* zen_SequentialAllocator_new(uint8_t* start, uint8_t* limit) {
+    zen_SequentialAllocator_t* allocator = jtk_Memory_allocate(zen_SequentialAllocator_t, 1);
+    allocator->m_start = start;
+    allocator->m_limit = limit;
+    allocator->m_free = start;
+
+    return allocator;
 }
 
 /* Destructor */
 
-void zen_SequentialAllocator_delete(jtk_Allocator_t* allocator,
-    zen_SequentialAllocator_t* sequentialAllocator) {
+void zen_SequentialAllocator_delete(zen_SequentialAllocator_t* allocator) {
     jtk_Assert_assertObject(allocator, "The specified allocator is null.");
-    jtk_Assert_assertObject(sequentialAllocator, "The specified sequential allocator is null.");
-    
-    jtk_Allocator_deallocate(allocator, sequentialAllocator);
+
+    jtk_Memory_deallocate(allocator);
 }
 
 /* Allocator */
 
-int8_t* zen_SequentialAllocator_allocate(zen_SequentialAllocator_t* allocator,
-    int32_t headerSize, int32_t bodySize) {
+uint8_t* zen_SequentialAllocator_allocate(zen_SequentialAllocator_t* allocator,
+    int32_t size) {
     jtk_Assert_assertObject(allocator, "The specified allocator is null.");
 
-    int8_t* result = NULL;
-    int32_t requestSize = headerSize + bodySize;
-    int8_t* newFree = allocator->m_free + requestSize;
-    
+    uint8_t* result = NULL;
+
     /* Make sure that when the free pointer is bumped, it does not exceed the
      * limitation of the memory chunk the allocator is assigned.
      */
-    if (newFree <= buffer->m_limit) {
+    if (size <= (allocator->m_limit - allocator->m_free)) {
         result = allocator->m_free;
         /* Bump the free pointer to indicate the new free region. */
-        buffer->m_free = newFree;
-        
-        xjtk_Logger_debug(JTK_SEQUENTIAL_ALLOCATOR, "Successfully allocated memory. (requestSize = %d, headerSize = %d, bodySize = %d)",
-        requestSize, headerSize, bodySize);
+        allocator->m_free += size;
     }
-    else {
-        xjtk_Logger_debug(JTK_SEQUENTIAL_ALLOCATOR, "Failed to allocate memory. (requestSize = %d, headerSize = %d, bodySize = %d)",
-        requestSize, headerSize, bodySize);
+
+    return result;
+}
+
+/* Reset */
+
+void zen_SequentialAllocator_reset(zen_SequentialAllocator_t* allocator,
+    uint8_t* start, uint8_t* limit) {
+    jtk_Assert_assertObject(allocator, "The specified allocator is null.");
+
+    allocator->m_start = start;
+    allocator->m_limit = limit;
+    allocator->m_free = start;
+}
+
+/* Allocation Buffer */
+
+bool zen_SequentialAllocator_makeAllocationBuffer(zen_SequentialAllocator_t* allocator,
+    zen_AllocationBuffer_t* buffer, int32_t minimumSize) {
+    jtk_Assert_assertObject(allocator, "The specified allocator is null.");
+    jtk_Assert_assertObject(buffer, "The specified allocation buffer is null.");
+
+    intptr_t available = allocator->m_limit - allocator->m_free;
+    bool result = (available >= minimumSize) && (available > 0);
+    if (result) {
+        intptr_t size = (available < ZEN_ALLOCATION_BUFFER_SIZE)?
+            available : ZEN_ALLOCATION_BUFFER_SIZE;
+        buffer->m_free = allocator->m_free;
+        buffer->m_limit = allocator->m_free + size;
+        allocator->m_free += size;
     }
-    
     return result;
+}
+
+void zen_SequentialAllocator_mergeAllocationBuffer(zen_SequentialAllocator_t* allocator,
+    zen_AllocationBuffer_t* buffer) {
+    jtk_Assert_assertObject(allocator, "The specified allocator is null.");
+    jtk_Assert_assertObject(buffer, "The specified allocation buffer is null.");
+
+    /* The free pointer can be moved back only if no chunk was carved after
+     * the buffer.
+     */
+    if ((buffer->m_limit != NULL) && (buffer->m_limit == allocator->m_free)) {
+        allocator->m_free = buffer->m_free;
+    }
+    buffer->m_free = NULL;
+    buffer->m_limit = NULL;
 }
\ No newline at end of file
@@ -16,32 +16,61 @@
 
 // Saturday, March 16, 2019
 
+#include <jtk/core/Assert.h>
+
 #include <com/onecube/zen/virtual-machine/memory/collector/GarbageCollectionProfile.h>
 
 /*******************************************************************************
  * GarbageCollectionProfile                                                    *
  *******************************************************************************/
 
+/* Constructor */
+
 zen_GarbageCollectionProfile_t* zen_GarbageCollectionProfile_new(
-    zen_GarbageCollectionReason_t m_reason, zen_GarbageCollectionType_t type,
+    zen_GarbageCollectionReason_t reason, zen_GarbageCollectionType_t type,
     uint64_t memoryFreePreviously, uint64_t memoryUsedPreviously) {
-    
     return zen_GarbageCollectionProfile_newEx(reason, type, memoryFreePreviously,
         memoryUsedPreviously, 0, 0, 0);
 }
 
 zen_GarbageCollectionProfile_t* zen_GarbageCollectionProfile_newEx(
-    zen_GarbageCollectionReason_t m_reason, zen_GarbageCollectionType_t type,
+    zen_GarbageCollectionReason_t reason, zen_GarbageCollectionType_t type,
     uint64_t memoryFreePreviously, uint64_t memoryUsedPreviously,
     uint64_t memoryFreeCurrently, uint64_t memoryUsedCurrently, uint64_t duration) {
-        zen_GarbageCollectionProfile_t* profile = zen_ReserveAllocator_allocate(zen_GarbageCollectionProfile_t, 1);
+    zen_GarbageCollectionProfile_t* profile = jtk_Memory_allocate(zen_GarbageCollectionProfile_t, 1);
     profile->m_reason = reason;
     profile->m_type = type;
     profile->m_memoryFreePreviously = memoryFreePreviously;
     profile->m_memoryUsedPreviously = memoryUsedPreviously;
     profile->m_memoryFreeCurrently = memoryFreeCurrently;
-    profile->m_memoryUsedPreviously = memoryUsedCurrently;
+    profile->m_memoryUsedCurrently = memoryUsedCurrently;
     profile->m_duration = duration;
-    
+    profile->m_pauseCount = 0;
+    profile->m_totalPauseTime = 0;
+    profile->m_maximumPauseTime = 0;
+
     return profile;
 }
+
+/* Destructor */
+
+void zen_GarbageCollectionProfile_delete(zen_GarbageCollectionProfile_t* profile) {
+    jtk_Assert_assertObject(profile, "The specified profile is null.");
+
+    jtk_Memory_deallocate(profile);
+}
+
+/* Pause */
+
+void zen_GarbageCollectionProfile_recordPause(zen_GarbageCollectionProfile_t* profile,
+    zen_GarbageCollectionType_t type, uint64_t duration) {
+    jtk_Assert_assertObject(profile, "The specified profile is null.");
+
+    profile->m_pauses[profile->m_pauseCount % ZEN_GARBAGE_COLLECTION_PROFILE_PAUSE_HISTORY_SIZE] = duration;
+    profile->m_pauseCount++;
+    profile->m_totalPauseTime += duration;
+    if (duration > profile->m_maximumPauseTime) {
+        profile->m_maximumPauseTime = duration;
+    }
+    profile->m_type = type;
+}
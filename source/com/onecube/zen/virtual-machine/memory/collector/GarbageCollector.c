@@ -0,0 +1,941 @@
+/*
+ * Copyright 2018-2020 Samuel Rowe
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Sunday, October 25, 2020
+
+#include <sched.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <jtk/collection/Iterator.h>
+#include <jtk/collection/map/HashMap.h>
+#include <jtk/collection/map/HashMapEntry.h>
+#include <jtk/core/Assert.h>
+
+#include <com/onecube/zen/virtual-machine/VirtualMachine.h>
+#include <com/onecube/zen/virtual-machine/feb/constant-pool/ConstantPool.h>
+#include <com/onecube/zen/virtual-machine/feb/constant-pool/ConstantPoolTag.h>
+#include <com/onecube/zen/virtual-machine/memory/collector/GarbageCollector.h>
+#include <com/onecube/zen/virtual-machine/object/Array.h>
+#include <com/onecube/zen/virtual-machine/object/Class.h>
+#include <com/onecube/zen/virtual-machine/object/Object.h>
+#include <com/onecube/zen/virtual-machine/object/String.h>
+
+/*******************************************************************************
+ * GarbageCollector                                                            *
+ *******************************************************************************/
+
+#define ZEN_GARBAGE_COLLECTOR_DEFAULT_MARK_STACK_CAPACITY 256
+#define ZEN_GARBAGE_COLLECTOR_DEFAULT_PINNED_OBJECT_CAPACITY 64
+
+/* The phases of a major collection, which are performed by all the workers. */
+#define ZEN_GARBAGE_COLLECTOR_PHASE_MARK 0
+#define ZEN_GARBAGE_COLLECTOR_PHASE_SWEEP 1
+#define ZEN_GARBAGE_COLLECTOR_PHASE_EXIT 2
+
+/* The number of memory blocks a worker claims at once while sweeping. */
+#define ZEN_GARBAGE_COLLECTOR_SWEEP_CHUNK_SIZE 8
+
+/* The number of objects traced by an incremental marking slice between two
+ * readings of the clock.
+ */
+#define ZEN_GARBAGE_COLLECTOR_SLICE_CHECK_INTERVAL 64
+
+/* The slots of the invocation stack store references as two consecutive
+ * 32-bit slots on 64-bit platforms, with the high part first.
+ */
+#define ZEN_GARBAGE_COLLECTOR_REFERENCE_SLOT_COUNT ((sizeof (uintptr_t) <= 4)? 1 : 2)
+
+
+/* The header of a young object that was copied to the old generation holds
+ * the address of the copy, tagged with this bit.
+ */
+#define ZEN_GARBAGE_COLLECTOR_FORWARDED ZEN_OBJECT_HEADER_FORWARDED
+
+/* During a minor collection, the type of a grey object is stored in the
+ * lower bits of its address, which are clear because objects begin at
+ * multiples of 8 bytes.
+ */
+#define ZEN_GARBAGE_COLLECTOR_TYPE_MASK ((uintptr_t)0x3)
+#define ZEN_GARBAGE_COLLECTOR_PACK(object, type) \
+    ((uint8_t*)((uintptr_t)(object) | (uintptr_t)(type)))
+#define ZEN_GARBAGE_COLLECTOR_UNPACK_OBJECT(entry) \
+    ((uint8_t*)((uintptr_t)(entry) & ~ZEN_GARBAGE_COLLECTOR_TYPE_MASK))
+#define ZEN_GARBAGE_COLLECTOR_UNPACK_TYPE(entry) \
+    ((zen_ObjectType_t)((uintptr_t)(entry) & ZEN_GARBAGE_COLLECTOR_TYPE_MASK))
+
+typedef void (*zen_GarbageCollector_VisitAmbiguousFunction_t)(zen_GarbageCollector_t* collector,
+    uintptr_t candidate);
+typedef void (*zen_GarbageCollector_VisitPreciseFunction_t)(zen_GarbageCollector_t* collector,
+    uintptr_t* slot);
+
+static void* zen_GarbageCollectorWorker_run(void* argument);
+static void zen_GarbageCollector_runPhase(zen_GarbageCollector_t* collector,
+    int32_t phase);
+
+/* Constructor */
+
+zen_GarbageCollector_t* zen_GarbageCollector_new(zen_VirtualMachine_t* virtualMachine,
+    zen_ClassTable_t* classTable, zen_SegregatedFitsAllocator_t* allocator,
+    zen_NewGeneration_t* newGeneration, int32_t workerCount) {
+    jtk_Assert_assertObject(classTable, "The specified class table is null.");
+    jtk_Assert_assertObject(allocator, "The specified allocator is null.");
+    jtk_Assert_assertObject(newGeneration, "The specified generation is null.");
+
+    zen_GarbageCollector_t* collector = jtk_Memory_allocate(zen_GarbageCollector_t, 1);
+    collector->m_lastCollectionTime = 0;
+    collector->m_totalCollectionTime = 0;
+    collector->m_virtualMachine = virtualMachine;
+    collector->m_allocator = allocator;
+    collector->m_newGeneration = newGeneration;
+    collector->m_markStack = jtk_Memory_allocate(uint8_t*,
+        ZEN_GARBAGE_COLLECTOR_DEFAULT_MARK_STACK_CAPACITY);
+    collector->m_markStackSize = 0;
+    collector->m_markStackCapacity = ZEN_GARBAGE_COLLECTOR_DEFAULT_MARK_STACK_CAPACITY;
+    collector->m_pinnedObjects = jtk_Memory_allocate(uint8_t*,
+        ZEN_GARBAGE_COLLECTOR_DEFAULT_PINNED_OBJECT_CAPACITY);
+    collector->m_pinnedObjectCount = 0;
+    collector->m_pinnedObjectCapacity = ZEN_GARBAGE_COLLECTOR_DEFAULT_PINNED_OBJECT_CAPACITY;
+    collector->m_collectionCount = 0;
+    collector->m_freedSize = 0;
+    collector->m_totalMinorCollectionTime = 0;
+    collector->m_minorCollectionCount = 0;
+    collector->m_promotedSize = 0;
+
+    if (workerCount <= 0) {
+        workerCount = (int32_t)sysconf(_SC_NPROCESSORS_ONLN);
+    }
+    if (workerCount <= 0) {
+        workerCount = 1;
+    }
+    else if (workerCount > ZEN_GARBAGE_COLLECTOR_MAXIMUM_WORKER_COUNT) {
+        workerCount = ZEN_GARBAGE_COLLECTOR_MAXIMUM_WORKER_COUNT;
+    }
+    collector->m_workers = jtk_Memory_allocate(zen_GarbageCollectorWorker_t, workerCount);
+    collector->m_workerCount = workerCount;
+    pthread_mutex_init(&collector->m_mutex, NULL);
+    pthread_cond_init(&collector->m_phaseCondition, NULL);
+    pthread_cond_init(&collector->m_completionCondition, NULL);
+    collector->m_phase = ZEN_GARBAGE_COLLECTOR_PHASE_EXIT;
+    collector->m_epoch = 0;
+    collector->m_pendingWorkerCount = 0;
+    collector->m_idleWorkerCount = 0;
+    collector->m_sweepCursor = 0;
+    collector->m_marking = false;
+    collector->m_classTable = classTable;
+    collector->m_profile = zen_GarbageCollectionProfile_new(
+        ZEN_GARBAGE_COLLECTION_REASON_NATIVE_REQUEST, ZEN_GARBAGE_COLLECTION_TYPE_MINOR, 0, 0);
+
+    int32_t i;
+    for (i = 0; i < workerCount; i++) {
+        zen_GarbageCollectorWorker_t* worker = &collector->m_workers[i];
+        worker->m_collector = collector;
+        worker->m_index = i;
+        worker->m_deque = zen_WorkStealingDeque_new();
+        worker->m_random = (uint32_t)(i + 1) * 2654435761U;
+        worker->m_freedSize = 0;
+    }
+
+    /* The first worker is the thread that requests a collection. */
+    for (i = 1; i < workerCount; i++) {
+        zen_GarbageCollectorWorker_t* worker = &collector->m_workers[i];
+        pthread_create(&worker->m_thread, NULL, zen_GarbageCollectorWorker_run, worker);
+    }
+
+    return collector;
+}
+
+/* Destructor */
+
+void zen_GarbageCollector_delete(zen_GarbageCollector_t* collector) {
+    jtk_Assert_assertObject(collector, "The specified garbage collector is null.");
+
+    zen_GarbageCollector_runPhase(collector, ZEN_GARBAGE_COLLECTOR_PHASE_EXIT);
+    int32_t i;
+    for (i = 0; i < collector->m_workerCount; i++) {
+        zen_GarbageCollectorWorker_t* worker = &collector->m_workers[i];
+        if (i > 0) {
+            pthread_join(worker->m_thread, NULL);
+        }
+        zen_WorkStealingDeque_delete(worker->m_deque);
+    }
+    jtk_Memory_deallocate(collector->m_workers);
+    pthread_cond_destroy(&collector->m_completionCondition);
+    pthread_cond_destroy(&collector->m_phaseCondition);
+    pthread_mutex_destroy(&collector->m_mutex);
+
+    zen_GarbageCollectionProfile_delete(collector->m_profile);
+
+    jtk_Memory_deallocate(collector->m_pinnedObjects);
+    jtk_Memory_deallocate(collector->m_markStack);
+    jtk_Memory_deallocate(collector);
+}
+
+/* Object Size */
+
+/* Returns the number of bytes occupied by an object, including the header.
+ * The size of an array or a string depends on its length, whereas the size
+ * of any other object is determined by its class.
+ */
+static int32_t zen_GarbageCollector_getObjectSize(zen_GarbageCollector_t* collector,
+    const uint8_t* object, uint64_t header, zen_ObjectType_t type) {
+    int32_t result;
+    if (type == ZEN_OBJECT_TYPE_AGGREGATE_OBJECT) {
+        zen_Class_t* class0 = ZEN_CLASS_TABLE_GET_CLASS(collector->m_classTable,
+            ZEN_OBJECT_HEADER_GET_CLASS_INDEX(header));
+        result = ZEN_OBJECT_HEADER_SIZE + class0->m_memoryRequirement;
+    }
+    else if (type == ZEN_OBJECT_TYPE_STRING) {
+        result = zen_String_getAllocationSize(ZEN_STRING_SIZE(object));
+    }
+    else {
+        result = zen_Array_getAllocationSize((zen_Type_t)ZEN_ARRAY_ELEMENT_TYPE(object),
+            ZEN_ARRAY_LENGTH(object));
+    }
+    return result;
+}
+
+/* Mark Stack */
+
+static void zen_GarbageCollector_push(zen_GarbageCollector_t* collector,
+    uint8_t* object) {
+    if (collector->m_markStackSize == collector->m_markStackCapacity) {
+        int32_t capacity = collector->m_markStackCapacity * 2;
+        uint8_t** markStack = jtk_Memory_allocate(uint8_t*, capacity);
+        int32_t i;
+        for (i = 0; i < collector->m_markStackSize; i++) {
+            markStack[i] = collector->m_markStack[i];
+        }
+        jtk_Memory_deallocate(collector->m_markStack);
+        collector->m_markStack = markStack;
+        collector->m_markStackCapacity = capacity;
+    }
+    collector->m_markStack[collector->m_markStackSize++] = object;
+}
+
+/* Roots */
+
+static void zen_GarbageCollector_visitSlots(zen_GarbageCollector_t* collector,
+    const int32_t* slots, int32_t size, zen_GarbageCollector_VisitAmbiguousFunction_t visit) {
+    /* The slots do not record whether they hold a reference. Further, a
+     * reference may begin at any slot. Therefore, every run of slots that is
+     * wide enough to hold a reference is considered.
+     */
+    int32_t i;
+    for (i = 0; i + ZEN_GARBAGE_COLLECTOR_REFERENCE_SLOT_COUNT <= size; i++) {
+        uintptr_t candidate = (ZEN_GARBAGE_COLLECTOR_REFERENCE_SLOT_COUNT == 1)?
+            (uintptr_t)(uint32_t)slots[i] :
+            (uintptr_t)(((uint64_t)(uint32_t)slots[i] << 32) | (uint32_t)slots[i + 1]);
+        visit(collector, candidate);
+    }
+}
+
+/* Visits the ambiguous roots, which cannot be updated, and the precise roots,
+ * which can be updated. Either of the visitors may be null.
+ */
+static void zen_GarbageCollector_visitRoots(zen_GarbageCollector_t* collector,
+    zen_Object_t** handles, int32_t handleCount,
+    zen_GarbageCollector_VisitAmbiguousFunction_t visitAmbiguous,
+    zen_GarbageCollector_VisitPreciseFunction_t visitPrecise) {
+    zen_VirtualMachine_t* virtualMachine = collector->m_virtualMachine;
+    zen_Interpreter_t* interpreter = virtualMachine->m_interpreter;
+    int32_t i;
+
+    if (visitAmbiguous != NULL) {
+        /* The local variable arrays and the operand stacks of the active stack
+         * frames.
+         */
+        zen_InvocationStack_t* invocationStack = interpreter->m_invocationStack;
+        for (i = 0; i < invocationStack->m_size; i++) {
+            zen_StackFrame_t* stackFrame = &invocationStack->m_stackFrames[i];
+            zen_GarbageCollector_visitSlots(collector, stackFrame->m_localVariableArray.m_values,
+                stackFrame->m_localVariableArray.m_size, visitAmbiguous);
+            zen_GarbageCollector_visitSlots(collector, stackFrame->m_operandStack.m_values,
+                stackFrame->m_operandStack.m_size, visitAmbiguous);
+        }
+
+        /* The objects referred by native code. Native code may push raw values
+         * along with references, which are filtered out like the slots.
+         */
+        for (i = 0; i < handleCount; i++) {
+            visitAmbiguous(collector, (uintptr_t)handles[i]);
+        }
+    }
+
+    if (visitPrecise != NULL) {
+        /* The literal objects resolved by the loaded classes and the static
+         * fields of the loaded classes.
+         */
+        jtk_Iterator_t* iterator = jtk_HashMap_getEntryIterator(virtualMachine->m_classLoader->m_classes);
+        while (jtk_Iterator_hasNext(iterator)) {
+            jtk_HashMapEntry_t* entry = (jtk_HashMapEntry_t*)jtk_Iterator_getNext(iterator);
+            zen_Class_t* class0 = (zen_Class_t*)jtk_HashMapEntry_getValue(entry);
+            zen_ConstantPool_t* constantPool = &class0->m_entityFile->m_constantPool;
+
+            int32_t j;
+            for (j = 1; j <= constantPool->m_size; j++) {
+                zen_ConstantPoolEntry_t* constantPoolEntry = constantPool->m_entries[j];
+                if ((constantPoolEntry != NULL) &&
+                    ((constantPoolEntry->m_tag == ZEN_CONSTANT_POOL_TAG_STRING) ||
+                    (constantPoolEntry->m_tag == ZEN_CONSTANT_POOL_TAG_INTEGER) ||
+                    (constantPoolEntry->m_tag == ZEN_CONSTANT_POOL_TAG_LONG))) {
+                    visitPrecise(collector,
+                        (uintptr_t*)&class0->m_resolvedEntries[j].m_object);
+                }
+            }
+
+            for (j = 0; j < class0->m_staticReferenceOffsetCount; j++) {
+                visitPrecise(collector, (uintptr_t*)(class0->m_staticFields +
+                    class0->m_staticReferenceOffsets[j]));
+            }
+        }
+        jtk_Iterator_delete(iterator);
+
+        /* The shared instances of the Boolean class and the exception being
+         * thrown.
+         */
+        visitPrecise(collector, (uintptr_t*)&virtualMachine->m_booleans[0]);
+        visitPrecise(collector, (uintptr_t*)&virtualMachine->m_booleans[1]);
+        visitPrecise(collector, (uintptr_t*)&interpreter->m_exception);
+    }
+}
+
+/* Minor Collection */
+
+static void zen_GarbageCollector_addPinnedObject(zen_GarbageCollector_t* collector,
+    uint8_t* object) {
+    if (collector->m_pinnedObjectCount == collector->m_pinnedObjectCapacity) {
+        int32_t capacity = collector->m_pinnedObjectCapacity * 2;
+        uint8_t** pinnedObjects = jtk_Memory_allocate(uint8_t*, capacity);
+        int32_t i;
+        for (i = 0; i < collector->m_pinnedObjectCount; i++) {
+            pinnedObjects[i] = collector->m_pinnedObjects[i];
+        }
+        jtk_Memory_deallocate(collector->m_pinnedObjects);
+        collector->m_pinnedObjects = pinnedObjects;
+        collector->m_pinnedObjectCapacity = capacity;
+    }
+    collector->m_pinnedObjects[collector->m_pinnedObjectCount++] = object;
+}
+
+/* Pins a young object in place. The object is scanned like the objects that
+ * are copied.
+ */
+static void zen_GarbageCollector_pin(zen_GarbageCollector_t* collector,
+    uint8_t* object) {
+    zen_NewGeneration_t* generation = collector->m_newGeneration;
+    uint8_t flags = ZEN_NEW_GENERATION_GET_OBJECT_FLAGS(generation, object);
+    zen_ObjectType_t type = ZEN_MEMORY_BLOCK_GET_CELL_TYPE(flags);
+
+    zen_NewGeneration_pin(generation, object, zen_GarbageCollector_getObjectSize(collector,
+        object, ZEN_OBJECT_HEADER(object), type));
+    zen_GarbageCollector_addPinnedObject(collector, object);
+    zen_GarbageCollector_push(collector, ZEN_GARBAGE_COLLECTOR_PACK(object, type));
+}
+
+static void zen_GarbageCollector_pinCandidate(zen_GarbageCollector_t* collector,
+    uintptr_t candidate) {
+    zen_NewGeneration_t* generation = collector->m_newGeneration;
+    if (ZEN_NEW_GENERATION_IS_OBJECT(generation, candidate) &&
+        ((ZEN_NEW_GENERATION_GET_OBJECT_FLAGS(generation, candidate) &
+            ZEN_NEW_GENERATION_OBJECT_PINNED) == 0)) {
+        zen_GarbageCollector_pin(collector, (uint8_t*)candidate);
+    }
+}
+
+/* Copies the young object referred by the specified slot to the old
+ * generation, unless it was already copied or pinned, and updates the slot.
+ * Returns true if the slot still refers to a young object, that is, a pinned
+ * object.
+ */
+static bool zen_GarbageCollector_forward(zen_GarbageCollector_t* collector,
+    uintptr_t* slot) {
+    zen_NewGeneration_t* generation = collector->m_newGeneration;
+    uintptr_t value = *slot;
+    bool result = false;
+    if (ZEN_NEW_GENERATION_IS_OBJECT(generation, value)) {
+        uint8_t flags = ZEN_NEW_GENERATION_GET_OBJECT_FLAGS(generation, value);
+        uint64_t* header = &ZEN_OBJECT_HEADER(value);
+        if ((flags & ZEN_NEW_GENERATION_OBJECT_PINNED) != 0) {
+            result = true;
+        }
+        else if ((*header & ZEN_GARBAGE_COLLECTOR_FORWARDED) != 0) {
+            *slot = (uintptr_t)(*header & ~ZEN_GARBAGE_COLLECTOR_FORWARDED);
+        }
+        else {
+            zen_ObjectType_t type = ZEN_MEMORY_BLOCK_GET_CELL_TYPE(flags);
+            int32_t size = zen_GarbageCollector_getObjectSize(collector, (const uint8_t*)value,
+                *header, type);
+            uint8_t* copy = zen_SegregatedFitsAllocator_allocate(collector->m_allocator,
+                size, type);
+            if (copy != NULL) {
+                memcpy(copy, (void*)value, size);
+                *header = (uint64_t)(uintptr_t)copy | ZEN_GARBAGE_COLLECTOR_FORWARDED;
+                *slot = (uintptr_t)copy;
+                collector->m_promotedSize += size;
+                /* The objects promoted during an incremental marking were
+                 * not reachable when the marking began.
+                 */
+                if (collector->m_marking) {
+                    zen_GarbageCollector_markAllocated(collector, copy);
+                }
+                zen_GarbageCollector_push(collector, ZEN_GARBAGE_COLLECTOR_PACK(copy, type));
+            }
+            else {
+                /* The old generation is exhausted. The object survives in
+                 * the new generation.
+                 */
+                zen_GarbageCollector_pin(collector, (uint8_t*)value);
+                result = true;
+            }
+        }
+    }
+    return result;
+}
+
+static void zen_GarbageCollector_forwardRoot(zen_GarbageCollector_t* collector,
+    uintptr_t* slot) {
+    zen_GarbageCollector_forward(collector, slot);
+}
+
+/* Updates the references held by an object. Returns true if the object
+ * still refers to a young object.
+ */
+static bool zen_GarbageCollector_scan(zen_GarbageCollector_t* collector,
+    uint8_t* object, zen_ObjectType_t type) {
+    bool result = false;
+    int32_t i;
+    if (type == ZEN_OBJECT_TYPE_AGGREGATE_OBJECT) {
+        zen_Class_t* class0 = ZEN_OBJECT_GET_CLASS(collector->m_classTable, object);
+        uint8_t* body = object + ZEN_OBJECT_HEADER_SIZE;
+        for (i = 0; i < class0->m_referenceOffsetCount; i++) {
+            result |= zen_GarbageCollector_forward(collector,
+                (uintptr_t*)(body + class0->m_referenceOffsets[i]));
+        }
+    }
+    else if (type == ZEN_OBJECT_TYPE_REFERENCE_ARRAY) {
+        /* The elements of a reference array follow its length. */
+        uintptr_t* elements = ZEN_ARRAY_GET_ELEMENTS(object, uintptr_t);
+        int32_t length = ZEN_ARRAY_LENGTH(object);
+        for (i = 0; i < length; i++) {
+            result |= zen_GarbageCollector_forward(collector, &elements[i]);
+        }
+    }
+    return result;
+}
+
+/* Pushes the old objects which begin within the dirty cards. The cards are
+ * cleaned, and dirtied again if the objects still refer to young objects
+ * after they are scanned.
+ */
+static void zen_GarbageCollector_scanCards(zen_GarbageCollector_t* collector) {
+    zen_SegregatedFitsAllocator_t* allocator = collector->m_allocator;
+    int32_t i;
+    for (i = 0; i < allocator->m_blockCount; i++) {
+        zen_MemoryBlock_t* block = allocator->m_blocks[i];
+        int32_t j;
+        for (j = 0; j < ZEN_MEMORY_BLOCK_CARD_COUNT; j++) {
+            if (block->m_cards[j] == ZEN_MEMORY_BLOCK_CARD_DIRTY) {
+                block->m_cards[j] = ZEN_MEMORY_BLOCK_CARD_CLEAN;
+
+                /* Find the first cell that begins within the card. */
+                intptr_t start = (intptr_t)j * ZEN_MEMORY_BLOCK_CARD_SIZE - ZEN_MEMORY_BLOCK_HEADER_SIZE;
+                int32_t index = (start <= 0)? 0 :
+                    (int32_t)((start + block->m_cellSize - 1) / block->m_cellSize);
+                uint8_t* limit = block->m_cards + ((intptr_t)(j + 1) * ZEN_MEMORY_BLOCK_CARD_SIZE);
+                for (; (index < block->m_cellCount) &&
+                    (block->m_cells + ((intptr_t)index * block->m_cellSize) < limit); index++) {
+                    uint8_t flags = block->m_flags[index];
+                    if ((flags & ZEN_MEMORY_BLOCK_CELL_ALLOCATED) != 0) {
+                        uint8_t* cell = block->m_cells + ((intptr_t)index * block->m_cellSize);
+                        zen_GarbageCollector_push(collector, ZEN_GARBAGE_COLLECTOR_PACK(cell,
+                            ZEN_MEMORY_BLOCK_GET_CELL_TYPE(flags)));
+                    }
+                }
+            }
+        }
+    }
+}
+
+static void zen_GarbageCollector_collectMinor(zen_GarbageCollector_t* collector,
+    zen_Object_t** handles, int32_t handleCount) {
+    zen_NewGeneration_t* generation = collector->m_newGeneration;
+    zen_NewGeneration_prepare(generation);
+    collector->m_pinnedObjectCount = 0;
+
+    /* The young objects referred by the ambiguous roots are pinned before
+     * any object is copied.
+     */
+    zen_GarbageCollector_visitRoots(collector, handles, handleCount,
+        zen_GarbageCollector_pinCandidate, NULL);
+    zen_GarbageCollector_scanCards(collector);
+    zen_GarbageCollector_visitRoots(collector, handles, handleCount,
+        NULL, zen_GarbageCollector_forwardRoot);
+
+    /* The copied objects, the pinned objects and the objects on the dirty
+     * cards are scanned until no grey objects remain.
+     */
+    while (collector->m_markStackSize > 0) {
+        uint8_t* entry = collector->m_markStack[--collector->m_markStackSize];
+        uint8_t* object = ZEN_GARBAGE_COLLECTOR_UNPACK_OBJECT(entry);
+        bool young = zen_GarbageCollector_scan(collector, object,
+            ZEN_GARBAGE_COLLECTOR_UNPACK_TYPE(entry));
+        if (young && !ZEN_NEW_GENERATION_CONTAINS(generation, object)) {
+            ZEN_MEMORY_BLOCK_DIRTY_CARD(object);
+        }
+    }
+
+    zen_NewGeneration_reset(generation);
+}
+
+/* Major Collection */
+
+/* Mark */
+
+static void zen_GarbageCollector_markCandidate(zen_GarbageCollectorWorker_t* worker,
+    uintptr_t candidate) {
+    /* Small integers are not allocated. */
+    if ((candidate != 0) && !ZEN_OBJECT_IS_SMALL_INTEGER(candidate)) {
+        int32_t index;
+        zen_MemoryBlock_t* block = zen_SegregatedFitsAllocator_findCell(
+            worker->m_collector->m_allocator, (const void*)candidate, &index);
+        /* The mark bit is set atomically, therefore, only the worker that
+         * sets the bit traces the object.
+         */
+        if ((block != NULL) &&
+            ((__atomic_load_n(&block->m_flags[index], __ATOMIC_RELAXED) &
+                ZEN_MEMORY_BLOCK_CELL_MARKED) == 0) &&
+            ((__atomic_fetch_or(&block->m_flags[index], ZEN_MEMORY_BLOCK_CELL_MARKED,
+                __ATOMIC_RELAXED) & ZEN_MEMORY_BLOCK_CELL_MARKED) == 0)) {
+            zen_WorkStealingDeque_push(worker->m_deque, (uint8_t*)candidate);
+        }
+    }
+}
+
+/* The roots are marked by the first worker. The other workers steal the
+ * objects from its deque.
+ */
+static void zen_GarbageCollector_markRoot(zen_GarbageCollector_t* collector,
+    uintptr_t candidate) {
+    zen_GarbageCollector_markCandidate(&collector->m_workers[0], candidate);
+}
+
+static void zen_GarbageCollector_markRootSlot(zen_GarbageCollector_t* collector,
+    uintptr_t* slot) {
+    zen_GarbageCollector_markCandidate(&collector->m_workers[0], *slot);
+}
+
+static void zen_GarbageCollector_markFields(zen_GarbageCollectorWorker_t* worker,
+    uint8_t* object, zen_ObjectType_t type) {
+    int32_t i;
+    if (type == ZEN_OBJECT_TYPE_AGGREGATE_OBJECT) {
+        zen_Class_t* class0 = ZEN_OBJECT_GET_CLASS(worker->m_collector->m_classTable, object);
+        uint8_t* body = object + ZEN_OBJECT_HEADER_SIZE;
+        for (i = 0; i < class0->m_referenceOffsetCount; i++) {
+            zen_GarbageCollector_markCandidate(worker,
+                *((uintptr_t*)(body + class0->m_referenceOffsets[i])));
+        }
+    }
+    else if (type == ZEN_OBJECT_TYPE_REFERENCE_ARRAY) {
+        uintptr_t* elements = ZEN_ARRAY_GET_ELEMENTS(object, uintptr_t);
+        int32_t length = ZEN_ARRAY_LENGTH(object);
+        for (i = 0; i < length; i++) {
+            zen_GarbageCollector_markCandidate(worker, elements[i]);
+        }
+    }
+}
+
+static void zen_GarbageCollector_traceObject(zen_GarbageCollectorWorker_t* worker,
+    uint8_t* object) {
+    int32_t index;
+    zen_MemoryBlock_t* block = zen_SegregatedFitsAllocator_findCell(
+        worker->m_collector->m_allocator, object, &index);
+    uint8_t flags = __atomic_load_n(&block->m_flags[index], __ATOMIC_RELAXED);
+    zen_GarbageCollector_markFields(worker, object, ZEN_MEMORY_BLOCK_GET_CELL_TYPE(flags));
+}
+
+/* Steals a grey object from the deque of another worker. The victims are
+ * visited beginning with a random worker, so that the thieves do not crowd
+ * the same deque.
+ */
+static uint8_t* zen_GarbageCollector_steal(zen_GarbageCollectorWorker_t* worker) {
+    zen_GarbageCollector_t* collector = worker->m_collector;
+    uint8_t* result = NULL;
+    if (collector->m_workerCount > 1) {
+        uint32_t random = worker->m_random;
+        random ^= random << 13;
+        random ^= random >> 17;
+        random ^= random << 5;
+        worker->m_random = random;
+
+        int32_t i;
+        for (i = 0; (i < collector->m_workerCount) && (result == NULL); i++) {
+            int32_t victim = (int32_t)((random + i) % collector->m_workerCount);
+            if (victim != worker->m_index) {
+                result = zen_WorkStealingDeque_steal(collector->m_workers[victim].m_deque);
+            }
+        }
+    }
+    return result;
+}
+
+/* Determines whether the marking is complete. The worker is counted as idle
+ * until it finds a deque with entries, in which case it resumes stealing. A
+ * worker pushes entries only on its own deque, and becomes idle only after
+ * its deque is empty. Therefore, the marking is complete when all the
+ * workers are idle.
+ */
+static bool zen_GarbageCollector_offerTermination(zen_GarbageCollectorWorker_t* worker) {
+    zen_GarbageCollector_t* collector = worker->m_collector;
+    __atomic_add_fetch(&collector->m_idleWorkerCount, 1, __ATOMIC_SEQ_CST);
+
+    bool result = false;
+    bool waiting = true;
+    while (waiting) {
+        if (__atomic_load_n(&collector->m_idleWorkerCount, __ATOMIC_SEQ_CST) ==
+            collector->m_workerCount) {
+            result = true;
+            waiting = false;
+        }
+        else {
+            int32_t i;
+            for (i = 0; (i < collector->m_workerCount) && waiting; i++) {
+                if (!zen_WorkStealingDeque_isEmpty(collector->m_workers[i].m_deque)) {
+                    __atomic_sub_fetch(&collector->m_idleWorkerCount, 1, __ATOMIC_SEQ_CST);
+                    waiting = false;
+                }
+            }
+
+            if (waiting) {
+                sched_yield();
+            }
+        }
+    }
+    return result;
+}
+
+static void zen_GarbageCollector_mark(zen_GarbageCollectorWorker_t* worker) {
+    bool marking = true;
+    while (marking) {
+        uint8_t* object = zen_WorkStealingDeque_take(worker->m_deque);
+        if (object == NULL) {
+            object = zen_GarbageCollector_steal(worker);
+        }
+
+        if (object != NULL) {
+            zen_GarbageCollector_traceObject(worker, object);
+        }
+        else {
+            marking = !zen_GarbageCollector_offerTermination(worker);
+        }
+    }
+}
+
+/* Sweeps the memory blocks in chunks, until no chunk remains. */
+static void zen_GarbageCollector_sweep(zen_GarbageCollectorWorker_t* worker) {
+    zen_GarbageCollector_t* collector = worker->m_collector;
+    zen_SegregatedFitsAllocator_t* allocator = collector->m_allocator;
+    int32_t blockCount = allocator->m_blockCount;
+    int32_t first = __atomic_fetch_add(&collector->m_sweepCursor,
+        ZEN_GARBAGE_COLLECTOR_SWEEP_CHUNK_SIZE, __ATOMIC_RELAXED);
+    while (first < blockCount) {
+        int32_t last = first + ZEN_GARBAGE_COLLECTOR_SWEEP_CHUNK_SIZE;
+        if (last > blockCount) {
+            last = blockCount;
+        }
+
+        int32_t i;
+        for (i = first; i < last; i++) {
+            /* Objects do not own native memory, therefore, they are not
+             * finalized.
+             */
+            worker->m_freedSize += zen_SegregatedFitsAllocator_sweepBlock(allocator, i,
+                NULL, NULL);
+        }
+
+        first = __atomic_fetch_add(&collector->m_sweepCursor,
+            ZEN_GARBAGE_COLLECTOR_SWEEP_CHUNK_SIZE, __ATOMIC_RELAXED);
+    }
+}
+
+/* Workers */
+
+static void zen_GarbageCollectorWorker_perform(zen_GarbageCollectorWorker_t* worker,
+    int32_t phase) {
+    if (phase == ZEN_GARBAGE_COLLECTOR_PHASE_MARK) {
+        zen_GarbageCollector_mark(worker);
+    }
+    else if (phase == ZEN_GARBAGE_COLLECTOR_PHASE_SWEEP) {
+        zen_GarbageCollector_sweep(worker);
+    }
+}
+
+static void* zen_GarbageCollectorWorker_run(void* argument) {
+    zen_GarbageCollectorWorker_t* worker = (zen_GarbageCollectorWorker_t*)argument;
+    zen_GarbageCollector_t* collector = worker->m_collector;
+
+    int32_t epoch = 0;
+    bool running = true;
+    while (running) {
+        pthread_mutex_lock(&collector->m_mutex);
+        while (collector->m_epoch == epoch) {
+            pthread_cond_wait(&collector->m_phaseCondition, &collector->m_mutex);
+        }
+        epoch = collector->m_epoch;
+        int32_t phase = collector->m_phase;
+        pthread_mutex_unlock(&collector->m_mutex);
+
+        running = (phase != ZEN_GARBAGE_COLLECTOR_PHASE_EXIT);
+        zen_GarbageCollectorWorker_perform(worker, phase);
+
+        pthread_mutex_lock(&collector->m_mutex);
+        collector->m_pendingWorkerCount--;
+        if (collector->m_pendingWorkerCount == 0) {
+            pthread_cond_signal(&collector->m_completionCondition);
+        }
+        pthread_mutex_unlock(&collector->m_mutex);
+    }
+
+    return NULL;
+}
+
+/* Performs the specified phase with all the workers. The calling thread acts
+ * as the first worker, and returns once every worker has completed the
+ * phase.
+ */
+static void zen_GarbageCollector_runPhase(zen_GarbageCollector_t* collector,
+    int32_t phase) {
+    collector->m_idleWorkerCount = 0;
+    collector->m_sweepCursor = 0;
+
+    pthread_mutex_lock(&collector->m_mutex);
+    collector->m_phase = phase;
+    collector->m_pendingWorkerCount = collector->m_workerCount - 1;
+    collector->m_epoch++;
+    pthread_cond_broadcast(&collector->m_phaseCondition);
+    pthread_mutex_unlock(&collector->m_mutex);
+
+    zen_GarbageCollectorWorker_perform(&collector->m_workers[0], phase);
+
+    pthread_mutex_lock(&collector->m_mutex);
+    while (collector->m_pendingWorkerCount > 0) {
+        pthread_cond_wait(&collector->m_completionCondition, &collector->m_mutex);
+    }
+    pthread_mutex_unlock(&collector->m_mutex);
+}
+
+/* Marks the roots and the objects pinned by the last minor collection. The
+ * objects are pushed on the deque of the first worker.
+ */
+static void zen_GarbageCollector_markRoots(zen_GarbageCollector_t* collector,
+    zen_Object_t** handles, int32_t handleCount) {
+    zen_GarbageCollector_visitRoots(collector, handles, handleCount,
+        zen_GarbageCollector_markRoot, zen_GarbageCollector_markRootSlot);
+    zen_NewGeneration_t* generation = collector->m_newGeneration;
+    int32_t i;
+    for (i = 0; i < collector->m_pinnedObjectCount; i++) {
+        uint8_t* object = collector->m_pinnedObjects[i];
+        zen_GarbageCollector_markFields(&collector->m_workers[0], object,
+            ZEN_MEMORY_BLOCK_GET_CELL_TYPE(ZEN_NEW_GENERATION_GET_OBJECT_FLAGS(generation, object)));
+    }
+}
+
+/* Traces the remaining grey objects with all the workers and sweeps the old
+ * generation.
+ */
+static uint64_t zen_GarbageCollector_finishMajor(zen_GarbageCollector_t* collector) {
+    zen_GarbageCollector_runPhase(collector, ZEN_GARBAGE_COLLECTOR_PHASE_MARK);
+    collector->m_marking = false;
+
+    int32_t i;
+    for (i = 0; i < collector->m_workerCount; i++) {
+        zen_GarbageCollectorWorker_t* worker = &collector->m_workers[i];
+        zen_WorkStealingDeque_reset(worker->m_deque);
+        worker->m_freedSize = 0;
+    }
+    zen_GarbageCollector_runPhase(collector, ZEN_GARBAGE_COLLECTOR_PHASE_SWEEP);
+
+    uint64_t result = 0;
+    for (i = 0; i < collector->m_workerCount; i++) {
+        result += collector->m_workers[i].m_freedSize;
+    }
+    zen_SegregatedFitsAllocator_finishSweep(collector->m_allocator, result);
+
+    return result;
+}
+
+static uint64_t zen_GarbageCollector_collectMajor(zen_GarbageCollector_t* collector,
+    zen_Object_t** handles, int32_t handleCount) {
+    /* Evacuate the new generation first. Only the pinned objects remain
+     * there, which are treated as roots.
+     */
+    zen_GarbageCollector_collectMinor(collector, handles, handleCount);
+
+    /* An incremental marking in progress is completed at once. Its roots
+     * were marked when it began.
+     */
+    if (!collector->m_marking) {
+        zen_GarbageCollector_markRoots(collector, handles, handleCount);
+    }
+
+    return zen_GarbageCollector_finishMajor(collector);
+}
+
+/* The pauses are measured with a monotonic clock, in microseconds. Unlike
+ * clock(), it does not count the time spent by the workers.
+ */
+static int64_t zen_GarbageCollector_getTime() {
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return (int64_t)time.tv_sec * 1000000 + time.tv_nsec / 1000;
+}
+
+/* Collect */
+
+uint64_t zen_GarbageCollector_collect(zen_GarbageCollector_t* collector,
+    zen_GarbageCollectionType_t type, zen_Object_t** handles, int32_t handleCount) {
+    jtk_Assert_assertObject(collector, "The specified garbage collector is null.");
+
+    clock_t start = clock();
+    int64_t pauseStart = zen_GarbageCollector_getTime();
+
+    uint64_t result = 0;
+    if (type == ZEN_GARBAGE_COLLECTION_TYPE_MINOR) {
+        uint64_t allocatedSize = collector->m_newGeneration->m_allocatedSize;
+        uint64_t promotedSize = collector->m_promotedSize;
+
+        zen_GarbageCollector_collectMinor(collector, handles, handleCount);
+
+        /* The collection time is measured in microseconds. */
+        collector->m_lastCollectionTime = (int64_t)(clock() - start) * 1000000 / CLOCKS_PER_SEC;
+        collector->m_totalMinorCollectionTime += collector->m_lastCollectionTime;
+        collector->m_minorCollectionCount++;
+
+        jtk_Logger_debug(collector->m_virtualMachine->m_logger, "Collected the new generation in %lld microseconds (allocated = %llu, promoted = %llu, pinned = %d)",
+            (long long)collector->m_lastCollectionTime, (unsigned long long)allocatedSize,
+            (unsigned long long)(collector->m_promotedSize - promotedSize),
+            collector->m_pinnedObjectCount);
+    }
+    else {
+        result = zen_GarbageCollector_collectMajor(collector, handles, handleCount);
+
+        collector->m_lastCollectionTime = (int64_t)(clock() - start) * 1000000 / CLOCKS_PER_SEC;
+        collector->m_totalCollectionTime += collector->m_lastCollectionTime;
+        collector->m_collectionCount++;
+        collector->m_freedSize += result;
+
+        jtk_Logger_debug(collector->m_virtualMachine->m_logger, "Collected %llu bytes in %lld microseconds (used = %llu, reserved = %llu)",
+            (unsigned long long)result, (long long)collector->m_lastCollectionTime,
+            (unsigned long long)collector->m_allocator->m_usedSize,
+            (unsigned long long)collector->m_allocator->m_reservedSize);
+    }
+    zen_GarbageCollectionProfile_recordPause(collector->m_profile, type,
+        (uint64_t)(zen_GarbageCollector_getTime() - pauseStart));
+
+    return result;
+}
+
+/* Incremental Collection */
+
+void zen_GarbageCollector_startMarking(zen_GarbageCollector_t* collector,
+    zen_Object_t** handles, int32_t handleCount) {
+    jtk_Assert_assertObject(collector, "The specified garbage collector is null.");
+    jtk_Assert_assertTrue(!collector->m_marking, "An incremental marking is in progress.");
+
+    int64_t start = zen_GarbageCollector_getTime();
+
+    zen_GarbageCollector_collectMinor(collector, handles, handleCount);
+    zen_GarbageCollector_markRoots(collector, handles, handleCount);
+    collector->m_marking = true;
+
+    int64_t duration = zen_GarbageCollector_getTime() - start;
+    collector->m_totalCollectionTime += duration;
+    zen_GarbageCollectionProfile_recordPause(collector->m_profile,
+        ZEN_GARBAGE_COLLECTION_TYPE_MAJOR, (uint64_t)duration);
+
+    jtk_Logger_debug(collector->m_virtualMachine->m_logger, "Started an incremental marking in %lld microseconds",
+        (long long)duration);
+}
+
+bool zen_GarbageCollector_markIncrementally(zen_GarbageCollector_t* collector,
+    int64_t budget) {
+    jtk_Assert_assertObject(collector, "The specified garbage collector is null.");
+
+    int64_t start = zen_GarbageCollector_getTime();
+
+    /* The slices are performed by the thread that runs the program, which
+     * owns the deque of the first worker.
+     */
+    zen_GarbageCollectorWorker_t* worker = &collector->m_workers[0];
+    bool exhausted = false;
+    bool expired = false;
+    int32_t count = 0;
+    while (!exhausted && !expired) {
+        uint8_t* object = zen_WorkStealingDeque_take(worker->m_deque);
+        if (object == NULL) {
+            exhausted = true;
+        }
+        else {
+            zen_GarbageCollector_traceObject(worker, object);
+            count++;
+            if ((count % ZEN_GARBAGE_COLLECTOR_SLICE_CHECK_INTERVAL) == 0) {
+                expired = (zen_GarbageCollector_getTime() - start) >= budget;
+            }
+        }
+    }
+
+    bool result = false;
+    if (exhausted) {
+        uint64_t freedSize = zen_GarbageCollector_finishMajor(collector);
+        collector->m_collectionCount++;
+        collector->m_freedSize += freedSize;
+        result = true;
+
+        jtk_Logger_debug(collector->m_virtualMachine->m_logger, "Completed an incremental collection, collected %llu bytes (used = %llu, reserved = %llu)",
+            (unsigned long long)freedSize, (unsigned long long)collector->m_allocator->m_usedSize,
+            (unsigned long long)collector->m_allocator->m_reservedSize);
+    }
+
+    int64_t duration = zen_GarbageCollector_getTime() - start;
+    collector->m_lastCollectionTime = duration;
+    collector->m_totalCollectionTime += duration;
+    zen_GarbageCollectionProfile_recordPause(collector->m_profile,
+        ZEN_GARBAGE_COLLECTION_TYPE_MAJOR, (uint64_t)duration);
+
+    return result;
+}
+
+void zen_GarbageCollector_shade(zen_GarbageCollector_t* collector, uintptr_t value) {
+    jtk_Assert_assertObject(collector, "The specified garbage collector is null.");
+
+    /* Young objects are not marked. */
+    if (!ZEN_NEW_GENERATION_CONTAINS(collector->m_newGeneration, value)) {
+        zen_GarbageCollector_markCandidate(&collector->m_workers[0], value);
+    }
+}
+
+void zen_GarbageCollector_markAllocated(zen_GarbageCollector_t* collector,
+    const void* object) {
+    jtk_Assert_assertObject(collector, "The specified garbage collector is null.");
+
+    int32_t index;
+    zen_MemoryBlock_t* block = zen_SegregatedFitsAllocator_findCell(collector->m_allocator,
+        object, &index);
+    if (block != NULL) {
+        block->m_flags[index] |= ZEN_MEMORY_BLOCK_CELL_MARKED;
+    }
+}
@@ -0,0 +1,179 @@
+/*
+ * Copyright 2018-2020 Samuel Rowe
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Saturday, November 07, 2020
+
+#include <jtk/core/Assert.h>
+
+#include <com/onecube/zen/virtual-machine/memory/collector/WorkStealingDeque.h>
+
+/*******************************************************************************
+ * WorkStealingDequeArray                                                      *
+ *******************************************************************************/
+
+/* Constructor */
+
+static zen_WorkStealingDequeArray_t* zen_WorkStealingDequeArray_new(int64_t capacity,
+    zen_WorkStealingDequeArray_t* previous) {
+    zen_WorkStealingDequeArray_t* array = jtk_Memory_allocate(zen_WorkStealingDequeArray_t, 1);
+    array->m_values = jtk_Memory_allocate(uint8_t*, capacity);
+    array->m_capacity = capacity;
+    array->m_previous = previous;
+
+    return array;
+}
+
+/* Destructor */
+
+static void zen_WorkStealingDequeArray_delete(zen_WorkStealingDequeArray_t* array) {
+    jtk_Memory_deallocate(array->m_values);
+    jtk_Memory_deallocate(array);
+}
+
+/*******************************************************************************
+ * WorkStealingDeque                                                           *
+ *******************************************************************************/
+
+/* The capacity of an array is a power of two, therefore, the indexes are
+ * wrapped around by masking.
+ */
+#define ZEN_WORK_STEALING_DEQUE_GET_VALUE(array, index) \
+    __atomic_load_n(&(array)->m_values[(index) & ((array)->m_capacity - 1)], __ATOMIC_RELAXED)
+
+#define ZEN_WORK_STEALING_DEQUE_SET_VALUE(array, index, value) \
+    __atomic_store_n(&(array)->m_values[(index) & ((array)->m_capacity - 1)], value, __ATOMIC_RELAXED)
+
+/* Constructor */
+
+zen_WorkStealingDeque_t* zen_WorkStealingDeque_new() {
+    zen_WorkStealingDeque_t* deque = jtk_Memory_allocate(zen_WorkStealingDeque_t, 1);
+    deque->m_top = 0;
+    deque->m_bottom = 0;
+    deque->m_array = zen_WorkStealingDequeArray_new(ZEN_WORK_STEALING_DEQUE_DEFAULT_CAPACITY, NULL);
+
+    return deque;
+}
+
+/* Destructor */
+
+void zen_WorkStealingDeque_delete(zen_WorkStealingDeque_t* deque) {
+    jtk_Assert_assertObject(deque, "The specified deque is null.");
+
+    zen_WorkStealingDeque_reset(deque);
+    zen_WorkStealingDequeArray_delete(deque->m_array);
+    jtk_Memory_deallocate(deque);
+}
+
+/* Empty */
+
+bool zen_WorkStealingDeque_isEmpty(zen_WorkStealingDeque_t* deque) {
+    jtk_Assert_assertObject(deque, "The specified deque is null.");
+
+    int64_t top = __atomic_load_n(&deque->m_top, __ATOMIC_ACQUIRE);
+    int64_t bottom = __atomic_load_n(&deque->m_bottom, __ATOMIC_ACQUIRE);
+    return top >= bottom;
+}
+
+/* Push */
+
+void zen_WorkStealingDeque_push(zen_WorkStealingDeque_t* deque, uint8_t* value) {
+    jtk_Assert_assertObject(deque, "The specified deque is null.");
+
+    int64_t bottom = __atomic_load_n(&deque->m_bottom, __ATOMIC_RELAXED);
+    int64_t top = __atomic_load_n(&deque->m_top, __ATOMIC_ACQUIRE);
+    zen_WorkStealingDequeArray_t* array = __atomic_load_n(&deque->m_array, __ATOMIC_RELAXED);
+    if (bottom - top > array->m_capacity - 1) {
+        /* The entries between the top and the bottom are copied to an array
+         * twice as large. The thieves may continue to read the old array.
+         */
+        zen_WorkStealingDequeArray_t* array0 =
+            zen_WorkStealingDequeArray_new(array->m_capacity * 2, array);
+        int64_t i;
+        for (i = top; i < bottom; i++) {
+            ZEN_WORK_STEALING_DEQUE_SET_VALUE(array0, i,
+                ZEN_WORK_STEALING_DEQUE_GET_VALUE(array, i));
+        }
+        __atomic_store_n(&deque->m_array, array0, __ATOMIC_RELEASE);
+        array = array0;
+    }
+    ZEN_WORK_STEALING_DEQUE_SET_VALUE(array, bottom, value);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    __atomic_store_n(&deque->m_bottom, bottom + 1, __ATOMIC_RELAXED);
+}
+
+/* Take */
+
+uint8_t* zen_WorkStealingDeque_take(zen_WorkStealingDeque_t* deque) {
+    jtk_Assert_assertObject(deque, "The specified deque is null.");
+
+    int64_t bottom = __atomic_load_n(&deque->m_bottom, __ATOMIC_RELAXED) - 1;
+    zen_WorkStealingDequeArray_t* array = __atomic_load_n(&deque->m_array, __ATOMIC_RELAXED);
+    __atomic_store_n(&deque->m_bottom, bottom, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    int64_t top = __atomic_load_n(&deque->m_top, __ATOMIC_RELAXED);
+
+    uint8_t* result = NULL;
+    if (top <= bottom) {
+        result = ZEN_WORK_STEALING_DEQUE_GET_VALUE(array, bottom);
+        if (top == bottom) {
+            /* The last entry may be stolen at the same time. */
+            if (!__atomic_compare_exchange_n(&deque->m_top, &top, top + 1, false,
+                __ATOMIC_SEQ_CST, __ATOMIC_RELAXED)) {
+                result = NULL;
+            }
+            __atomic_store_n(&deque->m_bottom, bottom + 1, __ATOMIC_RELAXED);
+        }
+    }
+    else {
+        __atomic_store_n(&deque->m_bottom, bottom + 1, __ATOMIC_RELAXED);
+    }
+    return result;
+}
+
+/* Steal */
+
+uint8_t* zen_WorkStealingDeque_steal(zen_WorkStealingDeque_t* deque) {
+    jtk_Assert_assertObject(deque, "The specified deque is null.");
+
+    int64_t top = __atomic_load_n(&deque->m_top, __ATOMIC_ACQUIRE);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    int64_t bottom = __atomic_load_n(&deque->m_bottom, __ATOMIC_ACQUIRE);
+
+    uint8_t* result = NULL;
+    if (top < bottom) {
+        zen_WorkStealingDequeArray_t* array = __atomic_load_n(&deque->m_array, __ATOMIC_ACQUIRE);
+        uint8_t* value = ZEN_WORK_STEALING_DEQUE_GET_VALUE(array, top);
+        if (__atomic_compare_exchange_n(&deque->m_top, &top, top + 1, false,
+            __ATOMIC_SEQ_CST, __ATOMIC_RELAXED)) {
+            result = value;
+        }
+    }
+    return result;
+}
+
+/* Reset */
+
+void zen_WorkStealingDeque_reset(zen_WorkStealingDeque_t* deque) {
+    jtk_Assert_assertObject(deque, "The specified deque is null.");
+
+    zen_WorkStealingDequeArray_t* array = deque->m_array->m_previous;
+    while (array != NULL) {
+        zen_WorkStealingDequeArray_t* previous = array->m_previous;
+        zen_WorkStealingDequeArray_delete(array);
+        array = previous;
+    }
+    deque->m_array->m_previous = NULL;
+}
@@ -0,0 +1,209 @@
+/*
+ * Copyright 2018-2020 Samuel Rowe
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Sunday, November 08, 2020
+
+#include <sys/mman.h>
+
+#include <jtk/core/Assert.h>
+
+#include <com/onecube/zen/virtual-machine/memory/heap/Heap.h>
+
+/*******************************************************************************
+ * Heap                                                                        *
+ *******************************************************************************/
+
+/* Constructor */
+
+zen_Heap_t* zen_Heap_new(uint64_t size, bool hugePages) {
+    zen_Heap_t* heap = NULL;
+
+    uintptr_t size0 = ((uintptr_t)size + (ZEN_REGION_SIZE - 1)) & ~((uintptr_t)ZEN_REGION_SIZE - 1);
+    if (size0 == 0) {
+        size0 = ZEN_REGION_SIZE;
+    }
+
+    /* The system aligns the range to a page only. Therefore, an additional
+     * region is reserved, and the excess on either side of the aligned range
+     * is unmapped.
+     */
+    uintptr_t reservedSize = size0 + ZEN_REGION_SIZE;
+    void* memory = mmap(NULL, reservedSize, PROT_NONE,
+        MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if (memory != MAP_FAILED) {
+        uint8_t* reserved = (uint8_t*)memory;
+        uint8_t* start = (uint8_t*)(((uintptr_t)reserved + (ZEN_REGION_SIZE - 1)) &
+            ~((uintptr_t)ZEN_REGION_SIZE - 1));
+        if (start > reserved) {
+            munmap(reserved, start - reserved);
+        }
+        uint8_t* end = start + size0;
+        if (end < reserved + reservedSize) {
+            munmap(end, (reserved + reservedSize) - end);
+        }
+
+#ifdef MADV_HUGEPAGE
+        if (hugePages) {
+            /* The advice is merely a hint, which the system may ignore. */
+            madvise(start, size0, MADV_HUGEPAGE);
+        }
+#endif
+
+        int32_t regionCount = (int32_t)(size0 >> ZEN_REGION_SHIFT);
+        heap = jtk_Memory_allocate(zen_Heap_t, 1);
+        heap->m_start = start;
+        heap->m_size = size0;
+        heap->m_regions = jtk_Memory_allocate(zen_Region_t, regionCount);
+        heap->m_regionCount = regionCount;
+        heap->m_usedRegionCount = 0;
+        heap->m_committedRegionCount = 0;
+        heap->m_freeRegionHint = 0;
+
+        int32_t i;
+        for (i = 0; i < regionCount; i++) {
+            zen_Region_t* region = &heap->m_regions[i];
+            region->m_start = start + ((uintptr_t)i << ZEN_REGION_SHIFT);
+            region->m_flags = 0;
+            region->m_length = 0;
+            region->m_block = NULL;
+            region->m_liveSize = 0;
+            region->m_age = 0;
+        }
+    }
+
+    return heap;
+}
+
+/* Destructor */
+
+void zen_Heap_delete(zen_Heap_t* heap) {
+    jtk_Assert_assertObject(heap, "The specified heap is null.");
+
+    munmap(heap->m_start, heap->m_size);
+    jtk_Memory_deallocate(heap->m_regions);
+    jtk_Memory_deallocate(heap);
+}
+
+/* Allocate */
+
+zen_Region_t* zen_Heap_allocateRegions(zen_Heap_t* heap, int32_t count) {
+    jtk_Assert_assertObject(heap, "The specified heap is null.");
+
+    /* Find the lowest run of free regions that is long enough. */
+    int32_t first = heap->m_freeRegionHint;
+    int32_t length = 0;
+    while ((length < count) && ((first + length) < heap->m_regionCount)) {
+        if ((heap->m_regions[first + length].m_flags & ZEN_REGION_USED) != 0) {
+            first = first + length + 1;
+            length = 0;
+        }
+        else {
+            length++;
+        }
+    }
+
+    zen_Region_t* result = NULL;
+    if (length == count) {
+        int32_t i;
+        for (i = first; i < first + count; i++) {
+            zen_Region_t* region = &heap->m_regions[i];
+            if ((region->m_flags & ZEN_REGION_COMMITTED) == 0) {
+                /* The system backs the region with cleared pages as they are
+                 * touched.
+                 */
+                if (mprotect(region->m_start, ZEN_REGION_SIZE, PROT_READ | PROT_WRITE) != 0) {
+                    break;
+                }
+                region->m_flags |= ZEN_REGION_COMMITTED;
+                heap->m_committedRegionCount++;
+            }
+            region->m_flags |= ZEN_REGION_USED;
+            region->m_length = 0;
+            region->m_block = NULL;
+            region->m_liveSize = 0;
+            region->m_age = 0;
+        }
+
+        if (i == first + count) {
+            result = &heap->m_regions[first];
+            result->m_length = count;
+            heap->m_usedRegionCount += count;
+            if (first == heap->m_freeRegionHint) {
+                heap->m_freeRegionHint = first + count;
+            }
+        }
+        else {
+            /* The system refused to commit the memory. The regions that were
+             * committed remain so, but are released.
+             */
+            int32_t j;
+            for (j = first; j < i; j++) {
+                heap->m_regions[j].m_flags &= ~ZEN_REGION_USED;
+            }
+        }
+    }
+
+    return result;
+}
+
+void zen_Heap_releaseRegions(zen_Heap_t* heap, zen_Region_t* region) {
+    jtk_Assert_assertObject(heap, "The specified heap is null.");
+    jtk_Assert_assertObject(region, "The specified region is null.");
+
+    int32_t first = (int32_t)(region - heap->m_regions);
+    int32_t count = region->m_length;
+    int32_t i;
+    for (i = first; i < first + count; i++) {
+        zen_Region_t* region0 = &heap->m_regions[i];
+        region0->m_flags &= ~ZEN_REGION_USED;
+        region0->m_length = 0;
+        region0->m_block = NULL;
+        region0->m_liveSize = 0;
+        region0->m_age = 0;
+    }
+    heap->m_usedRegionCount -= count;
+
+    if (first < heap->m_freeRegionHint) {
+        heap->m_freeRegionHint = first;
+    }
+}
+
+/* Trim */
+
+void zen_Heap_trim(zen_Heap_t* heap, int32_t retainedCount) {
+    jtk_Assert_assertObject(heap, "The specified heap is null.");
+
+    /* The regions that are handed out are always committed. */
+    int32_t surplus = (heap->m_committedRegionCount - heap->m_usedRegionCount) - retainedCount;
+
+    /* The free regions with the highest addresses are decommitted first,
+     * because the regions are handed out beginning with the lowest address.
+     */
+    int32_t i;
+    for (i = heap->m_regionCount - 1; (i >= 0) && (surplus > 0); i--) {
+        zen_Region_t* region = &heap->m_regions[i];
+        if ((region->m_flags & (ZEN_REGION_COMMITTED | ZEN_REGION_USED)) == ZEN_REGION_COMMITTED) {
+            /* The pages of a private anonymous mapping are discarded, and
+             * read as zeroes if they are touched again.
+             */
+            madvise(region->m_start, ZEN_REGION_SIZE, MADV_DONTNEED);
+            mprotect(region->m_start, ZEN_REGION_SIZE, PROT_NONE);
+            region->m_flags &= ~ZEN_REGION_COMMITTED;
+            heap->m_committedRegionCount--;
+            surplus--;
+        }
+    }
+}
@@ -0,0 +1,292 @@
+/*
+ * Copyright 2018-2020 Samuel Rowe
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Saturday, October 31, 2020
+
+#include <string.h>
+
+#include <jtk/core/Assert.h>
+
+#include <com/onecube/zen/virtual-machine/memory/heap/NewGeneration.h>
+
+/*******************************************************************************
+ * NewGeneration                                                               *
+ *******************************************************************************/
+
+/* Constructor */
+
+zen_NewGeneration_t* zen_NewGeneration_new(zen_Heap_t* heap, uint64_t size) {
+    jtk_Assert_assertObject(heap, "The specified heap is null.");
+
+    int32_t pageCount = (int32_t)(size >> ZEN_NEW_GENERATION_PAGE_SHIFT);
+    if (pageCount < 1) {
+        pageCount = 1;
+    }
+    uintptr_t size0 = (uintptr_t)pageCount << ZEN_NEW_GENERATION_PAGE_SHIFT;
+
+    int32_t regionCount = (int32_t)((size0 + (ZEN_REGION_SIZE - 1)) >> ZEN_REGION_SHIFT);
+    zen_Region_t* region = zen_Heap_allocateRegions(heap, regionCount);
+    zen_NewGeneration_t* generation = NULL;
+    if (region != NULL) {
+        generation = jtk_Memory_allocate(zen_NewGeneration_t, 1);
+        generation->m_heap = heap;
+        generation->m_region = region;
+        generation->m_start = region->m_start;
+        generation->m_size = size0;
+        /* The allocator is assigned a run of free pages when the first object
+         * is allocated.
+         */
+        generation->m_allocator = zen_SequentialAllocator_new(generation->m_start,
+            generation->m_start);
+        generation->m_objectMap = jtk_Memory_allocate(uint8_t,
+            size0 >> ZEN_NEW_GENERATION_GRANULE_SHIFT);
+        generation->m_pageFlags = jtk_Memory_allocate(uint8_t, pageCount);
+        generation->m_pageCount = pageCount;
+        generation->m_allocatedSize = 0;
+        generation->m_mutex = jtk_Mutex_new();
+        generation->m_allocationBuffers = jtk_Memory_allocate(zen_AllocationBuffer_t*,
+            ZEN_NEW_GENERATION_DEFAULT_ALLOCATION_BUFFER_CAPACITY);
+        generation->m_allocationBufferCount = 0;
+        generation->m_allocationBufferCapacity = ZEN_NEW_GENERATION_DEFAULT_ALLOCATION_BUFFER_CAPACITY;
+    }
+
+    return generation;
+}
+
+/* Destructor */
+
+void zen_NewGeneration_delete(zen_NewGeneration_t* generation) {
+    jtk_Assert_assertObject(generation, "The specified generation is null.");
+
+    jtk_Memory_deallocate(generation->m_allocationBuffers);
+    jtk_Mutex_delete(generation->m_mutex);
+    zen_SequentialAllocator_delete(generation->m_allocator);
+    jtk_Memory_deallocate(generation->m_pageFlags);
+    jtk_Memory_deallocate(generation->m_objectMap);
+    zen_Heap_releaseRegions(generation->m_heap, generation->m_region);
+    jtk_Memory_deallocate(generation);
+}
+
+/* Allocate */
+
+/* Assigns the next run of pages that are not pinned to the sequential
+ * allocator. Returns false if no such pages remain before the end of the new
+ * generation.
+ */
+static bool zen_NewGeneration_advance(zen_NewGeneration_t* generation) {
+    zen_SequentialAllocator_t* allocator = generation->m_allocator;
+    int32_t first = (int32_t)((allocator->m_limit - generation->m_start) >>
+        ZEN_NEW_GENERATION_PAGE_SHIFT);
+    while ((first < generation->m_pageCount) &&
+        ((generation->m_pageFlags[first] & ZEN_NEW_GENERATION_PAGE_PINNED) != 0)) {
+        first++;
+    }
+
+    int32_t last = first;
+    while ((last < generation->m_pageCount) &&
+        ((generation->m_pageFlags[last] & ZEN_NEW_GENERATION_PAGE_PINNED) == 0)) {
+        generation->m_pageFlags[last] |= ZEN_NEW_GENERATION_PAGE_USED;
+        last++;
+    }
+
+    bool result = (first < last);
+    if (result) {
+        zen_SequentialAllocator_reset(allocator,
+            generation->m_start + ((uintptr_t)first << ZEN_NEW_GENERATION_PAGE_SHIFT),
+            generation->m_start + ((uintptr_t)last << ZEN_NEW_GENERATION_PAGE_SHIFT));
+    }
+    return result;
+}
+
+uint8_t* zen_NewGeneration_allocate(zen_NewGeneration_t* generation, int32_t size) {
+    jtk_Assert_assertObject(generation, "The specified generation is null.");
+
+    int32_t size0 = (size + (ZEN_NEW_GENERATION_GRANULE_SIZE - 1)) &
+        ~(ZEN_NEW_GENERATION_GRANULE_SIZE - 1);
+    jtk_Mutex_lock(generation->m_mutex);
+    uint8_t* result = zen_SequentialAllocator_allocate(generation->m_allocator, size0);
+    while ((result == NULL) && zen_NewGeneration_advance(generation)) {
+        result = zen_SequentialAllocator_allocate(generation->m_allocator, size0);
+    }
+    if (result != NULL) {
+        generation->m_allocatedSize += size0;
+    }
+    jtk_Mutex_unlock(generation->m_mutex);
+
+    if (result != NULL) {
+        /* The pages are reused after a collection, therefore, they may hold
+         * stale objects.
+         */
+        memset(result, 0, size0);
+        ZEN_NEW_GENERATION_GET_OBJECT_FLAGS(generation, result) =
+            ZEN_NEW_GENERATION_OBJECT_START |
+            (ZEN_OBJECT_TYPE_AGGREGATE_OBJECT << ZEN_MEMORY_BLOCK_CELL_TYPE_SHIFT);
+    }
+    return result;
+}
+
+/* Allocation Buffer */
+
+void zen_NewGeneration_addAllocationBuffer(zen_NewGeneration_t* generation,
+    zen_AllocationBuffer_t* buffer) {
+    jtk_Assert_assertObject(generation, "The specified generation is null.");
+    jtk_Assert_assertObject(buffer, "The specified allocation buffer is null.");
+
+    jtk_Mutex_lock(generation->m_mutex);
+    if (generation->m_allocationBufferCount == generation->m_allocationBufferCapacity) {
+        int32_t capacity = generation->m_allocationBufferCapacity * 2;
+        zen_AllocationBuffer_t** buffers = jtk_Memory_allocate(zen_AllocationBuffer_t*, capacity);
+        int32_t i;
+        for (i = 0; i < generation->m_allocationBufferCount; i++) {
+            buffers[i] = generation->m_allocationBuffers[i];
+        }
+        jtk_Memory_deallocate(generation->m_allocationBuffers);
+        generation->m_allocationBuffers = buffers;
+        generation->m_allocationBufferCapacity = capacity;
+    }
+    buffer->m_free = NULL;
+    buffer->m_limit = NULL;
+    generation->m_allocationBuffers[generation->m_allocationBufferCount++] = buffer;
+    jtk_Mutex_unlock(generation->m_mutex);
+}
+
+void zen_NewGeneration_removeAllocationBuffer(zen_NewGeneration_t* generation,
+    zen_AllocationBuffer_t* buffer) {
+    jtk_Assert_assertObject(generation, "The specified generation is null.");
+    jtk_Assert_assertObject(buffer, "The specified allocation buffer is null.");
+
+    jtk_Mutex_lock(generation->m_mutex);
+    zen_SequentialAllocator_mergeAllocationBuffer(generation->m_allocator, buffer);
+    int32_t i;
+    for (i = 0; i < generation->m_allocationBufferCount; i++) {
+        if (generation->m_allocationBuffers[i] == buffer) {
+            generation->m_allocationBuffers[i] =
+                generation->m_allocationBuffers[--generation->m_allocationBufferCount];
+            break;
+        }
+    }
+    jtk_Mutex_unlock(generation->m_mutex);
+}
+
+bool zen_NewGeneration_refillAllocationBuffer(zen_NewGeneration_t* generation,
+    zen_AllocationBuffer_t* buffer, int32_t size) {
+    jtk_Assert_assertObject(generation, "The specified generation is null.");
+    jtk_Assert_assertObject(buffer, "The specified allocation buffer is null.");
+
+    int32_t size0 = (size + (ZEN_NEW_GENERATION_GRANULE_SIZE - 1)) &
+        ~(ZEN_NEW_GENERATION_GRANULE_SIZE - 1);
+    zen_SequentialAllocator_t* allocator = generation->m_allocator;
+    jtk_Mutex_lock(generation->m_mutex);
+    bool result = zen_SequentialAllocator_makeAllocationBuffer(allocator, buffer, size0);
+    while (!result && zen_NewGeneration_advance(generation)) {
+        result = zen_SequentialAllocator_makeAllocationBuffer(allocator, buffer, size0);
+    }
+    if (result) {
+        generation->m_allocatedSize += buffer->m_limit - buffer->m_free;
+    }
+    jtk_Mutex_unlock(generation->m_mutex);
+
+    /* The buffer belongs to the current thread, therefore, it is cleared
+     * outside the lock.
+     */
+    if (result) {
+        memset(buffer->m_free, 0, buffer->m_limit - buffer->m_free);
+    }
+    return result;
+}
+
+/* Object Type */
+
+void zen_NewGeneration_setType(zen_NewGeneration_t* generation, const void* object,
+    zen_ObjectType_t type) {
+    jtk_Assert_assertObject(generation, "The specified generation is null.");
+
+    if (ZEN_NEW_GENERATION_IS_OBJECT(generation, object)) {
+        uint8_t* flags = &ZEN_NEW_GENERATION_GET_OBJECT_FLAGS(generation, object);
+        *flags = (*flags & ~ZEN_MEMORY_BLOCK_CELL_TYPE_MASK) |
+            (type << ZEN_MEMORY_BLOCK_CELL_TYPE_SHIFT);
+    }
+}
+
+/* Pin */
+
+void zen_NewGeneration_pin(zen_NewGeneration_t* generation, const void* object,
+    int32_t size) {
+    jtk_Assert_assertObject(generation, "The specified generation is null.");
+
+    ZEN_NEW_GENERATION_GET_OBJECT_FLAGS(generation, object) |= ZEN_NEW_GENERATION_OBJECT_PINNED;
+
+    /* An object may straddle the boundary between two pages. */
+    uintptr_t offset = (uintptr_t)object - (uintptr_t)generation->m_start;
+    int32_t first = (int32_t)(offset >> ZEN_NEW_GENERATION_PAGE_SHIFT);
+    int32_t last = (int32_t)((offset + size - 1) >> ZEN_NEW_GENERATION_PAGE_SHIFT);
+    int32_t i;
+    for (i = first; (i <= last) && (i < generation->m_pageCount); i++) {
+        generation->m_pageFlags[i] |= ZEN_NEW_GENERATION_PAGE_PINNED;
+    }
+}
+
+/* Collection */
+
+void zen_NewGeneration_prepare(zen_NewGeneration_t* generation) {
+    jtk_Assert_assertObject(generation, "The specified generation is null.");
+
+    /* The pages pinned by the previous collection still hold objects, which
+     * are forgotten when the collection ends, unless they are pinned again.
+     */
+    int32_t i;
+    for (i = 0; i < generation->m_pageCount; i++) {
+        generation->m_pageFlags[i] &= ~ZEN_NEW_GENERATION_PAGE_PINNED;
+    }
+}
+
+void zen_NewGeneration_reset(zen_NewGeneration_t* generation) {
+    jtk_Assert_assertObject(generation, "The specified generation is null.");
+
+    int32_t granuleCount = ZEN_NEW_GENERATION_PAGE_SIZE >> ZEN_NEW_GENERATION_GRANULE_SHIFT;
+    int32_t i;
+    for (i = 0; i < generation->m_pageCount; i++) {
+        uint8_t flags = generation->m_pageFlags[i];
+        if ((flags & ZEN_NEW_GENERATION_PAGE_USED) != 0) {
+            uint8_t* entries = generation->m_objectMap + (i * granuleCount);
+            if ((flags & ZEN_NEW_GENERATION_PAGE_PINNED) != 0) {
+                /* Only the pinned objects are remembered. They are unpinned
+                 * for the next collection.
+                 */
+                int32_t j;
+                for (j = 0; j < granuleCount; j++) {
+                    entries[j] = ((entries[j] & ZEN_NEW_GENERATION_OBJECT_PINNED) != 0)?
+                        (entries[j] & ~ZEN_NEW_GENERATION_OBJECT_PINNED) : 0;
+                }
+            }
+            else {
+                memset(entries, 0, granuleCount);
+                generation->m_pageFlags[i] = 0;
+            }
+        }
+    }
+
+    /* The buffers were carved from the pages that are reused. */
+    for (i = 0; i < generation->m_allocationBufferCount; i++) {
+        zen_AllocationBuffer_t* buffer = generation->m_allocationBuffers[i];
+        buffer->m_free = NULL;
+        buffer->m_limit = NULL;
+    }
+
+    zen_SequentialAllocator_reset(generation->m_allocator, generation->m_start,
+        generation->m_start);
+    generation->m_allocatedSize = 0;
+}
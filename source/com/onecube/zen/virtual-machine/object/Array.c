@@ -0,0 +1,51 @@
+/*
+ * Copyright 2018-2020 Samuel Rowe
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Thursday, November 12, 2020
+
+#include <com/onecube/zen/virtual-machine/object/Array.h>
+
+/*******************************************************************************
+ * Array                                                                       *
+ *******************************************************************************/
+
+/* The sizes of the elements, indexed by their types. The arrays of void and
+ * unknown types cannot be created.
+ */
+static const int32_t zen_Array_elementSizes[] = {
+    sizeof (uint8_t), // ZEN_TYPE_BOOLEAN
+    sizeof (uint16_t), // ZEN_TYPE_CHARACTER
+    sizeof (int8_t), // ZEN_TYPE_INTEGER_8
+    sizeof (int16_t), // ZEN_TYPE_INTEGER_16
+    sizeof (int32_t), // ZEN_TYPE_INTEGER_32
+    sizeof (int64_t), // ZEN_TYPE_INTEGER_64
+    sizeof (float), // ZEN_TYPE_DECIMAL_32
+    sizeof (double), // ZEN_TYPE_DECIMAL_64
+    sizeof (zen_Object_t*), // ZEN_TYPE_REFERENCE
+    0, // ZEN_TYPE_VOID
+    0 // ZEN_TYPE_UNKNOWN
+};
+
+/* Size */
+
+int32_t zen_Array_getElementSize(zen_Type_t type) {
+    return (((int32_t)type >= ZEN_TYPE_BOOLEAN) && (type <= ZEN_TYPE_UNKNOWN))?
+        zen_Array_elementSizes[(int32_t)type] : 0;
+}
+
+int32_t zen_Array_getAllocationSize(zen_Type_t type, int32_t length) {
+    return ZEN_ARRAY_ELEMENTS_OFFSET + (zen_Array_getElementSize(type) * length);
+}
@@ -16,15 +16,21 @@
 
 // Saturday, April 06, 2019
 
+#include <string.h>
+
 // TODO: Change this to single-linked list.
 #include <jtk/collection/Iterator.h>
 #include <jtk/collection/list/DoublyLinkedList.h>
 #include <jtk/core/CStringObjectAdapter.h>
 #include <jtk/core/CString.h>
+#include <jtk/collection/array/Arrays.h>
 
 #include <com/onecube/zen/virtual-machine/VirtualMachine.h>
 #include <com/onecube/zen/virtual-machine/object/Class.h>
+#include <com/onecube/zen/virtual-machine/object/ClassTable.h>
 #include <com/onecube/zen/virtual-machine/feb/constant-pool/ConstantPoolClass.h>
+#include <com/onecube/zen/virtual-machine/feb/constant-pool/ConstantPoolField.h>
+#include <com/onecube/zen/virtual-machine/feb/constant-pool/ConstantPoolFunction.h>
 #include <com/onecube/zen/virtual-machine/feb/constant-pool/ConstantPoolUtf8.h>
 
 /*******************************************************************************
@@ -48,6 +54,18 @@ zen_Class_t* zen_Class_new(zen_VirtualMachine_t* virtualMachine,
     class0->m_memoryRequirement = 0;
     class0->m_functionTable = NULL;
     class0->m_functionTableSize = 0;
+    class0->m_resolvedEntries = NULL;
+    class0->m_superclasses = NULL;
+    class0->m_superclassCount = 0;
+    class0->m_virtualFunctionTable = NULL;
+    class0->m_virtualFunctionTableSize = 0;
+    class0->m_referenceOffsets = NULL;
+    class0->m_referenceOffsetCount = 0;
+    class0->m_staticFields = NULL;
+    class0->m_staticFieldsSize = 0;
+    class0->m_staticReferenceOffsets = NULL;
+    class0->m_staticReferenceOffsetCount = 0;
+    class0->m_index = zen_ClassTable_add(virtualMachine->m_classTable, class0);
 
     zen_Class_initialize(virtualMachine, class0, entityFile);
 
@@ -86,6 +104,12 @@ void zen_Class_delete(zen_Class_t* class0) {
 
     // TODO: Delete overloads
 
+    jtk_Memory_deallocate(class0->m_resolvedEntries);
+    jtk_Memory_deallocate(class0->m_superclasses);
+    jtk_Memory_deallocate(class0->m_virtualFunctionTable);
+    jtk_Memory_deallocate(class0->m_referenceOffsets);
+    jtk_Memory_deallocate(class0->m_staticFields);
+    jtk_Memory_deallocate(class0->m_staticReferenceOffsets);
     jtk_HashMap_delete(class0->m_overloads);
     jtk_HashMap_delete(class0->m_functions);
     jtk_HashMap_delete(class0->m_fields);
@@ -101,12 +125,22 @@ zen_EntityFile_t* zen_Class_getEntityFile(zen_Class_t* class0) {
 
 // Field Index
 
+zen_Field_t* zen_Class_findField(zen_Class_t* class0, const uint8_t* name,
+    int32_t nameSize) {
+    jtk_Assert_assertObject(class0, "The specified class is null.");
+    jtk_Assert_assertObject(name, "The specified field name is null.");
+
+    return (zen_Field_t*)jtk_HashMap_getValue(class0->m_fields, name);
+}
+
 int32_t zen_Class_findFieldOffset(zen_Class_t* class0, const uint8_t* name,
     int32_t nameSize) {
     jtk_Assert_assertObject(class0, "The specified class is null.");
     jtk_Assert_assertObject(name, "The specified field name is null.");
 
-    // TODO: Implement this function to find fields in class hierarchies.
+    /* The fields inherited from the superclasses are described by the class,
+     * too.
+     */
     // TODO: Wrap the byte string in a String object, instead of allocating.
 
     zen_Field_t* field = jtk_HashMap_getValue(class0->m_fields, name);
@@ -158,71 +192,440 @@ zen_Function_t* zen_Class_getInstanceFunction(zen_Class_t* class0,
     return result;
 }
 
-// Initialize
+// Virtual Function
 
-void zen_Class_initialize(zen_VirtualMachine_t* virtualMachine,
-    zen_Class_t* class0, zen_EntityFile_t* entityFile) {
+/* Determines whether two instance functions have the same signature, that
+ * is, one overrides the other.
+ */
+static bool zen_Class_isSameSignature(zen_Function_t* function1,
+    zen_Function_t* function2) {
+    return jtk_CString_equals(function1->m_name, function1->m_nameSize,
+            function2->m_name, function2->m_nameSize) &&
+        jtk_CString_equals(function1->m_descriptor, function1->m_descriptorSize,
+            function2->m_descriptor, function2->m_descriptorSize);
+}
+
+int32_t zen_Class_findVirtualFunctionIndex(zen_Class_t* class0,
+    const uint8_t* name, int32_t nameSize, const uint8_t* descriptor,
+    int32_t descriptorSize) {
     jtk_Assert_assertObject(class0, "The specified class is null.");
-    jtk_Assert_assertObject(entityFile, "The specified entity file is null.");
 
-    zen_Entity_t* entity = &entityFile->m_entity;
-    zen_ConstantPool_t* constantPool = &entityFile->m_constantPool;
+    int32_t result = -1;
+    int32_t i;
+    for (i = 0; i < class0->m_virtualFunctionTableSize; i++) {
+        zen_Function_t* function = class0->m_virtualFunctionTable[i];
+        if (jtk_CString_equals(function->m_name, function->m_nameSize, name, nameSize) &&
+            jtk_CString_equals(function->m_descriptor, function->m_descriptorSize,
+                descriptor, descriptorSize)) {
+            result = i;
+            break;
+        }
+    }
+    return result;
+}
 
-    zen_ConstantPoolUtf8_t* descriptorEntry =
-        (zen_ConstantPoolUtf8_t*)constantPool->m_entries[entity->m_reference];
-    class0->m_descriptor = jtk_CString_newEx(descriptorEntry->m_bytes, descriptorEntry->m_length);
-    class0->m_descriptorSize = descriptorEntry->m_length;
+zen_Function_t* zen_Class_getVirtualFunction(zen_Class_t* class0,
+    const uint8_t* name, int32_t nameSize, const uint8_t* descriptor,
+    int32_t descriptorSize) {
+    int32_t index = zen_Class_findVirtualFunctionIndex(class0, name, nameSize,
+        descriptor, descriptorSize);
+    return (index >= 0)? class0->m_virtualFunctionTable[index] : NULL;
+}
+
+// Subclass
+
+bool zen_Class_isSubclass(zen_Class_t* class0, zen_Class_t* superclass) {
+    jtk_Assert_assertObject(class0, "The specified class is null.");
 
+    bool result = (class0 == superclass);
     int32_t i;
-    int32_t fieldCount = entity->m_fieldCount;
-    for (i = 0; i < fieldCount; i++) {
-        zen_FieldEntity_t* fieldEntity = (zen_FieldEntity_t*)entity->m_fields[i];
-        /* Memory requirement should be strictly used to calculate the space
-         * required by the fields of the class. This constraint is placed due
-         * to the usage of m_memoryRequirement in evaluating the offsets of the
-         * fields.
+    for (i = 0; (i < class0->m_superclassCount) && !result; i++) {
+        result = zen_Class_isSubclass(class0->m_superclasses[i], superclass);
+    }
+    return result;
+}
+
+// Resolve
+
+zen_Class_t* zen_Class_resolveClass(zen_VirtualMachine_t* virtualMachine,
+    zen_Class_t* class0, int32_t index) {
+    jtk_Assert_assertObject(class0, "The specified class is null.");
+
+    zen_ResolvedEntry_t* resolvedEntry = &class0->m_resolvedEntries[index];
+    if (resolvedEntry->m_class == NULL) {
+        zen_ConstantPool_t* constantPool = &class0->m_entityFile->m_constantPool;
+        zen_ConstantPoolClass_t* classEntry =
+            (zen_ConstantPoolClass_t*)constantPool->m_entries[index];
+        zen_ConstantPoolUtf8_t* nameEntry =
+            (zen_ConstantPoolUtf8_t*)constantPool->m_entries[classEntry->m_nameIndex];
+
+        /* The class is not cached when it cannot be found, so that the
+         * ClassNotFoundException is raised every time.
          */
-        zen_Field_t* field = zen_Field_new(class0, fieldEntity, class0->m_memoryRequirement);
-        jtk_HashMap_put(class0->m_fields, field->m_name, field);
+        resolvedEntry->m_class = zen_VirtualMachine_getClassEx(virtualMachine,
+            nameEntry->m_bytes, nameEntry->m_length, &nameEntry->m_hashCode);
+    }
 
-        if (field->m_descriptorSize == 1) {
-            switch (field->m_descriptor[0]) {
-                // TODO: What is the size of a character?
+    return resolvedEntry->m_class;
+}
 
-                case 'z':
-                case 'b': {
-                    class0->m_memoryRequirement += 1;
-                    break;
-                }
+zen_Function_t* zen_Class_resolveFunction(zen_VirtualMachine_t* virtualMachine,
+    zen_Class_t* class0, int32_t index) {
+    jtk_Assert_assertObject(class0, "The specified class is null.");
 
-                case 's': {
-                    class0->m_memoryRequirement += 2;
-                    break;
-                }
+    zen_ResolvedEntry_t* resolvedEntry = &class0->m_resolvedEntries[index];
+    if (resolvedEntry->m_function == NULL) {
+        zen_ConstantPool_t* constantPool = &class0->m_entityFile->m_constantPool;
+        zen_ConstantPoolFunction_t* functionEntry =
+            (zen_ConstantPoolFunction_t*)constantPool->m_entries[index];
+        zen_Class_t* targetClass = zen_Class_resolveClass(virtualMachine, class0,
+            functionEntry->m_classIndex);
+
+        if (targetClass != NULL) {
+            /* The table index is valid only within the class that declares the
+             * function. A value of 0 indicates that the function should be
+             * looked up by its name and descriptor.
+             */
+            if (functionEntry->m_tableIndex > 0) {
+                resolvedEntry->m_function = targetClass->m_functionTable[functionEntry->m_tableIndex];
+            }
+            else {
+                zen_ConstantPoolUtf8_t* nameEntry =
+                    (zen_ConstantPoolUtf8_t*)constantPool->m_entries[functionEntry->m_nameIndex];
+                zen_ConstantPoolUtf8_t* descriptorEntry =
+                    (zen_ConstantPoolUtf8_t*)constantPool->m_entries[functionEntry->m_descriptorIndex];
+
+                /* Constructors are stored as static functions named <initialize>. */
+                resolvedEntry->m_function = zen_Class_getStaticFunction(targetClass,
+                    nameEntry->m_bytes, nameEntry->m_length, descriptorEntry->m_bytes,
+                    descriptorEntry->m_length);
+            }
+        }
+    }
 
-                case 'f':
-                case 'i': {
-                    class0->m_memoryRequirement += 4;
-                    break;
-                }
+    return resolvedEntry->m_function;
+}
+
+zen_Field_t* zen_Class_resolveField(zen_VirtualMachine_t* virtualMachine,
+    zen_Class_t* class0, int32_t index) {
+    jtk_Assert_assertObject(class0, "The specified class is null.");
+
+    zen_ResolvedEntry_t* resolvedEntry = &class0->m_resolvedEntries[index];
+    if (resolvedEntry->m_field == NULL) {
+        zen_ConstantPool_t* constantPool = &class0->m_entityFile->m_constantPool;
+        zen_ConstantPoolField_t* fieldEntry =
+            (zen_ConstantPoolField_t*)constantPool->m_entries[index];
+        zen_Class_t* targetClass = zen_Class_resolveClass(virtualMachine, class0,
+            fieldEntry->m_classIndex);
+
+        if (targetClass != NULL) {
+            zen_ConstantPoolUtf8_t* nameEntry =
+                (zen_ConstantPoolUtf8_t*)constantPool->m_entries[fieldEntry->m_nameIndex];
+
+            /* The inherited fields are found, too. */
+            resolvedEntry->m_field = (zen_Field_t*)jtk_HashMap_getValue(targetClass->m_fields,
+                nameEntry->m_bytes);
+        }
+    }
+
+    return resolvedEntry->m_field;
+}
+
+zen_Function_t* zen_Class_resolveVirtualFunction(zen_VirtualMachine_t* virtualMachine,
+    zen_Class_t* class0, int32_t index, int32_t* virtualIndex) {
+    jtk_Assert_assertObject(class0, "The specified class is null.");
+
+    zen_Function_t* result = NULL;
+    zen_ConstantPool_t* constantPool = &class0->m_entityFile->m_constantPool;
+    zen_ConstantPoolFunction_t* functionEntry =
+        (zen_ConstantPoolFunction_t*)constantPool->m_entries[index];
+
+    zen_Class_t* targetClass = zen_Class_resolveClass(virtualMachine, class0,
+        functionEntry->m_classIndex);
+    if (targetClass != NULL) {
+        zen_ConstantPoolUtf8_t* nameEntry =
+            (zen_ConstantPoolUtf8_t*)constantPool->m_entries[functionEntry->m_nameIndex];
+        zen_ConstantPoolUtf8_t* descriptorEntry =
+            (zen_ConstantPoolUtf8_t*)constantPool->m_entries[functionEntry->m_descriptorIndex];
+        int32_t slot = zen_Class_findVirtualFunctionIndex(targetClass,
+            nameEntry->m_bytes, nameEntry->m_length, descriptorEntry->m_bytes,
+            descriptorEntry->m_length);
+        if (slot >= 0) {
+            result = targetClass->m_virtualFunctionTable[slot];
+            *virtualIndex = slot;
+        }
+    }
+
+    return result;
+}
+
+// Link
+
+/* Finds the direct superclasses of the specified class. The classes are
+ * loaded if necessary. A superclass that cannot be found is left out without
+ * raising an exception, because the bootstrap classes, such as zen.core.Object,
+ * are not always available as binary entities.
+ */
+static void zen_Class_linkSuperclasses(zen_VirtualMachine_t* virtualMachine,
+    zen_Class_t* class0, zen_Entity_t* entity) {
+    zen_ConstantPool_t* constantPool = &class0->m_entityFile->m_constantPool;
+
+    class0->m_superclasses = jtk_Memory_allocate(zen_Class_t*, entity->m_superclassCount + 1);
+    class0->m_superclassCount = 0;
+
+    int32_t i;
+    for (i = 0; i < entity->m_superclassCount; i++) {
+        zen_ConstantPoolUtf8_t* nameEntry =
+            (zen_ConstantPoolUtf8_t*)constantPool->m_entries[entity->m_superclasses[i]];
+        /* The compiler may write the qualified name of the superclass. */
+        uint8_t* descriptor = jtk_CString_newEx(nameEntry->m_bytes, nameEntry->m_length);
+        jtk_Arrays_replace_b(descriptor, nameEntry->m_length, '.', '/');
+
+        zen_Class_t* superclass = zen_ClassLoader_findClass(virtualMachine->m_classLoader,
+            descriptor, nameEntry->m_length);
+        if ((superclass != NULL) && (superclass != class0)) {
+            class0->m_superclasses[class0->m_superclassCount++] = superclass;
+        }
+
+        jtk_CString_delete(descriptor);
+    }
+}
 
-                case 'd':
-                case 'l': {
-                    class0->m_memoryRequirement += 8;
-                    break;
+/* Builds the virtual function table of the specified class. The superclasses
+ * must be linked before the virtual function table is built.
+ */
+static void zen_Class_buildVirtualFunctionTable(zen_Class_t* class0,
+    int32_t functionCount) {
+    int32_t capacity = functionCount;
+    int32_t i;
+    for (i = 0; i < class0->m_superclassCount; i++) {
+        capacity += class0->m_superclasses[i]->m_virtualFunctionTableSize;
+    }
+
+    zen_Function_t** table = jtk_Memory_allocate(zen_Function_t*, capacity + 1);
+    int32_t size = 0;
+
+    /* Inherit the slots of the superclasses. The slots of the first superclass
+     * are copied as they are, so that a slot index resolved against the first
+     * superclass is valid in this class, too.
+     */
+    for (i = 0; i < class0->m_superclassCount; i++) {
+        zen_Class_t* superclass = class0->m_superclasses[i];
+        int32_t j;
+        for (j = 0; j < superclass->m_virtualFunctionTableSize; j++) {
+            zen_Function_t* inherited = superclass->m_virtualFunctionTable[j];
+            bool duplicate = false;
+            if (i > 0) {
+                int32_t k;
+                for (k = 0; k < size; k++) {
+                    if (zen_Class_isSameSignature(table[k], inherited)) {
+                        duplicate = true;
+                        break;
+                    }
                 }
+            }
+
+            if (!duplicate) {
+                table[size++] = inherited;
+            }
+        }
+    }
+
+    /* Override the inherited slots, or introduce new slots. Static functions
+     * and constructors are not dispatched virtually.
+     */
+    for (i = 1; i <= functionCount; i++) {
+        zen_Function_t* function = class0->m_functionTable[i];
+        if (zen_Function_isStatic(function) || (function->m_name[0] == '<')) {
+            continue;
+        }
+
+        int32_t slot = -1;
+        int32_t k;
+        for (k = 0; k < size; k++) {
+            if (zen_Class_isSameSignature(table[k], function)) {
+                slot = k;
+                break;
+            }
+        }
 
-                default: {
-                    printf("[internal error] Control should not reach here!\n");
-                    break;
+        if (slot >= 0) {
+            function->m_virtualRoot = table[slot]->m_virtualRoot;
+        }
+        else {
+            slot = size++;
+            function->m_virtualRoot = function;
+        }
+        table[slot] = function;
+    }
+
+    class0->m_virtualFunctionTable = table;
+    class0->m_virtualFunctionTableSize = size;
+}
+
+/* The sizes of the fields, in the order they are laid out. Since every size
+ * is a multiple of the sizes that follow it, the fields are aligned to their
+ * sizes without any padding between them.
+ */
+static const int32_t zen_Class_fieldSizes[] = { 8, 4, 2, 1 };
+
+/* Assigns offsets to the specified fields, beginning at the specified offset,
+ * and records the offsets of the fields that hold references.
+ *
+ * @return The offset that follows the last field.
+ */
+static int32_t zen_Class_assignOffsets(zen_Field_t** fields, int32_t fieldCount,
+    int32_t offset, int32_t* referenceOffsets, int32_t* referenceOffsetCount) {
+    int32_t k;
+    for (k = 0; k < (int32_t)(sizeof (zen_Class_fieldSizes) / sizeof (int32_t)); k++) {
+        int32_t i;
+        for (i = 0; i < fieldCount; i++) {
+            zen_Field_t* field = fields[i];
+            if (field->m_size == zen_Class_fieldSizes[k]) {
+                field->m_offset = offset;
+                offset += field->m_size;
+
+                if (zen_Field_isReference(field)) {
+                    referenceOffsets[(*referenceOffsetCount)++] = field->m_offset;
                 }
             }
         }
+    }
+    return offset;
+}
+
+/* Lays out the fields of the specified class, including the fields inherited
+ * from the superclasses. The superclasses must be linked before the fields
+ * are laid out.
+ *
+ * The body of an instance begins with the fields of the first superclass,
+ * which retain their offsets, so that an offset resolved against the first
+ * superclass is valid in this class, too. The fields declared by this class
+ * and the fields inherited from the other superclasses follow, grouped by
+ * their sizes in descending order. A field declared by this class hides an
+ * inherited field with the same name.
+ *
+ * The static fields declared by this class are laid out likewise, in the
+ * static storage of this class. The inherited static fields retain their
+ * offsets, which refer to the static storage of the declaring classes.
+ */
+static void zen_Class_layoutFields(zen_Class_t* class0, zen_Entity_t* entity) {
+    int32_t capacity = entity->m_fieldCount;
+    /* The reference offsets of the first superclass are copied as they are,
+     * including the offsets reserved for the fields that it hides.
+     */
+    int32_t referenceCapacity = entity->m_fieldCount;
+    int32_t i;
+    for (i = 0; i < class0->m_superclassCount; i++) {
+        zen_Class_t* superclass = class0->m_superclasses[i];
+        int32_t inheritedCount = jtk_HashMap_getSize(superclass->m_fields);
+        capacity += inheritedCount;
+        referenceCapacity += (i == 0)? superclass->m_referenceOffsetCount : inheritedCount;
+    }
+
+    /* The fields that are laid out after the fields of the first superclass. */
+    zen_Field_t** fields = jtk_Memory_allocate(zen_Field_t*, capacity + 1);
+    int32_t fieldCount = 0;
+    zen_Field_t** staticFields = jtk_Memory_allocate(zen_Field_t*, entity->m_fieldCount + 1);
+    int32_t staticFieldCount = 0;
+    class0->m_referenceOffsets = jtk_Memory_allocate(int32_t, referenceCapacity + 1);
+    class0->m_referenceOffsetCount = 0;
+    class0->m_staticReferenceOffsets = jtk_Memory_allocate(int32_t, entity->m_fieldCount + 1);
+    class0->m_staticReferenceOffsetCount = 0;
+    class0->m_memoryRequirement = 0;
+
+    for (i = 0; i < entity->m_fieldCount; i++) {
+        zen_FieldEntity_t* fieldEntity = (zen_FieldEntity_t*)entity->m_fields[i];
+        zen_Field_t* field = zen_Field_new(class0, fieldEntity, -1);
+        jtk_HashMap_put(class0->m_fields, field->m_name, field);
+        if (zen_Field_isStatic(field)) {
+            staticFields[staticFieldCount++] = field;
+        }
         else {
-            class0->m_memoryRequirement += sizeof (uintptr_t);
+            fields[fieldCount++] = field;
         }
     }
 
+    for (i = 0; i < class0->m_superclassCount; i++) {
+        zen_Class_t* superclass = class0->m_superclasses[i];
+        jtk_Iterator_t* iterator = jtk_HashMap_getEntryIterator(superclass->m_fields);
+        while (jtk_Iterator_hasNext(iterator)) {
+            jtk_HashMapEntry_t* entry = (jtk_HashMapEntry_t*)jtk_Iterator_getNext(iterator);
+            zen_Field_t* inherited = (zen_Field_t*)jtk_HashMapEntry_getValue(entry);
+            if (jtk_HashMap_getValue(class0->m_fields, inherited->m_name) == NULL) {
+                bool retained = (i == 0) || zen_Field_isStatic(inherited);
+                zen_Field_t* field = zen_Field_newInherited(inherited,
+                    retained? inherited->m_offset : -1);
+                jtk_HashMap_put(class0->m_fields, field->m_name, field);
+                if (!retained) {
+                    fields[fieldCount++] = field;
+                }
+            }
+        }
+        jtk_Iterator_delete(iterator);
+
+        /* The slots of the first superclass are reserved, even for the fields
+         * that are hidden.
+         */
+        if (i == 0) {
+            int32_t j;
+            for (j = 0; j < superclass->m_referenceOffsetCount; j++) {
+                class0->m_referenceOffsets[class0->m_referenceOffsetCount++] =
+                    superclass->m_referenceOffsets[j];
+            }
+            class0->m_memoryRequirement = superclass->m_memoryRequirement;
+        }
+    }
+
+    /* The memory requirement of every class is a multiple of 8 bytes.
+     * Therefore, the fields that follow the fields of the first superclass
+     * begin at an offset aligned to the largest field size.
+     */
+    int32_t offset = zen_Class_assignOffsets(fields, fieldCount,
+        class0->m_memoryRequirement, class0->m_referenceOffsets,
+        &class0->m_referenceOffsetCount);
+    class0->m_memoryRequirement = (offset + 7) & ~7;
+
+    if (staticFieldCount > 0) {
+        int32_t staticOffset = zen_Class_assignOffsets(staticFields, staticFieldCount,
+            0, class0->m_staticReferenceOffsets, &class0->m_staticReferenceOffsetCount);
+        class0->m_staticFieldsSize = (staticOffset + 7) & ~7;
+        class0->m_staticFields = jtk_Memory_allocate(uint8_t, class0->m_staticFieldsSize);
+        memset(class0->m_staticFields, 0, class0->m_staticFieldsSize);
+    }
+
+    jtk_Memory_deallocate(staticFields);
+    jtk_Memory_deallocate(fields);
+}
+
+// Initialize
+
+void zen_Class_initialize(zen_VirtualMachine_t* virtualMachine,
+    zen_Class_t* class0, zen_EntityFile_t* entityFile) {
+    jtk_Assert_assertObject(class0, "The specified class is null.");
+    jtk_Assert_assertObject(entityFile, "The specified entity file is null.");
+
+    zen_Entity_t* entity = &entityFile->m_entity;
+    zen_ConstantPool_t* constantPool = &entityFile->m_constantPool;
+
+    zen_ConstantPoolUtf8_t* descriptorEntry =
+        (zen_ConstantPoolUtf8_t*)constantPool->m_entries[entity->m_reference];
+    class0->m_descriptor = jtk_CString_newEx(descriptorEntry->m_bytes, descriptorEntry->m_length);
+    class0->m_descriptorSize = descriptorEntry->m_length;
+
+    /* All the entries are initially unresolved. The constant pool indexes begin
+     * from 1.
+     */
+    class0->m_resolvedEntries = jtk_Memory_allocate(zen_ResolvedEntry_t, constantPool->m_size + 1);
+    int32_t k;
+    for (k = 0; k <= constantPool->m_size; k++) {
+        class0->m_resolvedEntries[k].m_function = NULL;
+    }
+
+    /* The fields are laid out after the superclasses are linked. */
+    zen_Class_linkSuperclasses(virtualMachine, class0, entity);
+    zen_Class_layoutFields(class0, entity);
+
     class0->m_functionTableSize = entity->m_functionTableSize;
     class0->m_functionTable = jtk_Memory_allocate(zen_Function_t*, entity->m_functionTableSize + 1);
     class0->m_functionTable[0] = NULL;
@@ -256,4 +659,6 @@ void zen_Class_initialize(zen_VirtualMachine_t* virtualMachine,
 
         // TODO: Delete overloads!
     }
+
+    zen_Class_buildVirtualFunctionTable(class0, functionCount);
 }
\ No newline at end of file
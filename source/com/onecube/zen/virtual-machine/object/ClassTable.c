@@ -0,0 +1,68 @@
+/*
+ * Copyright 2018-2020 Samuel Rowe
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Monday, November 09, 2020
+
+#include <jtk/core/Assert.h>
+
+#include <com/onecube/zen/virtual-machine/object/ClassTable.h>
+
+/*******************************************************************************
+ * ClassTable                                                                  *
+ *******************************************************************************/
+
+/* Constructor */
+
+zen_ClassTable_t* zen_ClassTable_new() {
+    zen_ClassTable_t* table = jtk_Memory_allocate(zen_ClassTable_t, 1);
+    table->m_classes = jtk_Memory_allocate(zen_Class_t*, ZEN_CLASS_TABLE_DEFAULT_CAPACITY);
+    table->m_classes[ZEN_CLASS_TABLE_INVALID_INDEX] = NULL;
+    table->m_size = 1;
+    table->m_capacity = ZEN_CLASS_TABLE_DEFAULT_CAPACITY;
+
+    return table;
+}
+
+/* Destructor */
+
+void zen_ClassTable_delete(zen_ClassTable_t* table) {
+    jtk_Assert_assertObject(table, "The specified class table is null.");
+
+    jtk_Memory_deallocate(table->m_classes);
+    jtk_Memory_deallocate(table);
+}
+
+/* Add */
+
+uint32_t zen_ClassTable_add(zen_ClassTable_t* table, zen_Class_t* class0) {
+    jtk_Assert_assertObject(table, "The specified class table is null.");
+    jtk_Assert_assertObject(class0, "The specified class is null.");
+
+    if (table->m_size == table->m_capacity) {
+        int32_t capacity = table->m_capacity * 2;
+        zen_Class_t** classes = jtk_Memory_allocate(zen_Class_t*, capacity);
+        int32_t i;
+        for (i = 0; i < table->m_size; i++) {
+            classes[i] = table->m_classes[i];
+        }
+        jtk_Memory_deallocate(table->m_classes);
+        table->m_classes = classes;
+        table->m_capacity = capacity;
+    }
+    table->m_classes[table->m_size] = class0;
+
+    return (uint32_t)table->m_size++;
+}
@@ -16,6 +16,8 @@
 
 // Sunday, July 14, 2019
 
+#include <stdio.h>
+
 #include <com/onecube/zen/virtual-machine/object/Field.h>
 #include <com/onecube/zen/virtual-machine/object/Class.h>
 #include <jtk/core/CString.h>
@@ -24,6 +26,107 @@
  * Field                                                                       *
  *******************************************************************************/
 
+// Type
+
+/* Determines the type of a field from its descriptor. Descriptors of a single
+ * character denote primitive types, whereas the other descriptors denote
+ * classes.
+ */
+static zen_FieldType_t zen_Field_getTypeFromDescriptor(const uint8_t* descriptor,
+    int32_t descriptorSize) {
+    zen_FieldType_t result = ZEN_FIELD_TYPE_REFERENCE;
+    if (descriptorSize == 1) {
+        switch (descriptor[0]) {
+            // TODO: What is the size of a character?
+
+            case 'z': {
+                result = ZEN_FIELD_TYPE_BOOLEAN;
+                break;
+            }
+
+            case 'b': {
+                result = ZEN_FIELD_TYPE_BYTE;
+                break;
+            }
+
+            case 's': {
+                result = ZEN_FIELD_TYPE_SHORT;
+                break;
+            }
+
+            case 'i': {
+                result = ZEN_FIELD_TYPE_INTEGER;
+                break;
+            }
+
+            case 'l': {
+                result = ZEN_FIELD_TYPE_LONG;
+                break;
+            }
+
+            case 'f': {
+                result = ZEN_FIELD_TYPE_FLOAT;
+                break;
+            }
+
+            case 'd': {
+                result = ZEN_FIELD_TYPE_DOUBLE;
+                break;
+            }
+
+            default: {
+                printf("[internal error] Control should not reach here!\n");
+                break;
+            }
+        }
+    }
+    return result;
+}
+
+static int32_t zen_Field_getSizeFromType(zen_FieldType_t type) {
+    int32_t result = 0;
+    switch (type) {
+        case ZEN_FIELD_TYPE_BOOLEAN:
+        case ZEN_FIELD_TYPE_BYTE: {
+            result = 1;
+            break;
+        }
+
+        case ZEN_FIELD_TYPE_SHORT: {
+            result = 2;
+            break;
+        }
+
+        case ZEN_FIELD_TYPE_INTEGER:
+        case ZEN_FIELD_TYPE_FLOAT: {
+            result = 4;
+            break;
+        }
+
+        case ZEN_FIELD_TYPE_LONG:
+        case ZEN_FIELD_TYPE_DOUBLE: {
+            result = 8;
+            break;
+        }
+
+        case ZEN_FIELD_TYPE_REFERENCE: {
+            result = sizeof (uintptr_t);
+            break;
+        }
+    }
+    return result;
+}
+
+bool zen_Field_isReference(zen_Field_t* field) {
+    return field->m_type == ZEN_FIELD_TYPE_REFERENCE;
+}
+
+// Static
+
+bool zen_Field_isStatic(zen_Field_t* field) {
+    return (field->m_entity->m_flags & (1 << 6)) != 0;
+}
+
 // Constructor
 
 zen_Field_t* zen_Field_new(zen_Class_t* class0,
@@ -40,10 +143,27 @@ zen_Field_t* zen_Field_new(zen_Class_t* class0,
     field->m_class = class0;
     field->m_offset = offset;
     field->m_entity = entity;
+    field->m_type = zen_Field_getTypeFromDescriptor(field->m_descriptor, field->m_descriptorSize);
+    field->m_size = zen_Field_getSizeFromType(field->m_type);
 
     return field;
 }
 
+zen_Field_t* zen_Field_newInherited(zen_Field_t* field, int32_t offset) {
+    zen_Field_t* result = jtk_Memory_allocate(zen_Field_t, 1);
+    result->m_name = jtk_CString_newEx(field->m_name, field->m_nameSize);
+    result->m_nameSize = field->m_nameSize;
+    result->m_descriptor = jtk_CString_newEx(field->m_descriptor, field->m_descriptorSize);
+    result->m_descriptorSize = field->m_descriptorSize;
+    result->m_class = field->m_class;
+    result->m_offset = offset;
+    result->m_entity = field->m_entity;
+    result->m_type = field->m_type;
+    result->m_size = field->m_size;
+
+    return result;
+}
+
 // Destructor
 
 void zen_Field_delete(zen_Field_t* field) {
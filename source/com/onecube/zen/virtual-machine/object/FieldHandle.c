@@ -0,0 +1,50 @@
+/*
+ * Copyright 2018-2020 Samuel Rowe
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Monday, November 16, 2020
+
+#include <jtk/core/Assert.h>
+
+#include <com/onecube/zen/virtual-machine/object/Class.h>
+#include <com/onecube/zen/virtual-machine/object/Field.h>
+#include <com/onecube/zen/virtual-machine/object/FieldHandle.h>
+
+/*******************************************************************************
+ * FieldHandle                                                                 *
+ *******************************************************************************/
+
+// Initialize
+
+bool zen_FieldHandle_initialize(zen_FieldHandle_t* handle, zen_Class_t* class0,
+    const uint8_t* name, int32_t nameSize) {
+    jtk_Assert_assertObject(handle, "The specified field handle is null.");
+    jtk_Assert_assertObject(class0, "The specified class is null.");
+    jtk_Assert_assertObject(name, "The specified field name is null.");
+
+    zen_Field_t* field = zen_Class_findField(class0, name, nameSize);
+    if (field != NULL) {
+        handle->m_class = class0;
+        handle->m_offset = field->m_offset;
+        handle->m_type = field->m_type;
+    }
+    else {
+        handle->m_class = NULL;
+        handle->m_offset = -1;
+        handle->m_type = ZEN_FIELD_TYPE_REFERENCE;
+    }
+
+    return field != NULL;
+}
@@ -17,6 +17,7 @@
 // Tuesday, March 26, 2019
 
 #include <jtk/core/CString.h>
+#include <com/onecube/zen/virtual-machine/feb/ByteCode.h>
 #include <com/onecube/zen/virtual-machine/feb/EntityFlag.h>
 #include <com/onecube/zen/virtual-machine/object/Function.h>
 #include <com/onecube/zen/virtual-machine/object/Class.h>
@@ -27,18 +28,15 @@
  * Function                                                                    *
  *******************************************************************************/
 
+#define ZEN_FUNCTION_REFERENCE_SLOT_COUNT ((sizeof (uintptr_t) <= 4)? 1 : 2)
+
 // Constructor
 
-/* A native function can be loaded in two ways. If a native
- * function is registered before the program begins execution,
- * the native function is automatically associated with the
- * function object when it is being loaded from the binary entity
- * format. This ensures that native functions are always present
- * throughtout the life cycle of a class. This is called as cold
- * registration.
- * 
- * Alternatively, a native function can be registered after the
- * class has been loaded. This is called as hot registration.
+/* The native functions are registered in a table which is built before the
+ * program begins execution. The native function is associated with the
+ * function object when it is being loaded from the binary entity format, so
+ * that native functions are always present throughout the life cycle of a
+ * class. Only the functions marked as native are looked up.
  */
 
 zen_Function_t* zen_Function_new(zen_VirtualMachine_t* virtualMachine,
@@ -55,10 +53,10 @@ zen_Function_t* zen_Function_new(zen_VirtualMachine_t* virtualMachine,
     function->m_class = class0;
     function->m_flags = 0;
     function->m_functionEntity = functionEntity;
-    function->m_nativeFunction = zen_VirtualMachine_getNativeFunction(virtualMachine,
-        class0->m_descriptor, class0->m_descriptorSize,
-        function->m_name, function->m_nameSize,
-        function->m_descriptor, function->m_descriptorSize);
+    function->m_nativeFunction = NULL;
+    function->m_intrinsic = ZEN_INTRINSIC_NONE;
+    function->m_intrinsicOperator = -1;
+    function->m_intrinsicValueOffset = -1;
 
     // type, startIndex
     int32_t afterColon = -1;
@@ -223,7 +221,21 @@ zen_Function_t* zen_Function_new(zen_VirtualMachine_t* virtualMachine,
     function->m_parameterCount = parameterCount;
     function->m_parameters = parameters;
 
+    /* Precompute the layout of the arguments, so that the interpreter does not
+     * inspect the parameters on every invocation.
+     */
+    function->m_argumentSlotCount = parameterCount * ZEN_FUNCTION_REFERENCE_SLOT_COUNT;
+    function->m_directArguments = true;
+    for (i = 0; i < parameterCount; i++) {
+        if (parameters[i * 2] != ZEN_TYPE_REFERENCE) {
+            function->m_directArguments = false;
+            break;
+        }
+    }
+
     function->m_instructionAttribute = NULL;
+    function->m_siteCaches = NULL;
+    function->m_virtualRoot = NULL;
     if ((function->m_functionEntity->m_flags & (1 << 7)) == 0) {
         int32_t limit = functionEntity->m_attributeTable.m_size;
         for (i = 0; i < limit; i++) {
@@ -240,7 +252,43 @@ zen_Function_t* zen_Function_new(zen_VirtualMachine_t* virtualMachine,
             }
         }
     }
-
+    else {
+        zen_NativeFunction_t* nativeFunction = zen_VirtualMachine_getNativeFunction(
+            virtualMachine, class0->m_descriptor, class0->m_descriptorSize,
+            function->m_name, function->m_nameSize,
+            function->m_descriptor, function->m_descriptorSize);
+        /* The interpreter passes the arguments of a fast native function
+         * without checking their number. Therefore, a fast native function
+         * registered with a different number of parameters is rejected.
+         */
+        if ((nativeFunction != NULL) && ZEN_NATIVE_FUNCTION_IS_FAST(nativeFunction) &&
+            (nativeFunction->m_parameterCount != parameterCount)) {
+            printf("[error] The native function '%.*s' expects %d parameters, found %d.\n",
+                function->m_nameSize, function->m_name, nativeFunction->m_parameterCount,
+                parameterCount);
+            nativeFunction = NULL;
+        }
+        function->m_nativeFunction = nativeFunction;
+
+        /* The intrinsic falls back to the native function. Therefore, the
+         * native function should be available.
+         */
+        const zen_IntrinsicEntry_t* intrinsic = (nativeFunction != NULL)?
+            zen_Intrinsic_find(class0->m_descriptor, class0->m_descriptorSize,
+                function->m_name, function->m_nameSize, function->m_descriptor,
+                function->m_descriptorSize) : NULL;
+        if (intrinsic != NULL) {
+            int32_t valueOffset = -1;
+            if (intrinsic->m_intrinsic != ZEN_INTRINSIC_STRING) {
+                valueOffset = zen_Class_findFieldOffset(class0, "value", 5);
+            }
+            if ((intrinsic->m_intrinsic == ZEN_INTRINSIC_STRING) || (valueOffset >= 0)) {
+                function->m_intrinsic = intrinsic->m_intrinsic;
+                function->m_intrinsicOperator = intrinsic->m_operator;
+                function->m_intrinsicValueOffset = valueOffset;
+            }
+        }
+    }
 
     return function;
 }
@@ -248,6 +296,33 @@ zen_Function_t* zen_Function_new(zen_VirtualMachine_t* virtualMachine,
 // Destructor
 
 void zen_Function_delete(zen_Function_t* function) {
+    if (function->m_siteCaches != NULL) {
+        uint8_t* instructions = function->m_instructionAttribute->m_instructions;
+        int32_t length = function->m_instructionAttribute->m_instructionLength;
+        int32_t i;
+        for (i = 0; i < length; i++) {
+            void* siteCache = function->m_siteCaches[i];
+            if (siteCache != NULL) {
+                switch (instructions[i]) {
+                    case ZEN_BYTE_CODE_INVOKE_VIRTUAL: {
+                        zen_InlineCache_delete((zen_InlineCache_t*)siteCache);
+                        break;
+                    }
+
+                    case ZEN_BYTE_CODE_INVOKE_OPERATOR: {
+                        zen_OperatorCache_delete((zen_OperatorCache_t*)siteCache);
+                        break;
+                    }
+
+                    default: {
+                        zen_FieldCache_delete((zen_FieldCache_t*)siteCache);
+                        break;
+                    }
+                }
+            }
+        }
+        jtk_Memory_deallocate(function->m_siteCaches);
+    }
     jtk_Memory_deallocate(function->m_parameters);
     jtk_CString_delete(function->m_name);
     jtk_CString_delete(function->m_descriptor);
@@ -264,4 +339,46 @@ zen_Class_t* zen_Function_getClass(zen_Function_t* function) {
 
 bool zen_Function_isNative(zen_Function_t* function) {
     return (function->m_functionEntity->m_flags & (1 << 7)) != 0;
+}
+
+// Static
+
+bool zen_Function_isStatic(zen_Function_t* function) {
+    return (function->m_functionEntity->m_flags & (1 << 6)) != 0;
+}
+
+// Site Cache
+
+void* zen_Function_createSiteCache(zen_Function_t* function, int32_t offset) {
+    if (function->m_siteCaches == NULL) {
+        int32_t length = function->m_instructionAttribute->m_instructionLength;
+        function->m_siteCaches = jtk_Memory_allocate(void*, length);
+        int32_t i;
+        for (i = 0; i < length; i++) {
+            function->m_siteCaches[i] = NULL;
+        }
+    }
+
+    void* siteCache = function->m_siteCaches[offset];
+    if (siteCache == NULL) {
+        switch (function->m_instructionAttribute->m_instructions[offset]) {
+            case ZEN_BYTE_CODE_INVOKE_VIRTUAL: {
+                siteCache = zen_InlineCache_new();
+                break;
+            }
+
+            case ZEN_BYTE_CODE_INVOKE_OPERATOR: {
+                siteCache = zen_OperatorCache_new();
+                break;
+            }
+
+            /* The field instructions. */
+            default: {
+                siteCache = zen_FieldCache_new();
+                break;
+            }
+        }
+        function->m_siteCaches[offset] = siteCache;
+    }
+    return siteCache;
 }
\ No newline at end of file
@@ -28,6 +28,8 @@ zen_NativeFunction_t* zen_NativeFunction_new(
     zen_NativeFunction_InvokeFunction_t invoke) {
     zen_NativeFunction_t* nativeFunction = jtk_Memory_allocate(zen_NativeFunction_t, 1);
     nativeFunction->m_invoke = invoke;
+    nativeFunction->m_fastInvoke = NULL;
+    nativeFunction->m_parameterCount = -1;
 
     return nativeFunction;
 }
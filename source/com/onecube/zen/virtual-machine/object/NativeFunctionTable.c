@@ -0,0 +1,245 @@
+/*
+ * Copyright 2018-2020 Samuel Rowe
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Saturday, November 14, 2020
+
+#include <jtk/core/Assert.h>
+#include <jtk/core/CString.h>
+
+#include <com/onecube/zen/virtual-machine/object/NativeFunctionTable.h>
+
+/*******************************************************************************
+ * NativeFunctionTable                                                         *
+ *******************************************************************************/
+
+#define ZEN_NATIVE_FUNCTION_TABLE_FNV_OFFSET_BASIS 14695981039346656037ULL
+#define ZEN_NATIVE_FUNCTION_TABLE_FNV_PRIME 1099511628211ULL
+
+/* The table gives up if the keys cannot be displaced within this number of
+ * slots, which happens only if two entries have the same key.
+ */
+#define ZEN_NATIVE_FUNCTION_TABLE_MAXIMUM_SLOT_COUNT (1 << 20)
+
+/* The high half of the hash selects the bucket. The low half, the upper bits
+ * of the high half and the displacement of the bucket select the slot. The
+ * step is odd, therefore, the displacements of a bucket visit every slot.
+ */
+#define ZEN_NATIVE_FUNCTION_TABLE_GET_BUCKET(table, hash) \
+    ((uint32_t)((hash) >> 32) & (uint32_t)((table)->m_bucketCount - 1))
+
+#define ZEN_NATIVE_FUNCTION_TABLE_GET_SLOT(table, hash, displacement) \
+    (((uint32_t)(hash) + ((displacement) * ((uint32_t)((hash) >> 40) | 1))) & \
+        (uint32_t)((table)->m_slotCount - 1))
+
+/* Hash */
+
+static uint64_t zen_NativeFunctionTable_hashBytes(uint64_t hash,
+    const uint8_t* bytes, int32_t size) {
+    int32_t i;
+    for (i = 0; i < size; i++) {
+        hash ^= bytes[i];
+        hash *= ZEN_NATIVE_FUNCTION_TABLE_FNV_PRIME;
+    }
+    /* A null character terminates every string, so that keys whose strings
+     * merely split at different positions are hashed differently.
+     */
+    hash *= ZEN_NATIVE_FUNCTION_TABLE_FNV_PRIME;
+
+    return hash;
+}
+
+static uint64_t zen_NativeFunctionTable_hash(const uint8_t* className,
+    int32_t classNameSize, const uint8_t* name, int32_t nameSize,
+    const uint8_t* descriptor, int32_t descriptorSize) {
+    uint64_t result = ZEN_NATIVE_FUNCTION_TABLE_FNV_OFFSET_BASIS;
+    result = zen_NativeFunctionTable_hashBytes(result, className, classNameSize);
+    result = zen_NativeFunctionTable_hashBytes(result, name, nameSize);
+    result = zen_NativeFunctionTable_hashBytes(result, descriptor, descriptorSize);
+
+    return result;
+}
+
+/* Build */
+
+/* Displaces the buckets, largest first. Returns false if a bucket cannot be
+ * displaced, in which case the table should have more slots.
+ */
+static bool zen_NativeFunctionTable_build(zen_NativeFunctionTable_t* table,
+    const uint64_t* hashes) {
+    int32_t entryCount = table->m_entryCount;
+    int32_t bucketCount = table->m_bucketCount;
+    int32_t* heads = jtk_Memory_allocate(int32_t, bucketCount);
+    int32_t* sizes = jtk_Memory_allocate(int32_t, bucketCount);
+    int32_t* order = jtk_Memory_allocate(int32_t, bucketCount);
+    int32_t* next = jtk_Memory_allocate(int32_t, entryCount + 1);
+    uint32_t* claimedSlots = jtk_Memory_allocate(uint32_t, entryCount + 1);
+
+    int32_t i;
+    int32_t j;
+    for (i = 0; i < table->m_slotCount; i++) {
+        table->m_slots[i] = -1;
+    }
+    for (i = 0; i < bucketCount; i++) {
+        heads[i] = -1;
+        sizes[i] = 0;
+        table->m_displacements[i] = 0;
+    }
+
+    /* The entries of a bucket are chained through their indexes. */
+    for (i = 0; i < entryCount; i++) {
+        uint32_t bucket = ZEN_NATIVE_FUNCTION_TABLE_GET_BUCKET(table, hashes[i]);
+        next[i] = heads[bucket];
+        heads[bucket] = i;
+        sizes[bucket]++;
+    }
+
+    /* Sort the buckets by their sizes, in descending order. */
+    for (i = 0; i < bucketCount; i++) {
+        for (j = i; (j > 0) && (sizes[order[j - 1]] < sizes[i]); j--) {
+            order[j] = order[j - 1];
+        }
+        order[j] = i;
+    }
+
+    bool result = true;
+    for (i = 0; (i < bucketCount) && result && (sizes[order[i]] > 0); i++) {
+        int32_t bucket = order[i];
+        bool displaced = false;
+        uint32_t displacement;
+        for (displacement = 0; (displacement < (uint32_t)table->m_slotCount) && !displaced;
+            displacement++) {
+            /* The slots are claimed one after another, and released if any
+             * of them is already taken.
+             */
+            int32_t claimedSlotCount = 0;
+            int32_t entry;
+            for (entry = heads[bucket]; entry >= 0; entry = next[entry]) {
+                uint32_t slot = ZEN_NATIVE_FUNCTION_TABLE_GET_SLOT(table, hashes[entry],
+                    displacement);
+                if (table->m_slots[slot] >= 0) {
+                    break;
+                }
+                table->m_slots[slot] = entry;
+                claimedSlots[claimedSlotCount++] = slot;
+            }
+
+            if (entry < 0) {
+                table->m_displacements[bucket] = displacement;
+                displaced = true;
+            }
+            else {
+                for (j = 0; j < claimedSlotCount; j++) {
+                    table->m_slots[claimedSlots[j]] = -1;
+                }
+            }
+        }
+        result = displaced;
+    }
+
+    jtk_Memory_deallocate(claimedSlots);
+    jtk_Memory_deallocate(next);
+    jtk_Memory_deallocate(order);
+    jtk_Memory_deallocate(sizes);
+    jtk_Memory_deallocate(heads);
+
+    return result;
+}
+
+/* Constructor */
+
+zen_NativeFunctionTable_t* zen_NativeFunctionTable_new(zen_NativeFunctionEntry_t* entries,
+    int32_t entryCount) {
+    jtk_Assert_assertObject(entries, "The specified entries are null.");
+
+    uint64_t* hashes = jtk_Memory_allocate(uint64_t, entryCount + 1);
+    int32_t i;
+    for (i = 0; i < entryCount; i++) {
+        zen_NativeFunctionEntry_t* entry = &entries[i];
+        hashes[i] = zen_NativeFunctionTable_hash(entry->m_className, entry->m_classNameSize,
+            entry->m_name, entry->m_nameSize, entry->m_descriptor, entry->m_descriptorSize);
+    }
+
+    zen_NativeFunctionTable_t* table = jtk_Memory_allocate(zen_NativeFunctionTable_t, 1);
+    table->m_entries = entries;
+    table->m_entryCount = entryCount;
+
+    /* Initially, at most half of the slots are occupied and a bucket holds
+     * two keys on average. The slots are doubled until every bucket is
+     * displaced.
+     */
+    int32_t slotCount = 4;
+    while (slotCount < (entryCount * 2)) {
+        slotCount *= 2;
+    }
+
+    bool built = false;
+    while (!built && (slotCount <= ZEN_NATIVE_FUNCTION_TABLE_MAXIMUM_SLOT_COUNT)) {
+        table->m_slotCount = slotCount;
+        table->m_bucketCount = slotCount / 4;
+        table->m_displacements = jtk_Memory_allocate(uint32_t, table->m_bucketCount);
+        table->m_slots = jtk_Memory_allocate(int32_t, slotCount);
+
+        built = zen_NativeFunctionTable_build(table, hashes);
+        if (!built) {
+            jtk_Memory_deallocate(table->m_displacements);
+            jtk_Memory_deallocate(table->m_slots);
+            slotCount *= 2;
+        }
+    }
+    jtk_Assert_assertTrue(built, "The keys of the native function table are not distinct.");
+
+    jtk_Memory_deallocate(hashes);
+
+    return table;
+}
+
+/* Destructor */
+
+void zen_NativeFunctionTable_delete(zen_NativeFunctionTable_t* table) {
+    jtk_Assert_assertObject(table, "The specified native function table is null.");
+
+    jtk_Memory_deallocate(table->m_slots);
+    jtk_Memory_deallocate(table->m_displacements);
+    jtk_Memory_deallocate(table);
+}
+
+/* Find */
+
+zen_NativeFunction_t* zen_NativeFunctionTable_find(zen_NativeFunctionTable_t* table,
+    const uint8_t* className, int32_t classNameSize, const uint8_t* name,
+    int32_t nameSize, const uint8_t* descriptor, int32_t descriptorSize) {
+    jtk_Assert_assertObject(table, "The specified native function table is null.");
+
+    uint64_t hash = zen_NativeFunctionTable_hash(className, classNameSize, name,
+        nameSize, descriptor, descriptorSize);
+    uint32_t displacement = table->m_displacements[
+        ZEN_NATIVE_FUNCTION_TABLE_GET_BUCKET(table, hash)];
+    int32_t index = table->m_slots[ZEN_NATIVE_FUNCTION_TABLE_GET_SLOT(table, hash,
+        displacement)];
+
+    /* The slot may belong to another key, or to no key at all. */
+    zen_NativeFunction_t* result = NULL;
+    if (index >= 0) {
+        zen_NativeFunctionEntry_t* entry = &table->m_entries[index];
+        if (jtk_CString_equals(entry->m_className, entry->m_classNameSize, className, classNameSize) &&
+            jtk_CString_equals(entry->m_name, entry->m_nameSize, name, nameSize) &&
+            jtk_CString_equals(entry->m_descriptor, entry->m_descriptorSize, descriptor, descriptorSize)) {
+            result = &entry->m_function;
+        }
+    }
+
+    return result;
+}
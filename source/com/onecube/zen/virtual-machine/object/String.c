@@ -0,0 +1,77 @@
+/*
+ * Copyright 2018-2020 Samuel Rowe
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Friday, November 13, 2020
+
+#include <string.h>
+
+#include <com/onecube/zen/virtual-machine/object/String.h>
+
+/*******************************************************************************
+ * String                                                                      *
+ *******************************************************************************/
+
+#define ZEN_STRING_FNV_OFFSET_BASIS 2166136261U
+#define ZEN_STRING_FNV_PRIME 16777619U
+
+/* Size */
+
+int32_t zen_String_getAllocationSize(int32_t size) {
+    return ZEN_STRING_BYTES_OFFSET + size;
+}
+
+/* Hash */
+
+int32_t zen_String_getHash(zen_Object_t* string) {
+    int32_t result = ZEN_STRING_HASH(string);
+    if (result == 0) {
+        const uint8_t* bytes = ZEN_STRING_GET_BYTES(string);
+        int32_t size = ZEN_STRING_SIZE(string);
+        uint32_t hash = ZEN_STRING_FNV_OFFSET_BASIS;
+        int32_t i;
+        for (i = 0; i < size; i++) {
+            hash ^= bytes[i];
+            hash *= ZEN_STRING_FNV_PRIME;
+        }
+        /* Zero is reserved for strings whose hash was not computed yet. */
+        result = (hash != 0)? (int32_t)hash : 1;
+        ZEN_STRING_HASH(string) = result;
+    }
+    return result;
+}
+
+/* Equality */
+
+bool zen_String_isEqual(zen_Object_t* string1, zen_Object_t* string2) {
+    bool result = false;
+    if (string1 == string2) {
+        result = true;
+    }
+    else if ((string1 != NULL) && (string2 != NULL)) {
+        int32_t size = ZEN_STRING_SIZE(string1);
+        int32_t hash1 = ZEN_STRING_HASH(string1);
+        int32_t hash2 = ZEN_STRING_HASH(string2);
+        /* The hashes are compared only if both of them are cached, because
+         * computing a hash reads all the bytes anyway.
+         */
+        if ((size == ZEN_STRING_SIZE(string2)) &&
+            ((hash1 == 0) || (hash2 == 0) || (hash1 == hash2))) {
+            result = memcmp(ZEN_STRING_GET_BYTES(string1), ZEN_STRING_GET_BYTES(string2),
+                size) == 0;
+        }
+    }
+    return result;
+}
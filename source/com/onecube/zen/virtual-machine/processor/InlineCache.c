@@ -0,0 +1,231 @@
+/*
+ * Copyright 2018-2020 Samuel Rowe
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Sunday, October 18, 2020
+
+#include <jtk/core/Assert.h>
+
+#include <com/onecube/zen/virtual-machine/processor/InlineCache.h>
+
+/*******************************************************************************
+ * InlineCache                                                                 *
+ *******************************************************************************/
+
+/* Constructor */
+
+zen_InlineCache_t* zen_InlineCache_new() {
+    zen_InlineCache_t* inlineCache = jtk_Memory_allocate(zen_InlineCache_t, 1);
+    inlineCache->m_virtualIndex = ZEN_INLINE_CACHE_UNLINKED;
+    inlineCache->m_virtualRoot = NULL;
+    int32_t i;
+    for (i = 0; i < ZEN_INLINE_CACHE_CAPACITY; i++) {
+        inlineCache->m_classes[i] = NULL;
+        inlineCache->m_functions[i] = NULL;
+    }
+    inlineCache->m_size = 0;
+
+    return inlineCache;
+}
+
+/* Destructor */
+
+void zen_InlineCache_delete(zen_InlineCache_t* inlineCache) {
+    jtk_Assert_assertObject(inlineCache, "The specified inline cache is null.");
+
+    jtk_Memory_deallocate(inlineCache);
+}
+
+/* Add */
+
+bool zen_InlineCache_add(zen_InlineCache_t* inlineCache, zen_Class_t* class0,
+    zen_Function_t* function) {
+    jtk_Assert_assertObject(inlineCache, "The specified inline cache is null.");
+
+    bool result = inlineCache->m_size < ZEN_INLINE_CACHE_CAPACITY;
+    if (result) {
+        inlineCache->m_classes[inlineCache->m_size] = class0;
+        inlineCache->m_functions[inlineCache->m_size] = function;
+        inlineCache->m_size++;
+    }
+    return result;
+}
+
+/* Function */
+
+zen_Function_t* zen_InlineCache_getPolymorphicFunction(zen_InlineCache_t* inlineCache,
+    zen_Class_t* class0) {
+    jtk_Assert_assertObject(inlineCache, "The specified inline cache is null.");
+
+    zen_Function_t* result = NULL;
+    int32_t i;
+    for (i = 1; i < inlineCache->m_size; i++) {
+        if (inlineCache->m_classes[i] == class0) {
+            result = inlineCache->m_functions[i];
+            break;
+        }
+    }
+    return result;
+}
+
+/* Megamorphic */
+
+bool zen_InlineCache_isMegamorphic(zen_InlineCache_t* inlineCache) {
+    jtk_Assert_assertObject(inlineCache, "The specified inline cache is null.");
+
+    return inlineCache->m_size == ZEN_INLINE_CACHE_CAPACITY;
+}
+
+/*******************************************************************************
+ * OperatorCache                                                               *
+ *******************************************************************************/
+
+/* Constructor */
+
+zen_OperatorCache_t* zen_OperatorCache_new() {
+    zen_OperatorCache_t* operatorCache = jtk_Memory_allocate(zen_OperatorCache_t, 1);
+    int32_t i;
+    for (i = 0; i < ZEN_OPERATOR_CACHE_CAPACITY; i++) {
+        operatorCache->m_classes1[i] = NULL;
+        operatorCache->m_classes2[i] = NULL;
+        operatorCache->m_functions[i] = NULL;
+    }
+    operatorCache->m_size = 0;
+    operatorCache->m_intrinsic = ZEN_OPERATOR_INTRINSIC_NONE;
+    operatorCache->m_valueOffset = -1;
+
+    return operatorCache;
+}
+
+/* Destructor */
+
+void zen_OperatorCache_delete(zen_OperatorCache_t* operatorCache) {
+    jtk_Assert_assertObject(operatorCache, "The specified operator cache is null.");
+
+    jtk_Memory_deallocate(operatorCache);
+}
+
+/* Add */
+
+bool zen_OperatorCache_add(zen_OperatorCache_t* operatorCache, zen_Class_t* class1,
+    zen_Class_t* class2, zen_Function_t* function) {
+    jtk_Assert_assertObject(operatorCache, "The specified operator cache is null.");
+
+    bool result = operatorCache->m_size < ZEN_OPERATOR_CACHE_CAPACITY;
+    if (result) {
+        operatorCache->m_classes1[operatorCache->m_size] = class1;
+        operatorCache->m_classes2[operatorCache->m_size] = class2;
+        operatorCache->m_functions[operatorCache->m_size] = function;
+        operatorCache->m_size++;
+    }
+    return result;
+}
+
+/* Function */
+
+zen_Function_t* zen_OperatorCache_getFunction(zen_OperatorCache_t* operatorCache,
+    zen_Class_t* class1, zen_Class_t* class2) {
+    jtk_Assert_assertObject(operatorCache, "The specified operator cache is null.");
+
+    zen_Function_t* result = NULL;
+    int32_t i;
+    for (i = 0; i < operatorCache->m_size; i++) {
+        if ((operatorCache->m_classes1[i] == class1) &&
+            (operatorCache->m_classes2[i] == class2)) {
+            result = operatorCache->m_functions[i];
+            break;
+        }
+    }
+    return result;
+}
+
+/* Megamorphic */
+
+bool zen_OperatorCache_isMegamorphic(zen_OperatorCache_t* operatorCache) {
+    jtk_Assert_assertObject(operatorCache, "The specified operator cache is null.");
+
+    return operatorCache->m_size == ZEN_OPERATOR_CACHE_CAPACITY;
+}
+
+/*******************************************************************************
+ * MegamorphicCache                                                            *
+ *******************************************************************************/
+
+/* Both the keys are pointers to allocated memory, whose lower bits are
+ * usually zero. Therefore, they are discarded before the keys are mixed.
+ */
+#define ZEN_MEGAMORPHIC_CACHE_HASH(class0, selector) \
+    ((int32_t)((((uintptr_t)(class0) >> 3) ^ ((uintptr_t)(selector) >> 3)) & \
+        (ZEN_MEGAMORPHIC_CACHE_SIZE - 1)))
+
+/* Initialize */
+
+void zen_MegamorphicCache_initialize(zen_MegamorphicCache_t* cache) {
+    jtk_Assert_assertObject(cache, "The specified megamorphic cache is null.");
+
+    int32_t i;
+    for (i = 0; i < ZEN_MEGAMORPHIC_CACHE_SIZE; i++) {
+        zen_MegamorphicCacheEntry_t* entry = &cache->m_entries[i];
+        entry->m_class = NULL;
+        entry->m_selector = NULL;
+        entry->m_function = NULL;
+    }
+}
+
+/* Function */
+
+zen_Function_t* zen_MegamorphicCache_getFunction(zen_MegamorphicCache_t* cache,
+    zen_Class_t* class0, const void* selector) {
+    jtk_Assert_assertObject(cache, "The specified megamorphic cache is null.");
+
+    zen_MegamorphicCacheEntry_t* entry =
+        &cache->m_entries[ZEN_MEGAMORPHIC_CACHE_HASH(class0, selector)];
+    return ((entry->m_class == class0) && (entry->m_selector == selector))?
+        entry->m_function : NULL;
+}
+
+void zen_MegamorphicCache_putFunction(zen_MegamorphicCache_t* cache,
+    zen_Class_t* class0, const void* selector, zen_Function_t* function) {
+    jtk_Assert_assertObject(cache, "The specified megamorphic cache is null.");
+
+    zen_MegamorphicCacheEntry_t* entry =
+        &cache->m_entries[ZEN_MEGAMORPHIC_CACHE_HASH(class0, selector)];
+    entry->m_class = class0;
+    entry->m_selector = selector;
+    entry->m_function = function;
+}
+
+/*******************************************************************************
+ * FieldCache                                                                  *
+ *******************************************************************************/
+
+/* Constructor */
+
+zen_FieldCache_t* zen_FieldCache_new() {
+    zen_FieldCache_t* fieldCache = jtk_Memory_allocate(zen_FieldCache_t, 1);
+    fieldCache->m_class = NULL;
+    fieldCache->m_offset = -1;
+    fieldCache->m_address = NULL;
+
+    return fieldCache;
+}
+
+/* Destructor */
+
+void zen_FieldCache_delete(zen_FieldCache_t* fieldCache) {
+    jtk_Assert_assertObject(fieldCache, "The specified field cache is null.");
+
+    jtk_Memory_deallocate(fieldCache);
+}
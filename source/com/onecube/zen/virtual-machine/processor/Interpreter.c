@@ -26,6 +26,7 @@
 #include <com/onecube/zen/virtual-machine/VirtualMachine.h>
 #include <com/onecube/zen/virtual-machine/feb/ByteCode.h>
 #include <com/onecube/zen/virtual-machine/feb/constant-pool/ConstantPool.h>
+#include <com/onecube/zen/virtual-machine/feb/constant-pool/ConstantPoolField.h>
 #include <com/onecube/zen/virtual-machine/feb/constant-pool/ConstantPoolFunction.h>
 #include <com/onecube/zen/virtual-machine/feb/constant-pool/ConstantPoolInteger.h>
 #include <com/onecube/zen/virtual-machine/feb/constant-pool/ConstantPoolLong.h>
@@ -35,6 +36,9 @@
 #include <com/onecube/zen/virtual-machine/feb/constant-pool/ConstantPoolUtf8.h>
 #include <com/onecube/zen/virtual-machine/feb/constant-pool/ConstantPoolTag.h>
 #include <com/onecube/zen/virtual-machine/feb/Entity.h>
+#include <com/onecube/zen/virtual-machine/feb/Operator.h>
+#include <com/onecube/zen/virtual-machine/object/Array.h>
+#include <com/onecube/zen/virtual-machine/object/String.h>
 #include <com/onecube/zen/virtual-machine/object/Class.h>
 #include <com/onecube/zen/virtual-machine/object/Object.h>
 #include <com/onecube/zen/virtual-machine/object/Function.h>
@@ -65,7 +69,7 @@ const uint8_t* ZEN_BOOTSTRAP_CLASS_ZEN_CORE_NULL_POINTER_EXCEPTION = "zen.core.N
 
 zen_Interpreter_t* zen_Interpreter_new(zen_MemoryManager_t* manager,
     zen_VirtualMachine_t* virtualMachine, zen_ProcessorThread_t* processorThread) {
-    // jtk_Assert_assertObject(manager, "The specified memory manager is null.");
+    jtk_Assert_assertObject(manager, "The specified memory manager is null.");
 
     zen_Interpreter_t* interpreter = jtk_Memory_allocate(zen_Interpreter_t, 1);
     interpreter->m_counter = -1;
@@ -76,6 +80,17 @@ zen_Interpreter_t* zen_Interpreter_new(zen_MemoryManager_t* manager,
     interpreter->m_state = 0;
     interpreter->m_exception = NULL;
     interpreter->m_handlerStackFrame = NULL;
+    interpreter->m_megamorphicCache = jtk_Memory_allocate(zen_MegamorphicCache_t, 1);
+    zen_MegamorphicCache_initialize(interpreter->m_megamorphicCache);
+    interpreter->m_inlineCacheStatistics.m_virtualTableHits = 0;
+    interpreter->m_inlineCacheStatistics.m_monomorphicHits = 0;
+    interpreter->m_inlineCacheStatistics.m_polymorphicHits = 0;
+    interpreter->m_inlineCacheStatistics.m_megamorphicHits = 0;
+    interpreter->m_inlineCacheStatistics.m_misses = 0;
+    interpreter->m_inlineCacheStatistics.m_intrinsicHits = 0;
+    interpreter->m_inlineCacheStatistics.m_fieldHits = 0;
+    interpreter->m_inlineCacheStatistics.m_fieldMisses = 0;
+    zen_MemoryManager_addAllocationBuffer(manager, &interpreter->m_allocationBuffer);
 
     return interpreter;
 }
@@ -85,7 +100,10 @@ zen_Interpreter_t* zen_Interpreter_new(zen_MemoryManager_t* manager,
 void zen_Interpreter_delete(zen_Interpreter_t* interpreter) {
     jtk_Assert_assertObject(interpreter, "The specified interpreter is null.");
 
+    zen_MemoryManager_removeAllocationBuffer(interpreter->m_virtualMachine->m_memoryManager,
+        &interpreter->m_allocationBuffer);
     zen_InvocationStack_delete(interpreter->m_invocationStack);
+    jtk_Memory_deallocate(interpreter->m_megamorphicCache);
     jtk_Memory_deallocate(interpreter);
 }
 
@@ -119,6 +137,260 @@ zen_Object_t* zen_Interpreter_makeException(zen_Interpreter_t* interpreter,
     return NULL;
 }
 
+/*******************************************************************************
+ * Dispatch                                                                    *
+ *******************************************************************************/
+
+/* The interpreter can dispatch instructions in two ways. The first technique
+ * uses a switch statement, which is portable but forces every instruction to
+ * jump back to a single dispatch point. The second technique, known as direct
+ * threading, uses the "labels as values" extension of GCC and Clang. Each
+ * instruction handler jumps directly to the handler of the next instruction,
+ * which keeps the branch predictor informed about the instruction sequences
+ * of the program.
+ *
+ * Define ZEN_INTERPRETER_SWITCH_DISPATCH to force the switch based dispatch.
+ */
+#if defined(__GNUC__) && !defined(ZEN_INTERPRETER_SWITCH_DISPATCH)
+    #define ZEN_INTERPRETER_DIRECT_THREADED
+#endif
+
+#ifdef ZEN_INTERPRETER_DIRECT_THREADED
+    #define ZEN_INTERPRETER_CASE(opcode) case opcode: label_##opcode:
+    #define ZEN_INTERPRETER_DEFAULT default: label_unknown:
+    #define ZEN_INTERPRETER_TARGET(opcode) [opcode] = &&label_##opcode
+    #define ZEN_INTERPRETER_DISPATCH() \
+        do { \
+            ZEN_INTERPRETER_FETCH(); \
+            goto *dispatchTable[instruction]; \
+        } \
+        while (false)
+#else
+    #define ZEN_INTERPRETER_CASE(opcode) case opcode:
+    #define ZEN_INTERPRETER_DEFAULT default:
+    #define ZEN_INTERPRETER_DISPATCH() continue
+#endif
+
+/* Fetches the next instruction. The interpreter returns to the caller when
+ * the instructions of the current function have been exhausted.
+ */
+#define ZEN_INTERPRETER_FETCH() \
+    if (ip >= instructionLength) { \
+        returnSlotCount = 0; \
+        goto returnFromFunction; \
+    } \
+    instruction = instructions[ip++]; \
+    jtk_Logger_debug(logger, "Fetched instruction... (instruction pointer = %d, instruction = 0x%X)", \
+        ip, instruction)
+
+/* Reads a 16-bit operand from the instruction stream. The high byte
+ * appears first.
+ */
+#define ZEN_INTERPRETER_READ_SHORT() \
+    (ip += 2, (uint16_t)(((uint16_t)instructions[ip - 2] << 8) | instructions[ip - 1]))
+
+/* The instruction pointer, the top of the operand stack and the base of the
+ * local variable array of the current stack frame are cached in local
+ * variables, which the compiler can keep in registers. The cached state is
+ * written back to the stack frame only before the interpreter hands over the
+ * control to code which observes it, namely, function invocations, object
+ * creation, and exception handling.
+ */
+#define ZEN_INTERPRETER_SAVE_STATE() \
+    currentStackFrame->m_ip = ip; \
+    operandStack->m_size = (int32_t)(stackTop - operandStack->m_values)
+
+/* Polls the memory manager at a safepoint. While the old generation is marked
+ * incrementally, the program performs a marking slice here. The cached state
+ * is written back first, so that the stack frames are up to date.
+ */
+#define ZEN_INTERPRETER_SAFEPOINT() \
+    do { \
+        if (ZEN_MEMORY_MANAGER_IS_SAFEPOINT_REQUESTED(manager)) { \
+            ZEN_INTERPRETER_SAVE_STATE(); \
+            zen_MemoryManager_safepoint(manager); \
+        } \
+    } \
+    while (false)
+
+/* Transfers the control to the specified instruction. Backward branches are
+ * safepoints, which ensures that a loop cannot run indefinitely without
+ * polling the memory manager.
+ */
+#define ZEN_INTERPRETER_BRANCH(target) \
+    do { \
+        int32_t target0 = (int32_t)(target); \
+        if (target0 < ip) { \
+            ZEN_INTERPRETER_SAFEPOINT(); \
+        } \
+        ip = target0; \
+    } \
+    while (false)
+
+#define ZEN_INTERPRETER_LOAD_STATE() \
+    operandStack = &currentStackFrame->m_operandStack; \
+    localVariableArray = &currentStackFrame->m_localVariableArray; \
+    instructions = currentStackFrame->m_instructionAttribute->m_instructions; \
+    instructionLength = currentStackFrame->m_instructionAttribute->m_instructionLength; \
+    ip = currentStackFrame->m_ip; \
+    stackTop = operandStack->m_values + operandStack->m_size; \
+    locals = localVariableArray->m_values
+
+/* The operand stack and the local variable array store 64-bit values and
+ * references as two consecutive 32-bit slots, with the high part first.
+ * The following macros follow the encoding used by the OperandStack and
+ * LocalVariableArray classes.
+ */
+#define ZEN_INTERPRETER_REFERENCE_SLOT_COUNT ((sizeof (uintptr_t) <= 4)? 1 : 2)
+
+#define ZEN_INTERPRETER_GET_STACK_SIZE() ((int32_t)(stackTop - operandStack->m_values))
+#define ZEN_INTERPRETER_PUSH_INTEGER(value) (*stackTop++ = (int32_t)(value))
+#define ZEN_INTERPRETER_POP_INTEGER() (*--stackTop)
+#define ZEN_INTERPRETER_POP() (*--stackTop)
+#define ZEN_INTERPRETER_PUSH_LONG(value) (zen_Interpreter_writeLong(stackTop, (value)), stackTop += 2)
+#define ZEN_INTERPRETER_POP_LONG() (stackTop -= 2, zen_Interpreter_readLong(stackTop))
+#define ZEN_INTERPRETER_POP2() ZEN_INTERPRETER_POP_LONG()
+#define ZEN_INTERPRETER_PUSH_FLOAT(value) (*stackTop++ = zen_Interpreter_floatToBits(value))
+#define ZEN_INTERPRETER_POP_FLOAT() zen_Interpreter_bitsToFloat(*--stackTop)
+#define ZEN_INTERPRETER_PUSH_DOUBLE(value) ZEN_INTERPRETER_PUSH_LONG(zen_Interpreter_doubleToBits(value))
+#define ZEN_INTERPRETER_POP_DOUBLE() zen_Interpreter_bitsToDouble(ZEN_INTERPRETER_POP_LONG())
+#define ZEN_INTERPRETER_PUSH_REFERENCE(value) \
+    (zen_Interpreter_writeReference(stackTop, (uintptr_t)(value)), \
+    stackTop += ZEN_INTERPRETER_REFERENCE_SLOT_COUNT)
+#define ZEN_INTERPRETER_POP_REFERENCE() \
+    (stackTop -= ZEN_INTERPRETER_REFERENCE_SLOT_COUNT, zen_Interpreter_readReference(stackTop))
+#define ZEN_INTERPRETER_PEEK_REFERENCE() \
+    zen_Interpreter_readReference(stackTop - ZEN_INTERPRETER_REFERENCE_SLOT_COUNT)
+
+/* Determines whether the specified reference refers to an allocated instance
+ * of the specified class. Subclasses are not accepted.
+ */
+#define ZEN_INTERPRETER_IS_EXACT_INSTANCE(object, class0) \
+    (((object) != NULL) && !ZEN_OBJECT_IS_SMALL_INTEGER(object) && \
+        (ZEN_OBJECT_GET_CLASS(interpreter->m_virtualMachine->m_classTable, object) == (class0)))
+
+/* Reads the value of an instance of the Integer class, which is either a small
+ * integer or an object whose value field is at the specified offset.
+ */
+#define ZEN_INTERPRETER_GET_INTEGER_VALUE(integer, offset) \
+    (ZEN_OBJECT_IS_SMALL_INTEGER(integer)? ZEN_OBJECT_GET_SMALL_INTEGER(integer) : \
+        (int64_t)*((zen_Object_t**)((uint8_t*)(integer) + (offset))))
+
+/* Determines whether an instruction which expects elements of the specified
+ * type can access the element at the specified index of an array.
+ */
+#define ZEN_INTERPRETER_IS_ARRAY_ACCESSIBLE(array, index, type) \
+    (((array) != NULL) && (ZEN_ARRAY_ELEMENT_TYPE(array) == (type)) && \
+        ZEN_ARRAY_IS_VALID_INDEX(array, index))
+
+/* Pushes a stack frame for the specified function and makes it the current
+ * stack frame. When the invocation stack overflows, a StackOverflowException
+ * is thrown instead. The state of the interpreter should be saved before.
+ */
+#define ZEN_INTERPRETER_PUSH_STACK_FRAME(function, argumentSlotCount) \
+    do { \
+        zen_StackFrame_t* newStackFrame = zen_InvocationStack_pushStackFrameEx( \
+            interpreter->m_invocationStack, (function), (argumentSlotCount)); \
+        if (newStackFrame == NULL) { \
+            zen_Interpreter_raiseStackOverflowException(interpreter); \
+            goto handleException; \
+        } \
+        currentStackFrame = newStackFrame; \
+    } \
+    while (false)
+
+/* Raises an exception on behalf of an instruction which cannot access an
+ * element of an array, and transfers the control to the exception handler.
+ * An array whose elements are of a different type is reported like an
+ * invalid index.
+ */
+#define ZEN_INTERPRETER_RAISE_ARRAY_ACCESS_EXCEPTION(array, index) \
+    do { \
+        ZEN_INTERPRETER_SAVE_STATE(); \
+        if ((array) == NULL) { \
+            zen_VirtualMachine_raiseNullReferenceException(interpreter->m_virtualMachine); \
+        } \
+        else { \
+            zen_VirtualMachine_raiseInvalidArrayIndexException(interpreter->m_virtualMachine, \
+                (index)); \
+        } \
+        goto handleException; \
+    } \
+    while (false)
+
+/* NOTE: The duplicate instruction currently duplicates two slots, that is, a
+ * reference.
+ */
+#define ZEN_INTERPRETER_DUPLICATE() \
+    stackTop[0] = stackTop[-2]; \
+    stackTop[1] = stackTop[-1]; \
+    stackTop += 2
+
+#define ZEN_INTERPRETER_SWAP() \
+    { \
+        int32_t temporary = stackTop[-1]; \
+        stackTop[-1] = stackTop[-2]; \
+        stackTop[-2] = temporary; \
+    }
+
+#define ZEN_INTERPRETER_GET_LOCAL_INTEGER(index) locals[index]
+#define ZEN_INTERPRETER_SET_LOCAL_INTEGER(index, value) (locals[index] = (int32_t)(value))
+#define ZEN_INTERPRETER_GET_LOCAL_LONG(index) zen_Interpreter_readLong(locals + (index))
+#define ZEN_INTERPRETER_SET_LOCAL_LONG(index, value) zen_Interpreter_writeLong(locals + (index), (value))
+#define ZEN_INTERPRETER_GET_LOCAL_FLOAT(index) zen_Interpreter_bitsToFloat(locals[index])
+#define ZEN_INTERPRETER_SET_LOCAL_FLOAT(index, value) (locals[index] = zen_Interpreter_floatToBits(value))
+#define ZEN_INTERPRETER_GET_LOCAL_DOUBLE(index) zen_Interpreter_bitsToDouble(zen_Interpreter_readLong(locals + (index)))
+#define ZEN_INTERPRETER_SET_LOCAL_DOUBLE(index, value) zen_Interpreter_writeLong(locals + (index), zen_Interpreter_doubleToBits(value))
+#define ZEN_INTERPRETER_GET_LOCAL_REFERENCE(index) zen_Interpreter_readReference(locals + (index))
+#define ZEN_INTERPRETER_SET_LOCAL_REFERENCE(index, value) zen_Interpreter_writeReference(locals + (index), (uintptr_t)(value))
+
+static inline int64_t zen_Interpreter_readLong(const int32_t* slots) {
+    return (int64_t)(((uint64_t)(uint32_t)slots[0] << 32) | (uint32_t)slots[1]);
+}
+
+static inline void zen_Interpreter_writeLong(int32_t* slots, int64_t value) {
+    slots[0] = (int32_t)((uint64_t)value >> 32);
+    slots[1] = (int32_t)((uint64_t)value & 0xFFFFFFFFL);
+}
+
+static inline uintptr_t zen_Interpreter_readReference(const int32_t* slots) {
+    return (ZEN_INTERPRETER_REFERENCE_SLOT_COUNT == 1)?
+        (uintptr_t)(uint32_t)slots[0] : (uintptr_t)zen_Interpreter_readLong(slots);
+}
+
+static inline void zen_Interpreter_writeReference(int32_t* slots, uintptr_t reference) {
+    if (ZEN_INTERPRETER_REFERENCE_SLOT_COUNT == 1) {
+        slots[0] = (int32_t)reference;
+    }
+    else {
+        zen_Interpreter_writeLong(slots, (int64_t)reference);
+    }
+}
+
+static inline int32_t zen_Interpreter_floatToBits(float value) {
+    union { float m_float; int32_t m_bits; } converter;
+    converter.m_float = value;
+    return converter.m_bits;
+}
+
+static inline float zen_Interpreter_bitsToFloat(int32_t bits) {
+    union { float m_float; int32_t m_bits; } converter;
+    converter.m_bits = bits;
+    return converter.m_float;
+}
+
+static inline int64_t zen_Interpreter_doubleToBits(double value) {
+    union { double m_double; int64_t m_bits; } converter;
+    converter.m_double = value;
+    return converter.m_bits;
+}
+
+static inline double zen_Interpreter_bitsToDouble(int64_t bits) {
+    union { double m_double; int64_t m_bits; } converter;
+    converter.m_bits = bits;
+    return converter.m_double;
+}
+
 /* Interpret */
 
 /*
@@ -166,199 +438,398 @@ void zen_Interpreter_interpret(zen_Interpreter_t* interpreter) {
     jtk_Assert_assertObject(interpreter, "The specified interpreter is null.");
     jtk_Logger_t* logger = interpreter->m_virtualMachine->m_logger;
 
+#ifdef ZEN_INTERPRETER_DIRECT_THREADED
+    /* The addresses of the instruction handlers, indexed by the opcode. */
+    static const void* dispatchTable[256] = {
+        [0 ... 255] = &&label_unknown,
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_NOP),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_ADD_I),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_ADD_L),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_ADD_F),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_ADD_D),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_AND_I),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_AND_L),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_OR_I),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_OR_L),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_SHIFT_LEFT_I),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_SHIFT_LEFT_L),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_SHIFT_RIGHT_I),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_SHIFT_RIGHT_L),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_SHIFT_RIGHT_UI),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_SHIFT_RIGHT_UL),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_XOR_I),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_XOR_L),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_CAST_ITB),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_CAST_ITS),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_CAST_ITL),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_CAST_ITF),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_CAST_ITD),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_CAST_LTI),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_CAST_LTF),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_CAST_LTD),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_CAST_FTI),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_CAST_FTL),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_CAST_FTD),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_CAST_DTI),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_CAST_DTL),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_CAST_DTF),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_CAST_ITC),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_CHECK_CAST),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_COMPARE_L),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_COMPARE_LT_F),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_COMPARE_GT_F),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_COMPARE_LT_D),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_COMPARE_GT_D),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_DIVIDE_I),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_DIVIDE_L),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_DIVIDE_F),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_DIVIDE_D),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_DUPLICATE),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_DUPLICATE_X1),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_DUPLICATE_X2),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_DUPLICATE2),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_DUPLICATE2_X1),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_DUPLICATE2_X2),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_INCREMENT_I),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_INVOKE_SPECIAL),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_INVOKE_VIRTUAL),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_INVOKE_DYNAMIC),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_INVOKE_STATIC),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_JUMP),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_JUMP_EQ0_I),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_JUMP_NE0_I),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_JUMP_LT0_I),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_JUMP_GT0_I),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_JUMP_LE0_I),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_JUMP_GE0_I),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_JUMP_EQ_I),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_JUMP_NE_I),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_JUMP_LT_I),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_JUMP_GT_I),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_JUMP_LE_I),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_JUMP_GE_I),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_JUMP_EQ_A),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_JUMP_NE_A),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_JUMP_EQN_A),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_JUMP_NEN_A),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_LOAD_I),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_LOAD_L),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_LOAD_F),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_LOAD_D),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_LOAD_A),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_LOAD_I0),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_LOAD_I1),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_LOAD_I2),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_LOAD_I3),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_LOAD_L0),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_LOAD_L1),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_LOAD_L2),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_LOAD_L3),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_LOAD_F0),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_LOAD_F1),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_LOAD_F2),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_LOAD_F3),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_LOAD_D0),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_LOAD_D1),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_LOAD_D2),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_LOAD_D3),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_LOAD_A0),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_LOAD_A1),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_LOAD_A2),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_LOAD_A3),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_LOAD_AB),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_LOAD_AC),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_LOAD_AS),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_LOAD_AI),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_LOAD_AL),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_LOAD_AF),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_LOAD_AD),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_LOAD_AA),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_LOAD_INSTANCE_FIELD),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_LOAD_STATIC_FIELD),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_LOAD_CPR),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_LOAD_ARRAY_SIZE),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_MODULO_I),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_MODULO_L),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_MODULO_F),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_MODULO_D),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_MULTIPLY_I),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_MULTIPLY_L),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_MULTIPLY_F),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_MULTIPLY_D),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_NEGATE_I),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_NEGATE_L),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_NEGATE_F),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_NEGATE_D),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_NEW),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_NEW_ARRAY),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_NEW_ARRAY_A),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_NEW_ARRAY_AN),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_POP),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_POP2),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_PUSH_NULL),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_PUSH_IN1),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_PUSH_I0),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_PUSH_I1),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_PUSH_I2),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_PUSH_I3),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_PUSH_I4),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_PUSH_I5),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_PUSH_L0),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_PUSH_L1),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_PUSH_L2),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_PUSH_F0),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_PUSH_F1),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_PUSH_F2),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_PUSH_D0),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_PUSH_D1),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_PUSH_D2),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_PUSH_B),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_PUSH_S),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_RETURN),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_RETURN_I),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_RETURN_L),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_RETURN_F),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_RETURN_D),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_RETURN_A),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_RTTI),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_STORE_I),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_STORE_I0),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_STORE_I1),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_STORE_I2),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_STORE_I3),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_STORE_L),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_STORE_L0),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_STORE_L1),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_STORE_L2),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_STORE_L3),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_STORE_F),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_STORE_F0),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_STORE_F1),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_STORE_F2),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_STORE_F3),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_STORE_D),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_STORE_D0),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_STORE_D1),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_STORE_D2),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_STORE_D3),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_STORE_A),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_STORE_A0),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_STORE_A1),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_STORE_A2),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_STORE_A3),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_STORE_AB),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_STORE_AC),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_STORE_AS),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_STORE_AI),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_STORE_AL),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_STORE_AF),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_STORE_AD),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_STORE_AA),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_STORE_INSTANCE_FIELD),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_STORE_STATIC_FIELD),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_SUBTRACT_I),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_SUBTRACT_L),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_SUBTRACT_F),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_SUBTRACT_D),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_SWAP),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_SWITCH_TABLE),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_SWITCH_SEARCH),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_THROW),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_WIDE),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_INVOKE_OPERATOR),
+        ZEN_INTERPRETER_TARGET(ZEN_BYTE_CODE_LOAD_LITERAL),
+    };
+#endif
+
     zen_StackFrame_t* currentStackFrame = zen_InvocationStack_peekStackFrame(interpreter->m_invocationStack);
+    zen_OperandStack_t* operandStack;
+    zen_LocalVariableArray_t* localVariableArray;
+    uint8_t* instructions;
+    int32_t instructionLength;
+    int32_t ip;
+    int32_t* stackTop;
+    int32_t* locals;
+    uint8_t instruction;
     uint32_t flags = 0;
-    while (!zen_InvocationStack_isEmpty(interpreter->m_invocationStack)) {
-        /* Stop the interpreter loop if the byte stream has been exhausted. */
-        zen_InstructionAttribute_t* instructionAttribute = currentStackFrame->m_instructionAttribute;
-        if ((currentStackFrame->m_ip + 1) > instructionAttribute->m_instructionLength) {
-            break;
-        }
-
-        if ((interpreter->m_state & ZEN_INTERPRETER_STATE_EXCEPTION_THROWN) != 0) {
-            if (interpreter->m_handlerStackFrame == currentStackFrame) {
-                interpreter->m_state &= ~ZEN_INTERPRETER_STATE_EXCEPTION_THROWN;
-                interpreter->m_exception = NULL;
-            }
-            else {
-                break;
-            }
-        }
-
-        /* Destroy the stack frames that were traced. */
-        // TODO: Move stopTracing somewhere more appropriate.
-        zen_InvocationStack_stopTracing(interpreter->m_invocationStack);
+    /* The number of slots occupied by the return value of the function that
+     * is returning.
+     */
+    int32_t returnSlotCount;
+    /* The stack frames above the entry frame are pushed and popped by this
+     * invocation of the interpreter. The entry frame itself belongs to the
+     * caller, which collects the return value from its operand stack.
+     */
+    int32_t entryDepth = zen_InvocationStack_getSize(interpreter->m_invocationStack);
+    zen_MemoryManager_t* manager = interpreter->m_virtualMachine->m_memoryManager;
 
-        uint8_t* instructions = instructionAttribute->m_instructions;
-        uint8_t instruction = instructions[currentStackFrame->m_ip++];
+    ZEN_INTERPRETER_LOAD_STATE();
 
-        jtk_Logger_debug(logger, "Fetched instruction... (instruction pointer = %d, instruction = 0x%X, function = %s -> %s)",
-            currentStackFrame->m_ip, instruction, zen_Interpreter_getCurrentFunctionName(interpreter),
-            zen_Interpreter_getCurrentClassName(interpreter));
-        fflush(stdout);
+    while (true) {
+        ZEN_INTERPRETER_FETCH();
 
         switch (instruction) {
 
             /* No Operation */
 
-            case ZEN_BYTE_CODE_NOP: { /* nop */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_NOP) { /* nop */
                 /* Perform no operation. */
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `nop` (No operation was performed.)");
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
             /* Add */
 
-            case ZEN_BYTE_CODE_ADD_I: { /* add_i */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_ADD_I) { /* add_i */
                 /* Retrieve the second operand from the operand stack. */
-                int32_t operand2 = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand2 = ZEN_INTERPRETER_POP_INTEGER();
                 /* Retrieve the first operand from the operand stack. */
-                int32_t operand1 = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand1 = ZEN_INTERPRETER_POP_INTEGER();
                 /* Add the operands. Push the result on the operand stack. */
                 int32_t result = operand1 + operand2;
-                zen_OperandStack_pushInteger(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_INTEGER(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `add_i` (operand1 = %d, operand2 = %d, result = %d, operand stack = %d)",
-                    operand1, operand2, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand1, operand2, result, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_ADD_L: { /* add_l */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_ADD_L) { /* add_l */
                 /* Retrieve the second operand from the operand stack. */
-                int64_t operand2 = zen_OperandStack_popLong(currentStackFrame->m_operandStack);
+                int64_t operand2 = ZEN_INTERPRETER_POP_LONG();
                 /* Retrieve the first operand from the operand stack. */
-                int64_t operand1 = zen_OperandStack_popLong(currentStackFrame->m_operandStack);
+                int64_t operand1 = ZEN_INTERPRETER_POP_LONG();
                 /* Add the operands. Push the result on the operand stack. */
                 int64_t result = operand1 + operand2;
-                zen_OperandStack_pushLong(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_LONG(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `add_l` (operand1 = %l, operand2 = %l, result = %l, operand stack = %d)",
-                    operand1, operand2, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand1, operand2, result, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_ADD_F: { /* add_f */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_ADD_F) { /* add_f */
                 /* Retrieve the second operand from the operand stack. */
-                float operand2 = zen_OperandStack_popFloat(currentStackFrame->m_operandStack);
+                float operand2 = ZEN_INTERPRETER_POP_FLOAT();
                 /* Retrieve the first operand from the operand stack. */
-                float operand1 = zen_OperandStack_popFloat(currentStackFrame->m_operandStack);
+                float operand1 = ZEN_INTERPRETER_POP_FLOAT();
                 /* Add the operands. Push the result on the operand stack. */
                 float result = operand1 + operand2;
-                zen_OperandStack_pushFloat(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_FLOAT(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `add_f` (operand1 = %f, operand2 = %f, result = %f, operand stack = %d)",
-                    operand1, operand2, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand1, operand2, result, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_ADD_D: { /* add_d */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_ADD_D) { /* add_d */
                 /* Retrieve the second operand from the operand stack. */
-                double operand2 = zen_OperandStack_popDouble(currentStackFrame->m_operandStack);
+                double operand2 = ZEN_INTERPRETER_POP_DOUBLE();
                 /* Retrieve the first operand from the operand stack. */
-                double operand1 = zen_OperandStack_popDouble(currentStackFrame->m_operandStack);
+                double operand1 = ZEN_INTERPRETER_POP_DOUBLE();
                 /* Add the operands. Push the result on the operand stack. */
                 float result = operand1 + operand2;
-                zen_OperandStack_pushDouble(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_DOUBLE(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `add_d` (operand1 = %f, operand2 = %f, result = %f, operand stack = %d)",
-                    operand1, operand2, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand1, operand2, result, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
             /* Bitwise AND */
 
-            case ZEN_BYTE_CODE_AND_I: { /* and_i */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_AND_I) { /* and_i */
                 /* Retrieve the second operand from the operand stack. */
-                int32_t operand2 = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand2 = ZEN_INTERPRETER_POP_INTEGER();
                 /* Retrieve the first operand from the operand stack. */
-                int32_t operand1 = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand1 = ZEN_INTERPRETER_POP_INTEGER();
                 /* Perform bitwise AND on the operands. Push the result on the
                  * operand stack.
                  */
                 int32_t result = operand1 & operand2;
-                zen_OperandStack_pushInteger(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_INTEGER(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `and_i` (operand1 = %d, operand2 = %d, result = %d, operand stack = %d)",
-                    operand1, operand2, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand1, operand2, result, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_AND_L: { /* and_l */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_AND_L) { /* and_l */
                 /* Retrieve the second operand from the operand stack. */
-                int64_t operand2 = zen_OperandStack_popLong(currentStackFrame->m_operandStack);
+                int64_t operand2 = ZEN_INTERPRETER_POP_LONG();
                 /* Retrieve the first operand from the operand stack. */
-                int64_t operand1 = zen_OperandStack_popLong(currentStackFrame->m_operandStack);
+                int64_t operand1 = ZEN_INTERPRETER_POP_LONG();
                 /* Perform bitwise AND on the operands. Push the result on the
                  * operand stack.
                  */
                 int64_t result = operand1 & operand2;
-                zen_OperandStack_pushLong(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_LONG(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `and_l` (operand1 = %l, operand2 = %l, result = %l, operand stack = %d)",
-                    operand1, operand2, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand1, operand2, result, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
             /* Bitwise OR */
 
-            case ZEN_BYTE_CODE_OR_I: { /* or_i */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_OR_I) { /* or_i */
                 /* Retrieve the second operand from the operand stack. */
-                int32_t operand2 = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand2 = ZEN_INTERPRETER_POP_INTEGER();
                 /* Retrieve the first operand from the operand stack. */
-                int32_t operand1 = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand1 = ZEN_INTERPRETER_POP_INTEGER();
                 /* Perform bitwise OR on the operands. Push the result on the
                  * operand stack.
                  */
                 int32_t result = operand1 | operand2;
-                zen_OperandStack_pushInteger(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_INTEGER(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `or_i` (operand1 = %d, operand2 = %d, result = %d, operand stack = %d)",
-                    operand1, operand2, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand1, operand2, result, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_OR_L: { /* or_l */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_OR_L) { /* or_l */
                 /* Retrieve the second operand from the operand stack. */
-                int64_t operand2 = zen_OperandStack_popLong(currentStackFrame->m_operandStack);
+                int64_t operand2 = ZEN_INTERPRETER_POP_LONG();
                 /* Retrieve the first operand from the operand stack. */
-                int64_t operand1 = zen_OperandStack_popLong(currentStackFrame->m_operandStack);
+                int64_t operand1 = ZEN_INTERPRETER_POP_LONG();
                 /* Perform bitwise OR on the operands. Push the result on the
                  * operand stack.
                  */
                 int64_t result = operand1 | operand2;
-                zen_OperandStack_pushLong(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_LONG(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `or_l` (operand1 = %l, operand2 = %l, result = %l, operand stack = %d)",
-                    operand1, operand2, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand1, operand2, result, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
             /* Bitwise Shift */
 
-            case ZEN_BYTE_CODE_SHIFT_LEFT_I: { /* shift_left_i */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_SHIFT_LEFT_I) { /* shift_left_i */
                 /* Retrieve the second operand from the operand stack. */
-                int32_t operand2 = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand2 = ZEN_INTERPRETER_POP_INTEGER();
                 /* Retrieve the first operand from the operand stack. */
-                int32_t operand1 = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand1 = ZEN_INTERPRETER_POP_INTEGER();
                 /* Shift the least significant bit (LSB) of the first operand
                  * towards left, as specified by the second operand. Push the
                  * result on the operand stack.
@@ -368,20 +839,20 @@ void zen_Interpreter_interpret(zen_Interpreter_t* interpreter) {
                  * inclusively.
                  */
                 int32_t result = operand1 << (operand2 & 0x1F);
-                zen_OperandStack_pushInteger(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_INTEGER(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `shift_left_l` (operand1 = %d, operand2 = %d, result = %d, operand stack = %d)",
-                    operand1, operand2, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand1, operand2, result, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_SHIFT_LEFT_L: { /* shift_left_l */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_SHIFT_LEFT_L) { /* shift_left_l */
                 /* Retrieve the second operand from the operand stack. */
-                int64_t operand2 = zen_OperandStack_popLong(currentStackFrame->m_operandStack);
+                int64_t operand2 = ZEN_INTERPRETER_POP_LONG();
                 /* Retrieve the first operand from the operand stack. */
-                int64_t operand1 = zen_OperandStack_popLong(currentStackFrame->m_operandStack);
+                int64_t operand1 = ZEN_INTERPRETER_POP_LONG();
                 /* Shift the least significant bit (LSB) of the first operand
                  * towards left, as specified by the second operand. Push the
                  * result on the operand stack.
@@ -391,20 +862,20 @@ void zen_Interpreter_interpret(zen_Interpreter_t* interpreter) {
                  * inclusively.
                  */
                 int64_t result = operand1 << (operand2 & 0x3FL);
-                zen_OperandStack_pushLong(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_LONG(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `shift_left_l` (operand1 = %l, operand2 = %l, result = %l, operand stack = %d)",
-                    operand1, operand2, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand1, operand2, result, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_SHIFT_RIGHT_I: { /* shift_right_i */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_SHIFT_RIGHT_I) { /* shift_right_i */
                 /* Retrieve the second operand from the operand stack. */
-                int32_t operand2 = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand2 = ZEN_INTERPRETER_POP_INTEGER();
                 /* Retrieve the first operand from the operand stack. */
-                int32_t operand1 = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand1 = ZEN_INTERPRETER_POP_INTEGER();
                 /* Shift the most significant bit (MSB) of the first operand
                  * towards right, as specified by the second operand. Push the
                  * result on the operand stack.
@@ -414,20 +885,20 @@ void zen_Interpreter_interpret(zen_Interpreter_t* interpreter) {
                  * inclusively.
                  */
                 int32_t result = operand1 >> (operand2 & 0x1F);
-                zen_OperandStack_pushInteger(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_INTEGER(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `shift_right_i` (operand1 = %d, operand2 = %d, result = %d, operand stack = %d)",
-                    operand1, operand2, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand1, operand2, result, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_SHIFT_RIGHT_L: { /* shift_right_l */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_SHIFT_RIGHT_L) { /* shift_right_l */
                 /* Retrieve the second operand from the operand stack. */
-                int64_t operand2 = zen_OperandStack_popLong(currentStackFrame->m_operandStack);
+                int64_t operand2 = ZEN_INTERPRETER_POP_LONG();
                 /* Retrieve the first operand from the operand stack. */
-                int64_t operand1 = zen_OperandStack_popLong(currentStackFrame->m_operandStack);
+                int64_t operand1 = ZEN_INTERPRETER_POP_LONG();
                 /* Shift the most significant bit (MSB) of the first operand
                  * towards right, as specified by the second operand. Push the
                  * result on the operand stack.
@@ -437,20 +908,20 @@ void zen_Interpreter_interpret(zen_Interpreter_t* interpreter) {
                  * inclusively.
                  */
                 int64_t result = operand1 >> (operand2 & 0x3FL);
-                zen_OperandStack_pushLong(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_LONG(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `shift_right_l` (operand1 = %l, operand2 = %l, result = %l, operand stack = %d)",
-                    operand1, operand2, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand1, operand2, result, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_SHIFT_RIGHT_UI: { /* shift_right_ui */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_SHIFT_RIGHT_UI) { /* shift_right_ui */
                 /* Retrieve the second operand from the operand stack. */
-                int32_t operand2 = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand2 = ZEN_INTERPRETER_POP_INTEGER();
                 /* Retrieve the first operand from the operand stack. */
-                uint32_t operand1 = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                uint32_t operand1 = ZEN_INTERPRETER_POP_INTEGER();
                 /* Shift the most significant bit (MSB) of the first operand
                  * towards right, as specified by the second operand. Push the
                  * result on the operand stack.
@@ -460,20 +931,20 @@ void zen_Interpreter_interpret(zen_Interpreter_t* interpreter) {
                  * inclusively.
                  */
                 int32_t result = operand1 >> (operand2 & 0x1F);
-                zen_OperandStack_pushInteger(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_INTEGER(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `shift_right_ui` (operand1 = %u, operand2 = %d, result = %d, operand stack = %d)",
-                    operand1, operand2, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand1, operand2, result, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_SHIFT_RIGHT_UL: { /* shift_right_ul */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_SHIFT_RIGHT_UL) { /* shift_right_ul */
                 /* Retrieve the second operand from the operand stack. */
-                int64_t operand2 = zen_OperandStack_popLong(currentStackFrame->m_operandStack);
+                int64_t operand2 = ZEN_INTERPRETER_POP_LONG();
                 /* Retrieve the first operand from the operand stack. */
-                uint64_t operand1 = zen_OperandStack_popLong(currentStackFrame->m_operandStack);
+                uint64_t operand1 = ZEN_INTERPRETER_POP_LONG();
                 /* Shift the most significant bit (MSB) of the first operand
                  * towards right, as specified by the second operand. Push the
                  * result on the operand stack.
@@ -483,321 +954,327 @@ void zen_Interpreter_interpret(zen_Interpreter_t* interpreter) {
                  * inclusively.
                  */
                 int64_t result = operand1 >> (operand2 & 0x3FL);
-                zen_OperandStack_pushLong(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_LONG(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `shift_right_ul` (operand1 = %l, operand2 = %l, result = %l, operand stack = %d)",
-                    operand1, operand2, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand1, operand2, result, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
             /* Bitwise XOR */
 
-            case ZEN_BYTE_CODE_XOR_I: { /* xor_i */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_XOR_I) { /* xor_i */
                 /* Retrieve the second operand from the operand stack. */
-                int32_t operand2 = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand2 = ZEN_INTERPRETER_POP_INTEGER();
                 /* Retrieve the first operand from the operand stack. */
-                int32_t operand1 = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand1 = ZEN_INTERPRETER_POP_INTEGER();
                 /* Perform bitwise XOR on the operands. Push the result on the
                  * operand stack.
                  */
                 int32_t result = operand1 ^ operand2;
-                zen_OperandStack_pushInteger(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_INTEGER(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `xor_i` (operand1 = %d, operand2 = %d, result = %d, operand stack = %d)",
-                    operand1, operand2, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand1, operand2, result, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_XOR_L: { /* xor_l */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_XOR_L) { /* xor_l */
                 /* Retrieve the second operand from the operand stack. */
-                int64_t operand2 = zen_OperandStack_popLong(currentStackFrame->m_operandStack);
+                int64_t operand2 = ZEN_INTERPRETER_POP_LONG();
                 /* Retrieve the first operand from the operand stack. */
-                int64_t operand1 = zen_OperandStack_popLong(currentStackFrame->m_operandStack);
+                int64_t operand1 = ZEN_INTERPRETER_POP_LONG();
                 /* Perform bitwise XOR on the operands. Push the result on the
                  * operand stack.
                  */
                 int64_t result = operand1 ^ operand2;
-                zen_OperandStack_pushLong(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_LONG(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `xor_l` (operand1 = %l, operand2 = %l, result = %l, operand stack = %d)",
-                    operand1, operand2, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand1, operand2, result, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
             /* Cast */
 
-            case ZEN_BYTE_CODE_CAST_ITL: { /* cast_itl */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_CAST_ITL) { /* cast_itl */
                 /* Retrieve the operand from the operand stack. */
-                int32_t operand = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand = ZEN_INTERPRETER_POP_INTEGER();
                 /* Cast the operand from 32-bit integer to 64-bit integer. Push
                  * the result on the operand stack.
                  */
                 int64_t result = (int64_t)operand;
-                zen_OperandStack_pushLong(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_LONG(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `cast_itl` (operand = %d, result = %l, operand stack = %d)",
-                    operand, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, result, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_CAST_ITF: { /* cast_itf */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_CAST_ITF) { /* cast_itf */
                 /* Retrieve the operand from the operand stack. */
-                int32_t operand = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand = ZEN_INTERPRETER_POP_INTEGER();
                 /* Cast the operand from 32-bit integer to 32-bit decimal. Push
                  * the result on the operand stack.
                  */
                 float result = (float)operand;
-                zen_OperandStack_pushFloat(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_FLOAT(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `cast_itf` (operand = %d, result = %f, operand stack = %d)",
-                    operand, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, result, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_CAST_ITD: { /* cast_itd */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_CAST_ITD) { /* cast_itd */
                 /* Retrieve the operand from the operand stack. */
-                int32_t operand = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand = ZEN_INTERPRETER_POP_INTEGER();
                 /* Cast the operand from 32-bit integer to 64-bit decimal. Push
                  * the result on the operand stack.
                  */
                 double result = (double)operand;
-                zen_OperandStack_pushDouble(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_DOUBLE(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `cast_itd` (operand = %d, result = %f, operand stack = %d)",
-                    operand, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, result, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_CAST_LTI: { /* cast_lti */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_CAST_LTI) { /* cast_lti */
                 /* Retrieve the operand from the operand stack. */
-                int64_t operand = zen_OperandStack_popLong(currentStackFrame->m_operandStack);
+                int64_t operand = ZEN_INTERPRETER_POP_LONG();
                 /* Cast the operand from 64-bit integer to 32-bit integer. Push
                  * the result on the operand stack.
                  */
                 int32_t result = (int32_t)operand;
-                zen_OperandStack_pushInteger(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_INTEGER(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `cast_lti` (operand = %l, result = %i, operand stack = %d)",
-                    operand, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, result, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_CAST_LTF: { /* cast_ltf */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_CAST_LTF) { /* cast_ltf */
                 /* Retrieve the operand from the operand stack. */
-                int64_t operand = zen_OperandStack_popLong(currentStackFrame->m_operandStack);
+                int64_t operand = ZEN_INTERPRETER_POP_LONG();
                 /* Cast the operand from 64-bit integer to 32-bit decimal. Push
                  * the result on the operand stack.
                  */
                 float result = (float)operand;
-                zen_OperandStack_pushFloat(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_FLOAT(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `cast_ltf` (operand = %l, result = %f, operand stack = %d)",
-                    operand, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, result, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_CAST_LTD: { /* cast_ltd */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_CAST_LTD) { /* cast_ltd */
                 /* Retrieve the operand from the operand stack. */
-                int64_t operand = zen_OperandStack_popLong(currentStackFrame->m_operandStack);
+                int64_t operand = ZEN_INTERPRETER_POP_LONG();
                 /* Cast the operand from 64-bit integer to 64-bit decimal. Push
                  * the result on the operand stack.
                  */
                 double result = (double)operand;
-                zen_OperandStack_pushDouble(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_DOUBLE(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `cast_ltd` (operand = %l, result = %f, operand stack = %d)",
-                    operand, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, result, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_CAST_FTI: { /* cast_fti */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_CAST_FTI) { /* cast_fti */
                 /* Retrieve the operand from the operand stack. */
-                float operand = zen_OperandStack_popFloat(currentStackFrame->m_operandStack);
+                float operand = ZEN_INTERPRETER_POP_FLOAT();
                 /* Cast the operand from 32-bit decimal to 32-bit integer. Push
                  * the result on the operand stack.
                  */
                 int32_t result = (int32_t)operand;
-                zen_OperandStack_pushInteger(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_INTEGER(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `cast_fti` (operand = %f, result = %d, operand stack = %d)",
-                    operand, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, result, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_CAST_FTL: { /* cast_ftl */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_CAST_FTL) { /* cast_ftl */
                 /* Retrieve the operand from the operand stack. */
-                float operand = zen_OperandStack_popFloat(currentStackFrame->m_operandStack);
+                float operand = ZEN_INTERPRETER_POP_FLOAT();
                 /* Cast the operand from 32-bit decimal to 64-bit integer. Push
                  * the result on the operand stack.
                  */
                 int64_t result = (int64_t)operand;
-                zen_OperandStack_pushLong(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_LONG(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `cast_ftl` (operand = %f, result = %l, operand stack = %d)",
-                    operand, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, result, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_CAST_FTD: { /* cast_ftd */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_CAST_FTD) { /* cast_ftd */
                 /* Retrieve the operand from the operand stack. */
-                float operand = zen_OperandStack_popFloat(currentStackFrame->m_operandStack);
+                float operand = ZEN_INTERPRETER_POP_FLOAT();
                 /* Cast the operand from 32-bit decimal to 64-bit decimal. Push
                  * the result on the operand stack.
                  */
                 double result = (double)operand;
-                zen_OperandStack_pushDouble(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_DOUBLE(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `cast_ftd` (operand = %f, result = %f, operand stack = %d)",
-                    operand, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, result, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_CAST_DTI: { /* cast_dti */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_CAST_DTI) { /* cast_dti */
                 /* Retrieve the operand from the operand stack. */
-                double operand = zen_OperandStack_popDouble(currentStackFrame->m_operandStack);
+                double operand = ZEN_INTERPRETER_POP_DOUBLE();
                 /* Cast the operand from 64-bit decimal to 32-bit integer. Push
                  * the result on the operand stack.
                  */
                 int32_t result = (int32_t)operand;
-                zen_OperandStack_pushInteger(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_INTEGER(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `cast_dti` (operand = %f, result = %i, operand stack = %d)",
-                    operand, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, result, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_CAST_DTL: { /* cast_dtl */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_CAST_DTL) { /* cast_dtl */
                 /* Retrieve the operand from the operand stack. */
-                double operand = zen_OperandStack_popDouble(currentStackFrame->m_operandStack);
+                double operand = ZEN_INTERPRETER_POP_DOUBLE();
                 /* Cast the operand from 64-bit decimal to 64-bit integer. Push
                  * the result on the operand stack.
                  */
                 int64_t result = (int64_t)operand;
-                zen_OperandStack_pushLong(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_LONG(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `cast_dtl` (operand = %f, result = %l, operand stack = %d)",
-                    operand, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, result, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_CAST_DTF: { /* cast_dtf */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_CAST_DTF) { /* cast_dtf */
                 /* Retrieve the operand from the operand stack. */
-                double operand = zen_OperandStack_popDouble(currentStackFrame->m_operandStack);
+                double operand = ZEN_INTERPRETER_POP_DOUBLE();
                 /* Cast the operand from 64-bit decimal to 32-bit decimal. Push
                  * the result on the operand stack.
                  */
                 float result = (float)operand;
-                zen_OperandStack_pushFloat(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_FLOAT(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `cast_dtf` (operand = %f, result = %f, operand stack = %d)",
-                    operand, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, result, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_CAST_ITB: { /* cast_itb */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_CAST_ITB) { /* cast_itb */
                 /* Retrieve the operand from the operand stack. */
-                int32_t operand = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand = ZEN_INTERPRETER_POP_INTEGER();
                 /* Cast the operand from 32-bit integer to 8-bit integer. Push
                  * the result on the operand stack.
                  */
                 int8_t result = (int8_t)operand;
-                zen_OperandStack_pushInteger(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_INTEGER(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `cast_itb` (operand = %d, result = %d, operand stack = %d)",
-                    operand, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, result, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_CAST_ITC: { /* cast_itc */
-                break;
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_CAST_ITC) { /* cast_itc */
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_CAST_ITS: { /* cast_its */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_CAST_ITS) { /* cast_its */
                 /* Retrieve the operand from the operand stack. */
-                int32_t operand = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand = ZEN_INTERPRETER_POP_INTEGER();
                 /* Cast the operand from 32-bit integer to 16-bit integer. Push
                  * the result on the operand stack.
                  */
                 int16_t result = (int16_t)operand;
-                zen_OperandStack_pushInteger(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_INTEGER(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `cast_its` (operand = %d, result = %d, operand stack = %d)",
-                    operand, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, result, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
             /* Check Cast */
 
-            case ZEN_BYTE_CODE_CHECK_CAST: { /* check_cast */
-                uint16_t index = (((uint16_t)instructions[currentStackFrame->m_ip++] << 8) | (uint16_t)instructions[currentStackFrame->m_ip++]);
-            /*
-                zen_Object_t* object = zen_OperandStack_peekReference(currentStackFrame->m_operandStack);
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_CHECK_CAST) { /* check_cast */
+                uint16_t index = ZEN_INTERPRETER_READ_SHORT();
+                /* The object is left on the operand stack. A null reference
+                 * can be cast to any class.
+                 */
+                zen_Object_t* object = (zen_Object_t*)ZEN_INTERPRETER_PEEK_REFERENCE();
                 if (object != NULL) {
-                    zen_Class_t* targetClass = NULL; //zen_ConstantPool_resolveClass(constantPool, function, index);
-                    if (jtk_ProcessorThread_hasException(thread)) {
-                        goto exceptionHandler;
+                    /* The class is looked up only when the instruction is
+                     * executed for the first time.
+                     */
+                    zen_Class_t* targetClass = currentStackFrame->m_class->m_resolvedEntries[index].m_class;
+                    if (targetClass == NULL) {
+                        ZEN_INTERPRETER_SAVE_STATE();
+                        targetClass = zen_Class_resolveClass(interpreter->m_virtualMachine,
+                            currentStackFrame->m_class, index);
+                        if ((interpreter->m_state & ZEN_INTERPRETER_STATE_EXCEPTION_THROWN) != 0) {
+                            goto handleException;
+                        }
                     }
 
-                    if (!zen_Object_isInstance(object, targetClass)) {
-                        const uint8_t* objectClassName = zen_Class_getName(zen_Object_getClass(object));
-                        const uint8_t* targetClassName = zen_Class_getName(targetClass);
-                        zen_Object_t* exception = zen_Interpreter_makeException(interpreter, ZEN_BOOTSTRAP_CLASS_ZEN_CORE_INVALID_CAST_EXCEPTION,
-                            "Cannot cast instance of `%s` to `%s`", objectClassName, targetClassName);
-                        jtk_ProcessorThread_setException(thread, exception);
-
-                        goto exceptionHandler;
+                    if ((targetClass == NULL) || !zen_Class_isSubclass(
+                        zen_Object_getClass(interpreter->m_virtualMachine, object), targetClass)) {
+                        ZEN_INTERPRETER_SAVE_STATE();
+                        zen_VirtualMachine_raiseClassCastException(interpreter->m_virtualMachine);
+                        goto handleException;
                     }
                 }
-                */
 
                 /* Log debugging information for assistance in debugging the interpreter. */
-                //jtk_Logger_debug(logger, "Executed instruction `check_cast` (operand = 0x%X, result = 0x%X, operand stack = %d)",
-                //    object, object, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                jtk_Logger_debug(logger, "Executed instruction `check_cast` (index = %d, operand = 0x%X, operand stack = %d)",
+                    index, object, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
             /* Compare */
 
-            case ZEN_BYTE_CODE_COMPARE_L: { /* compare_l */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_COMPARE_L) { /* compare_l */
                 /* Retrieve the second operand from the operand stack. */
-                int64_t operand2 = zen_OperandStack_popLong(currentStackFrame->m_operandStack);
+                int64_t operand2 = ZEN_INTERPRETER_POP_LONG();
                 /* Retrieve the first operand from the operand stack. */
-                int64_t operand1 = zen_OperandStack_popLong(currentStackFrame->m_operandStack);
+                int64_t operand1 = ZEN_INTERPRETER_POP_LONG();
                 /* Compare the operands. Push the result on the operand stack.
                  * -> 1 indicates that the first operand is greater than the second
                  *    operand.
@@ -807,20 +1284,20 @@ void zen_Interpreter_interpret(zen_Interpreter_t* interpreter) {
                  *    operand.
                  */
                 int32_t result = (operand1 > operand2)? 1 : ((operand1 == operand2)? 0 : -1);
-                zen_OperandStack_pushInteger(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_INTEGER(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `compare_l` (operand1 = %l, operand2 = %l, result = %d, operand stack = %d)",
-                    operand1, operand2, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand1, operand2, result, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_COMPARE_LT_F: { /* compare_lt_f */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_COMPARE_LT_F) { /* compare_lt_f */
                 /* Retrieve the second operand from the operand stack. */
-                float operand2 = zen_OperandStack_popFloat(currentStackFrame->m_operandStack);
+                float operand2 = ZEN_INTERPRETER_POP_FLOAT();
                 /* Retrieve the first operand from the operand stack. */
-                float operand1 = zen_OperandStack_popFloat(currentStackFrame->m_operandStack);
+                float operand1 = ZEN_INTERPRETER_POP_FLOAT();
                 /* Compare the operands. Push the result on the operand stack.
                  * -> 1 indicates that the first operand is greater than the second
                  *    operand.
@@ -846,20 +1323,20 @@ void zen_Interpreter_interpret(zen_Interpreter_t* interpreter) {
                 else {
                     // jtk_Logger_error(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Control should not reach here!");
                 }
-                zen_OperandStack_pushInteger(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_INTEGER(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `compare_lt_f` (operand1 = %f, operand2 = %f, result = %d, operand stack = %d)",
-                    operand1, operand2, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand1, operand2, result, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_COMPARE_GT_F: { /* compare_gt_f */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_COMPARE_GT_F) { /* compare_gt_f */
                 /* Retrieve the second operand from the operand stack. */
-                float operand2 = zen_OperandStack_popFloat(currentStackFrame->m_operandStack);
+                float operand2 = ZEN_INTERPRETER_POP_FLOAT();
                 /* Retrieve the first operand from the operand stack. */
-                float operand1 = zen_OperandStack_popFloat(currentStackFrame->m_operandStack);
+                float operand1 = ZEN_INTERPRETER_POP_FLOAT();
                 /* Compare the operands. Push the result on the operand stack.
                  * -> 1 indicates that the first operand is greater than the second
                  *    operand.
@@ -885,20 +1362,20 @@ void zen_Interpreter_interpret(zen_Interpreter_t* interpreter) {
                 else {
                     // jtk_Logger_error(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Control should not reach here!");
                 }
-                zen_OperandStack_pushInteger(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_INTEGER(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `compare_gt_f` (operand1 = %f, operand2 = %f, result = %d, operand stack = %d)",
-                    operand1, operand2, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand1, operand2, result, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_COMPARE_LT_D: { /* compare_lt_d */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_COMPARE_LT_D) { /* compare_lt_d */
                 /* Retrieve the second operand from the operand stack. */
-                double operand2 = zen_OperandStack_popDouble(currentStackFrame->m_operandStack);
+                double operand2 = ZEN_INTERPRETER_POP_DOUBLE();
                 /* Retrieve the first operand from the operand stack. */
-                double operand1 = zen_OperandStack_popDouble(currentStackFrame->m_operandStack);
+                double operand1 = ZEN_INTERPRETER_POP_DOUBLE();
                 /* Compare the operands. Push the result on the operand stack.
                  * -> 1 indicates that the first operand is greater than the second
                  *    operand.
@@ -924,20 +1401,20 @@ void zen_Interpreter_interpret(zen_Interpreter_t* interpreter) {
                 else {
                     // jtk_Logger_error(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Control should not reach here!");
                 }
-                zen_OperandStack_pushInteger(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_INTEGER(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `compare_lt_d` (operand1 = %f, operand2 = %f, result = %d, operand stack = %d)",
-                    operand1, operand2, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand1, operand2, result, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_COMPARE_GT_D: { /* compare_gt_d */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_COMPARE_GT_D) { /* compare_gt_d */
                 /* Retrieve the second operand from the operand stack. */
-                double operand2 = zen_OperandStack_popDouble(currentStackFrame->m_operandStack);
+                double operand2 = ZEN_INTERPRETER_POP_DOUBLE();
                 /* Retrieve the first operand from the operand stack. */
-                double operand1 = zen_OperandStack_popDouble(currentStackFrame->m_operandStack);
+                double operand1 = ZEN_INTERPRETER_POP_DOUBLE();
                 /* Compare the operands. Push the result on the operand stack.
                  * -> 1 indicates that the first operand is greater than the second
                  *    operand.
@@ -963,22 +1440,22 @@ void zen_Interpreter_interpret(zen_Interpreter_t* interpreter) {
                 else {
                     // jtk_Logger_error(interpreter->m_logger, ZEN_INTERPRETER_TAG, "Control should not reach here!");
                 }
-                zen_OperandStack_pushInteger(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_INTEGER(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `compare_gt_f` (operand1 = %f, operand2 = %f, result = %d, operand stack = %d)",
-                    operand1, operand2, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand1, operand2, result, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
             /* Divide */
 
-            case ZEN_BYTE_CODE_DIVIDE_I: { /* divide_i */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_DIVIDE_I) { /* divide_i */
                 /* Retrieve the second operand from the operand stack. */
-                int32_t operand2 = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand2 = ZEN_INTERPRETER_POP_INTEGER();
                 /* Retrieve the first operand from the operand stack. */
-                int32_t operand1 = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand1 = ZEN_INTERPRETER_POP_INTEGER();
 
                 int32_t result = -1;
                 if (operand2 == 0) {
@@ -992,21 +1469,21 @@ void zen_Interpreter_interpret(zen_Interpreter_t* interpreter) {
                 else {
                     /* Divide the operands. Push the result on the operand stack. */
                     result = operand1 / operand2;
-                    zen_OperandStack_pushInteger(currentStackFrame->m_operandStack, result);
+                    ZEN_INTERPRETER_PUSH_INTEGER(result);
                 }
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `divide_i` (operand1 = %d, operand2 = %d, result = %d, operand stack = %d)",
-                    operand1, operand2, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand1, operand2, result, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_DIVIDE_L: { /* divide_l */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_DIVIDE_L) { /* divide_l */
                 /* Retrieve the second operand from the operand stack. */
-                int64_t operand2 = zen_OperandStack_popLong(currentStackFrame->m_operandStack);
+                int64_t operand2 = ZEN_INTERPRETER_POP_LONG();
                 /* Retrieve the first operand from the operand stack. */
-                int64_t operand1 = zen_OperandStack_popLong(currentStackFrame->m_operandStack);
+                int64_t operand1 = ZEN_INTERPRETER_POP_LONG();
 
                 int64_t result = -1;
                 if (operand2 == 0L) {
@@ -1020,138 +1497,148 @@ void zen_Interpreter_interpret(zen_Interpreter_t* interpreter) {
                 else {
                     /* Divide the operands. Push the result on the operand stack. */
                     result = operand1 / operand2;
-                    zen_OperandStack_pushLong(currentStackFrame->m_operandStack, result);
+                    ZEN_INTERPRETER_PUSH_LONG(result);
                 }
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `divide_l` (operand1 = %l, operand2 = %l, result = %l, operand stack = %d)",
-                    operand1, operand2, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand1, operand2, result, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_DIVIDE_F: { /* divide_f */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_DIVIDE_F) { /* divide_f */
                 /* Retrieve the second operand from the operand stack. */
-                float operand2 = zen_OperandStack_popFloat(currentStackFrame->m_operandStack);
+                float operand2 = ZEN_INTERPRETER_POP_FLOAT();
                 /* Retrieve the first operand from the operand stack. */
-                float operand1 = zen_OperandStack_popFloat(currentStackFrame->m_operandStack);
+                float operand1 = ZEN_INTERPRETER_POP_FLOAT();
                 /* Divide the operands. Push the result on the operand stack. */
                 float result = operand1 / operand2;
-                zen_OperandStack_pushFloat(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_FLOAT(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `divide_f` (operand1 = %f, operand2 = %f, result = %f, operand stack = %d)",
-                    operand1, operand2, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand1, operand2, result, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_DIVIDE_D: { /* divide_d */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_DIVIDE_D) { /* divide_d */
                 /* Retrieve the second operand from the operand stack. */
-                double operand2 = zen_OperandStack_popDouble(currentStackFrame->m_operandStack);
+                double operand2 = ZEN_INTERPRETER_POP_DOUBLE();
                 /* Retrieve the first operand from the operand stack. */
-                double operand1 = zen_OperandStack_popDouble(currentStackFrame->m_operandStack);
+                double operand1 = ZEN_INTERPRETER_POP_DOUBLE();
                 /* Divide the operands. Push the result on the operand stack. */
                 double result = operand1 / operand2;
-                zen_OperandStack_pushDouble(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_DOUBLE(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `divide_d` (operand1 = %f, operand2 = %f, result = %f, operand stack = %d)",
-                    operand1, operand2, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand1, operand2, result, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
             /* Duplicate */
 
-            case ZEN_BYTE_CODE_DUPLICATE: { /* duplicate */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_DUPLICATE) { /* duplicate */
                 /* Duplicate the operand on top of the stack. */
-                zen_OperandStack_duplicate(currentStackFrame->m_operandStack);
+                ZEN_INTERPRETER_DUPLICATE();
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `duplicate` (operand stack = %d)",
-                    zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_DUPLICATE_X1: { /* duplicate_x1 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_DUPLICATE_X1) { /* duplicate_x1 */
                 /* Duplicate the operand on top of the stack and insert it beneath the second
                  * operand.
                  */
-                zen_OperandStack_duplicateX1(currentStackFrame->m_operandStack);
+                ZEN_INTERPRETER_SAVE_STATE();
+                zen_OperandStack_duplicateX1(operandStack);
+                ZEN_INTERPRETER_LOAD_STATE();
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `duplicate_x1` (operand stack = %d)",
-                    zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_DUPLICATE_X2: { /* duplicate_x2 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_DUPLICATE_X2) { /* duplicate_x2 */
                 /* Duplicate the operand on top of the stack and insert it beneath the third
                  * operand.
                  */
-                zen_OperandStack_duplicateX2(currentStackFrame->m_operandStack);
+                ZEN_INTERPRETER_SAVE_STATE();
+                zen_OperandStack_duplicateX2(operandStack);
+                ZEN_INTERPRETER_LOAD_STATE();
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `duplicate_x2` (operand stack = %d)",
-                    zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_DUPLICATE2: { /* duplicate2 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_DUPLICATE2) { /* duplicate2 */
                 /* Duplicate the second operand from the top of the operand stack. */
-                zen_OperandStack_duplicate2(currentStackFrame->m_operandStack);
+                ZEN_INTERPRETER_SAVE_STATE();
+                zen_OperandStack_duplicate2(operandStack);
+                ZEN_INTERPRETER_LOAD_STATE();
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `duplicate2` (operand stack = %d)",
-                    zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_DUPLICATE2_X1: { /* duplicate2_x1 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_DUPLICATE2_X1) { /* duplicate2_x1 */
                 /* Duplicate the second operand from the top of the operand stack.
                  * Insert the duplicate beneath the third item.
                  */
-                zen_OperandStack_duplicate2X1(currentStackFrame->m_operandStack);
+                ZEN_INTERPRETER_SAVE_STATE();
+                zen_OperandStack_duplicate2X1(operandStack);
+                ZEN_INTERPRETER_LOAD_STATE();
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `duplicate2_x1` (operand stack = %d)",
-                    zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_DUPLICATE2_X2: { /* duplicate2_x2 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_DUPLICATE2_X2) { /* duplicate2_x2 */
                 /* Duplicate the second operand from the top of the operand stack.
                  * Insert the duplicate beneath the fourth item.
                  */
-                zen_OperandStack_duplicate2X2(currentStackFrame->m_operandStack);
+                ZEN_INTERPRETER_SAVE_STATE();
+                zen_OperandStack_duplicate2X2(operandStack);
+                ZEN_INTERPRETER_LOAD_STATE();
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `duplicate2_x2` (operand stack = %d)",
-                    zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
             /* Jump */
 
-            case ZEN_BYTE_CODE_JUMP_EQ0_I: { /* jump_eq0_i */
-                // int32_t operand = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_JUMP_EQ0_I) { /* jump_eq0_i */
+                // int32_t operand = ZEN_INTERPRETER_POP_INTEGER();
 
                 #warning    "TODO: 32-bit instruction is implemented as 64-bit instruction!"
-                int32_t operand = (int32_t)zen_OperandStack_popLong(currentStackFrame->m_operandStack);
+                int32_t operand = (int32_t)ZEN_INTERPRETER_POP_LONG();
 
                 if (operand == 0) {
-                    uint16_t offset = (((uint16_t)instructions[currentStackFrame->m_ip++] << 8) | (uint16_t)instructions[currentStackFrame->m_ip++]);
-                    currentStackFrame->m_ip = offset;
+                    uint16_t offset = ZEN_INTERPRETER_READ_SHORT();
+                    ZEN_INTERPRETER_BRANCH(offset);
                 }
                 else {
-                    currentStackFrame->m_ip += 2;
+                    ip += 2;
 
                     jtk_Logger_debug(logger, "Operand is %d, expected 0. Branch ignored.", operand);
                 }
@@ -1159,23 +1646,23 @@ void zen_Interpreter_interpret(zen_Interpreter_t* interpreter) {
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `jump_eq0_i` (operand = %d, expected = 0, operand stack = %d)",
-                    operand, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_JUMP_NE0_I: { /* jump_ne0_i */
-                // int32_t operand = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_JUMP_NE0_I) { /* jump_ne0_i */
+                // int32_t operand = ZEN_INTERPRETER_POP_INTEGER();
 
                 #warning    "TODO: 32-bit instruction is implemented as 64-bit instruction!"
-                int32_t operand = (int32_t)zen_OperandStack_popLong(currentStackFrame->m_operandStack);
+                int32_t operand = (int32_t)ZEN_INTERPRETER_POP_LONG();
 
                 if (operand != 0) {
-                    uint16_t offset = (((uint16_t)instructions[currentStackFrame->m_ip++] << 8) | (uint16_t)instructions[currentStackFrame->m_ip++]);
-                    currentStackFrame->m_ip = offset;
+                    uint16_t offset = ZEN_INTERPRETER_READ_SHORT();
+                    ZEN_INTERPRETER_BRANCH(offset);
                 }
                 else {
-                    currentStackFrame->m_ip += 2;
+                    ip += 2;
 
                     jtk_Logger_debug(logger, "Operand is %d, expected integer value other than 0. Branch ignored.",
                         operand);
@@ -1183,20 +1670,20 @@ void zen_Interpreter_interpret(zen_Interpreter_t* interpreter) {
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `jump_ne0_i` (operand = %d, expected != 0, operand stack = %d)",
-                    operand, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_JUMP_LT0_I: { /* jump_lt0_i */
-                int32_t operand = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_JUMP_LT0_I) { /* jump_lt0_i */
+                int32_t operand = ZEN_INTERPRETER_POP_INTEGER();
 
                 if (operand < 0) {
-                    uint16_t offset = (((uint16_t)instructions[currentStackFrame->m_ip++] << 8) | (uint16_t)instructions[currentStackFrame->m_ip++]);
-                    currentStackFrame->m_ip += offset - 3;
+                    uint16_t offset = ZEN_INTERPRETER_READ_SHORT();
+                    ZEN_INTERPRETER_BRANCH(ip + offset - 3);
                 }
                 else {
-                    currentStackFrame->m_ip += 2;
+                    ip += 2;
 
                     jtk_Logger_debug(logger, "Operand is %d, expected integer value lesser than 0. Branch ignored.",
                         operand);
@@ -1204,20 +1691,20 @@ void zen_Interpreter_interpret(zen_Interpreter_t* interpreter) {
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `jump_lt0_i` (operand = %d, expected < 0, operand stack = %d)",
-                    operand, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_JUMP_GT0_I: { /* jump_gt0_i */
-                int32_t operand = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_JUMP_GT0_I) { /* jump_gt0_i */
+                int32_t operand = ZEN_INTERPRETER_POP_INTEGER();
 
                 if (operand > 0) {
-                    uint16_t offset = (((uint16_t)instructions[currentStackFrame->m_ip++] << 8) | (uint16_t)instructions[currentStackFrame->m_ip++]);
-                    currentStackFrame->m_ip += offset - 3;
+                    uint16_t offset = ZEN_INTERPRETER_READ_SHORT();
+                    ZEN_INTERPRETER_BRANCH(ip + offset - 3);
                 }
                 else {
-                    currentStackFrame->m_ip += 2;
+                    ip += 2;
 
                     jtk_Logger_debug(logger, "Operand is %d, expected integer value greater than 0. Branch ignored.",
                         operand);
@@ -1225,20 +1712,20 @@ void zen_Interpreter_interpret(zen_Interpreter_t* interpreter) {
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `jump_gt0_i` (operand = %d, expected > 0, operand stack = %d)",
-                    operand, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_JUMP_LE0_I: { /* jump_le0_i */
-                int32_t operand = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_JUMP_LE0_I) { /* jump_le0_i */
+                int32_t operand = ZEN_INTERPRETER_POP_INTEGER();
 
                 if (operand <= 0) {
-                    uint16_t offset = (((uint16_t)instructions[currentStackFrame->m_ip++] << 8) | (uint16_t)instructions[currentStackFrame->m_ip++]);
-                    currentStackFrame->m_ip += offset - 3;
+                    uint16_t offset = ZEN_INTERPRETER_READ_SHORT();
+                    ZEN_INTERPRETER_BRANCH(ip + offset - 3);
                 }
                 else {
-                    currentStackFrame->m_ip += 2;
+                    ip += 2;
 
                     jtk_Logger_debug(logger, "Operand is %d, expected integer value lesser than or equal to 0. Branch ignored.",
                         operand);
@@ -1246,20 +1733,20 @@ void zen_Interpreter_interpret(zen_Interpreter_t* interpreter) {
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `jump_le0_i` (operand = %d, expected <= 0, operand stack = %d)",
-                    operand, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_JUMP_GE0_I: { /* jump_ge0_i */
-                int32_t operand = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_JUMP_GE0_I) { /* jump_ge0_i */
+                int32_t operand = ZEN_INTERPRETER_POP_INTEGER();
 
                 if (operand >= 0) {
-                    uint16_t offset = (((uint16_t)instructions[currentStackFrame->m_ip++] << 8) | (uint16_t)instructions[currentStackFrame->m_ip++]);
-                    currentStackFrame->m_ip += offset - 3;
+                    uint16_t offset = ZEN_INTERPRETER_READ_SHORT();
+                    ZEN_INTERPRETER_BRANCH(ip + offset - 3);
                 }
                 else {
-                    currentStackFrame->m_ip += 2;
+                    ip += 2;
 
                     jtk_Logger_debug(logger, "Operand is %d, expected integer value greater than or equal to 0. Branch ignored.",
                         operand);
@@ -1267,26 +1754,26 @@ void zen_Interpreter_interpret(zen_Interpreter_t* interpreter) {
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `jump_ge0_i` (operand = %d, expected >= 0, operand stack = %d)",
-                    operand, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_JUMP_EQ_I: { /* jump_eq_i */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_JUMP_EQ_I) { /* jump_eq_i */
                 /* Retrieve the second operand from the operand stack. */
-                int32_t operand2 = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand2 = ZEN_INTERPRETER_POP_INTEGER();
                 /* Retrieve the first operand from the operand stack. */
-                int32_t operand1 = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand1 = ZEN_INTERPRETER_POP_INTEGER();
 
                 if (operand1 == operand2) {
-                    int16_t offset = (((uint16_t)instructions[currentStackFrame->m_ip++] << 8) | (uint16_t)instructions[currentStackFrame->m_ip++]);
-                    currentStackFrame->m_ip += offset - 3;
+                    int16_t offset = ZEN_INTERPRETER_READ_SHORT();
+                    ZEN_INTERPRETER_BRANCH(ip + offset - 3);
 
                     jtk_Logger_debug(logger, "Operands are equal. Branch acknowledged, program counter adjusted accordingly.  (operand1 = %d, operand2 = %d, offset = %d)",
                         operand1, operand2, offset);
                 }
                 else {
-                    currentStackFrame->m_ip += 2;
+                    ip += 2;
 
                     jtk_Logger_debug(logger, "Operands are unequal. Branch ignored. (operand1 = %d, operand2 = %d)",
                         operand1, operand2);
@@ -1294,26 +1781,26 @@ void zen_Interpreter_interpret(zen_Interpreter_t* interpreter) {
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `jump_eq_i` (operand1 = %d, operand2 = %d, operand stack = %d)",
-                    operand1, operand2, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand1, operand2, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_JUMP_NE_I: { /* jump_ne_i */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_JUMP_NE_I) { /* jump_ne_i */
                 /* Retrieve the second operand from the operand stack. */
-                int32_t operand2 = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand2 = ZEN_INTERPRETER_POP_INTEGER();
                 /* Retrieve the first operand from the operand stack. */
-                int32_t operand1 = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand1 = ZEN_INTERPRETER_POP_INTEGER();
 
                 if (operand1 != operand2) {
-                    int16_t offset = (((uint16_t)instructions[currentStackFrame->m_ip++] << 8) | (uint16_t)instructions[currentStackFrame->m_ip++]);
-                    currentStackFrame->m_ip += offset - 3;
+                    int16_t offset = ZEN_INTERPRETER_READ_SHORT();
+                    ZEN_INTERPRETER_BRANCH(ip + offset - 3);
 
                     jtk_Logger_debug(logger, "Operands are unequal. Branch acknowledged, program counter adjusted accordingly.  (operand1 = %d, operand2 = %d, offset = %d)",
                         operand1, operand2, offset);
                 }
                 else {
-                    currentStackFrame->m_ip += 2;
+                    ip += 2;
 
                     jtk_Logger_debug(logger, "Operands are equal. Branch ignored. (operand1 = %d, operand2 = %d)",
                         operand1, operand2);
@@ -1321,26 +1808,26 @@ void zen_Interpreter_interpret(zen_Interpreter_t* interpreter) {
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `jump_ne_i` (operand1 = %d, operand2 = %d, operand stack = %d)",
-                    operand1, operand2, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand1, operand2, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_JUMP_LT_I: { /* jump_lt_i */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_JUMP_LT_I) { /* jump_lt_i */
                 /* Retrieve the second operand from the operand stack. */
-                int32_t operand2 = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand2 = ZEN_INTERPRETER_POP_INTEGER();
                 /* Retrieve the first operand from the operand stack. */
-                int32_t operand1 = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand1 = ZEN_INTERPRETER_POP_INTEGER();
 
                 if (operand1 < operand2) {
-                    int16_t offset = (((uint16_t)instructions[currentStackFrame->m_ip++] << 8) | (uint16_t)instructions[currentStackFrame->m_ip++]);
-                    currentStackFrame->m_ip += offset - 3;
+                    int16_t offset = ZEN_INTERPRETER_READ_SHORT();
+                    ZEN_INTERPRETER_BRANCH(ip + offset - 3);
 
                     jtk_Logger_debug(logger, "operand1 is lesser than operand2. Branch acknowledged, program counter adjusted accordingly.  (operand1 = %d, operand2 = %d, offset = %d)",
                         operand1, operand2, offset);
                 }
                 else {
-                    currentStackFrame->m_ip += 2;
+                    ip += 2;
 
                     jtk_Logger_debug(logger, "operand1 is not lesser than operand2. Branch ignored. (operand1 = %d, operand2 = %d)",
                         operand1, operand2);
@@ -1348,26 +1835,26 @@ void zen_Interpreter_interpret(zen_Interpreter_t* interpreter) {
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `jump_lt_i` (operand1 = %d, operand2 = %d, operand stack = %d)",
-                    operand1, operand2, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand1, operand2, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_JUMP_GT_I: { /* jump_gt_i */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_JUMP_GT_I) { /* jump_gt_i */
                 /* Retrieve the second operand from the operand stack. */
-                int32_t operand2 = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand2 = ZEN_INTERPRETER_POP_INTEGER();
                 /* Retrieve the first operand from the operand stack. */
-                int32_t operand1 = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand1 = ZEN_INTERPRETER_POP_INTEGER();
 
                 if (operand1 > operand2) {
-                    int16_t offset = (((uint16_t)instructions[currentStackFrame->m_ip++] << 8) | (uint16_t)instructions[currentStackFrame->m_ip++]);
-                    currentStackFrame->m_ip += offset - 3;
+                    int16_t offset = ZEN_INTERPRETER_READ_SHORT();
+                    ZEN_INTERPRETER_BRANCH(ip + offset - 3);
 
                     jtk_Logger_debug(logger, "operand1 is greater than operand2. Branch acknowledged, program counter adjusted accordingly.  (operand1 = %d, operand2 = %d, offset = %d)",
                         operand1, operand2, offset);
                 }
                 else {
-                    currentStackFrame->m_ip += 2;
+                    ip += 2;
 
                     jtk_Logger_debug(logger, "operand1 is not greater than operand2. Branch ignored. (operand1 = %d, operand2 = %d)",
                         operand1, operand2);
@@ -1375,26 +1862,26 @@ void zen_Interpreter_interpret(zen_Interpreter_t* interpreter) {
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `jump_gt_i` (operand1 = %d, operand2 = %d, operand stack = %d)",
-                    operand1, operand2, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand1, operand2, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_JUMP_LE_I: { /* jump_le_i */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_JUMP_LE_I) { /* jump_le_i */
                 /* Retrieve the second operand from the operand stack. */
-                int32_t operand2 = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand2 = ZEN_INTERPRETER_POP_INTEGER();
                 /* Retrieve the first operand from the operand stack. */
-                int32_t operand1 = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand1 = ZEN_INTERPRETER_POP_INTEGER();
 
                 if (operand1 <= operand2) {
-                    int16_t offset = (((uint16_t)instructions[currentStackFrame->m_ip++] << 8) | (uint16_t)instructions[currentStackFrame->m_ip++]);
-                    currentStackFrame->m_ip += offset - 3;
+                    int16_t offset = ZEN_INTERPRETER_READ_SHORT();
+                    ZEN_INTERPRETER_BRANCH(ip + offset - 3);
 
                     jtk_Logger_debug(logger, "operand1 is lesser than or equal to operand2. Branch acknowledged, program counter adjusted accordingly.  (operand1 = %d, operand2 = %d, offset = %d)",
                         operand1, operand2, offset);
                 }
                 else {
-                    currentStackFrame->m_ip += 2;
+                    ip += 2;
 
                     jtk_Logger_debug(logger, "operand1 is not lesser than or equal to operand2. Branch ignored. (operand1 = %d, operand2 = %d)",
                         operand1, operand2);
@@ -1402,26 +1889,26 @@ void zen_Interpreter_interpret(zen_Interpreter_t* interpreter) {
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `jump_le_i` (operand1 = %d, operand2 = %d, operand stack = %d)",
-                    operand1, operand2, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand1, operand2, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_JUMP_GE_I: { /* jump_ge_i */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_JUMP_GE_I) { /* jump_ge_i */
                 /* Retrieve the second operand from the operand stack. */
-                int32_t operand2 = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand2 = ZEN_INTERPRETER_POP_INTEGER();
                 /* Retrieve the first operand from the operand stack. */
-                int32_t operand1 = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand1 = ZEN_INTERPRETER_POP_INTEGER();
 
                 if (operand1 >= operand2) {
-                    int16_t offset = (((uint16_t)instructions[currentStackFrame->m_ip++] << 8) | (uint16_t)instructions[currentStackFrame->m_ip++]);
-                    currentStackFrame->m_ip += offset - 3;
+                    int16_t offset = ZEN_INTERPRETER_READ_SHORT();
+                    ZEN_INTERPRETER_BRANCH(ip + offset - 3);
 
                     jtk_Logger_debug(logger, "operand1 is greater than or equal to operand2. Branch acknowledged, program counter adjusted accordingly.  (operand1 = %d, operand2 = %d, offset = %d)",
                         operand1, operand2, offset);
                 }
                 else {
-                    currentStackFrame->m_ip += 2;
+                    ip += 2;
 
                     jtk_Logger_debug(logger, "operand1 is not greater than or equal to operand2. Branch ignored. (operand1 = %d, operand2 = %d)",
                         operand1, operand2);
@@ -1429,26 +1916,26 @@ void zen_Interpreter_interpret(zen_Interpreter_t* interpreter) {
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `jump_ge_i` (operand1 = %d, operand2 = %d, operand stack = %d)",
-                    operand1, operand2, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand1, operand2, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_JUMP_EQ_A: { /* jump_eq_a */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_JUMP_EQ_A) { /* jump_eq_a */
                 /* Retrieve the second operand from the operand stack. */
-                uintptr_t operand2 = zen_OperandStack_popReference(currentStackFrame->m_operandStack);
+                uintptr_t operand2 = ZEN_INTERPRETER_POP_REFERENCE();
                 /* Retrieve the first operand from the operand stack. */
-                uintptr_t operand1 = zen_OperandStack_popReference(currentStackFrame->m_operandStack);
+                uintptr_t operand1 = ZEN_INTERPRETER_POP_REFERENCE();
 
                 if (operand1 == operand2) {
-                    int16_t offset = (((uint16_t)instructions[currentStackFrame->m_ip++] << 8) | (uint16_t)instructions[currentStackFrame->m_ip++]);
-                    currentStackFrame->m_ip += offset - 3;
+                    int16_t offset = ZEN_INTERPRETER_READ_SHORT();
+                    ZEN_INTERPRETER_BRANCH(ip + offset - 3);
 
                     jtk_Logger_debug(logger, "Operands are equal. Branch acknowledged, program counter adjusted accordingly.  (operand1 = 0x%X, operand2 = 0x%X, offset = %d)",
                         operand1, operand2, offset);
                 }
                 else {
-                    currentStackFrame->m_ip += 2;
+                    ip += 2;
 
                     jtk_Logger_debug(logger, "Operands are unequal. Branch ignored. (operand1 = 0x%X, operand2 = 0x%X)",
                         operand1, operand2);
@@ -1456,26 +1943,26 @@ void zen_Interpreter_interpret(zen_Interpreter_t* interpreter) {
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `jump_eq_a` (operand1 = 0x%X, operand2 = 0x%X, operand stack = %d)",
-                    operand1, operand2, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand1, operand2, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_JUMP_NE_A: { /* jump_ne_a */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_JUMP_NE_A) { /* jump_ne_a */
                 /* Retrieve the second operand from the operand stack. */
-                uintptr_t operand2 = zen_OperandStack_popReference(currentStackFrame->m_operandStack);
+                uintptr_t operand2 = ZEN_INTERPRETER_POP_REFERENCE();
                 /* Retrieve the first operand from the operand stack. */
-                uintptr_t operand1 = zen_OperandStack_popReference(currentStackFrame->m_operandStack);
+                uintptr_t operand1 = ZEN_INTERPRETER_POP_REFERENCE();
 
                 if (operand1 != operand2) {
-                    int16_t offset = (((uint16_t)instructions[currentStackFrame->m_ip++] << 8) | (uint16_t)instructions[currentStackFrame->m_ip++]);
-                    currentStackFrame->m_ip += offset - 3;
+                    int16_t offset = ZEN_INTERPRETER_READ_SHORT();
+                    ZEN_INTERPRETER_BRANCH(ip + offset - 3);
 
                     jtk_Logger_debug(logger, "Operands are unequal. Branch acknowledged, program counter adjusted accordingly.  (operand1 = 0x%X, operand2 = 0x%X, offset = %d)",
                         operand1, operand2, offset);
                 }
                 else {
-                    currentStackFrame->m_ip += 2;
+                    ip += 2;
 
                     jtk_Logger_debug(logger, "Operands are equal. Branch ignored. (operand1 = 0x%X, operand2 = 0x%X)",
                         operand1, operand2);
@@ -1483,24 +1970,24 @@ void zen_Interpreter_interpret(zen_Interpreter_t* interpreter) {
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `jump_ne_a` (operand1 = 0x%X, operand2 = 0x%X, operand stack = %d)",
-                    operand1, operand2, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand1, operand2, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_JUMP_EQN_A: { /* jump_eqn_a */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_JUMP_EQN_A) { /* jump_eqn_a */
                 /* Retrieve the first operand from the operand stack. */
-                uintptr_t operand = zen_OperandStack_popReference(currentStackFrame->m_operandStack);
+                uintptr_t operand = ZEN_INTERPRETER_POP_REFERENCE();
 
                 if (operand == ZEN_INTERPRETER_NULL_REFERENCE) {
-                    int16_t offset = (((uint16_t)instructions[currentStackFrame->m_ip++] << 8) | (uint16_t)instructions[currentStackFrame->m_ip++]);
-                    currentStackFrame->m_ip += offset - 3;
+                    int16_t offset = ZEN_INTERPRETER_READ_SHORT();
+                    ZEN_INTERPRETER_BRANCH(ip + offset - 3);
 
                     jtk_Logger_debug(logger, "Operand is equal to null. Branch acknowledged, program counter adjusted accordingly.  (operand = 0x%X, offset = %d)",
                         operand, offset);
                 }
                 else {
-                    currentStackFrame->m_ip += 2;
+                    ip += 2;
 
                     jtk_Logger_debug(logger, "Operand is not equal to null. Branch ignored. (operand = 0x%X)",
                         operand);
@@ -1508,24 +1995,24 @@ void zen_Interpreter_interpret(zen_Interpreter_t* interpreter) {
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `jump_eqn_a` (operand = 0x%X, operand stack = %d)",
-                    operand, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_JUMP_NEN_A: { /* jump_nen_a */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_JUMP_NEN_A) { /* jump_nen_a */
                 /* Retrieve the first operand from the operand stack. */
-                uintptr_t operand = zen_OperandStack_popReference(currentStackFrame->m_operandStack);
+                uintptr_t operand = ZEN_INTERPRETER_POP_REFERENCE();
 
                 if (operand != ZEN_INTERPRETER_NULL_REFERENCE) {
-                    int16_t offset = (((uint16_t)instructions[currentStackFrame->m_ip++] << 8) | (uint16_t)instructions[currentStackFrame->m_ip++]);
-                    currentStackFrame->m_ip += offset - 3;
+                    int16_t offset = ZEN_INTERPRETER_READ_SHORT();
+                    ZEN_INTERPRETER_BRANCH(ip + offset - 3);
 
                     jtk_Logger_debug(logger, "Operand is not equal to null. Branch acknowledged, program counter adjusted accordingly.  (operand = 0x%X, offset = %d)",
                         operand, offset);
                 }
                 else {
-                    currentStackFrame->m_ip += 2;
+                    ip += 2;
 
                     jtk_Logger_debug(logger, "Operand is equal to null. Branch ignored. (operand = 0x%X)",
                         operand);
@@ -1533,60 +2020,82 @@ void zen_Interpreter_interpret(zen_Interpreter_t* interpreter) {
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `jump_nen_a` (operand = 0x%X, operand stack = %d)",
-                    operand, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
             /* Increment */
 
-            case ZEN_BYTE_CODE_INCREMENT_I: { /* increment_i */
-                break;
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_INCREMENT_I) { /* increment_i */
+                ZEN_INTERPRETER_DISPATCH();
             }
 
             /* Invoke */
 
-            case ZEN_BYTE_CODE_INVOKE_SPECIAL: { /* invoke_special */
-                uint16_t index = (((uint16_t)instructions[currentStackFrame->m_ip++] << 8) | (uint16_t)instructions[currentStackFrame->m_ip++]);
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_INVOKE_SPECIAL) { /* invoke_special */
+                ZEN_INTERPRETER_SAFEPOINT();
 
-                zen_EntityFile_t* entityFile = currentStackFrame->m_class->m_entityFile;
-                zen_ConstantPool_t* constantPool = &entityFile->m_constantPool;
-                zen_ConstantPoolFunction_t* constructorEntry =
-                    (zen_ConstantPoolFunction_t*)constantPool->m_entries[index];
-                zen_ConstantPoolUtf8_t* nameEntry = constantPool->m_entries[constructorEntry->m_nameIndex];
-                zen_ConstantPoolUtf8_t* descriptorEntry = constantPool->m_entries[constructorEntry->m_descriptorIndex];
-                zen_ConstantPoolClass_t* classEntry = constantPool->m_entries[constructorEntry->m_classIndex];
-                zen_ConstantPoolUtf8_t* classNameEntry = constantPool->m_entries[classEntry->m_nameIndex];
-
-                zen_Class_t* targetClass = zen_VirtualMachine_getClassEx(interpreter->m_virtualMachine,
-                    classNameEntry->m_bytes, classNameEntry->m_length,
-                    &classNameEntry->m_hashCode);
-
-                zen_Function_t* constructor = zen_Class_getConstructor(targetClass,
-                    descriptorEntry->m_bytes, descriptorEntry->m_length);
-
-                if (constructor != NULL) {
-                    jtk_Array_t* arguments = NULL;
-                    int32_t parameterCount = constructor->m_parameterCount;
+                uint16_t index = ZEN_INTERPRETER_READ_SHORT();
 
-                    if (constructor->m_parameterCount > 0) {
-                        arguments = jtk_Array_new(parameterCount);
+                /* The constructor is looked up only when the instruction is executed
+                 * for the first time.
+                 */
+                zen_Function_t* constructor = currentStackFrame->m_class->m_resolvedEntries[index].m_function;
+                if (constructor == NULL) {
+                    constructor = zen_Class_resolveFunction(interpreter->m_virtualMachine,
+                        currentStackFrame->m_class, index);
+                }
 
-                        int32_t parameterIndex;
-                        for (parameterIndex = parameterCount - 1; parameterIndex >= 0; parameterIndex--) {
-                            void* argument = (void*)zen_OperandStack_popReference(currentStackFrame->m_operandStack);
-                            jtk_Array_setValue(arguments, parameterIndex, argument);
-                        }
+                if ((constructor != NULL) && !zen_Function_isNative(constructor)) {
+                    /* The object and the arguments are already on the operand
+                     * stack in the order of the local variables. They are handed
+                     * over to the stack frame of the constructor as they are.
+                     */
+                    ZEN_INTERPRETER_SAVE_STATE();
+                    ZEN_INTERPRETER_PUSH_STACK_FRAME(constructor,
+                        constructor->m_argumentSlotCount + ZEN_INTERPRETER_REFERENCE_SLOT_COUNT);
+                    if (!constructor->m_directArguments) {
+                        zen_Interpreter_unpackArguments(interpreter, constructor,
+                            &currentStackFrame->m_localVariableArray, true);
                     }
+                    ZEN_INTERPRETER_LOAD_STATE();
+                }
+                else if (constructor != NULL) {
+                    /* Native functions receive a view of the arguments, which
+                     * lives on the native stack.
+                     */
+                    int32_t parameterCount = constructor->m_parameterCount;
+                    void* values[parameterCount + 1];
+                    jtk_Array_t arguments;
+                    arguments.m_values = values;
+                    arguments.m_size = parameterCount;
+
+                    int32_t parameterIndex;
+                    for (parameterIndex = parameterCount - 1; parameterIndex >= 0; parameterIndex--) {
+                        values[parameterIndex] = (void*)ZEN_INTERPRETER_POP_REFERENCE();
+                    }
+
+                    zen_Object_t* object = ZEN_INTERPRETER_POP_REFERENCE();
+                    ZEN_INTERPRETER_SAVE_STATE();
 
-                    zen_Object_t* object = zen_OperandStack_popReference(currentStackFrame->m_operandStack);
-                    zen_Interpreter_invokeConstructor(interpreter, object, constructor, arguments);
+                    zen_Interpreter_invokeConstructor(interpreter, object, constructor,
+                        (parameterCount > 0)? &arguments : NULL);
 
-                    if (arguments != NULL) {
-                        jtk_Array_delete(arguments);
+                    /* The constructor may have thrown an exception. */
+                    if ((interpreter->m_state & ZEN_INTERPRETER_STATE_EXCEPTION_THROWN) != 0) {
+                        goto handleException;
                     }
+                    ZEN_INTERPRETER_LOAD_STATE();
                 }
                 else {
+                    zen_ConstantPool_t* constantPool = &currentStackFrame->m_class->m_entityFile->m_constantPool;
+                    zen_ConstantPoolFunction_t* constructorEntry =
+                        (zen_ConstantPoolFunction_t*)constantPool->m_entries[index];
+                    zen_ConstantPoolUtf8_t* descriptorEntry = constantPool->m_entries[constructorEntry->m_descriptorIndex];
+                    zen_ConstantPoolClass_t* classEntry = constantPool->m_entries[constructorEntry->m_classIndex];
+                    zen_ConstantPoolUtf8_t* classNameEntry = constantPool->m_entries[classEntry->m_nameIndex];
+
                     /* TODO: Throw an instance of the UnknownFunctionException class. */
                     printf("[error] Unknown constructor in class %s with signature %s!",
                         classNameEntry->m_bytes, descriptorEntry->m_bytes);
@@ -1594,321 +2103,446 @@ void zen_Interpreter_interpret(zen_Interpreter_t* interpreter) {
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `invoke_special` (index = %d, operand stack = %d)",
-                    index, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    index, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_INVOKE_VIRTUAL: { /* invoke_virtual */
-                uint16_t index = (((uint16_t)instructions[currentStackFrame->m_ip++] << 8) | (uint16_t)instructions[currentStackFrame->m_ip++]);
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_INVOKE_VIRTUAL) { /* invoke_virtual */
+                ZEN_INTERPRETER_SAFEPOINT();
 
-                zen_EntityFile_t* entityFile = currentStackFrame->m_class->m_entityFile;
-                zen_ConstantPool_t* constantPool = &entityFile->m_constantPool;
-                zen_ConstantPoolFunction_t* functionEntry =
-                    (zen_ConstantPoolFunction_t*)constantPool->m_entries[index];
-                zen_ConstantPoolUtf8_t* nameEntry = constantPool->m_entries[functionEntry->m_nameIndex];
-                zen_ConstantPoolUtf8_t* descriptorEntry = constantPool->m_entries[functionEntry->m_descriptorIndex];
-                zen_ConstantPoolClass_t* classEntry = constantPool->m_entries[functionEntry->m_classIndex];
-                zen_ConstantPoolUtf8_t* classNameEntry = constantPool->m_entries[classEntry->m_nameIndex];
-
-                zen_Object_t* self = (zen_Object_t*)zen_OperandStack_popReference(currentStackFrame->m_operandStack);
-                zen_Class_t* selfClass = zen_Object_getClass(self);
-
-                /*zen_Function_t* function = zen_Class_getVirtualFunction(selfClass,
-                    functionName, functionDescriptor);*/
-                #warning "TODO: Replace the following statement with the previous statement!"
-                zen_Function_t* function = zen_Class_getStaticFunction(selfClass,
-                    nameEntry->m_bytes, nameEntry->m_length, descriptorEntry->m_bytes,
-                    descriptorEntry->m_length);
-
-                if (function != NULL) {
+                uint16_t index = ZEN_INTERPRETER_READ_SHORT();
+
+                zen_Object_t* self = (zen_Object_t*)ZEN_INTERPRETER_POP_REFERENCE();
+                if (self == NULL) {
+                    ZEN_INTERPRETER_SAVE_STATE();
+                    zen_VirtualMachine_raiseNullReferenceException(interpreter->m_virtualMachine);
+                    goto handleException;
+                }
+                zen_Class_t* selfClass = zen_Object_getClass(interpreter->m_virtualMachine, self);
+
+                /* Every call site has an inline cache. When the call site is
+                 * executed for the first time, it is linked to a slot in the
+                 * virtual function table. The function is loaded from the
+                 * slot, if the receiver class shares the layout. Otherwise,
+                 * the monomorphic entry is checked here; the remaining entries
+                 * and the megamorphic cache are checked out of line.
+                 */
+                zen_InlineCache_t* inlineCache = (zen_InlineCache_t*)ZEN_FUNCTION_GET_SITE_CACHE(
+                    currentStackFrame->m_function, ip - 3);
+                if (inlineCache->m_virtualIndex == ZEN_INLINE_CACHE_UNLINKED) {
+                    ZEN_INTERPRETER_SAVE_STATE();
+                    zen_Interpreter_linkVirtualCallSite(interpreter, currentStackFrame,
+                        inlineCache, index);
+                    if ((interpreter->m_state & ZEN_INTERPRETER_STATE_EXCEPTION_THROWN) != 0) {
+                        goto handleException;
+                    }
+                }
+
+                int32_t virtualIndex = inlineCache->m_virtualIndex;
+                zen_Function_t* function;
+                if ((virtualIndex >= 0) && (virtualIndex < selfClass->m_virtualFunctionTableSize) &&
+                    (selfClass->m_virtualFunctionTable[virtualIndex]->m_virtualRoot == inlineCache->m_virtualRoot)) {
+                    function = selfClass->m_virtualFunctionTable[virtualIndex];
+                    interpreter->m_inlineCacheStatistics.m_virtualTableHits++;
+                }
+                else if (inlineCache->m_classes[0] == selfClass) {
+                    function = inlineCache->m_functions[0];
+                    interpreter->m_inlineCacheStatistics.m_monomorphicHits++;
+                }
+                else {
+                    function = zen_Interpreter_lookupVirtualFunction(interpreter,
+                        currentStackFrame, inlineCache, selfClass, index);
+                }
+
+                if ((function != NULL) && !zen_Function_isNative(function)) {
+                    /* The self reference is on top of the arguments, whereas it
+                     * belongs to the first local variable of the function. Move
+                     * the arguments up to make room for it. The arguments are then
+                     * handed over to the stack frame of the function as they are.
+                     */
+                    int32_t argumentSlotCount = function->m_argumentSlotCount;
+                    int32_t* arguments = stackTop - argumentSlotCount;
+                    int32_t i;
+                    for (i = argumentSlotCount - 1; i >= 0; i--) {
+                        arguments[i + ZEN_INTERPRETER_REFERENCE_SLOT_COUNT] = arguments[i];
+                    }
+                    zen_Interpreter_writeReference(arguments, (uintptr_t)self);
+                    stackTop += ZEN_INTERPRETER_REFERENCE_SLOT_COUNT;
+
+                    ZEN_INTERPRETER_SAVE_STATE();
+                    ZEN_INTERPRETER_PUSH_STACK_FRAME(function,
+                        argumentSlotCount + ZEN_INTERPRETER_REFERENCE_SLOT_COUNT);
+                    if (!function->m_directArguments) {
+                        zen_Interpreter_unpackArguments(interpreter, function,
+                            &currentStackFrame->m_localVariableArray, true);
+                    }
+                    ZEN_INTERPRETER_LOAD_STATE();
+                }
+                else if (function != NULL) {
+                    /* Native functions receive the arguments in an array, which
+                     * lives on the native stack.
+                     */
                     int32_t parameterCount = function->m_parameterCount;
-                    jtk_Array_t* arguments = NULL;
+                    zen_Object_t* values[parameterCount + 1];
+
+                    int32_t parameterIndex;
+                    for (parameterIndex = parameterCount - 1; parameterIndex >= 0; parameterIndex--) {
+                        values[parameterIndex] = (zen_Object_t*)ZEN_INTERPRETER_POP_REFERENCE();
+                    }
 
-                    if (function->m_parameterCount > 0) {
-                        arguments = jtk_Array_new(parameterCount);
+                    ZEN_INTERPRETER_SAVE_STATE();
 
-                        int32_t parameterIndex;
-                        for (parameterIndex = parameterCount - 1; parameterIndex >= 0; parameterIndex--) {
-                            void* argument = (void*)zen_OperandStack_popReference(currentStackFrame->m_operandStack);
-                            jtk_Array_setValue(arguments, parameterIndex, argument);
+                    zen_Object_t* result = NULL;
+                    if ((function->m_intrinsic != ZEN_INTRINSIC_NONE) &&
+                        zen_Interpreter_evaluateIntrinsic(interpreter, function, self, values, &result)) {
+                        /* The result may have been allocated, which may have
+                         * thrown an exception.
+                         */
+                        if ((interpreter->m_state & ZEN_INTERPRETER_STATE_EXCEPTION_THROWN) != 0) {
+                            goto handleException;
+                        }
+                        ZEN_INTERPRETER_LOAD_STATE();
+                        if (function->m_returnType != ZEN_TYPE_VOID) {
+                            ZEN_INTERPRETER_PUSH_REFERENCE(result);
                         }
                     }
+                    else if ((function->m_nativeFunction != NULL) &&
+                        ZEN_NATIVE_FUNCTION_IS_FAST(function->m_nativeFunction)) {
+                        result = zen_Interpreter_invokeFastNativeFunction(
+                            interpreter, function, self, values);
+
+                        /* The invoked function may have thrown an exception. */
+                        if ((interpreter->m_state & ZEN_INTERPRETER_STATE_EXCEPTION_THROWN) != 0) {
+                            goto handleException;
+                        }
+                        ZEN_INTERPRETER_LOAD_STATE();
+                        if (function->m_returnType != ZEN_TYPE_VOID) {
+                            ZEN_INTERPRETER_PUSH_REFERENCE(result);
+                        }
+                    }
+                    else {
+                        jtk_Array_t arguments;
+                        arguments.m_values = (void**)values;
+                        arguments.m_size = parameterCount;
 
-                    zen_Interpreter_invokeVirtualFunction(interpreter, function, self, arguments);
+                        zen_Interpreter_invokeVirtualFunction(interpreter, function, self,
+                            (parameterCount > 0)? &arguments : NULL);
 
-                    if (arguments != NULL) {
-                        jtk_Array_delete(arguments);
+                        /* The invoked function may have thrown an exception. */
+                        if ((interpreter->m_state & ZEN_INTERPRETER_STATE_EXCEPTION_THROWN) != 0) {
+                            goto handleException;
+                        }
+                        ZEN_INTERPRETER_LOAD_STATE();
                     }
                 }
                 else {
+                    zen_ConstantPool_t* constantPool = &currentStackFrame->m_class->m_entityFile->m_constantPool;
+                    zen_ConstantPoolFunction_t* functionEntry =
+                        (zen_ConstantPoolFunction_t*)constantPool->m_entries[index];
+                    zen_ConstantPoolUtf8_t* nameEntry = constantPool->m_entries[functionEntry->m_nameIndex];
+                    zen_ConstantPoolUtf8_t* descriptorEntry = constantPool->m_entries[functionEntry->m_descriptorIndex];
+
                     /* TODO: Throw an instance of the UnknownFunctionException class. */
                     printf("[error] An exception was thrown\n"
                         "[error] UnknownFunctionException: Cannot resolve function '%s' with signature '%s'.\n",
                         nameEntry->m_bytes, descriptorEntry->m_bytes);
                 }
 
-                if ((interpreter->m_state & ZEN_INTERPRETER_STATE_EXCEPTION_THROWN) == 0) {
-                    /* Log debugging information for assistance in debugging the interpreter. */
-                    jtk_Logger_debug(logger, "Executed instruction `invoke_virtual` (index = %d, operand stack = %d)",
-                        index, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
-                }
-                else {
-                    /* Log debugging information for assistance in debugging the interpreter. */
-                    jtk_Logger_debug(logger, "An exception was thrown when executing `invoke_virtual` (index = %d)",
-                        index);
-                }
+                /* Log debugging information for assistance in debugging the interpreter. */
+                jtk_Logger_debug(logger, "Executed instruction `invoke_virtual` (index = %d, operand stack = %d)",
+                    index, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_INVOKE_DYNAMIC: { /* invoke_dynamic */
-                break;
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_INVOKE_DYNAMIC) { /* invoke_dynamic */
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_INVOKE_STATIC: { /* invoke_static */
-                uint16_t index = (((uint16_t)instructions[currentStackFrame->m_ip++] << 8) | (uint16_t)instructions[currentStackFrame->m_ip++]);
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_INVOKE_STATIC) { /* invoke_static */
+                ZEN_INTERPRETER_SAFEPOINT();
 
-                zen_EntityFile_t* entityFile = currentStackFrame->m_class->m_entityFile;
-                zen_ConstantPool_t* constantPool = &entityFile->m_constantPool;
-                zen_ConstantPoolFunction_t* functionEntry =
-                    (zen_ConstantPoolFunction_t*)constantPool->m_entries[index];
-                zen_ConstantPoolUtf8_t* nameEntry = constantPool->m_entries[functionEntry->m_nameIndex];
-                zen_ConstantPoolUtf8_t* descriptorEntry = constantPool->m_entries[functionEntry->m_descriptorIndex];
-                zen_ConstantPoolClass_t* classEntry = constantPool->m_entries[functionEntry->m_classIndex];
-                zen_ConstantPoolUtf8_t* classNameEntry = constantPool->m_entries[classEntry->m_nameIndex];
-
-                zen_Class_t* targetClass = zen_VirtualMachine_getClassEx(interpreter->m_virtualMachine,
-                    classNameEntry->m_bytes, classNameEntry->m_length, &classNameEntry->m_hashCode);
-
-                zen_Function_t* function = NULL;
-                if (functionEntry->m_tableIndex > 0) {
-                    function = targetClass->m_functionTable[functionEntry->m_tableIndex];
-                } else {
-                    function = zen_Class_getStaticFunction(targetClass,
-                        nameEntry->m_bytes, nameEntry->m_length,
-                        descriptorEntry->m_bytes, descriptorEntry->m_length);
+                uint16_t index = ZEN_INTERPRETER_READ_SHORT();
+
+                /* The function is looked up only when the instruction is executed
+                 * for the first time.
+                 */
+                zen_Function_t* function = currentStackFrame->m_class->m_resolvedEntries[index].m_function;
+                if (function == NULL) {
+                    function = zen_Class_resolveFunction(interpreter->m_virtualMachine,
+                        currentStackFrame->m_class, index);
                 }
 
-                if (function != NULL) {
+                if ((function != NULL) && !zen_Function_isNative(function)) {
+                    /* The arguments are already on the operand stack in the order
+                     * of the local variables. They are handed over to the stack
+                     * frame of the function as they are.
+                     */
+                    ZEN_INTERPRETER_SAVE_STATE();
+                    ZEN_INTERPRETER_PUSH_STACK_FRAME(function, function->m_argumentSlotCount);
+                    if (!function->m_directArguments) {
+                        zen_Interpreter_unpackArguments(interpreter, function,
+                            &currentStackFrame->m_localVariableArray, false);
+                    }
+                    ZEN_INTERPRETER_LOAD_STATE();
+                }
+                else if (function != NULL) {
+                    /* Native functions receive the arguments in an array, which
+                     * lives on the native stack.
+                     */
                     int32_t parameterCount = function->m_parameterCount;
-                    jtk_Array_t* arguments = NULL;
-
-                    if (function->m_parameterCount > 0) {
-                        arguments = jtk_Array_new(parameterCount);
-                        int32_t parameterIndex;
-                        for (parameterIndex = parameterCount - 1; parameterIndex >= 0; parameterIndex--) {
-                            void* argument = (void*)zen_OperandStack_popReference(currentStackFrame->m_operandStack);
-                            jtk_Array_setValue(arguments, parameterIndex, argument);
+                    zen_Object_t* values[parameterCount + 1];
+
+                    int32_t parameterIndex;
+                    for (parameterIndex = parameterCount - 1; parameterIndex >= 0; parameterIndex--) {
+                        values[parameterIndex] = (zen_Object_t*)ZEN_INTERPRETER_POP_REFERENCE();
+                    }
+
+                    ZEN_INTERPRETER_SAVE_STATE();
+
+                    zen_Object_t* result = NULL;
+                    if ((function->m_intrinsic != ZEN_INTRINSIC_NONE) &&
+                        zen_Interpreter_evaluateIntrinsic(interpreter, function, NULL, values, &result)) {
+                        /* The result may have been allocated, which may have
+                         * thrown an exception.
+                         */
+                        if ((interpreter->m_state & ZEN_INTERPRETER_STATE_EXCEPTION_THROWN) != 0) {
+                            goto handleException;
+                        }
+                        ZEN_INTERPRETER_LOAD_STATE();
+                        if (function->m_returnType != ZEN_TYPE_VOID) {
+                            ZEN_INTERPRETER_PUSH_REFERENCE(result);
+                        }
+                    }
+                    else if ((function->m_nativeFunction != NULL) &&
+                        ZEN_NATIVE_FUNCTION_IS_FAST(function->m_nativeFunction)) {
+                        result = zen_Interpreter_invokeFastNativeFunction(
+                            interpreter, function, NULL, values);
+
+                        /* The invoked function may have thrown an exception. */
+                        if ((interpreter->m_state & ZEN_INTERPRETER_STATE_EXCEPTION_THROWN) != 0) {
+                            goto handleException;
+                        }
+                        ZEN_INTERPRETER_LOAD_STATE();
+                        if (function->m_returnType != ZEN_TYPE_VOID) {
+                            ZEN_INTERPRETER_PUSH_REFERENCE(result);
                         }
                     }
+                    else {
+                        jtk_Array_t arguments;
+                        arguments.m_values = (void**)values;
+                        arguments.m_size = parameterCount;
 
-                    zen_Interpreter_invokeStaticFunction(interpreter, function, arguments);
+                        zen_Interpreter_invokeStaticFunction(interpreter, function,
+                            (parameterCount > 0)? &arguments : NULL);
 
-                    if (arguments != NULL) {
-                        jtk_Array_delete(arguments);
+                        /* The invoked function may have thrown an exception. */
+                        if ((interpreter->m_state & ZEN_INTERPRETER_STATE_EXCEPTION_THROWN) != 0) {
+                            goto handleException;
+                        }
+                        ZEN_INTERPRETER_LOAD_STATE();
                     }
                 }
                 else {
+                    zen_ConstantPool_t* constantPool = &currentStackFrame->m_class->m_entityFile->m_constantPool;
+                    zen_ConstantPoolFunction_t* functionEntry =
+                        (zen_ConstantPoolFunction_t*)constantPool->m_entries[index];
+                    zen_ConstantPoolUtf8_t* nameEntry = constantPool->m_entries[functionEntry->m_nameIndex];
+                    zen_ConstantPoolUtf8_t* descriptorEntry = constantPool->m_entries[functionEntry->m_descriptorIndex];
+
                     /* TODO: Throw an instance of the UnknownFunctionException class. */
                     printf("[error] An exception was thrown\n"
                         "[error] UnknownFunctionException: Cannot resolve function '%s' with signature '%s'.\n",
                         nameEntry->m_bytes, descriptorEntry->m_bytes);
                 }
 
-                if ((interpreter->m_state & ZEN_INTERPRETER_STATE_EXCEPTION_THROWN) == 0) {
-                    /* Log debugging information for assistance in debugging the interpreter. */
-                    jtk_Logger_debug(logger, "Executed instruction `invoke_static` (index = %d, operand stack = %d)",
-                        index, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
-                }
-                else {
-                    /* Log debugging information for assistance in debugging the interpreter. */
-                    jtk_Logger_debug(logger, "An exception was thrown when executing `invoke_static` (index = %d)",
-                        index);
-                }
+                /* Log debugging information for assistance in debugging the interpreter. */
+                jtk_Logger_debug(logger, "Executed instruction `invoke_static` (index = %d, operand stack = %d)",
+                    index, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
             /* Jump */
 
-            case ZEN_BYTE_CODE_JUMP: { /* jump */
-                int16_t offset = (((uint16_t)instructions[currentStackFrame->m_ip++] << 8) | (uint16_t)instructions[currentStackFrame->m_ip++]);
-                currentStackFrame->m_ip = offset;
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_JUMP) { /* jump */
+                int16_t offset = ZEN_INTERPRETER_READ_SHORT();
+                ZEN_INTERPRETER_BRANCH(offset);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `jump` (offset = %d, operand stack = %d)",
                     offset);
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
             /* Load */
 
-            case ZEN_BYTE_CODE_LOAD_I: { /* load_i */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_LOAD_I) { /* load_i */
                 /* Read the index of the local variable to load. */
-                uint8_t index = instructions[currentStackFrame->m_ip++];
+                uint8_t index = instructions[ip++];
 
                 /* Retrieve the 32-bit integer value stored in the local variable at
                  * the specified index.
                  */
-                int32_t value = zen_LocalVariableArray_getInteger(currentStackFrame->m_localVariableArray, index);
+                int32_t value = ZEN_INTERPRETER_GET_LOCAL_INTEGER(index);
                 /* Push the retrieved value on the operand stack. */
-                zen_OperandStack_pushInteger(currentStackFrame->m_operandStack, value);
+                ZEN_INTERPRETER_PUSH_INTEGER(value);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `load_i` (index = %d, result = %d, operand stack = %d)",
-                    index, value, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    index, value, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_LOAD_L: { /* load_l */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_LOAD_L) { /* load_l */
                 /* Read the index of the local variable to load. */
-                int32_t index = instructions[currentStackFrame->m_ip++];
+                int32_t index = instructions[ip++];
 
                 /* Retrieve the 32-bit integer value stored in the local variable at
                  * the specified index. It represents the low-part of the 64-bit
                  * integer value.
                  */
-                int32_t lowPart = zen_LocalVariableArray_getInteger(currentStackFrame->m_localVariableArray, index);
+                int32_t lowPart = ZEN_INTERPRETER_GET_LOCAL_INTEGER(index);
                 /* Retrieve the 32-bit integer value stored in the local variable at
                  * the specified index. It represents the high-part of the 64-bit
                  * integer value.
                  */
-                int32_t highPart = zen_LocalVariableArray_getInteger(currentStackFrame->m_localVariableArray, index + 1);
+                int32_t highPart = ZEN_INTERPRETER_GET_LOCAL_INTEGER(index + 1);
                 /* Push the retrieved values on the operand stack. */
-                zen_OperandStack_pushInteger(currentStackFrame->m_operandStack, highPart);
-                zen_OperandStack_pushInteger(currentStackFrame->m_operandStack, lowPart);
+                ZEN_INTERPRETER_PUSH_INTEGER(highPart);
+                ZEN_INTERPRETER_PUSH_INTEGER(lowPart);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `load_l` (index = %d, high part = %d, low part = %d, operand stack = %d)",
-                    index, highPart, lowPart, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    index, highPart, lowPart, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_LOAD_F: { /* load_f */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_LOAD_F) { /* load_f */
                 /* Read the index of the local variable to load. */
-                int32_t index = instructions[currentStackFrame->m_ip++];
+                int32_t index = instructions[ip++];
 
                 /* Retrieve the bit pattern of the 32-bit decimal value stored
                  * in the local variable at the specified index.
                  */
-                int32_t value = zen_LocalVariableArray_getInteger(currentStackFrame->m_localVariableArray, index);
+                int32_t value = ZEN_INTERPRETER_GET_LOCAL_INTEGER(index);
                 /* Push the retrieved bit pattern of the value on the operand
                  * stack.
                  */
-                zen_OperandStack_pushInteger(currentStackFrame->m_operandStack, value);
+                ZEN_INTERPRETER_PUSH_INTEGER(value);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `load_f` (index = %d, result = 0x%X, operand stack = %d)",
-                    index, value, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    index, value, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_LOAD_D: { /* load_d */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_LOAD_D) { /* load_d */
                 /* Read the index of the local variable to load. */
-                int32_t index = instructions[currentStackFrame->m_ip++];
+                int32_t index = instructions[ip++];
 
                 /* Retrieve the 32-bit integer value stored in the local variable at
                  * the specified index. It represents the low-part of the bit pattern
                  * of the 64-bit decimal value.
                  */
-                int32_t lowPart = zen_LocalVariableArray_getInteger(currentStackFrame->m_localVariableArray, index);
+                int32_t lowPart = ZEN_INTERPRETER_GET_LOCAL_INTEGER(index);
                 /* Retrieve the 32-bit integer value stored in the local variable at
                  * the specified index. It represents the high-part of the bit pattern
                  * of the 64-bit decimal value.
                  */
-                int32_t highPart = zen_LocalVariableArray_getInteger(currentStackFrame->m_localVariableArray, index + 1);
+                int32_t highPart = ZEN_INTERPRETER_GET_LOCAL_INTEGER(index + 1);
                 /* Push the retrieved values on the operand stack. */
-                zen_OperandStack_pushInteger(currentStackFrame->m_operandStack, highPart);
-                zen_OperandStack_pushInteger(currentStackFrame->m_operandStack, lowPart);
+                ZEN_INTERPRETER_PUSH_INTEGER(highPart);
+                ZEN_INTERPRETER_PUSH_INTEGER(lowPart);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `load_d` (index = %d, high part = 0x%X, low part = 0x%X, operand stack = %d)",
-                    index, highPart, lowPart, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    index, highPart, lowPart, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_LOAD_A: { /* load_a */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_LOAD_A) { /* load_a */
                 /* Read the index of the local variable to load. */
-                uint8_t index = instructions[currentStackFrame->m_ip++];
+                uint8_t index = instructions[ip++];
 
                 /* Retrieve the object reference stored in the local variable at
                  * the specified index.
                  */
-                uintptr_t reference = zen_LocalVariableArray_getReference(currentStackFrame->m_localVariableArray, index);
+                uintptr_t reference = ZEN_INTERPRETER_GET_LOCAL_REFERENCE(index);
                 /* Push the retrieved reference on the operand stack. */
-                zen_OperandStack_pushReference(currentStackFrame->m_operandStack, reference);
+                ZEN_INTERPRETER_PUSH_REFERENCE(reference);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `load_a` (index = %d, result = 0x%X, operand stack = %d)",
-                    index, reference, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    index, reference, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_LOAD_I0: { /* load_i0 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_LOAD_I0) { /* load_i0 */
                 /* Retrieve the 32-bit integer value stored in the local variable at
                  * index 0.
                  */
-                int32_t value = zen_LocalVariableArray_getInteger(currentStackFrame->m_localVariableArray, 0);
+                int32_t value = ZEN_INTERPRETER_GET_LOCAL_INTEGER(0);
                 /* Push the retrieved value on the operand stack. */
-                zen_OperandStack_pushInteger(currentStackFrame->m_operandStack, value);
+                ZEN_INTERPRETER_PUSH_INTEGER(value);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `load_i0` (index = 0, result = %d, operand stack = %d)",
-                    value, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    value, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_LOAD_I1: { /* load_i1 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_LOAD_I1) { /* load_i1 */
                 /* Retrieve the 32-bit integer value stored in the local variable at
                  * index 1.
                  */
-                int32_t value = zen_LocalVariableArray_getInteger(currentStackFrame->m_localVariableArray, 1);
+                int32_t value = ZEN_INTERPRETER_GET_LOCAL_INTEGER(1);
                 /* Push the retrieved value on the operand stack. */
-                zen_OperandStack_pushInteger(currentStackFrame->m_operandStack, value);
+                ZEN_INTERPRETER_PUSH_INTEGER(value);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `load_i1` (index = 1, result = %d, operand stack = %d)",
-                    value, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    value, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_LOAD_I2: { /* load_i2 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_LOAD_I2) { /* load_i2 */
                 /* Retrieve the 32-bit integer value stored in the local variable at
                  * index 2.
                  */
-                int32_t value = zen_LocalVariableArray_getInteger(currentStackFrame->m_localVariableArray, 2);
+                int32_t value = ZEN_INTERPRETER_GET_LOCAL_INTEGER(2);
                 /* Push the retrieved value on the operand stack. */
-                zen_OperandStack_pushInteger(currentStackFrame->m_operandStack, value);
+                ZEN_INTERPRETER_PUSH_INTEGER(value);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `load_i2` (index = 2, result = %d, operand stack = %d)",
-                    value, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    value, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_LOAD_I3: { /* load_i3 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_LOAD_I3) { /* load_i3 */
                 /* Retrieve the 32-bit integer value stored in the local variable at
                  * index 3.
                  */
-                int32_t value = zen_LocalVariableArray_getInteger(currentStackFrame->m_localVariableArray, 3);
+                int32_t value = ZEN_INTERPRETER_GET_LOCAL_INTEGER(3);
                 /* Push the retrieved value on the operand stack. */
-                zen_OperandStack_pushInteger(currentStackFrame->m_operandStack, value);
+                ZEN_INTERPRETER_PUSH_INTEGER(value);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `load_i3` (index = 3, result = %d, operand stack = %d)",
-                    value, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    value, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
             /* When copying 64-bit integer values, the high and low parts can be retrieved
@@ -1925,292 +2559,470 @@ void zen_Interpreter_interpret(zen_Interpreter_t* interpreter) {
              * and bring about consistency in the code.
              */
 
-            case ZEN_BYTE_CODE_LOAD_L0: { /* load_l0 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_LOAD_L0) { /* load_l0 */
                 /* Retrieve the 64-bit integer value stored in the local variable at
                  * index 0.
                  */
-                int64_t value = zen_LocalVariableArray_getLong(currentStackFrame->m_localVariableArray, 0);
+                int64_t value = ZEN_INTERPRETER_GET_LOCAL_LONG(0);
                 /* Push the retrieved value on the operand stack. */
-                zen_OperandStack_pushLong(currentStackFrame->m_operandStack, value);
+                ZEN_INTERPRETER_PUSH_LONG(value);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `load_l0` (index = 0, result = %l, operand stack = %d)",
-                    value, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    value, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_LOAD_L1: { /* load_l1 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_LOAD_L1) { /* load_l1 */
                 /* Retrieve the 64-bit integer value stored in the local variable at
                  * index 1.
                  */
-                int64_t value = zen_LocalVariableArray_getLong(currentStackFrame->m_localVariableArray, 1);
+                int64_t value = ZEN_INTERPRETER_GET_LOCAL_LONG(1);
                 /* Push the retrieved value on the operand stack. */
-                zen_OperandStack_pushLong(currentStackFrame->m_operandStack, value);
+                ZEN_INTERPRETER_PUSH_LONG(value);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `load_l1` (index = 1, result = %l, operand stack = %d)",
-                    value, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    value, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_LOAD_L2: { /* load_l2 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_LOAD_L2) { /* load_l2 */
                 /* Retrieve the 64-bit integer value stored in the local variable at
                  * index 2.
                  */
-                int64_t value = zen_LocalVariableArray_getLong(currentStackFrame->m_localVariableArray, 2);
+                int64_t value = ZEN_INTERPRETER_GET_LOCAL_LONG(2);
                 /* Push the retrieved value on the operand stack. */
-                zen_OperandStack_pushLong(currentStackFrame->m_operandStack, value);
+                ZEN_INTERPRETER_PUSH_LONG(value);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `load_l2` (index = 2, result = %l, operand stack = %d)",
-                    value, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    value, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_LOAD_L3: { /* load_l3 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_LOAD_L3) { /* load_l3 */
                 /* Retrieve the 64-bit integer value stored in the local variable at
                  * index 3.
                  */
-                int64_t value = zen_LocalVariableArray_getLong(currentStackFrame->m_localVariableArray, 3);
+                int64_t value = ZEN_INTERPRETER_GET_LOCAL_LONG(3);
                 /* Push the retrieved value on the operand stack. */
-                zen_OperandStack_pushLong(currentStackFrame->m_operandStack, value);
+                ZEN_INTERPRETER_PUSH_LONG(value);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `load_l3` (index = 3, result = %l, operand stack = %d)",
-                    value, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    value, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_LOAD_F0: { /* load_f0 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_LOAD_F0) { /* load_f0 */
                 /* Retrieve the 32-bit decimal value stored in the local variable
                  * at index 0.
                  */
-                float value = zen_LocalVariableArray_getFloat(currentStackFrame->m_localVariableArray, 0);
+                float value = ZEN_INTERPRETER_GET_LOCAL_FLOAT(0);
                 /* Push the retrieved value on the operand stack. */
-                zen_OperandStack_pushFloat(currentStackFrame->m_operandStack, value);
+                ZEN_INTERPRETER_PUSH_FLOAT(value);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `load_f0` (index = 0, result = %f, operand stack = %d)",
-                    value, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    value, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_LOAD_F1: { /* load_f1 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_LOAD_F1) { /* load_f1 */
                 /* Retrieve the 32-bit decimal value stored in the local variable
                  * at index 1.
                  */
-                float value = zen_LocalVariableArray_getFloat(currentStackFrame->m_localVariableArray, 1);
+                float value = ZEN_INTERPRETER_GET_LOCAL_FLOAT(1);
                 /* Push the retrieved value on the operand stack. */
-                zen_OperandStack_pushFloat(currentStackFrame->m_operandStack, value);
+                ZEN_INTERPRETER_PUSH_FLOAT(value);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `load_f1` (index = 1, result = %f, operand stack = %d)",
-                    value, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    value, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_LOAD_F2: { /* load_f2 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_LOAD_F2) { /* load_f2 */
                 /* Retrieve the 32-bit decimal value stored in the local variable
                  * at index 2.
                  */
-                float value = zen_LocalVariableArray_getFloat(currentStackFrame->m_localVariableArray, 2);
+                float value = ZEN_INTERPRETER_GET_LOCAL_FLOAT(2);
                 /* Push the retrieved value on the operand stack. */
-                zen_OperandStack_pushFloat(currentStackFrame->m_operandStack, value);
+                ZEN_INTERPRETER_PUSH_FLOAT(value);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `load_f2` (index = 2, result = %f, operand stack = %d)",
-                    value, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    value, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_LOAD_F3: { /* load_f3 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_LOAD_F3) { /* load_f3 */
                 /* Retrieve the 32-bit decimal value stored in the local variable
                  * at index 3.
                  */
-                float value = zen_LocalVariableArray_getFloat(currentStackFrame->m_localVariableArray, 3);
+                float value = ZEN_INTERPRETER_GET_LOCAL_FLOAT(3);
                 /* Push the retrieved value on the operand stack. */
-                zen_OperandStack_pushFloat(currentStackFrame->m_operandStack, value);
+                ZEN_INTERPRETER_PUSH_FLOAT(value);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `load_f3` (index = 3, result = %f, operand stack = %d)",
-                    value, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    value, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_LOAD_D0: { /* load_d0 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_LOAD_D0) { /* load_d0 */
                 /* Retrieve the 64-bit decimal value stored in the local variable at
                  * index 0.
                  */
-                double value = zen_LocalVariableArray_getDouble(currentStackFrame->m_localVariableArray, 0);
+                double value = ZEN_INTERPRETER_GET_LOCAL_DOUBLE(0);
                 /* Push the retrieved value on the operand stack. */
-                zen_OperandStack_pushDouble(currentStackFrame->m_operandStack, value);
+                ZEN_INTERPRETER_PUSH_DOUBLE(value);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `load_d0` (index = 0, result = %f, operand stack = %d)",
-                    value, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    value, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_LOAD_D1: { /* load_d1 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_LOAD_D1) { /* load_d1 */
                 /* Retrieve the 64-bit decimal value stored in the local variable at
                  * index 1.
                  */
-                double value = zen_LocalVariableArray_getDouble(currentStackFrame->m_localVariableArray, 1);
+                double value = ZEN_INTERPRETER_GET_LOCAL_DOUBLE(1);
                 /* Push the retrieved value on the operand stack. */
-                zen_OperandStack_pushDouble(currentStackFrame->m_operandStack, value);
+                ZEN_INTERPRETER_PUSH_DOUBLE(value);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `load_d1` (index = 1, result = %f, operand stack = %d)",
-                    value, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    value, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_LOAD_D2: { /* load_d2 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_LOAD_D2) { /* load_d2 */
                 /* Retrieve the 64-bit decimal value stored in the local variable at
                  * index 2.
                  */
-                double value = zen_LocalVariableArray_getDouble(currentStackFrame->m_localVariableArray, 2);
+                double value = ZEN_INTERPRETER_GET_LOCAL_DOUBLE(2);
                 /* Push the retrieved value on the operand stack. */
-                zen_OperandStack_pushDouble(currentStackFrame->m_operandStack, value);
+                ZEN_INTERPRETER_PUSH_DOUBLE(value);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `load_d2` (index = 2, result = %f, operand stack = %d)",
-                    value, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    value, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_LOAD_D3: { /* load_d3 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_LOAD_D3) { /* load_d3 */
                 /* Retrieve the 64-bit decimal value stored in the local variable at
                  * index 3.
                  */
-                double value = zen_LocalVariableArray_getDouble(currentStackFrame->m_localVariableArray, 3);
+                double value = ZEN_INTERPRETER_GET_LOCAL_DOUBLE(3);
                 /* Push the retrieved value on the operand stack. */
-                zen_OperandStack_pushDouble(currentStackFrame->m_operandStack, value);
+                ZEN_INTERPRETER_PUSH_DOUBLE(value);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `load_d3` (index = 3, result = %f, operand stack = %d)",
-                    value, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    value, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_LOAD_A0: { /* load_a0 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_LOAD_A0) { /* load_a0 */
                 /* Retrieve the reference of an object stored in the local variable
                  * at index 0.
                  */
-                intptr_t reference = zen_LocalVariableArray_getReference(
-                    currentStackFrame->m_localVariableArray, 0);
+                intptr_t reference = ZEN_INTERPRETER_GET_LOCAL_REFERENCE(0);
                 /* Push the retrieved value on the operand stack. */
-                zen_OperandStack_pushReference(currentStackFrame->m_operandStack, reference);
+                ZEN_INTERPRETER_PUSH_REFERENCE(reference);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `load_a0` (index = 0, result = 0x%X, operand stack = %d)",
-                    reference, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    reference, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_LOAD_A1: { /* load_a1 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_LOAD_A1) { /* load_a1 */
                 /* Retrieve the reference of an object stored in the local variable
                  * at index 1.
                  */
-                intptr_t reference = zen_LocalVariableArray_getReference(
-                    currentStackFrame->m_localVariableArray, 1);
+                intptr_t reference = ZEN_INTERPRETER_GET_LOCAL_REFERENCE(1);
                 /* Push the retrieved value on the operand stack. */
-                zen_OperandStack_pushReference(currentStackFrame->m_operandStack, reference);
+                ZEN_INTERPRETER_PUSH_REFERENCE(reference);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `load_a1` (index = 1, result = 0x%X, operand stack = %d)",
-                    reference, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    reference, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_LOAD_A2: { /* load_a2 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_LOAD_A2) { /* load_a2 */
                 /* Retrieve the reference of an object stored in the local variable
                  * at index 2.
                  */
-                intptr_t reference = zen_LocalVariableArray_getReference(
-                    currentStackFrame->m_localVariableArray, 2);
+                intptr_t reference = ZEN_INTERPRETER_GET_LOCAL_REFERENCE(2);
                 /* Push the retrieved value on the operand stack. */
-                zen_OperandStack_pushReference(currentStackFrame->m_operandStack, reference);
+                ZEN_INTERPRETER_PUSH_REFERENCE(reference);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `load_a2` (index = 2, result = 0x%X, operand stack = %d)",
-                    reference, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    reference, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_LOAD_A3: { /* load_a3 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_LOAD_A3) { /* load_a3 */
                 /* Retrieve the reference of an object stored in the local variable
                  * at index 3.
                  */
-                intptr_t reference = zen_LocalVariableArray_getReference(
-                    currentStackFrame->m_localVariableArray, 3);
+                intptr_t reference = ZEN_INTERPRETER_GET_LOCAL_REFERENCE(3);
                 /* Push the retrieved value on the operand stack. */
-                zen_OperandStack_pushReference(currentStackFrame->m_operandStack, reference);
+                ZEN_INTERPRETER_PUSH_REFERENCE(reference);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `load_a3` (index = 3, result = 0x%X, operand stack = %d)",
-                    reference, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    reference, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_LOAD_AB: { /* load_ab */
-                break;
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_LOAD_AB) { /* load_ab */
+                /* Retrieve the index from the operand stack. */
+                int32_t index = ZEN_INTERPRETER_POP_INTEGER();
+                /* Retrieve the array from the operand stack. */
+                zen_Object_t* array = (zen_Object_t*)ZEN_INTERPRETER_POP_REFERENCE();
+                /* The arrays of booleans are accessed with the byte instructions. */
+                if (!ZEN_INTERPRETER_IS_ARRAY_ACCESSIBLE(array, index, ZEN_TYPE_INTEGER_8) &&
+                    !ZEN_INTERPRETER_IS_ARRAY_ACCESSIBLE(array, index, ZEN_TYPE_BOOLEAN)) {
+                    ZEN_INTERPRETER_RAISE_ARRAY_ACCESS_EXCEPTION(array, index);
+                }
+                /* Retrieve the element at the specified index. */
+                int8_t value = ZEN_ARRAY_GET_ELEMENTS(array, int8_t)[index];
+                /* Push the retrieved value on the operand stack. */
+                ZEN_INTERPRETER_PUSH_INTEGER(value);
+
+                /* Log debugging information for assistance in debugging the interpreter. */
+                jtk_Logger_debug(logger, "Executed instruction `load_ab` (array = 0x%X, index = %d, result = %d, operand stack = %d)",
+                    array, index, value, ZEN_INTERPRETER_GET_STACK_SIZE());
+
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_LOAD_AC: { /* load_ac */
-                break;
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_LOAD_AC) { /* load_ac */
+                /* Retrieve the index from the operand stack. */
+                int32_t index = ZEN_INTERPRETER_POP_INTEGER();
+                /* Retrieve the array from the operand stack. */
+                zen_Object_t* array = (zen_Object_t*)ZEN_INTERPRETER_POP_REFERENCE();
+                if (!ZEN_INTERPRETER_IS_ARRAY_ACCESSIBLE(array, index, ZEN_TYPE_CHARACTER)) {
+                    ZEN_INTERPRETER_RAISE_ARRAY_ACCESS_EXCEPTION(array, index);
+                }
+                /* Retrieve the element at the specified index. */
+                uint16_t value = ZEN_ARRAY_GET_ELEMENTS(array, uint16_t)[index];
+                /* Push the retrieved value on the operand stack. */
+                ZEN_INTERPRETER_PUSH_INTEGER(value);
+
+                /* Log debugging information for assistance in debugging the interpreter. */
+                jtk_Logger_debug(logger, "Executed instruction `load_ac` (array = 0x%X, index = %d, result = %d, operand stack = %d)",
+                    array, index, value, ZEN_INTERPRETER_GET_STACK_SIZE());
+
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_LOAD_AS: { /* load_as */
-                break;
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_LOAD_AS) { /* load_as */
+                /* Retrieve the index from the operand stack. */
+                int32_t index = ZEN_INTERPRETER_POP_INTEGER();
+                /* Retrieve the array from the operand stack. */
+                zen_Object_t* array = (zen_Object_t*)ZEN_INTERPRETER_POP_REFERENCE();
+                if (!ZEN_INTERPRETER_IS_ARRAY_ACCESSIBLE(array, index, ZEN_TYPE_INTEGER_16)) {
+                    ZEN_INTERPRETER_RAISE_ARRAY_ACCESS_EXCEPTION(array, index);
+                }
+                /* Retrieve the element at the specified index. */
+                int16_t value = ZEN_ARRAY_GET_ELEMENTS(array, int16_t)[index];
+                /* Push the retrieved value on the operand stack. */
+                ZEN_INTERPRETER_PUSH_INTEGER(value);
+
+                /* Log debugging information for assistance in debugging the interpreter. */
+                jtk_Logger_debug(logger, "Executed instruction `load_as` (array = 0x%X, index = %d, result = %d, operand stack = %d)",
+                    array, index, value, ZEN_INTERPRETER_GET_STACK_SIZE());
+
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_LOAD_AI: { /* load_ai */
-                break;
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_LOAD_AI) { /* load_ai */
+                /* Retrieve the index from the operand stack. */
+                int32_t index = ZEN_INTERPRETER_POP_INTEGER();
+                /* Retrieve the array from the operand stack. */
+                zen_Object_t* array = (zen_Object_t*)ZEN_INTERPRETER_POP_REFERENCE();
+                if (!ZEN_INTERPRETER_IS_ARRAY_ACCESSIBLE(array, index, ZEN_TYPE_INTEGER_32)) {
+                    ZEN_INTERPRETER_RAISE_ARRAY_ACCESS_EXCEPTION(array, index);
+                }
+                /* Retrieve the element at the specified index. */
+                int32_t value = ZEN_ARRAY_GET_ELEMENTS(array, int32_t)[index];
+                /* Push the retrieved value on the operand stack. */
+                ZEN_INTERPRETER_PUSH_INTEGER(value);
+
+                /* Log debugging information for assistance in debugging the interpreter. */
+                jtk_Logger_debug(logger, "Executed instruction `load_ai` (array = 0x%X, index = %d, result = %d, operand stack = %d)",
+                    array, index, value, ZEN_INTERPRETER_GET_STACK_SIZE());
+
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_LOAD_AL: { /* load_al */
-                break;
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_LOAD_AL) { /* load_al */
+                /* Retrieve the index from the operand stack. */
+                int32_t index = ZEN_INTERPRETER_POP_INTEGER();
+                /* Retrieve the array from the operand stack. */
+                zen_Object_t* array = (zen_Object_t*)ZEN_INTERPRETER_POP_REFERENCE();
+                if (!ZEN_INTERPRETER_IS_ARRAY_ACCESSIBLE(array, index, ZEN_TYPE_INTEGER_64)) {
+                    ZEN_INTERPRETER_RAISE_ARRAY_ACCESS_EXCEPTION(array, index);
+                }
+                /* Retrieve the element at the specified index. */
+                int64_t value = ZEN_ARRAY_GET_ELEMENTS(array, int64_t)[index];
+                /* Push the retrieved value on the operand stack. */
+                ZEN_INTERPRETER_PUSH_LONG(value);
+
+                /* Log debugging information for assistance in debugging the interpreter. */
+                jtk_Logger_debug(logger, "Executed instruction `load_al` (array = 0x%X, index = %d, result = %ld, operand stack = %d)",
+                    array, index, value, ZEN_INTERPRETER_GET_STACK_SIZE());
+
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_LOAD_AF: { /* load_af */
-                break;
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_LOAD_AF) { /* load_af */
+                /* Retrieve the index from the operand stack. */
+                int32_t index = ZEN_INTERPRETER_POP_INTEGER();
+                /* Retrieve the array from the operand stack. */
+                zen_Object_t* array = (zen_Object_t*)ZEN_INTERPRETER_POP_REFERENCE();
+                if (!ZEN_INTERPRETER_IS_ARRAY_ACCESSIBLE(array, index, ZEN_TYPE_DECIMAL_32)) {
+                    ZEN_INTERPRETER_RAISE_ARRAY_ACCESS_EXCEPTION(array, index);
+                }
+                /* Retrieve the element at the specified index. */
+                float value = ZEN_ARRAY_GET_ELEMENTS(array, float)[index];
+                /* Push the retrieved value on the operand stack. */
+                ZEN_INTERPRETER_PUSH_FLOAT(value);
+
+                /* Log debugging information for assistance in debugging the interpreter. */
+                jtk_Logger_debug(logger, "Executed instruction `load_af` (array = 0x%X, index = %d, result = %f, operand stack = %d)",
+                    array, index, value, ZEN_INTERPRETER_GET_STACK_SIZE());
+
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_LOAD_AD: { /* load_ad */
-                break;
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_LOAD_AD) { /* load_ad */
+                /* Retrieve the index from the operand stack. */
+                int32_t index = ZEN_INTERPRETER_POP_INTEGER();
+                /* Retrieve the array from the operand stack. */
+                zen_Object_t* array = (zen_Object_t*)ZEN_INTERPRETER_POP_REFERENCE();
+                if (!ZEN_INTERPRETER_IS_ARRAY_ACCESSIBLE(array, index, ZEN_TYPE_DECIMAL_64)) {
+                    ZEN_INTERPRETER_RAISE_ARRAY_ACCESS_EXCEPTION(array, index);
+                }
+                /* Retrieve the element at the specified index. */
+                double value = ZEN_ARRAY_GET_ELEMENTS(array, double)[index];
+                /* Push the retrieved value on the operand stack. */
+                ZEN_INTERPRETER_PUSH_DOUBLE(value);
+
+                /* Log debugging information for assistance in debugging the interpreter. */
+                jtk_Logger_debug(logger, "Executed instruction `load_ad` (array = 0x%X, index = %d, result = %f, operand stack = %d)",
+                    array, index, value, ZEN_INTERPRETER_GET_STACK_SIZE());
+
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_LOAD_AA: { /* load_aa */
-                break;
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_LOAD_AA) { /* load_aa */
+                /* Retrieve the index from the operand stack. */
+                int32_t index = ZEN_INTERPRETER_POP_INTEGER();
+                /* Retrieve the array from the operand stack. */
+                zen_Object_t* array = (zen_Object_t*)ZEN_INTERPRETER_POP_REFERENCE();
+                if (!ZEN_INTERPRETER_IS_ARRAY_ACCESSIBLE(array, index, ZEN_TYPE_REFERENCE)) {
+                    ZEN_INTERPRETER_RAISE_ARRAY_ACCESS_EXCEPTION(array, index);
+                }
+                /* Retrieve the element at the specified index. */
+                uintptr_t value = ZEN_ARRAY_GET_ELEMENTS(array, uintptr_t)[index];
+                /* Push the retrieved value on the operand stack. */
+                ZEN_INTERPRETER_PUSH_REFERENCE(value);
+
+                /* Log debugging information for assistance in debugging the interpreter. */
+                jtk_Logger_debug(logger, "Executed instruction `load_aa` (array = 0x%X, index = %d, result = 0x%X, operand stack = %d)",
+                    array, index, value, ZEN_INTERPRETER_GET_STACK_SIZE());
+
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_LOAD_INSTANCE_FIELD: { /* load_instance_field */
-                break;
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_LOAD_INSTANCE_FIELD) { /* load_instance_field */
+                uint16_t index = ZEN_INTERPRETER_READ_SHORT();
+                zen_Object_t* self = (zen_Object_t*)ZEN_INTERPRETER_POP_REFERENCE();
+
+                /* Every field access site has a field cache. If the instance
+                 * belongs to the class seen last at the site, the field is
+                 * loaded from the cached offset. Otherwise, the field is
+                 * looked up by its name out of line.
+                 */
+                zen_FieldCache_t* fieldCache = (zen_FieldCache_t*)ZEN_FUNCTION_GET_SITE_CACHE(
+                    currentStackFrame->m_function, ip - 3);
+                uintptr_t value;
+                if (ZEN_INTERPRETER_IS_EXACT_INSTANCE(self, fieldCache->m_class)) {
+                    value = *((uintptr_t*)((uint8_t*)self + ZEN_OBJECT_HEADER_SIZE +
+                        fieldCache->m_offset));
+                    interpreter->m_inlineCacheStatistics.m_fieldHits++;
+                }
+                else {
+                    ZEN_INTERPRETER_SAVE_STATE();
+                    if (!zen_Interpreter_loadInstanceField(interpreter, currentStackFrame,
+                        fieldCache, self, index, &value)) {
+                        goto handleException;
+                    }
+                }
+                /* Push the retrieved value on the operand stack. */
+                ZEN_INTERPRETER_PUSH_REFERENCE(value);
+
+                /* Log debugging information for assistance in debugging the interpreter. */
+                jtk_Logger_debug(logger, "Executed instruction `load_instance_field` (index = %d, instance = 0x%X, result = 0x%X, operand stack = %d)",
+                    index, self, value, ZEN_INTERPRETER_GET_STACK_SIZE());
+
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_LOAD_STATIC_FIELD: { /* load_static_field */
-                break;
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_LOAD_STATIC_FIELD) { /* load_static_field */
+                uint16_t index = ZEN_INTERPRETER_READ_SHORT();
+
+                /* The address of a static field is resolved when the site is
+                 * executed for the first time.
+                 */
+                zen_FieldCache_t* fieldCache = (zen_FieldCache_t*)ZEN_FUNCTION_GET_SITE_CACHE(
+                    currentStackFrame->m_function, ip - 3);
+                if (fieldCache->m_address == NULL) {
+                    ZEN_INTERPRETER_SAVE_STATE();
+                    if (!zen_Interpreter_linkStaticField(interpreter, currentStackFrame,
+                        fieldCache, index)) {
+                        goto handleException;
+                    }
+                }
+                uintptr_t value = *((uintptr_t*)fieldCache->m_address);
+                /* Push the retrieved value on the operand stack. */
+                ZEN_INTERPRETER_PUSH_REFERENCE(value);
+
+                /* Log debugging information for assistance in debugging the interpreter. */
+                jtk_Logger_debug(logger, "Executed instruction `load_static_field` (index = %d, result = 0x%X, operand stack = %d)",
+                    index, value, ZEN_INTERPRETER_GET_STACK_SIZE());
+
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_LOAD_CPR: { /* load_cpr */
-                int32_t index = instructions[currentStackFrame->m_ip++];
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_LOAD_CPR) { /* load_cpr */
+                int32_t index = instructions[ip++];
 
                 zen_EntityFile_t* entityFile = currentStackFrame->m_class->m_entityFile;
                 zen_ConstantPool_t* constantPool = &entityFile->m_constantPool;
@@ -2219,10 +3031,10 @@ void zen_Interpreter_interpret(zen_Interpreter_t* interpreter) {
                     case ZEN_CONSTANT_POOL_TAG_INTEGER: {
                         zen_ConstantPoolInteger_t* constantPoolInteger = (zen_ConstantPoolInteger_t*)entry;
                         int32_t value = zen_ConstantPoolInteger_getValue(constantPoolInteger);
-                        zen_OperandStack_pushInteger(currentStackFrame->m_operandStack, value);
+                        ZEN_INTERPRETER_PUSH_INTEGER(value);
 
                         jtk_Logger_debug(logger, "Executed instruction `load_cpr` (index = %d, result = '%d', operand stack = %d)",
-                            index, value, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                            index, value, ZEN_INTERPRETER_GET_STACK_SIZE());
 
                         break;
                     }
@@ -2230,10 +3042,10 @@ void zen_Interpreter_interpret(zen_Interpreter_t* interpreter) {
                     case ZEN_CONSTANT_POOL_TAG_LONG: {
                         zen_ConstantPoolLong_t* constantPoolLong = (zen_ConstantPoolLong_t*)entry;
                         int64_t value = zen_ConstantPoolLong_getValue(constantPoolLong);
-                        zen_OperandStack_pushLong(currentStackFrame->m_operandStack, value);
+                        ZEN_INTERPRETER_PUSH_LONG(value);
 
                         jtk_Logger_debug(logger, "Executed instruction `load_cpr` (index = %d, result = '%l', operand stack = %d)",
-                            index, value, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                            index, value, ZEN_INTERPRETER_GET_STACK_SIZE());
 
                         break;
                     }
@@ -2241,10 +3053,10 @@ void zen_Interpreter_interpret(zen_Interpreter_t* interpreter) {
                     case ZEN_CONSTANT_POOL_TAG_FLOAT: {
                         zen_ConstantPoolFloat_t* constantPoolFloat = (zen_ConstantPoolFloat_t*)entry;
                         float value = zen_ConstantPoolFloat_getValue(constantPoolFloat);
-                        zen_OperandStack_pushFloat(currentStackFrame->m_operandStack, value);
+                        ZEN_INTERPRETER_PUSH_FLOAT(value);
 
                         jtk_Logger_debug(logger, "Executed instruction `load_cpr` (index = %d, result = '%f', operand stack = %d)",
-                            index, value, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                            index, value, ZEN_INTERPRETER_GET_STACK_SIZE());
 
                         break;
                     }
@@ -2252,45 +3064,35 @@ void zen_Interpreter_interpret(zen_Interpreter_t* interpreter) {
                     case ZEN_CONSTANT_POOL_TAG_DOUBLE: {
                         zen_ConstantPoolDouble_t* constantPoolDouble = (zen_ConstantPoolDouble_t*)entry;
                         double value = zen_ConstantPoolDouble_getValue(constantPoolDouble);
-                        zen_OperandStack_pushDouble(currentStackFrame->m_operandStack, value);
+                        ZEN_INTERPRETER_PUSH_DOUBLE(value);
 
                         jtk_Logger_debug(logger, "Executed instruction `load_cpr` (index = %d, result = '%f', operand stack = %d)",
-                            index, value, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                            index, value, ZEN_INTERPRETER_GET_STACK_SIZE());
 
                         break;
                     }
 
                     case ZEN_CONSTANT_POOL_TAG_STRING: {
-                        zen_ConstantPoolString_t* constantPoolString = (zen_ConstantPoolString_t*)entry;
-                        zen_ConstantPoolUtf8_t* constantPoolUtf8 =
-                            (zen_ConstantPoolString_t*)constantPool->m_entries[constantPoolString->m_stringIndex];
-                        // jtk_String_t* value = jtk_String_newEx(constantPoolUtf8->m_bytes, constantPoolUtf8->m_length);
-
-                        // const uint8_t* arrayDescriptor = "b";
-                        // int32_t arrayDescriptorSize = 1;
-                        zen_Object_t* array = zen_VirtualMachine_newByteArray(interpreter->m_virtualMachine,
-                            constantPoolUtf8->m_bytes, constantPoolUtf8->m_length);
-
-                        const uint8_t* stringClassDescriptor = "zen/core/String";
-                        int32_t stringClassDescriptorSize = 15;
-                        const uint8_t* stringConstructorDescriptor = "v:(zen/core/Object)";
-                        int32_t stringConstructorDescriptorSize = 19;
-
-                        jtk_Array_t* arguments = jtk_Array_new(1);
-                        jtk_Array_setValue(arguments, 0, array);
-
-                        zen_Object_t* value = zen_VirtualMachine_newObjectEx(interpreter->m_virtualMachine,
-                            stringClassDescriptor, stringClassDescriptorSize, stringConstructorDescriptor,
-                            stringConstructorDescriptorSize, arguments);
-
-                        jtk_Array_delete(arguments);
-
-                        zen_OperandStack_pushReference(currentStackFrame->m_operandStack, value);
+                        /* String literals are materialized only once per constant
+                         * pool entry. Subsequent executions push the same object.
+                         */
+                        zen_Object_t* value = currentStackFrame->m_class->m_resolvedEntries[index].m_object;
+                        if (value == NULL) {
+                            /* The constructor of the string class is invoked by the interpreter. */
+                            ZEN_INTERPRETER_SAVE_STATE();
+                            value = zen_Interpreter_resolveLiteral(interpreter,
+                                currentStackFrame->m_class, index);
+
+                            if ((interpreter->m_state & ZEN_INTERPRETER_STATE_EXCEPTION_THROWN) != 0) {
+                                goto handleException;
+                            }
+                            ZEN_INTERPRETER_LOAD_STATE();
+                        }
 
-                        jtk_Logger_debug(logger, "Executed instruction `load_cpr` (index = %d, result = '%.*s', operand stack = %d)",
-                            index, constantPoolUtf8->m_length, constantPoolUtf8->m_bytes, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                        ZEN_INTERPRETER_PUSH_REFERENCE(value);
 
-                        jtk_Logger_debug(logger, "String object at 0x%X, array object at 0x%x", value, array);
+                        jtk_Logger_debug(logger, "Executed instruction `load_cpr` (index = %d, result = 0x%X, operand stack = %d)",
+                            index, value, ZEN_INTERPRETER_GET_STACK_SIZE());
 
                         break;
                     }
@@ -2300,20 +3102,34 @@ void zen_Interpreter_interpret(zen_Interpreter_t* interpreter) {
                     }
                 }
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_LOAD_ARRAY_SIZE: { /* load_array_size */
-                break;
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_LOAD_ARRAY_SIZE) { /* load_array_size */
+                /* Retrieve the array from the operand stack. */
+                zen_Object_t* array = (zen_Object_t*)ZEN_INTERPRETER_POP_REFERENCE();
+                if (array == NULL) {
+                    ZEN_INTERPRETER_RAISE_ARRAY_ACCESS_EXCEPTION(array, 0);
+                }
+                /* The length is stored right after the header of the array. */
+                int32_t size = ZEN_ARRAY_LENGTH(array);
+                /* Push the size of the array on the operand stack. */
+                ZEN_INTERPRETER_PUSH_INTEGER(size);
+
+                /* Log debugging information for assistance in debugging the interpreter. */
+                jtk_Logger_debug(logger, "Executed instruction `load_array_size` (array = 0x%X, result = %d, operand stack = %d)",
+                    array, size, ZEN_INTERPRETER_GET_STACK_SIZE());
+
+                ZEN_INTERPRETER_DISPATCH();
             }
 
             /* Modulo */
 
-            case ZEN_BYTE_CODE_MODULO_I: { /* modulo_i */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_MODULO_I) { /* modulo_i */
                 /* Retrieve the second operand from the operand stack. */
-                int32_t operand2 = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand2 = ZEN_INTERPRETER_POP_INTEGER();
                 /* Retrieve the first operand from the operand stack. */
-                int32_t operand1 = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand1 = ZEN_INTERPRETER_POP_INTEGER();
 
                 if (operand2 == 0) {
                     /* TODO: Throw an instance of the zen.core.DivisionByZeroException class. */
@@ -2323,20 +3139,20 @@ void zen_Interpreter_interpret(zen_Interpreter_t* interpreter) {
                  * on the operand stack.
                  */
                 int32_t result = operand1 % operand2;
-                zen_OperandStack_pushInteger(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_INTEGER(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `modulo_i` (operand1 = %d, operand2 = %d, result = %d, operand stack = %d)",
-                    operand1, operand2, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand1, operand2, result, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_MODULO_L: { /* modulo_l */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_MODULO_L) { /* modulo_l */
                 /* Retrieve the second operand from the operand stack. */
-                int64_t operand2 = zen_OperandStack_popLong(currentStackFrame->m_operandStack);
+                int64_t operand2 = ZEN_INTERPRETER_POP_LONG();
                 /* Retrieve the first operand from the operand stack. */
-                int64_t operand1 = zen_OperandStack_popLong(currentStackFrame->m_operandStack);
+                int64_t operand1 = ZEN_INTERPRETER_POP_LONG();
 
                 if (operand2 == 0L) {
                     /* TODO: Throw an instance of the zen.core.DivisionByZeroException class. */
@@ -2346,194 +3162,198 @@ void zen_Interpreter_interpret(zen_Interpreter_t* interpreter) {
                  * on the operand stack.
                  */
                 int64_t result = operand1 % operand2;
-                zen_OperandStack_pushLong(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_LONG(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `modulo_l` (operand1 = %l, operand2 = %l, result = %l, operand stack = %d)",
-                    operand1, operand2, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand1, operand2, result, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_MODULO_F: { /* modulo_f */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_MODULO_F) { /* modulo_f */
                 /* Retrieve the second operand from the operand stack. */
-                float operand2 = zen_OperandStack_popFloat(currentStackFrame->m_operandStack);
+                float operand2 = ZEN_INTERPRETER_POP_FLOAT();
                 /* Retrieve the first operand from the operand stack. */
-                float operand1 = zen_OperandStack_popFloat(currentStackFrame->m_operandStack);
+                float operand1 = ZEN_INTERPRETER_POP_FLOAT();
                 /* Divide the operands to evaluate the remainder. Push the result
                  * on the operand stack.
                  */
                 float result = jtk_Math_modulo_f(operand1, operand2);
-                zen_OperandStack_pushFloat(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_FLOAT(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `modulo_f` (operand1 = %f, operand2 = %f, result = %f, operand stack = %d)",
-                    operand1, operand2, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand1, operand2, result, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_MODULO_D: { /* modulo_d */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_MODULO_D) { /* modulo_d */
                 /* Retrieve the second operand from the operand stack. */
-                double operand2 = zen_OperandStack_popDouble(currentStackFrame->m_operandStack);
+                double operand2 = ZEN_INTERPRETER_POP_DOUBLE();
                 /* Retrieve the first operand from the operand stack. */
-                double operand1 = zen_OperandStack_popDouble(currentStackFrame->m_operandStack);
+                double operand1 = ZEN_INTERPRETER_POP_DOUBLE();
                 /* Divide the operands to evaluate the remainder. Push the result
                  * on the operand stack.
                  */
                 double result = jtk_Math_modulo_d(operand1, operand2);
-                zen_OperandStack_pushDouble(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_DOUBLE(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `modulo_d` (operand1 = %f, operand2 = %f, result = %f, operand stack = %d)",
-                    operand1, operand2, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand1, operand2, result, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
             /* Multiply */
 
-            case ZEN_BYTE_CODE_MULTIPLY_I: { /* multiply_i */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_MULTIPLY_I) { /* multiply_i */
                 /* Retrieve the second operand from the operand stack. */
-                int32_t operand2 = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand2 = ZEN_INTERPRETER_POP_INTEGER();
                 /* Retrieve the first operand from the operand stack. */
-                int32_t operand1 = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand1 = ZEN_INTERPRETER_POP_INTEGER();
                 /* Multiply the operands. Push the result on the operand stack. */
                 int32_t result = operand1 * operand2;
-                zen_OperandStack_pushInteger(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_INTEGER(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `multiply_i` (operand1 = %d, operand2 = %d, result = %d, operand stack = %d)",
-                    operand1, operand2, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand1, operand2, result, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_MULTIPLY_L: { /* multiply_l */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_MULTIPLY_L) { /* multiply_l */
                 /* Retrieve the second operand from the operand stack. */
-                int64_t operand2 = zen_OperandStack_popLong(currentStackFrame->m_operandStack);
+                int64_t operand2 = ZEN_INTERPRETER_POP_LONG();
                 /* Retrieve the first operand from the operand stack. */
-                int64_t operand1 = zen_OperandStack_popLong(currentStackFrame->m_operandStack);
+                int64_t operand1 = ZEN_INTERPRETER_POP_LONG();
                 /* Multiply the operands. Push the result on the operand stack. */
                 int64_t result = operand1 * operand2;
-                zen_OperandStack_pushLong(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_LONG(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `multiply_l` (operand1 = %l, operand2 = %l, result = %l, operand stack = %d)",
-                    operand1, operand2, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand1, operand2, result, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_MULTIPLY_F: { /* multiply_f */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_MULTIPLY_F) { /* multiply_f */
                 /* Retrieve the second operand from the operand stack. */
-                float operand2 = zen_OperandStack_popFloat(currentStackFrame->m_operandStack);
+                float operand2 = ZEN_INTERPRETER_POP_FLOAT();
                 /* Retrieve the first operand from the operand stack. */
-                float operand1 = zen_OperandStack_popFloat(currentStackFrame->m_operandStack);
+                float operand1 = ZEN_INTERPRETER_POP_FLOAT();
                 /* Multiply the operands. Push the result on the operand stack. */
                 float result = operand1 * operand2;
-                zen_OperandStack_pushFloat(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_FLOAT(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `multiply_f` (operand1 = %f, operand2 = %f, result = %f, operand stack = %d)",
-                    operand1, operand2, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand1, operand2, result, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_MULTIPLY_D: { /* multiply_d */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_MULTIPLY_D) { /* multiply_d */
                 /* Retrieve the second operand from the operand stack. */
-                double operand2 = zen_OperandStack_popDouble(currentStackFrame->m_operandStack);
+                double operand2 = ZEN_INTERPRETER_POP_DOUBLE();
                 /* Retrieve the first operand from the operand stack. */
-                double operand1 = zen_OperandStack_popDouble(currentStackFrame->m_operandStack);
+                double operand1 = ZEN_INTERPRETER_POP_DOUBLE();
                 /* Multiply the operands. Push the result on the operand stack. */
                 double result = operand1 * operand2;
-                zen_OperandStack_pushDouble(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_DOUBLE(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `multiply_d` (operand1 = %f, operand2 = %f, result = %f, operand stack = %d)",
-                    operand1, operand2, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand1, operand2, result, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
             /* Negate */
 
-            case ZEN_BYTE_CODE_NEGATE_I: { /* negate_i */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_NEGATE_I) { /* negate_i */
                 /* Retrieve the operand from the operand stack. */
-                int32_t operand = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand = ZEN_INTERPRETER_POP_INTEGER();
                 /* Negate the operand. Push the result on the operand stack. */
                 int32_t result = -operand;
-                zen_OperandStack_pushInteger(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_INTEGER(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `negate_i` (operand = %d, result = %d, operand stack = %d)",
-                    operand, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, result, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_NEGATE_L: { /* negate_l */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_NEGATE_L) { /* negate_l */
                 /* Retrieve the operand from the operand stack. */
-                int64_t operand = zen_OperandStack_popLong(currentStackFrame->m_operandStack);
+                int64_t operand = ZEN_INTERPRETER_POP_LONG();
                 /* Negate the operand. Push the result on the operand stack. */
                 int64_t result = -operand;
-                zen_OperandStack_pushLong(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_LONG(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `negate_l` (operand = %l, result = %l, operand stack = %d)",
-                    operand, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, result, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_NEGATE_F: { /* negate_f */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_NEGATE_F) { /* negate_f */
                 /* Retrieve the operand from the operand stack. */
-                float operand = zen_OperandStack_popFloat(currentStackFrame->m_operandStack);
+                float operand = ZEN_INTERPRETER_POP_FLOAT();
                 /* Negate the operand. Push the result on the operand stack. */
                 float result = -operand;
-                zen_OperandStack_pushFloat(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_FLOAT(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `negate_f` (operand = %f, result = %f, operand stack = %d)",
-                    operand, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, result, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_NEGATE_D: { /* negate_d */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_NEGATE_D) { /* negate_d */
                 /* Retrieve the operand from the operand stack. */
-                double operand = zen_OperandStack_popDouble(currentStackFrame->m_operandStack);
+                double operand = ZEN_INTERPRETER_POP_DOUBLE();
                 /* Negate the operand. Push the result on the operand stack. */
                 double result = -operand;
-                zen_OperandStack_pushDouble(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_DOUBLE(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `negate_d` (operand = %f, result = %f, operand stack = %d)",
-                    operand, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, result, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
             /* New */
 
-            case ZEN_BYTE_CODE_NEW: { /* new */
-                uint16_t index = (((uint16_t)instructions[currentStackFrame->m_ip++] << 8) | (uint16_t)instructions[currentStackFrame->m_ip++]);
-
-                zen_EntityFile_t* entityFile = currentStackFrame->m_class->m_entityFile;
-                zen_ConstantPool_t* constantPool = &entityFile->m_constantPool;
-                zen_ConstantPoolClass_t* classEntry =
-                    (zen_ConstantPoolClass_t*)constantPool->m_entries[index];
-                zen_ConstantPoolUtf8_t* nameEntry = constantPool->m_entries[classEntry->m_nameIndex];
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_NEW) { /* new */
+                uint16_t index = ZEN_INTERPRETER_READ_SHORT();
 
-                zen_Class_t* targetClass = zen_VirtualMachine_getClassEx(interpreter->m_virtualMachine,
-                    nameEntry->m_bytes, nameEntry->m_length, &nameEntry->m_hashCode);
+                /* The class is looked up only when the instruction is executed for
+                 * the first time.
+                 */
+                zen_Class_t* targetClass = currentStackFrame->m_class->m_resolvedEntries[index].m_class;
+                if (targetClass == NULL) {
+                    targetClass = zen_Class_resolveClass(interpreter->m_virtualMachine,
+                        currentStackFrame->m_class, index);
+                }
 
                 if (targetClass != NULL) {
+                    /* The allocation may trigger a collection, which scans the
+                     * operand stack.
+                     */
+                    ZEN_INTERPRETER_SAVE_STATE();
                     zen_Object_t* result = zen_VirtualMachine_allocateObject(interpreter->m_virtualMachine,
                         targetClass);
                     /* Push the reference of the newly allocated object onto the operand stack. */
-                    zen_OperandStack_pushReference(currentStackFrame->m_operandStack, result);
+                    ZEN_INTERPRETER_PUSH_REFERENCE(result);
                 }
                 else {
                     /* TODO: Throw an instance of the UnknownClassException class. */
@@ -2541,489 +3361,495 @@ void zen_Interpreter_interpret(zen_Interpreter_t* interpreter) {
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `new` (index = %d, operand stack = %d)",
-                    index, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    index, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_NEW_ARRAY: { /* new_array */
-                break;
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_NEW_ARRAY) { /* new_array */
+                /* Read the type of the elements from the instruction stream. */
+                uint8_t type = instructions[ip++];
+                /* Retrieve the size of the array from the operand stack. */
+                int32_t size = ZEN_INTERPRETER_POP_INTEGER();
+                /* The allocation may trigger a collection, which scans the
+                 * operand stack.
+                 */
+                ZEN_INTERPRETER_SAVE_STATE();
+                zen_Object_t* result = zen_VirtualMachine_newArray(interpreter->m_virtualMachine,
+                    (zen_Type_t)type, size);
+                /* The size may be invalid. */
+                if ((interpreter->m_state & ZEN_INTERPRETER_STATE_EXCEPTION_THROWN) != 0) {
+                    goto handleException;
+                }
+                /* Push the reference of the newly created primitive array. */
+                ZEN_INTERPRETER_PUSH_REFERENCE(result);
+
+                /* Log debugging information for assistance in debugging the interpreter. */
+                jtk_Logger_debug(logger, "Executed instruction `new_array` (type = %d, size = %d, result = 0x%X, operand stack = %d)",
+                    type, size, result, ZEN_INTERPRETER_GET_STACK_SIZE());
+
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_NEW_ARRAY_A: { /* new_array_a */
-                /* Read the class index from the instruction stream. */
-                uint16_t index = (((uint16_t)instructions[currentStackFrame->m_ip++] << 8) | (uint16_t)instructions[currentStackFrame->m_ip++]);
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_NEW_ARRAY_A) { /* new_array_a */
+                /* Read the class index from the instruction stream. The arrays
+                 * do not record the class of their elements, therefore, the
+                 * class is not resolved.
+                 */
+                uint16_t index = ZEN_INTERPRETER_READ_SHORT();
                 /* Retrieve the size of the array from the operand stack. */
-                int32_t size = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
-                /* TODO: Create a new reference array. */
-                jtk_Array_t* result = jtk_Array_new(size);
+                int32_t size = ZEN_INTERPRETER_POP_INTEGER();
+                ZEN_INTERPRETER_SAVE_STATE();
+                zen_Object_t* result = zen_VirtualMachine_newArray(interpreter->m_virtualMachine,
+                    ZEN_TYPE_REFERENCE, size);
+                if ((interpreter->m_state & ZEN_INTERPRETER_STATE_EXCEPTION_THROWN) != 0) {
+                    goto handleException;
+                }
                 /* Push the reference of the newly created reference array. */
-                zen_OperandStack_pushReference(currentStackFrame->m_operandStack, (void*)result);
+                ZEN_INTERPRETER_PUSH_REFERENCE(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `new_array_a` (index = %d, size = %d, result = 0x%X, operand stack = %d)",
-                    index, size, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    index, size, result, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_NEW_ARRAY_AN: { /* new_array_an */
-                break;
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_NEW_ARRAY_AN) { /* new_array_an */
+                /* Read the class index and the number of dimensions from the
+                 * instruction stream.
+                 */
+                uint16_t index = ZEN_INTERPRETER_READ_SHORT();
+                uint8_t dimensions = instructions[ip++];
+                /* Retrieve the sizes of the dimensions from the operand stack.
+                 * The size of the first dimension was pushed first.
+                 */
+                int32_t sizes[(dimensions > 0)? dimensions : 1];
+                int32_t i;
+                for (i = dimensions - 1; i >= 0; i--) {
+                    sizes[i] = ZEN_INTERPRETER_POP_INTEGER();
+                }
+                ZEN_INTERPRETER_SAVE_STATE();
+                zen_Object_t* result = zen_VirtualMachine_newMultidimensionalArray(
+                    interpreter->m_virtualMachine, sizes, dimensions);
+                if ((interpreter->m_state & ZEN_INTERPRETER_STATE_EXCEPTION_THROWN) != 0) {
+                    goto handleException;
+                }
+                /* Push the reference of the newly created reference array. */
+                ZEN_INTERPRETER_PUSH_REFERENCE(result);
+
+                /* Log debugging information for assistance in debugging the interpreter. */
+                jtk_Logger_debug(logger, "Executed instruction `new_array_an` (index = %d, dimensions = %d, result = 0x%X, operand stack = %d)",
+                    index, dimensions, result, ZEN_INTERPRETER_GET_STACK_SIZE());
+
+                ZEN_INTERPRETER_DISPATCH();
             }
 
             /* Pop */
 
-            case ZEN_BYTE_CODE_POP: { /* pop */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_POP) { /* pop */
                 /* Discard the operand on top of the operand stack. */
-                zen_OperandStack_pop(currentStackFrame->m_operandStack);
+                ZEN_INTERPRETER_POP();
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `pop` (operand stack = %d)",
-                    zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_POP2: { /* pop2 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_POP2) { /* pop2 */
                 /* Discard the first two operands on top of the operand stack. */
-                zen_OperandStack_popEx(currentStackFrame->m_operandStack);
+                ZEN_INTERPRETER_POP2();
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `pop2` (operand stack = %d)",
-                    zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
             /* Push */
 
-            case ZEN_BYTE_CODE_PUSH_NULL: { /* push_null */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_PUSH_NULL) { /* push_null */
                 /* Push an integer value of 0, which represents the null reference,
                  * on the operand stack.
                  */
-                zen_OperandStack_pushReference(currentStackFrame->m_operandStack, ZEN_INTERPRETER_NULL_REFERENCE);
+                ZEN_INTERPRETER_PUSH_REFERENCE(ZEN_INTERPRETER_NULL_REFERENCE);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `push_null` (operand stack = %d)",
-                    zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_PUSH_IN1: { /* push_in1 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_PUSH_IN1) { /* push_in1 */
                 /* Push a 32-bit integer value of -1 on the operand stack. */
-                zen_OperandStack_pushInteger(currentStackFrame->m_operandStack, -1);
+                ZEN_INTERPRETER_PUSH_INTEGER(-1);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `push_in1` (result = -1, operand stack = %d)",
-                    zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_PUSH_I0: { /* push_i0 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_PUSH_I0) { /* push_i0 */
                 /* Push a 32-bit integer value of 0 on the operand stack. */
-                zen_OperandStack_pushInteger(currentStackFrame->m_operandStack, 0);
+                ZEN_INTERPRETER_PUSH_INTEGER(0);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `push_i0` (result = 0, operand stack = %d)",
-                    zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_PUSH_I1: { /* push_i1 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_PUSH_I1) { /* push_i1 */
                 /* Push a 32-bit integer value of 1 on the operand stack. */
-                zen_OperandStack_pushInteger(currentStackFrame->m_operandStack, 1);
+                ZEN_INTERPRETER_PUSH_INTEGER(1);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `push_i1` (result = 1, operand stack = %d)",
-                    zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_PUSH_I2: { /* push_i2 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_PUSH_I2) { /* push_i2 */
                 /* Push a 32-bit integer value of 2 on the operand stack. */
-                zen_OperandStack_pushInteger(currentStackFrame->m_operandStack, 2);
+                ZEN_INTERPRETER_PUSH_INTEGER(2);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `push_i2` (result = 2, operand stack = %d)",
-                    zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_PUSH_I3: { /* push_i3 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_PUSH_I3) { /* push_i3 */
                 /* Push a 32-bit integer value of 3 on the operand stack. */
-                zen_OperandStack_pushInteger(currentStackFrame->m_operandStack, 3);
+                ZEN_INTERPRETER_PUSH_INTEGER(3);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `push_i3` (result = 3, operand stack = %d)",
-                    zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_PUSH_I4: { /* push_i4 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_PUSH_I4) { /* push_i4 */
                 /* Push a 32-bit integer value of 4 on the operand stack. */
-                zen_OperandStack_pushInteger(currentStackFrame->m_operandStack, 4);
+                ZEN_INTERPRETER_PUSH_INTEGER(4);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `push_i4` (result = 4, operand stack = %d)",
-                    zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_PUSH_I5: { /* push_i5 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_PUSH_I5) { /* push_i5 */
                 /* Push a 32-bit integer value of 5 on the operand stack. */
-                zen_OperandStack_pushInteger(currentStackFrame->m_operandStack, 5);
+                ZEN_INTERPRETER_PUSH_INTEGER(5);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `push_i5` (result = 5, operand stack = %d)",
-                    zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_PUSH_L0: { /* push_l0 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_PUSH_L0) { /* push_l0 */
                 /* Push a 64-bit integer value of 0 on the operand stack. */
-                zen_OperandStack_pushLong(currentStackFrame->m_operandStack, 0L);
+                ZEN_INTERPRETER_PUSH_LONG(0L);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `push_l0` (result = 0, operand stack = %d)",
-                    zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_PUSH_L1: { /* push_l1 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_PUSH_L1) { /* push_l1 */
                 /* Push a 64-bit integer value of 1 on the operand stack. */
-                zen_OperandStack_pushLong(currentStackFrame->m_operandStack, 1L);
+                ZEN_INTERPRETER_PUSH_LONG(1L);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `push_l1` (result = 1, operand stack = %d)",
-                    zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_PUSH_L2: { /* push_l2 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_PUSH_L2) { /* push_l2 */
                 /* Push a 64-bit integer value of 2 on the operand stack. */
-                zen_OperandStack_pushLong(currentStackFrame->m_operandStack, 2L);
+                ZEN_INTERPRETER_PUSH_LONG(2L);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `push_l2` (result = 2, operand stack = %d)",
-                    zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_PUSH_F0: { /* push_f0 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_PUSH_F0) { /* push_f0 */
                 /* Push a 32-bit decimal value of 0.0 on the operand stack. */
-                zen_OperandStack_pushFloat(currentStackFrame->m_operandStack, 0.0f);
+                ZEN_INTERPRETER_PUSH_FLOAT(0.0f);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `push_f0` (result = 0.0, operand stack = %d)",
-                    zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_PUSH_F1: { /* push_f1 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_PUSH_F1) { /* push_f1 */
                 /* Push a 32-bit decimal value of 1.0 on the operand stack. */
-                zen_OperandStack_pushFloat(currentStackFrame->m_operandStack, 1.0f);
+                ZEN_INTERPRETER_PUSH_FLOAT(1.0f);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `push_f1` (result = 1.0, operand stack = %d)",
-                    zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_PUSH_F2: { /* push_f2 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_PUSH_F2) { /* push_f2 */
                 /* Push a 32-bit decimal value of 2.0 on the operand stack. */
-                zen_OperandStack_pushFloat(currentStackFrame->m_operandStack, 2.0f);
+                ZEN_INTERPRETER_PUSH_FLOAT(2.0f);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `push_f2` (result = 2.0, operand stack = %d)",
-                    zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_PUSH_D0: { /* push_d0 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_PUSH_D0) { /* push_d0 */
                 /* Push a 64-bit decimal value of 0.0 on the operand stack. */
-                zen_OperandStack_pushDouble(currentStackFrame->m_operandStack, 0.0);
+                ZEN_INTERPRETER_PUSH_DOUBLE(0.0);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `push_d0` (result = 0.0, operand stack = %d)",
-                    zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_PUSH_D1: { /* push_d1 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_PUSH_D1) { /* push_d1 */
                 /* Push a 64-bit decimal value of 1.0 on the operand stack. */
-                zen_OperandStack_pushDouble(currentStackFrame->m_operandStack, 1.0);
+                ZEN_INTERPRETER_PUSH_DOUBLE(1.0);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `push_d1` (result = 1.0, operand stack = %d)",
-                    zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_PUSH_D2: { /* push_d2 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_PUSH_D2) { /* push_d2 */
                 /* Push a 64-bit decimal value of 2.0 on the operand stack. */
-                zen_OperandStack_pushDouble(currentStackFrame->m_operandStack, 2.0);
+                ZEN_INTERPRETER_PUSH_DOUBLE(2.0);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `push_d2` (result = 2.0, operand stack = %d)",
-                    zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_PUSH_B: { /* push_b */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_PUSH_B) { /* push_b */
                 /* Read the 8-bit integer value to push on the stack. */
-                int8_t value = instructions[currentStackFrame->m_ip++];
+                int8_t value = instructions[ip++];
                 /* Push the 8-bit integer value on the stack. It is extended to
                  * a 32-bit integer; zeroes are used as padding.
                  */
-                zen_OperandStack_pushInteger(currentStackFrame->m_operandStack, (int32_t)value);
+                ZEN_INTERPRETER_PUSH_INTEGER((int32_t)value);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `push_b` (result = %d, operand stack = %d)",
-                    value, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    value, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_PUSH_S: { /* push_s */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_PUSH_S) { /* push_s */
                 /* Read the 16-bit integer value to push on the stack. */
-                int16_t value = (((uint16_t)instructions[currentStackFrame->m_ip++] << 8) | (uint16_t)instructions[currentStackFrame->m_ip++]);
+                int16_t value = ZEN_INTERPRETER_READ_SHORT();
                 /* Push the 16-bit integer value on the stack. It is extended to
                  * a 32-bit integer; zeroes are used as padding.
                  */
-                zen_OperandStack_pushInteger(currentStackFrame->m_operandStack, (int32_t)value);
+                ZEN_INTERPRETER_PUSH_INTEGER((int32_t)value);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `push_s` (result = %d, operand stack = %d)",
-                    value, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    value, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
             /* Return */
 
-            case ZEN_BYTE_CODE_RETURN: { /* return */
-                /* The currently executing function is returning to the caller.
-                 * Therefore, pop the current stack frame.
-                 */
-                zen_InvocationStack_popStackFrame(interpreter->m_processorThread->m_invocationStack);
+            /* The return instructions do not pop the stack frame themselves. They
+             * record the number of slots the return value occupies on top of the
+             * operand stack and transfer the control to the common return sequence,
+             * which copies the return value to the operand stack of the caller.
+             *
+             * NOTE: The return_f and return_d instructions are implemented in terms of
+             * 32-bit and 64-bit integers. The return value is copied as raw slots.
+             * Therefore, its type does not really matter.
+             */
+
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_RETURN) { /* return */
+                returnSlotCount = 0;
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `return` (operand stack = %d)",
-                    zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                goto returnFromFunction;
             }
 
-            case ZEN_BYTE_CODE_RETURN_I: { /* return_i */
-                /* Retrieve the operand from the operand stack. */
-                int32_t returnValue = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
-
-                /* The currently executing function is returning to the caller.
-                 * Therefore, pop the current stack frame.
-                 */
-                zen_InvocationStack_popStackFrame(interpreter->m_processorThread->m_invocationStack);
-
-                /* Push the operand on the "new" current stack frame. */
-                zen_OperandStack_pushInteger(currentStackFrame->m_operandStack, returnValue);
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_RETURN_I) { /* return_i */
+                returnSlotCount = 1;
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `return_i` (operand = %d, operand stack = %d)",
-                    returnValue, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    stackTop[-1], ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                goto returnFromFunction;
             }
 
-            case ZEN_BYTE_CODE_RETURN_L: { /* return_l */
-                /* Retrieve the operand from the operand stack. */
-                int64_t returnValue = zen_OperandStack_popLong(currentStackFrame->m_operandStack);
-
-                /* The currently executing function is returning to the caller.
-                 * Therefore, pop the current stack frame.
-                 */
-                zen_InvocationStack_popStackFrame(interpreter->m_processorThread->m_invocationStack);
-
-                /* Push the operand on the "new" current stack frame. */
-                zen_OperandStack_pushLong(currentStackFrame->m_operandStack, returnValue);
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_RETURN_L) { /* return_l */
+                returnSlotCount = 2;
 
                 /* Log debugging information for assistance in debugging the interpreter. */
-                jtk_Logger_debug(logger, "Executed instruction `return_l` (operand = %l, operand stack = %d)",
-                    returnValue, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                jtk_Logger_debug(logger, "Executed instruction `return_l` (operand stack = %d)",
+                    ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                goto returnFromFunction;
             }
 
-            /* NOTE: The return_f and return_d instructions are implemented in terms of
-             * 32-bit and 64-bit integers.
-             *
-             * Since, we are retriving and pushing the operand from the OperandStack
-             * class it does not really affect. In fact, internally, the operand
-             * stack stores decimal values as integers.
-             */
-
-            case ZEN_BYTE_CODE_RETURN_F: { /* return_f */
-                /* Retrieve the operand from the operand stack. */
-                int32_t returnValue = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
-
-                /* The currently executing function is returning to the caller.
-                 * Therefore, pop the current stack frame.
-                 */
-                zen_InvocationStack_popStackFrame(interpreter->m_processorThread->m_invocationStack);
-
-                /* Push the operand on the "new" current stack frame. */
-                zen_OperandStack_pushInteger(currentStackFrame->m_operandStack, returnValue);
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_RETURN_F) { /* return_f */
+                returnSlotCount = 1;
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `return_f` (operand = 0x%X, operand stack = %d)",
-                    returnValue, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    stackTop[-1], ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                goto returnFromFunction;
             }
 
-            case ZEN_BYTE_CODE_RETURN_D: { /* return_d */
-                /* Retrieve the operand from the operand stack. */
-                int64_t returnValue = zen_OperandStack_popLong(currentStackFrame->m_operandStack);
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_RETURN_D) { /* return_d */
+                returnSlotCount = 2;
 
-                /* The currently executing function is returning to the caller.
-                 * Therefore, pop the current stack frame.
-                 */
-                zen_InvocationStack_popStackFrame(interpreter->m_processorThread->m_invocationStack);
+                /* Log debugging information for assistance in debugging the interpreter. */
+                jtk_Logger_debug(logger, "Executed instruction `return_d` (operand stack = %d)",
+                    ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                /* Push the operand on the "new" current stack frame. */
-                zen_OperandStack_pushLong(currentStackFrame->m_operandStack, returnValue);
+                goto returnFromFunction;
+            }
+
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_RETURN_A) { /* return_a */
+                returnSlotCount = ZEN_INTERPRETER_REFERENCE_SLOT_COUNT;
 
                 /* Log debugging information for assistance in debugging the interpreter. */
-                jtk_Logger_debug(logger, "Executed instruction `return_d` (operand = 0x%X, operand stack = %d)",
-                    returnValue, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                jtk_Logger_debug(logger, "Executed instruction `return_a` (operand = 0x%X, operand stack = %d)",
+                    ZEN_INTERPRETER_PEEK_REFERENCE(), ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
-            }
-
-            case ZEN_BYTE_CODE_RETURN_A: { /* return_a */
-                /* Retrieve the operand from the operand stack. */
-                intptr_t returnValue = zen_OperandStack_popReference(currentStackFrame->m_operandStack);
-
-                /* The currently executing function is returning to the caller.
-                 * Therefore, pop the current stack frame.
-                 */
-                // zen_InvocationStack_popStackFrame(interpreter->m_invocationStack);
-
-                /* Push the operand on the "new" current stack frame. */
-                zen_OperandStack_pushReference(currentStackFrame->m_operandStack, returnValue);
-
-                /* Log debugging information for assistance in debugging the interpreter. */
-                jtk_Logger_debug(logger, "Executed instruction `return_a` (operand = 0x%X, operand stack = %d)",
-                    returnValue, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
-
-                goto edgeOfEarth;
-
-                break;
+                goto returnFromFunction;
             }
 
             /* RTTI */
 
-            case ZEN_BYTE_CODE_RTTI: { /* rtti */
-                break;
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_RTTI) { /* rtti */
+                ZEN_INTERPRETER_DISPATCH();
             }
 
             /* Store */
 
-            case ZEN_BYTE_CODE_STORE_I: { /* store_i */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_STORE_I) { /* store_i */
                 /* Read the index of the local variable to modify. */
-                uint8_t index = instructions[currentStackFrame->m_ip++];
+                uint8_t index = instructions[ip++];
                 /* Retrieve the operand from the operand stack. */
-                int32_t operand = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand = ZEN_INTERPRETER_POP_INTEGER();
                 /* Update the value of the local variable with the specified index. */
-                zen_LocalVariableArray_setInteger(currentStackFrame->m_localVariableArray, index, operand);
+                ZEN_INTERPRETER_SET_LOCAL_INTEGER(index, operand);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `store_i` (operand = %d, index = %d, operand stack = %d)",
-                    operand, index, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, index, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_STORE_I0: { /* store_i0 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_STORE_I0) { /* store_i0 */
                 /* Retrieve the operand from the operand stack. */
-                int32_t operand = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand = ZEN_INTERPRETER_POP_INTEGER();
                 /* Store the retrieved operand in the local variable at index 0. */
-                zen_LocalVariableArray_setInteger(currentStackFrame->m_localVariableArray, 0, operand);
+                ZEN_INTERPRETER_SET_LOCAL_INTEGER(0, operand);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `store_i0` (operand = %d, index = 0, operand stack = %d)",
-                    operand, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_STORE_I1: { /* store_i1 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_STORE_I1) { /* store_i1 */
                 /* Retrieve the operand from the operand stack. */
-                int32_t operand = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand = ZEN_INTERPRETER_POP_INTEGER();
                 /* Store the retrieved operand in the local variable at index 1. */
-                zen_LocalVariableArray_setInteger(currentStackFrame->m_localVariableArray, 1, operand);
+                ZEN_INTERPRETER_SET_LOCAL_INTEGER(1, operand);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `store_i1` (operand = %d, index = 1, operand stack = %d)",
-                    operand, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_STORE_I2: { /* store_i2 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_STORE_I2) { /* store_i2 */
                 /* Retrieve the operand from the operand stack. */
-                int32_t operand = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand = ZEN_INTERPRETER_POP_INTEGER();
                 /* Store the retrieved operand in the local variable at index 2. */
-                zen_LocalVariableArray_setInteger(currentStackFrame->m_localVariableArray, 2, operand);
+                ZEN_INTERPRETER_SET_LOCAL_INTEGER(2, operand);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `store_i2` (operand = %d, index = 2, operand stack = %d)",
-                    operand, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_STORE_I3: { /* store_i3 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_STORE_I3) { /* store_i3 */
                 /* Retrieve the operand from the operand stack. */
-                int32_t operand = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand = ZEN_INTERPRETER_POP_INTEGER();
                 /* Store the retrieved operand in the local variable at index 3. */
-                zen_LocalVariableArray_setInteger(currentStackFrame->m_localVariableArray, 3, operand);
+                ZEN_INTERPRETER_SET_LOCAL_INTEGER(3, operand);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `store_i3` (operand = %d, index = 3, operand stack = %d)",
-                    operand, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_STORE_L: { /* store_l */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_STORE_L) { /* store_l */
                 /* Read the index of the local variable to modify. */
-                uint8_t index = instructions[currentStackFrame->m_ip++];
+                uint8_t index = instructions[ip++];
                 /* Retrieve the operand from the operand stack. */
-                int64_t operand = zen_OperandStack_popLong(currentStackFrame->m_operandStack);
+                int64_t operand = ZEN_INTERPRETER_POP_LONG();
                 /* Update the value of the local variable with the specified index. */
-                zen_LocalVariableArray_setLong(currentStackFrame->m_localVariableArray, index, operand);
+                ZEN_INTERPRETER_SET_LOCAL_LONG(index, operand);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `store_l` (operand = %d, index = %d, operand stack = %d)",
-                    operand, index, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, index, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
             /* NOTE: The order in which the high and low parts are stored should
@@ -3031,140 +3857,140 @@ void zen_Interpreter_interpret(zen_Interpreter_t* interpreter) {
              *       loaded.
              */
 
-            case ZEN_BYTE_CODE_STORE_L0: { /* store_l0 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_STORE_L0) { /* store_l0 */
                 /* Retrieve a 32-bit integer operand from the operand stack.
                  * It represents the low-part of the 64-bit integer.
                  */
-                // int32_t lowPart = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                // int32_t lowPart = ZEN_INTERPRETER_POP_INTEGER();
                 /* Retrieve a 32-bit integer operand from the operand stack.
                  * It represents the high-part of the 64-bit integer.
                  */
-                // int32_t highPart = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                // int32_t highPart = ZEN_INTERPRETER_POP_INTEGER();
                 /* Store the retrieved operands in the local variable at index 0.
                  *
                  * A 64-bit integer value occupies two indexes in the local variable
                  * array. The high part is stored at index 0. The low part is stored
                  * in the subsequent index, that is 1.
                  */
-                // zen_LocalVariableArray_setInteger(currentStackFrame->m_localVariableArray, 0, highPart);
-                // zen_LocalVariableArray_setInteger(currentStackFrame->m_localVariableArray, 1, lowPart);
+                // ZEN_INTERPRETER_SET_LOCAL_INTEGER(0, highPart);
+                // ZEN_INTERPRETER_SET_LOCAL_INTEGER(1, lowPart);
 
                 /* The above code implements the previous algorithm. The new algorithm is
                  * a humble attempt at optimizing the interpreter.
                  */
 
                 /* Retrieve the operand from the operand stack. */
-                int64_t operand = zen_OperandStack_popLong(currentStackFrame->m_operandStack);
+                int64_t operand = ZEN_INTERPRETER_POP_LONG();
                 /* Store the retrieved operand in the local variable at index 0. */
-                zen_LocalVariableArray_setLong(currentStackFrame->m_localVariableArray, 0, operand);
+                ZEN_INTERPRETER_SET_LOCAL_LONG(0, operand);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `store_l0` (operand = %l, index = 0, operand stack = %d)",
-                    operand, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_STORE_L1: { /* store_l1 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_STORE_L1) { /* store_l1 */
                 /* Retrieve a 32-bit integer operand from the operand stack.
                  * It represents the low-part of the 64-bit integer.
                  */
-                // int32_t lowPart = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                // int32_t lowPart = ZEN_INTERPRETER_POP_INTEGER();
                 /* Retrieve a 32-bit integer operand from the operand stack.
                  * It represents the high-part of the 64-bit integer.
                  */
-                // int32_t highPart = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                // int32_t highPart = ZEN_INTERPRETER_POP_INTEGER();
                 /* Store the retrieved operands in the local variable at index 1.
                  *
                  * A 64-bit integer value occupies two indexes in the local variable
                  * array. The high part is stored at index 1. The low part is stored
                  * in the subsequent index, that is 2.
                  */
-                // zen_LocalVariableArray_setInteger(currentStackFrame->m_localVariableArray, 1, highPart);
-                // zen_LocalVariableArray_setInteger(currentStackFrame->m_localVariableArray, 2, lowPart);
+                // ZEN_INTERPRETER_SET_LOCAL_INTEGER(1, highPart);
+                // ZEN_INTERPRETER_SET_LOCAL_INTEGER(2, lowPart);
 
                 /* The above code implements the previous algorithm. The new algorithm is
                  * a humble attempt at optimizing the interpreter.
                  */
 
                 /* Retrieve the operand from the operand stack. */
-                int64_t operand = zen_OperandStack_popLong(currentStackFrame->m_operandStack);
+                int64_t operand = ZEN_INTERPRETER_POP_LONG();
                 /* Store the retrieved operand in the local variable at index 1. */
-                zen_LocalVariableArray_setLong(currentStackFrame->m_localVariableArray, 1, operand);
+                ZEN_INTERPRETER_SET_LOCAL_LONG(1, operand);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `store_l1` (operand = %l, index = 1, operand stack = %d)",
-                    operand, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_STORE_L2: { /* store_l2 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_STORE_L2) { /* store_l2 */
                 /* Retrieve a 32-bit integer operand from the operand stack.
                  * It represents the low-part of the 64-bit integer.
                  */
-                // int32_t lowPart = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                // int32_t lowPart = ZEN_INTERPRETER_POP_INTEGER();
                 /* Retrieve a 32-bit integer operand from the operand stack.
                  * It represents the high-part of the 64-bit integer.
                  */
-                // int32_t highPart = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                // int32_t highPart = ZEN_INTERPRETER_POP_INTEGER();
                 /* Store the retrieved operands in the local variable at index 2.
                  *
                  * A 64-bit integer value occupies two indexes in the local variable
                  * array. The high part is stored at index 2. The low part is stored
                  * in the subsequent index, that is 3.
                  */
-                // zen_LocalVariableArray_setInteger(currentStackFrame->m_localVariableArray, 2, highPart);
-                // zen_LocalVariableArray_setInteger(currentStackFrame->m_localVariableArray, 3, lowPart);
+                // ZEN_INTERPRETER_SET_LOCAL_INTEGER(2, highPart);
+                // ZEN_INTERPRETER_SET_LOCAL_INTEGER(3, lowPart);
 
                 /* The above code implements the previous algorithm. The new algorithm is
                  * a humble attempt at optimizing the interpreter.
                  */
 
                 /* Retrieve the operand from the operand stack. */
-                int64_t operand = zen_OperandStack_popLong(currentStackFrame->m_operandStack);
+                int64_t operand = ZEN_INTERPRETER_POP_LONG();
                 /* Store the retrieved operand in the local variable at index 2. */
-                zen_LocalVariableArray_setLong(currentStackFrame->m_localVariableArray, 2, operand);
+                ZEN_INTERPRETER_SET_LOCAL_LONG(2, operand);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `store_l2` (operand = %l, index = 2, operand stack = %d)",
-                    operand, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_STORE_L3: { /* store_l3 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_STORE_L3) { /* store_l3 */
                 /* Retrieve a 32-bit integer operand from the operand stack.
                  * It represents the low-part of the 64-bit integer.
                  */
-                // int32_t lowPart = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                // int32_t lowPart = ZEN_INTERPRETER_POP_INTEGER();
                 /* Retrieve a 32-bit integer operand from the operand stack.
                  * It represents the high-part of the 64-bit integer.
                  */
-                // int32_t highPart = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                // int32_t highPart = ZEN_INTERPRETER_POP_INTEGER();
                 /* Store the retrieved operands in the local variable at index 3.
                  *
                  * A 64-bit integer value occupies two indexes in the local variable
                  * array. The high part is stored at index 3. The low part is stored
                  * in the subsequent index, that is 4.
                  */
-                // zen_LocalVariableArray_setInteger(currentStackFrame->m_localVariableArray, 3, highPart);
-                // zen_LocalVariableArray_setInteger(currentStackFrame->m_localVariableArray, 4, lowPart);
+                // ZEN_INTERPRETER_SET_LOCAL_INTEGER(3, highPart);
+                // ZEN_INTERPRETER_SET_LOCAL_INTEGER(4, lowPart);
 
                 /* The above code implements the previous algorithm. The new algorithm is
                  * a humble attempt at optimizing the interpreter.
                  */
 
                 /* Retrieve the operand from the operand stack. */
-                int64_t operand = zen_OperandStack_popLong(currentStackFrame->m_operandStack);
+                int64_t operand = ZEN_INTERPRETER_POP_LONG();
                 /* Store the retrieved operand in the local variable at index 3. */
-                zen_LocalVariableArray_setLong(currentStackFrame->m_localVariableArray, 3, operand);
+                ZEN_INTERPRETER_SET_LOCAL_LONG(3, operand);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `store_l3` (operand = %l, index = 3, operand stack = %d)",
-                    operand, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
             /* NOTE: The store_f and store_d instructions are implemented in terms of
@@ -3176,88 +4002,88 @@ void zen_Interpreter_interpret(zen_Interpreter_t* interpreter) {
              * array store decimal values as integers.
              */
 
-            case ZEN_BYTE_CODE_STORE_F: { /* store_f */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_STORE_F) { /* store_f */
                 /* Read the index of the local variable to modify. */
-                uint8_t index = instructions[currentStackFrame->m_ip++];
+                uint8_t index = instructions[ip++];
                 /* Retrieve the operand from the operand stack. */
-                int32_t operand = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand = ZEN_INTERPRETER_POP_INTEGER();
                 /* Update the value of the local variable with the specified index. */
-                zen_LocalVariableArray_setInteger(currentStackFrame->m_localVariableArray, index, operand);
+                ZEN_INTERPRETER_SET_LOCAL_INTEGER(index, operand);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `store_f` (operand = 0x%X, index = %d, operand stack = %d)",
-                    operand, index, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, index, ZEN_INTERPRETER_GET_STACK_SIZE());
 
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_STORE_F0: { /* store_f0 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_STORE_F0) { /* store_f0 */
                 /* Retrieve the operand from the operand stack. It represents
                  * the bit pattern of 32-bit decimal value.
                  */
-                int32_t operand = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand = ZEN_INTERPRETER_POP_INTEGER();
                 /* Store the retrieved bit pattern of the 32-decimal value operand
                  * in the local variable at index 0.
                  */
-                zen_LocalVariableArray_setInteger(currentStackFrame->m_localVariableArray, 0, operand);
+                ZEN_INTERPRETER_SET_LOCAL_INTEGER(0, operand);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `store_f0` (operand = %d, index = 0, operand stack = %d)",
-                    operand, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_STORE_F1: { /* store_f1 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_STORE_F1) { /* store_f1 */
                 /* Retrieve the operand from the operand stack. It represents
                  * the bit pattern of 32-bit decimal value.
                  */
-                int32_t operand = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand = ZEN_INTERPRETER_POP_INTEGER();
                 /* Store the retrieved bit pattern of the 32-decimal value operand
                  * in the local variable at index 1.
                  */
-                zen_LocalVariableArray_setInteger(currentStackFrame->m_localVariableArray, 1, operand);
+                ZEN_INTERPRETER_SET_LOCAL_INTEGER(1, operand);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `store_f1` (operand = %d, index = 1, operand stack = %d)",
-                    operand, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_STORE_F2: { /* store_f2 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_STORE_F2) { /* store_f2 */
                 /* Retrieve the operand from the operand stack. It represents
                  * the bit pattern of 32-bit decimal value.
                  */
-                int32_t operand = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand = ZEN_INTERPRETER_POP_INTEGER();
                 /* Store the retrieved bit pattern of the 32-decimal value operand
                  * in the local variable at index 2.
                  */
-                zen_LocalVariableArray_setInteger(currentStackFrame->m_localVariableArray, 2, operand);
+                ZEN_INTERPRETER_SET_LOCAL_INTEGER(2, operand);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `store_f2` (operand = %d, index = 2, operand stack = %d)",
-                    operand, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_STORE_F3: { /* store_f3 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_STORE_F3) { /* store_f3 */
                 /* Retrieve the operand from the operand stack. It represents
                  * the bit pattern of 32-bit decimal value.
                  */
-                int32_t operand = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand = ZEN_INTERPRETER_POP_INTEGER();
                 /* Store the retrieved bit pattern of the 32-decimal value operand
                  * in the local variable at index 3.
                  */
-                zen_LocalVariableArray_setInteger(currentStackFrame->m_localVariableArray, 3, operand);
+                ZEN_INTERPRETER_SET_LOCAL_INTEGER(3, operand);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `store_f3` (operand = %d, index = 3, operand stack = %d)",
-                    operand, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
             /* NOTE: The order in which the high and low parts are stored should
@@ -3265,409 +4091,581 @@ void zen_Interpreter_interpret(zen_Interpreter_t* interpreter) {
              *       loaded.
              */
 
-            case ZEN_BYTE_CODE_STORE_D: { /* store_d */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_STORE_D) { /* store_d */
                 /* Read the index of the local variable to modify. */
-                uint8_t index = instructions[currentStackFrame->m_ip++];
+                uint8_t index = instructions[ip++];
                 /* Retrieve the operand from the operand stack. */
-                int64_t operand = zen_OperandStack_popLong(currentStackFrame->m_operandStack);
+                int64_t operand = ZEN_INTERPRETER_POP_LONG();
                 /* Update the value of the local variable with the specified index. */
-                zen_LocalVariableArray_setLong(currentStackFrame->m_localVariableArray, index, operand);
+                ZEN_INTERPRETER_SET_LOCAL_LONG(index, operand);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `store_d` (operand = 0x%X, index = %d, operand stack = %d)",
-                    operand, index, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, index, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_STORE_D0: { /* store_d0 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_STORE_D0) { /* store_d0 */
                 /* Retrieve a 32-bit integer operand from the operand stack.
                  * It represents the low-part of the bit pattern of the 64-bit
                  * decimal value.
                  */
-                // int32_t lowPart = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                // int32_t lowPart = ZEN_INTERPRETER_POP_INTEGER();
                 /* Retrieve a 32-bit integer operand from the operand stack.
                  * It represents the high-part of the bit pattern of the 64-bit
                  * decimal value.
                  */
-                // int32_t highPart = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                // int32_t highPart = ZEN_INTERPRETER_POP_INTEGER();
                 /* Store the retrieved operands in the local variable at index 0.
                  *
                  * A 64-bit decimal value occupies two indexes in the local variable
                  * array. The high part is stored at index 0. The low part is stored
                  * in the subsequent index, that is 1.
                  */
-                // zen_LocalVariableArray_setInteger(currentStackFrame->m_localVariableArray, 0, highPart);
-                // zen_LocalVariableArray_setInteger(currentStackFrame->m_localVariableArray, 1, lowPart);
+                // ZEN_INTERPRETER_SET_LOCAL_INTEGER(0, highPart);
+                // ZEN_INTERPRETER_SET_LOCAL_INTEGER(1, lowPart);
 
                 /* The above code implements the previous algorithm. The new algorithm is
                  * a humble attempt at optimizing the interpreter.
                  */
 
                 /* Retrieve the operand from the operand stack. */
-                int64_t operand = zen_OperandStack_popLong(currentStackFrame->m_operandStack);
+                int64_t operand = ZEN_INTERPRETER_POP_LONG();
                 /* Store the retrieved operand in the local variable at index 0. */
-                zen_LocalVariableArray_setLong(currentStackFrame->m_localVariableArray, 0, operand);
+                ZEN_INTERPRETER_SET_LOCAL_LONG(0, operand);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `store_d0` (operand = %l, index = 0, operand stack = %d)",
-                    operand, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_STORE_D1: { /* store_d1 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_STORE_D1) { /* store_d1 */
                 /* Retrieve a 32-bit integer operand from the operand stack.
                  * It represents the low-part of the bit pattern of the 64-bit
                  * decimal value.
                  */
-                // int32_t lowPart = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                // int32_t lowPart = ZEN_INTERPRETER_POP_INTEGER();
                 /* Retrieve a 32-bit integer operand from the operand stack.
                  * It represents the high-part of the bit pattern of the 64-bit
                  * decimal value.
                  */
-                // int32_t highPart = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                // int32_t highPart = ZEN_INTERPRETER_POP_INTEGER();
                 /* Store the retrieved operands in the local variable at index 1.
                  *
                  * A 64-bit decimal value occupies two indexes in the local variable
                  * array. The high part is stored at index 1. The low part is stored
                  * in the subsequent index, that is 2.
                  */
-                // zen_LocalVariableArray_setInteger(currentStackFrame->m_localVariableArray, 1, highPart);
-                // zen_LocalVariableArray_setInteger(currentStackFrame->m_localVariableArray, 2, lowPart);
+                // ZEN_INTERPRETER_SET_LOCAL_INTEGER(1, highPart);
+                // ZEN_INTERPRETER_SET_LOCAL_INTEGER(2, lowPart);
 
                 /* The above code implements the previous algorithm. The new algorithm is
                  * a humble attempt at optimizing the interpreter.
                  */
 
                 /* Retrieve the operand from the operand stack. */
-                int64_t operand = zen_OperandStack_popLong(currentStackFrame->m_operandStack);
+                int64_t operand = ZEN_INTERPRETER_POP_LONG();
                 /* Store the retrieved operand in the local variable at index 1. */
-                zen_LocalVariableArray_setLong(currentStackFrame->m_localVariableArray, 1, operand);
+                ZEN_INTERPRETER_SET_LOCAL_LONG(1, operand);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `store_d1` (operand = %l, index = 1, operand stack = %d)",
-                    operand, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_STORE_D2: { /* store_d2 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_STORE_D2) { /* store_d2 */
                 /* Retrieve a 32-bit integer operand from the operand stack.
                  * It represents the low-part of the bit pattern of the 64-bit
                  * decimal value.
                  */
-                // int32_t lowPart = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                // int32_t lowPart = ZEN_INTERPRETER_POP_INTEGER();
                 /* Retrieve a 32-bit integer operand from the operand stack.
                  * It represents the high-part of the bit pattern of the 64-bit
                  * decimal value.
                  */
-                // int32_t highPart = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                // int32_t highPart = ZEN_INTERPRETER_POP_INTEGER();
                 /* Store the retrieved operands in the local variable at index 2.
                  *
                  * A 64-bit decimal value occupies two indexes in the local variable
                  * array. The high part is stored at index 2. The low part is stored
                  * in the subsequent index, that is 3.
                  */
-                // zen_LocalVariableArray_setInteger(currentStackFrame->m_localVariableArray, 2, highPart);
-                // zen_LocalVariableArray_setInteger(currentStackFrame->m_localVariableArray, 3, lowPart);
+                // ZEN_INTERPRETER_SET_LOCAL_INTEGER(2, highPart);
+                // ZEN_INTERPRETER_SET_LOCAL_INTEGER(3, lowPart);
 
                 /* Retrieve the operand from the operand stack. */
-                int64_t operand = zen_OperandStack_popLong(currentStackFrame->m_operandStack);
+                int64_t operand = ZEN_INTERPRETER_POP_LONG();
                 /* Store the retrieved operand in the local variable at index 0. */
-                zen_LocalVariableArray_setLong(currentStackFrame->m_localVariableArray, 0, operand);
+                ZEN_INTERPRETER_SET_LOCAL_LONG(0, operand);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `store_d2` (operand = %l, index = 1, operand stack = %d)",
-                    operand, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_STORE_D3: { /* store_d3 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_STORE_D3) { /* store_d3 */
                 /* Retrieve a 32-bit integer operand from the operand stack.
                  * It represents the low-part of the bit pattern of the 64-bit
                  * decimal value.
                  */
-                // int32_t lowPart = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                // int32_t lowPart = ZEN_INTERPRETER_POP_INTEGER();
                 /* Retrieve a 32-bit integer operand from the operand stack.
                  * It represents the high-part of the bit pattern of the 64-bit
                  * decimal value.
                  */
-                // int32_t highPart = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                // int32_t highPart = ZEN_INTERPRETER_POP_INTEGER();
                 /* Store the retrieved operands in the local variable at index 3.
                  *
                  * A 64-bit decimal value occupies two indexes in the local variable
                  * array. The high part is stored at index 3. The low part is stored
                  * in the subsequent index, that is 4.
                  */
-                // zen_LocalVariableArray_setInteger(currentStackFrame->m_localVariableArray, 3, highPart);
-                // zen_LocalVariableArray_setInteger(currentStackFrame->m_localVariableArray, 4, lowPart);
+                // ZEN_INTERPRETER_SET_LOCAL_INTEGER(3, highPart);
+                // ZEN_INTERPRETER_SET_LOCAL_INTEGER(4, lowPart);
 
                 /* Retrieve the operand from the operand stack. */
-                int64_t operand = zen_OperandStack_popLong(currentStackFrame->m_operandStack);
+                int64_t operand = ZEN_INTERPRETER_POP_LONG();
                 /* Store the retrieved operand in the local variable at index 3. */
-                zen_LocalVariableArray_setLong(currentStackFrame->m_localVariableArray, 3, operand);
+                ZEN_INTERPRETER_SET_LOCAL_LONG(3, operand);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `store_d3` (operand = %l, index = 3, operand stack = %d)",
-                    operand, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_STORE_A: { /* store_a */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_STORE_A) { /* store_a */
                 /* Read the index of the local variable to modify. */
-                uint8_t index = instructions[currentStackFrame->m_ip++];
+                uint8_t index = instructions[ip++];
                 /* Retrieve the operand from the operand stack. */
-                intptr_t operand = zen_OperandStack_popReference(currentStackFrame->m_operandStack);
+                intptr_t operand = ZEN_INTERPRETER_POP_REFERENCE();
                 /* Update the value of the local variable with the specified index. */
-                zen_LocalVariableArray_setReference(currentStackFrame->m_localVariableArray, index, operand);
+                ZEN_INTERPRETER_SET_LOCAL_REFERENCE(index, operand);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `store_a` (operand = 0x%X, index = %d, operand stack = %d)",
-                    operand, index, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, index, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_STORE_A0: { /* store_a0 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_STORE_A0) { /* store_a0 */
                 /* Retrieve the operand from the operand stack. It represents
                  * the address of an object.
                  */
-                intptr_t operand = zen_OperandStack_popReference(currentStackFrame->m_operandStack);
+                intptr_t operand = ZEN_INTERPRETER_POP_REFERENCE();
                 /* Store the retrieved address of the object in the local variable
                  * at index 0.
                  */
-                zen_LocalVariableArray_setReference(currentStackFrame->m_localVariableArray, 0, operand);
+                ZEN_INTERPRETER_SET_LOCAL_REFERENCE(0, operand);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `store_a0` (operand = 0x%X, index = 0, operand stack = %d)",
-                    operand, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_STORE_A1: { /* store_a1 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_STORE_A1) { /* store_a1 */
                 /* Retrieve the operand from the operand stack. It represents
                  * the address of an object.
                  */
-                intptr_t operand = zen_OperandStack_popReference(currentStackFrame->m_operandStack);
+                intptr_t operand = ZEN_INTERPRETER_POP_REFERENCE();
                 /* Store the retrieved address of the object in the local variable
                  * at index 1.
                  */
-                zen_LocalVariableArray_setReference(currentStackFrame->m_localVariableArray, 1, operand);
+                ZEN_INTERPRETER_SET_LOCAL_REFERENCE(1, operand);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `store_a1` (operand = 0x%X, index = 1, operand stack = %d)",
-                    operand, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_STORE_A2: { /* store_a2 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_STORE_A2) { /* store_a2 */
                 /* Retrieve the operand from the operand stack. It represents
                  * the address of an object.
                  */
-                intptr_t operand = zen_OperandStack_popReference(currentStackFrame->m_operandStack);
+                intptr_t operand = ZEN_INTERPRETER_POP_REFERENCE();
                 /* Store the retrieved address of the object in the local variable
                  * at index 2.
                  */
-                zen_LocalVariableArray_setReference(currentStackFrame->m_localVariableArray, 2, operand);
+                ZEN_INTERPRETER_SET_LOCAL_REFERENCE(2, operand);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `store_a2` (operand = 0x%X, index = 2, operand stack = %d)",
-                    operand, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_STORE_A3: { /* store_a3 */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_STORE_A3) { /* store_a3 */
                 /* Retrieve the operand from the operand stack. It represents
                  * the address of an object.
                  */
-                intptr_t operand = zen_OperandStack_popReference(currentStackFrame->m_operandStack);
+                intptr_t operand = ZEN_INTERPRETER_POP_REFERENCE();
                 /* Store the retrieved address of the object in the local variable
                  * at index 3.
                  */
-                zen_LocalVariableArray_setReference(currentStackFrame->m_localVariableArray, 3, operand);
+                ZEN_INTERPRETER_SET_LOCAL_REFERENCE(3, operand);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `store_a3` (operand = 0x%X, index = 3, operand stack = %d)",
-                    operand, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_STORE_AB: { /* store_ab */
-                break;
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_STORE_AB) { /* store_ab */
+                /* Retrieve the value from the operand stack. */
+                int8_t value = (int8_t)ZEN_INTERPRETER_POP_INTEGER();
+                /* Retrieve the index from the operand stack. */
+                int32_t index = ZEN_INTERPRETER_POP_INTEGER();
+                /* Retrieve the array from the operand stack. */
+                zen_Object_t* array = (zen_Object_t*)ZEN_INTERPRETER_POP_REFERENCE();
+                /* The arrays of booleans are accessed with the byte instructions. */
+                if (!ZEN_INTERPRETER_IS_ARRAY_ACCESSIBLE(array, index, ZEN_TYPE_INTEGER_8) &&
+                    !ZEN_INTERPRETER_IS_ARRAY_ACCESSIBLE(array, index, ZEN_TYPE_BOOLEAN)) {
+                    ZEN_INTERPRETER_RAISE_ARRAY_ACCESS_EXCEPTION(array, index);
+                }
+                /* Update the element at the specified index. */
+                ZEN_ARRAY_GET_ELEMENTS(array, int8_t)[index] = value;
+
+                /* Log debugging information for assistance in debugging the interpreter. */
+                jtk_Logger_debug(logger, "Executed instruction `store_ab` (value = %d, index = %d, array = 0x%X, operand stack = %d)",
+                    value, index, array, ZEN_INTERPRETER_GET_STACK_SIZE());
+
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_STORE_AC: { /* store_ac */
-                break;
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_STORE_AC) { /* store_ac */
+                /* Retrieve the value from the operand stack. */
+                uint16_t value = (uint16_t)ZEN_INTERPRETER_POP_INTEGER();
+                /* Retrieve the index from the operand stack. */
+                int32_t index = ZEN_INTERPRETER_POP_INTEGER();
+                /* Retrieve the array from the operand stack. */
+                zen_Object_t* array = (zen_Object_t*)ZEN_INTERPRETER_POP_REFERENCE();
+                if (!ZEN_INTERPRETER_IS_ARRAY_ACCESSIBLE(array, index, ZEN_TYPE_CHARACTER)) {
+                    ZEN_INTERPRETER_RAISE_ARRAY_ACCESS_EXCEPTION(array, index);
+                }
+                /* Update the element at the specified index. */
+                ZEN_ARRAY_GET_ELEMENTS(array, uint16_t)[index] = value;
+
+                /* Log debugging information for assistance in debugging the interpreter. */
+                jtk_Logger_debug(logger, "Executed instruction `store_ac` (value = %d, index = %d, array = 0x%X, operand stack = %d)",
+                    value, index, array, ZEN_INTERPRETER_GET_STACK_SIZE());
+
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_STORE_AS: { /* store_as */
-                break;
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_STORE_AS) { /* store_as */
+                /* Retrieve the value from the operand stack. */
+                int16_t value = (int16_t)ZEN_INTERPRETER_POP_INTEGER();
+                /* Retrieve the index from the operand stack. */
+                int32_t index = ZEN_INTERPRETER_POP_INTEGER();
+                /* Retrieve the array from the operand stack. */
+                zen_Object_t* array = (zen_Object_t*)ZEN_INTERPRETER_POP_REFERENCE();
+                if (!ZEN_INTERPRETER_IS_ARRAY_ACCESSIBLE(array, index, ZEN_TYPE_INTEGER_16)) {
+                    ZEN_INTERPRETER_RAISE_ARRAY_ACCESS_EXCEPTION(array, index);
+                }
+                /* Update the element at the specified index. */
+                ZEN_ARRAY_GET_ELEMENTS(array, int16_t)[index] = value;
+
+                /* Log debugging information for assistance in debugging the interpreter. */
+                jtk_Logger_debug(logger, "Executed instruction `store_as` (value = %d, index = %d, array = 0x%X, operand stack = %d)",
+                    value, index, array, ZEN_INTERPRETER_GET_STACK_SIZE());
+
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_STORE_AI: { /* store_ai */
-                break;
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_STORE_AI) { /* store_ai */
+                /* Retrieve the value from the operand stack. */
+                int32_t value = (int32_t)ZEN_INTERPRETER_POP_INTEGER();
+                /* Retrieve the index from the operand stack. */
+                int32_t index = ZEN_INTERPRETER_POP_INTEGER();
+                /* Retrieve the array from the operand stack. */
+                zen_Object_t* array = (zen_Object_t*)ZEN_INTERPRETER_POP_REFERENCE();
+                if (!ZEN_INTERPRETER_IS_ARRAY_ACCESSIBLE(array, index, ZEN_TYPE_INTEGER_32)) {
+                    ZEN_INTERPRETER_RAISE_ARRAY_ACCESS_EXCEPTION(array, index);
+                }
+                /* Update the element at the specified index. */
+                ZEN_ARRAY_GET_ELEMENTS(array, int32_t)[index] = value;
+
+                /* Log debugging information for assistance in debugging the interpreter. */
+                jtk_Logger_debug(logger, "Executed instruction `store_ai` (value = %d, index = %d, array = 0x%X, operand stack = %d)",
+                    value, index, array, ZEN_INTERPRETER_GET_STACK_SIZE());
+
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_STORE_AL: { /* store_al */
-                break;
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_STORE_AL) { /* store_al */
+                /* Retrieve the value from the operand stack. */
+                int64_t value = ZEN_INTERPRETER_POP_LONG();
+                /* Retrieve the index from the operand stack. */
+                int32_t index = ZEN_INTERPRETER_POP_INTEGER();
+                /* Retrieve the array from the operand stack. */
+                zen_Object_t* array = (zen_Object_t*)ZEN_INTERPRETER_POP_REFERENCE();
+                if (!ZEN_INTERPRETER_IS_ARRAY_ACCESSIBLE(array, index, ZEN_TYPE_INTEGER_64)) {
+                    ZEN_INTERPRETER_RAISE_ARRAY_ACCESS_EXCEPTION(array, index);
+                }
+                /* Update the element at the specified index. */
+                ZEN_ARRAY_GET_ELEMENTS(array, int64_t)[index] = value;
+
+                /* Log debugging information for assistance in debugging the interpreter. */
+                jtk_Logger_debug(logger, "Executed instruction `store_al` (value = %ld, index = %d, array = 0x%X, operand stack = %d)",
+                    value, index, array, ZEN_INTERPRETER_GET_STACK_SIZE());
+
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_STORE_AF: { /* store_af */
-                break;
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_STORE_AF) { /* store_af */
+                /* Retrieve the value from the operand stack. */
+                float value = ZEN_INTERPRETER_POP_FLOAT();
+                /* Retrieve the index from the operand stack. */
+                int32_t index = ZEN_INTERPRETER_POP_INTEGER();
+                /* Retrieve the array from the operand stack. */
+                zen_Object_t* array = (zen_Object_t*)ZEN_INTERPRETER_POP_REFERENCE();
+                if (!ZEN_INTERPRETER_IS_ARRAY_ACCESSIBLE(array, index, ZEN_TYPE_DECIMAL_32)) {
+                    ZEN_INTERPRETER_RAISE_ARRAY_ACCESS_EXCEPTION(array, index);
+                }
+                /* Update the element at the specified index. */
+                ZEN_ARRAY_GET_ELEMENTS(array, float)[index] = value;
+
+                /* Log debugging information for assistance in debugging the interpreter. */
+                jtk_Logger_debug(logger, "Executed instruction `store_af` (value = %f, index = %d, array = 0x%X, operand stack = %d)",
+                    value, index, array, ZEN_INTERPRETER_GET_STACK_SIZE());
+
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_STORE_AD: { /* store_ad */
-                break;
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_STORE_AD) { /* store_ad */
+                /* Retrieve the value from the operand stack. */
+                double value = ZEN_INTERPRETER_POP_DOUBLE();
+                /* Retrieve the index from the operand stack. */
+                int32_t index = ZEN_INTERPRETER_POP_INTEGER();
+                /* Retrieve the array from the operand stack. */
+                zen_Object_t* array = (zen_Object_t*)ZEN_INTERPRETER_POP_REFERENCE();
+                if (!ZEN_INTERPRETER_IS_ARRAY_ACCESSIBLE(array, index, ZEN_TYPE_DECIMAL_64)) {
+                    ZEN_INTERPRETER_RAISE_ARRAY_ACCESS_EXCEPTION(array, index);
+                }
+                /* Update the element at the specified index. */
+                ZEN_ARRAY_GET_ELEMENTS(array, double)[index] = value;
+
+                /* Log debugging information for assistance in debugging the interpreter. */
+                jtk_Logger_debug(logger, "Executed instruction `store_ad` (value = %f, index = %d, array = 0x%X, operand stack = %d)",
+                    value, index, array, ZEN_INTERPRETER_GET_STACK_SIZE());
+
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_STORE_AA: { /* store_aa */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_STORE_AA) { /* store_aa */
                 /* Retrieve the value from the operand stack. */
-                uintptr_t value = zen_OperandStack_popReference(currentStackFrame->m_operandStack);
+                uintptr_t value = ZEN_INTERPRETER_POP_REFERENCE();
                 /* Retrieve the index from the operand stack. */
-                int32_t index = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t index = ZEN_INTERPRETER_POP_INTEGER();
                 /* Retrieve the array from the operand stack. */
-                jtk_Array_t* array = (jtk_Array_t*)zen_OperandStack_popReference(currentStackFrame->m_operandStack);
-                /* Update the value at the specified index. */
-                jtk_Array_setValue(array, index, value);
+                zen_Object_t* array = (zen_Object_t*)ZEN_INTERPRETER_POP_REFERENCE();
+                if (!ZEN_INTERPRETER_IS_ARRAY_ACCESSIBLE(array, index, ZEN_TYPE_REFERENCE)) {
+                    ZEN_INTERPRETER_RAISE_ARRAY_ACCESS_EXCEPTION(array, index);
+                }
+                /* Update the element at the specified index. The elements belong
+                 * to the array, therefore, its card is dirtied.
+                 */
+                uintptr_t* element = &ZEN_ARRAY_GET_ELEMENTS(array, uintptr_t)[index];
+                ZEN_MEMORY_MANAGER_PRE_WRITE_BARRIER(manager, element);
+                *element = value;
+                ZEN_MEMORY_MANAGER_WRITE_BARRIER(manager, array, value);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `store_aa` (value = 0x%X, index = %d, array = 0x%X, operand stack = %d)",
-                    value, index, array, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    value, index, array, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_STORE_STATIC_FIELD: { /* store_static_field */
-                break;
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_STORE_STATIC_FIELD) { /* store_static_field */
+                uint16_t index = ZEN_INTERPRETER_READ_SHORT();
+                /* The value is left on the operand stack, because an assignment
+                 * evaluates to the assigned value.
+                 */
+                uintptr_t value = ZEN_INTERPRETER_PEEK_REFERENCE();
+
+                zen_FieldCache_t* fieldCache = (zen_FieldCache_t*)ZEN_FUNCTION_GET_SITE_CACHE(
+                    currentStackFrame->m_function, ip - 3);
+                if (fieldCache->m_address == NULL) {
+                    ZEN_INTERPRETER_SAVE_STATE();
+                    if (!zen_Interpreter_linkStaticField(interpreter, currentStackFrame,
+                        fieldCache, index)) {
+                        goto handleException;
+                    }
+                }
+                /* The static fields are roots, which the garbage collector
+                 * visits during every collection. Therefore, the write barrier
+                 * is not required.
+                 */
+                *((uintptr_t*)fieldCache->m_address) = value;
+
+                /* Log debugging information for assistance in debugging the interpreter. */
+                jtk_Logger_debug(logger, "Executed instruction `store_static_field` (index = %d, value = 0x%X, operand stack = %d)",
+                    index, value, ZEN_INTERPRETER_GET_STACK_SIZE());
+
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_STORE_INSTANCE_FIELD: { /* store_instance_field */
-                break;
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_STORE_INSTANCE_FIELD) { /* store_instance_field */
+                uint16_t index = ZEN_INTERPRETER_READ_SHORT();
+                zen_Object_t* self = (zen_Object_t*)ZEN_INTERPRETER_POP_REFERENCE();
+                /* The value is left on the operand stack, because an assignment
+                 * evaluates to the assigned value.
+                 */
+                uintptr_t value = ZEN_INTERPRETER_PEEK_REFERENCE();
+
+                zen_FieldCache_t* fieldCache = (zen_FieldCache_t*)ZEN_FUNCTION_GET_SITE_CACHE(
+                    currentStackFrame->m_function, ip - 3);
+                if (ZEN_INTERPRETER_IS_EXACT_INSTANCE(self, fieldCache->m_class)) {
+                    uintptr_t* field = (uintptr_t*)((uint8_t*)self + ZEN_OBJECT_HEADER_SIZE +
+                        fieldCache->m_offset);
+                    ZEN_MEMORY_MANAGER_PRE_WRITE_BARRIER(manager, field);
+                    *field = value;
+                    ZEN_MEMORY_MANAGER_WRITE_BARRIER(manager, self, value);
+                    interpreter->m_inlineCacheStatistics.m_fieldHits++;
+                }
+                else {
+                    ZEN_INTERPRETER_SAVE_STATE();
+                    if (!zen_Interpreter_storeInstanceField(interpreter, currentStackFrame,
+                        fieldCache, self, index, value)) {
+                        goto handleException;
+                    }
+                }
+
+                /* Log debugging information for assistance in debugging the interpreter. */
+                jtk_Logger_debug(logger, "Executed instruction `store_instance_field` (index = %d, instance = 0x%X, value = 0x%X, operand stack = %d)",
+                    index, self, value, ZEN_INTERPRETER_GET_STACK_SIZE());
+
+                ZEN_INTERPRETER_DISPATCH();
             }
 
             /* Subtract */
 
-            case ZEN_BYTE_CODE_SUBTRACT_I: { /* subtract_i */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_SUBTRACT_I) { /* subtract_i */
                 /* Retrieve the second operand from the operand stack. */
-                int32_t operand2 = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand2 = ZEN_INTERPRETER_POP_INTEGER();
                 /* Retrieve the first operand from the operand stack. */
-                int32_t operand1 = zen_OperandStack_popInteger(currentStackFrame->m_operandStack);
+                int32_t operand1 = ZEN_INTERPRETER_POP_INTEGER();
                 /* Subtract the operands. Push the result on the operand stack. */
                 int32_t result = operand1 - operand2;
-                zen_OperandStack_pushInteger(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_INTEGER(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `subtract_i` (operand1 = %d, operand2 = %d, result = %d, operand stack = %d)",
-                    operand1, operand2, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand1, operand2, result, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_SUBTRACT_L: { /* subtract_l */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_SUBTRACT_L) { /* subtract_l */
                 /* Retrieve the second operand from the operand stack. */
-                int64_t operand2 = zen_OperandStack_popLong(currentStackFrame->m_operandStack);
+                int64_t operand2 = ZEN_INTERPRETER_POP_LONG();
                 /* Retrieve the first operand from the operand stack. */
-                int64_t operand1 = zen_OperandStack_popLong(currentStackFrame->m_operandStack);
+                int64_t operand1 = ZEN_INTERPRETER_POP_LONG();
                 /* Subtract the operands. Push the result on the operand stack. */
                 int64_t result = operand1 - operand2;
-                zen_OperandStack_pushLong(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_LONG(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `subtract_l` (operand1 = %l, operand2 = %l, result = %l, operand stack = %d)",
-                    operand1, operand2, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand1, operand2, result, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_SUBTRACT_F: { /* subtract_f */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_SUBTRACT_F) { /* subtract_f */
                 /* Retrieve the second operand from the operand stack. */
-                float operand2 = zen_OperandStack_popFloat(currentStackFrame->m_operandStack);
+                float operand2 = ZEN_INTERPRETER_POP_FLOAT();
                 /* Retrieve the first operand from the operand stack. */
-                float operand1 = zen_OperandStack_popFloat(currentStackFrame->m_operandStack);
+                float operand1 = ZEN_INTERPRETER_POP_FLOAT();
                 /* Subtract the operands. Push the result on the operand stack. */
                 float result = operand1 - operand2;
-                zen_OperandStack_pushFloat(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_FLOAT(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `subtract_f` (operand1 = %f, operand2 = %f, result = %f, operand stack = %d)",
-                    operand1, operand2, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand1, operand2, result, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_SUBTRACT_D: { /* subtract_d */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_SUBTRACT_D) { /* subtract_d */
                 /* Retrieve the second operand from the operand stack. */
-                double operand2 = zen_OperandStack_popDouble(currentStackFrame->m_operandStack);
+                double operand2 = ZEN_INTERPRETER_POP_DOUBLE();
                 /* Retrieve the first operand from the operand stack. */
-                double operand1 = zen_OperandStack_popDouble(currentStackFrame->m_operandStack);
+                double operand1 = ZEN_INTERPRETER_POP_DOUBLE();
                 /* Subtract the operands. Push the result on the operand stack. */
                 double result = operand1 - operand2;
-                zen_OperandStack_pushDouble(currentStackFrame->m_operandStack, result);
+                ZEN_INTERPRETER_PUSH_DOUBLE(result);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `subtract_d` (operand1 = %f, operand2 = %f, result = %f, operand stack = %d)",
-                    operand1, operand2, result, zen_OperandStack_getSize(currentStackFrame->m_operandStack));
+                    operand1, operand2, result, ZEN_INTERPRETER_GET_STACK_SIZE());
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
             /* Swap */
 
-            case ZEN_BYTE_CODE_SWAP: { /* swap */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_SWAP) { /* swap */
                 /* Swap the two operands on top of the stack. */
-                zen_OperandStack_swap(currentStackFrame->m_operandStack);
+                ZEN_INTERPRETER_SWAP();
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `swap`");
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
             }
 
             /* Switch */
 
-            case ZEN_BYTE_CODE_SWITCH_TABLE: { /* switch_table */
-                break;
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_SWITCH_TABLE) { /* switch_table */
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            case ZEN_BYTE_CODE_SWITCH_SEARCH: { /* switch_search */
-                break;
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_SWITCH_SEARCH) { /* switch_search */
+                ZEN_INTERPRETER_DISPATCH();
             }
 
             /* Throw */
 
-            case ZEN_BYTE_CODE_THROW: { /* throw */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_THROW) { /* throw */
                 interpreter->m_state |= ZEN_INTERPRETER_STATE_EXCEPTION_THROWN;
 
                 /* Retrieve the reference to the exception object from the operand stack. */
-                uintptr_t reference = zen_OperandStack_popReference(currentStackFrame->m_operandStack);
-                zen_Object_t* exception = (zen_Object_t*)reference;;
+                uintptr_t reference = ZEN_INTERPRETER_POP_REFERENCE();
+                zen_Object_t* exception = (zen_Object_t*)reference;
 
-                bool possibleNativeFunction = !zen_Interpreter_throw(interpreter, exception);
+                /* The exception handler sites are looked up with the instruction
+                 * pointer of the stack frame.
+                 */
+                ZEN_INTERPRETER_SAVE_STATE();
+                zen_Interpreter_throw(interpreter, exception);
 
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `throw`");
 
-                /* If the thread was terminated because of an exception, the interpreter state for
-                 * that thread is not reset.
-                 */
-                if ((zen_InvocationStack_getSize(interpreter->m_invocationStack) == 0) ||
-                    possibleNativeFunction) {
-                    goto edgeOfEarth;
-                }
-
-                break;
+                goto handleException;
             }
 
             /* Wide */
 
-            case ZEN_BYTE_CODE_WIDE: { /* wide */
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_WIDE) { /* wide */
                 /* Flag the interpreter to switch to wide mode. Only certain instructions are
                  * supported in the wide mode.
                  */
@@ -3676,14 +4674,303 @@ void zen_Interpreter_interpret(zen_Interpreter_t* interpreter) {
                 /* Log debugging information for assistance in debugging the interpreter. */
                 jtk_Logger_debug(logger, "Executed instruction `wide`");
 
-                break;
+                ZEN_INTERPRETER_DISPATCH();
+            }
+
+            /* Operator */
+
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_INVOKE_OPERATOR) { /* invoke_operator */
+                ZEN_INTERPRETER_SAFEPOINT();
+
+                uint8_t operator0 = instructions[ip++];
+
+                /* The operands are left on the operand stack until the function
+                 * that implements the operator is known, because the function
+                 * receives them in the same order.
+                 */
+                zen_Object_t* operand2 = (zen_Object_t*)zen_Interpreter_readReference(
+                    stackTop - ZEN_INTERPRETER_REFERENCE_SLOT_COUNT);
+                zen_Object_t* operand1 = (zen_Object_t*)zen_Interpreter_readReference(
+                    stackTop - (2 * ZEN_INTERPRETER_REFERENCE_SLOT_COUNT));
+
+                if (operand1 == NULL) {
+                    stackTop -= 2 * ZEN_INTERPRETER_REFERENCE_SLOT_COUNT;
+                    ZEN_INTERPRETER_SAVE_STATE();
+                    zen_VirtualMachine_raiseNullReferenceException(interpreter->m_virtualMachine);
+                    goto handleException;
+                }
+
+                zen_Class_t* class1 = zen_Object_getClass(interpreter->m_virtualMachine, operand1);
+                zen_Class_t* class2 = (operand2 != NULL)?
+                    zen_Object_getClass(interpreter->m_virtualMachine, operand2) : NULL;
+
+                /* Every call site has an operator cache. The first entry is
+                 * checked here; the remaining entries are checked out of line.
+                 */
+                zen_OperatorCache_t* operatorCache = (zen_OperatorCache_t*)ZEN_FUNCTION_GET_SITE_CACHE(
+                    currentStackFrame->m_function, ip - 2);
+                bool hit = (operatorCache->m_classes1[0] == class1) &&
+                    (operatorCache->m_classes2[0] == class2);
+
+                if (hit && (operatorCache->m_intrinsic == ZEN_OPERATOR_INTRINSIC_INTEGER)) {
+                    int32_t offset = ZEN_OBJECT_HEADER_SIZE + operatorCache->m_valueOffset;
+                    int64_t value1 = ZEN_INTERPRETER_GET_INTEGER_VALUE(operand1, offset);
+                    int64_t value2 = ZEN_INTERPRETER_GET_INTEGER_VALUE(operand2, offset);
+
+                    /* Division by zero is left to the function that implements
+                     * the operator.
+                     */
+                    if ((value2 != 0) || ((operator0 != ZEN_OPERATOR_DIVIDE) &&
+                        (operator0 != ZEN_OPERATOR_REMAINDER))) {
+                        stackTop -= 2 * ZEN_INTERPRETER_REFERENCE_SLOT_COUNT;
+
+                        /* The result is allocated, which may invoke a constructor. */
+                        ZEN_INTERPRETER_SAVE_STATE();
+                        zen_Object_t* result = zen_Interpreter_evaluateIntegerOperator(
+                            interpreter, operator0, value1, value2);
+                        if ((interpreter->m_state & ZEN_INTERPRETER_STATE_EXCEPTION_THROWN) != 0) {
+                            goto handleException;
+                        }
+                        ZEN_INTERPRETER_LOAD_STATE();
+                        ZEN_INTERPRETER_PUSH_REFERENCE(result);
+
+                        interpreter->m_inlineCacheStatistics.m_operatorIntrinsicHits++;
+
+                        /* Log debugging information for assistance in debugging the interpreter. */
+                        jtk_Logger_debug(logger, "Executed instruction `invoke_operator` (operator = %d, operand stack = %d)",
+                            operator0, ZEN_INTERPRETER_GET_STACK_SIZE());
+
+                        ZEN_INTERPRETER_DISPATCH();
+                    }
+                }
+
+                /* Strings are compared inline. The result is a shared Boolean
+                 * object, therefore, the comparison does not allocate.
+                 */
+                if (hit && (operatorCache->m_intrinsic == ZEN_OPERATOR_INTRINSIC_STRING) &&
+                    ((operator0 == ZEN_OPERATOR_EQUAL) || (operator0 == ZEN_OPERATOR_NOT_EQUAL))) {
+                    bool equal = zen_String_isEqual(operand1, operand2);
+                    stackTop -= 2 * ZEN_INTERPRETER_REFERENCE_SLOT_COUNT;
+
+                    ZEN_INTERPRETER_SAVE_STATE();
+                    zen_Object_t* result = zen_VirtualMachine_newBoolean(interpreter->m_virtualMachine,
+                        equal == (operator0 == ZEN_OPERATOR_EQUAL));
+                    ZEN_INTERPRETER_LOAD_STATE();
+                    ZEN_INTERPRETER_PUSH_REFERENCE(result);
+
+                    interpreter->m_inlineCacheStatistics.m_operatorIntrinsicHits++;
+
+                    /* Log debugging information for assistance in debugging the interpreter. */
+                    jtk_Logger_debug(logger, "Executed instruction `invoke_operator` (operator = %d, operand stack = %d)",
+                        operator0, ZEN_INTERPRETER_GET_STACK_SIZE());
+
+                    ZEN_INTERPRETER_DISPATCH();
+                }
+
+                zen_Function_t* function;
+                if (hit) {
+                    function = operatorCache->m_functions[0];
+                    interpreter->m_inlineCacheStatistics.m_operatorHits++;
+                }
+                else {
+                    function = zen_Interpreter_lookupOperatorFunction(interpreter,
+                        operatorCache, operator0, class1, class2);
+                }
+
+                if ((function != NULL) && !zen_Function_isNative(function)) {
+                    /* The operands are handed over to the stack frame of the
+                     * function as they are.
+                     */
+                    ZEN_INTERPRETER_SAVE_STATE();
+                    ZEN_INTERPRETER_PUSH_STACK_FRAME(function, function->m_argumentSlotCount);
+                    if (!function->m_directArguments) {
+                        zen_Interpreter_unpackArguments(interpreter, function,
+                            &currentStackFrame->m_localVariableArray, false);
+                    }
+                    ZEN_INTERPRETER_LOAD_STATE();
+                }
+                else if (function != NULL) {
+                    zen_Object_t* values[2];
+                    values[1] = (zen_Object_t*)ZEN_INTERPRETER_POP_REFERENCE();
+                    values[0] = (zen_Object_t*)ZEN_INTERPRETER_POP_REFERENCE();
+
+                    ZEN_INTERPRETER_SAVE_STATE();
+
+                    zen_Object_t* result = NULL;
+                    if ((function->m_intrinsic != ZEN_INTRINSIC_NONE) &&
+                        zen_Interpreter_evaluateIntrinsic(interpreter, function, NULL, values, &result)) {
+                        /* The result may have been allocated, which may have
+                         * thrown an exception.
+                         */
+                        if ((interpreter->m_state & ZEN_INTERPRETER_STATE_EXCEPTION_THROWN) != 0) {
+                            goto handleException;
+                        }
+                        ZEN_INTERPRETER_LOAD_STATE();
+                        ZEN_INTERPRETER_PUSH_REFERENCE(result);
+                    }
+                    else if ((function->m_nativeFunction != NULL) &&
+                        ZEN_NATIVE_FUNCTION_IS_FAST(function->m_nativeFunction)) {
+                        result = zen_Interpreter_invokeFastNativeFunction(
+                            interpreter, function, NULL, values);
+                        if (hit && (operatorCache->m_intrinsic == ZEN_OPERATOR_INTRINSIC_STRING)) {
+                            interpreter->m_inlineCacheStatistics.m_operatorIntrinsicHits++;
+                        }
+
+                        /* The invoked function may have thrown an exception. */
+                        if ((interpreter->m_state & ZEN_INTERPRETER_STATE_EXCEPTION_THROWN) != 0) {
+                            goto handleException;
+                        }
+                        ZEN_INTERPRETER_LOAD_STATE();
+                        ZEN_INTERPRETER_PUSH_REFERENCE(result);
+                    }
+                    else {
+                        jtk_Array_t arguments;
+                        arguments.m_values = (void**)values;
+                        arguments.m_size = 2;
+
+                        zen_Interpreter_invokeStaticFunction(interpreter, function, &arguments);
+
+                        /* The invoked function may have thrown an exception. */
+                        if ((interpreter->m_state & ZEN_INTERPRETER_STATE_EXCEPTION_THROWN) != 0) {
+                            goto handleException;
+                        }
+                        ZEN_INTERPRETER_LOAD_STATE();
+                    }
+                }
+                else {
+                    stackTop -= 2 * ZEN_INTERPRETER_REFERENCE_SLOT_COUNT;
+
+                    int32_t nameSize = 0;
+                    const uint8_t* name = zen_Operator_getFunctionName(operator0, &nameSize);
+
+                    ZEN_INTERPRETER_SAVE_STATE();
+                    zen_VirtualMachine_raiseUnknownOperatorException(interpreter->m_virtualMachine,
+                        (name != NULL)? name : (const uint8_t*)"", nameSize);
+                    goto handleException;
+                }
+
+                /* Log debugging information for assistance in debugging the interpreter. */
+                jtk_Logger_debug(logger, "Executed instruction `invoke_operator` (operator = %d, operand stack = %d)",
+                    operator0, ZEN_INTERPRETER_GET_STACK_SIZE());
+
+                ZEN_INTERPRETER_DISPATCH();
             }
 
-            default: {
+            /* Literal */
+
+            ZEN_INTERPRETER_CASE(ZEN_BYTE_CODE_LOAD_LITERAL) { /* load_literal */
+                uint16_t index = ZEN_INTERPRETER_READ_SHORT();
+
+                /* Once resolved, the literal object is pushed without consulting
+                 * the constant pool.
+                 */
+                zen_Object_t* value = currentStackFrame->m_class->m_resolvedEntries[index].m_object;
+                if (value == NULL) {
+                    ZEN_INTERPRETER_SAVE_STATE();
+                    value = zen_Interpreter_resolveLiteral(interpreter,
+                        currentStackFrame->m_class, index);
+
+                    if ((interpreter->m_state & ZEN_INTERPRETER_STATE_EXCEPTION_THROWN) != 0) {
+                        goto handleException;
+                    }
+                    ZEN_INTERPRETER_LOAD_STATE();
+                }
+
+                ZEN_INTERPRETER_PUSH_REFERENCE(value);
+
+                /* Log debugging information for assistance in debugging the interpreter. */
+                jtk_Logger_debug(logger, "Executed instruction `load_literal` (index = %d, result = 0x%X, operand stack = %d)",
+                    index, value, ZEN_INTERPRETER_GET_STACK_SIZE());
+
+                ZEN_INTERPRETER_DISPATCH();
+            }
+
+            ZEN_INTERPRETER_DEFAULT {
                 fprintf(stderr, "[error] Unknown instruction `%X`\n", instruction);
-                break;
+                ZEN_INTERPRETER_DISPATCH();
+            }
+        }
+
+        /* The control reaches here when a function returns, either explicitly
+         * through one of the return instructions or implicitly by falling off the
+         * end of its instructions.
+         */
+    returnFromFunction:
+        {
+            zen_Function_t* function = currentStackFrame->m_function;
+            int32_t returnValue[2];
+            int32_t i;
+
+            if (function->m_returnType == ZEN_TYPE_VOID) {
+                returnSlotCount = 0;
+            }
+            else if (returnSlotCount == 0) {
+                /* A function that returns a value fell off the end of its
+                 * instructions. Return null on its behalf, so that the caller
+                 * always finds a value.
+                 */
+                ZEN_INTERPRETER_PUSH_REFERENCE(NULL);
+                returnSlotCount = ZEN_INTERPRETER_REFERENCE_SLOT_COUNT;
             }
+
+            if (zen_InvocationStack_getSize(interpreter->m_invocationStack) <= entryDepth) {
+                /* The entry frame is returning. Leave the return value on its
+                 * operand stack, where the caller expects it.
+                 */
+                ZEN_INTERPRETER_SAVE_STATE();
+                goto edgeOfEarth;
+            }
+
+            for (i = 0; i < returnSlotCount; i++) {
+                returnValue[i] = stackTop[i - returnSlotCount];
+            }
+
+            zen_InvocationStack_popStackFrame(interpreter->m_invocationStack);
+            currentStackFrame = zen_InvocationStack_peekStackFrame(interpreter->m_invocationStack);
+            ZEN_INTERPRETER_LOAD_STATE();
+
+            for (i = 0; i < returnSlotCount; i++) {
+                *stackTop++ = returnValue[i];
+            }
+
+            /* Log debugging information for assistance in debugging the interpreter. */
+            jtk_Logger_debug(logger, "Returned from function (return slots = %d, operand stack = %d)",
+                returnSlotCount, ZEN_INTERPRETER_GET_STACK_SIZE());
+
+            ZEN_INTERPRETER_DISPATCH();
+        }
+
+        /* The control reaches here only when an instruction causes an exception,
+         * either directly or through a function invocation.
+         */
+    handleException:
+        if ((interpreter->m_handlerStackFrame == NULL) ||
+            (zen_InvocationStack_getSize(interpreter->m_invocationStack) < entryDepth)) {
+            /* The exception handler, if any, belongs to a stack frame beneath the
+             * entry frame. Return the control to the caller, which resumes
+             * propagating the exception. If the thread was terminated because
+             * of an exception, the interpreter state for that thread is not reset.
+             */
+            goto edgeOfEarth;
         }
+
+        /* The stack frames above the handler were unwound by the exception
+         * handler. Resume the execution in the function which handles the
+         * exception.
+         */
+        currentStackFrame = interpreter->m_handlerStackFrame;
+        interpreter->m_state &= ~ZEN_INTERPRETER_STATE_EXCEPTION_THROWN;
+        interpreter->m_exception = NULL;
+        interpreter->m_handlerStackFrame = NULL;
+
+        /* Destroy the stack frames that were traced. */
+        zen_InvocationStack_stopTracing(interpreter->m_invocationStack);
+
+        /* The exception handler updated the instruction pointer and pushed the
+         * exception on the operand stack.
+         */
+        ZEN_INTERPRETER_LOAD_STATE();
+        ZEN_INTERPRETER_DISPATCH();
     }
     edgeOfEarth:
         ;
@@ -3691,6 +4978,49 @@ void zen_Interpreter_interpret(zen_Interpreter_t* interpreter) {
 
 /* Invoke Constructor */
 
+/* Native Handles */
+
+/* Native functions receive the self reference and the arguments through C
+ * variables, which the garbage collector cannot see. They are rooted as
+ * handles for the duration of the invocation.
+ */
+int32_t zen_Interpreter_pushNativeHandles(zen_Interpreter_t* interpreter,
+    zen_Object_t* self, jtk_Array_t* arguments) {
+    zen_MemoryManager_t* manager = interpreter->m_virtualMachine->m_memoryManager;
+    int32_t result = zen_MemoryManager_getHandleCount(manager);
+    if (self != NULL) {
+        zen_MemoryManager_pushHandle(manager, self);
+    }
+    if (arguments != NULL) {
+        int32_t i;
+        for (i = 0; i < arguments->m_size; i++) {
+            zen_MemoryManager_pushHandle(manager, (zen_Object_t*)arguments->m_values[i]);
+        }
+    }
+    return result;
+}
+
+/* Invoke Fast Native Function */
+
+zen_Object_t* zen_Interpreter_invokeFastNativeFunction(zen_Interpreter_t* interpreter,
+    zen_Function_t* function, zen_Object_t* self, zen_Object_t** arguments) {
+    zen_MemoryManager_t* manager = interpreter->m_virtualMachine->m_memoryManager;
+    int32_t handleCount = zen_MemoryManager_getHandleCount(manager);
+    if (self != NULL) {
+        zen_MemoryManager_pushHandle(manager, self);
+    }
+    int32_t i;
+    for (i = 0; i < function->m_parameterCount; i++) {
+        zen_MemoryManager_pushHandle(manager, arguments[i]);
+    }
+
+    zen_Object_t* result = function->m_nativeFunction->m_fastInvoke(
+        interpreter->m_virtualMachine, self, arguments);
+    zen_MemoryManager_popHandles(manager, handleCount);
+
+    return result;
+}
+
 typedef void (*zen_NativeFunction_InvokeConstructorFunction_t)(zen_VirtualMachine_t* virtualMachine, zen_Object_t* self, jtk_VariableArguments_t arguments);
 
 // TODO: Fix this function to accomodate exceptions.
@@ -3701,37 +5031,44 @@ void zen_Interpreter_invokeConstructor(zen_Interpreter_t* interpreter,
     zen_StackFrame_t* stackFrame = zen_InvocationStack_pushStackFrame(interpreter->m_invocationStack,
         constructor);
 
-    if (!zen_Function_isNative(constructor)) {
-        /* Pass the self reference to the constructor. */
-        zen_LocalVariableArray_setReference(stackFrame->m_localVariableArray, 0, object);
-    }
-
     zen_EntityFile_t* entityFile = constructor->m_class->m_entityFile;
     zen_Entity_t* entity = &entityFile->m_entity;
     zen_ConstantPoolUtf8_t* name =
         (zen_ConstantPoolUtf8_t*)entityFile->m_constantPool.m_entries[
             entity->m_reference];
 
-    if (zen_Function_isNative(constructor)) {
-        zen_NativeFunction_t* nativeConstructor = constructor->m_nativeFunction;
-
-        if (nativeConstructor != NULL) {
-            zen_NativeFunction_InvokeConstructorFunction_t invokeConstructor =
-                (zen_NativeFunction_InvokeConstructorFunction_t)nativeConstructor->m_invoke;
-            invokeConstructor(interpreter->m_virtualMachine, object, arguments);
+    if (stackFrame == NULL) {
+        zen_Interpreter_raiseStackOverflowException(interpreter);
+    }
+    else {
+        if (zen_Function_isNative(constructor)) {
+            zen_NativeFunction_t* nativeConstructor = constructor->m_nativeFunction;
+
+            if ((nativeConstructor != NULL) && !ZEN_NATIVE_FUNCTION_IS_FAST(nativeConstructor)) {
+                zen_NativeFunction_InvokeConstructorFunction_t invokeConstructor =
+                    (zen_NativeFunction_InvokeConstructorFunction_t)nativeConstructor->m_invoke;
+                int32_t handleCount = zen_Interpreter_pushNativeHandles(interpreter,
+                    object, arguments);
+                invokeConstructor(interpreter->m_virtualMachine, object, arguments);
+                zen_MemoryManager_popHandles(interpreter->m_virtualMachine->m_memoryManager,
+                    handleCount);
+            }
+            else {
+                printf("[error] Unknown native constructor (class=%s, name=%s, descriptor=%s)\n",
+                    name->m_bytes, constructor->m_name, constructor->m_descriptor);
+            }
         }
         else {
-            printf("[error] Unknown native constructor (class=%s, name=%s, descriptor=%s)\n",
-                name->m_bytes, constructor->m_name, constructor->m_descriptor);
+            /* Pass the self reference to the constructor. */
+            zen_LocalVariableArray_setReference(&stackFrame->m_localVariableArray, 0, object);
+
+            zen_Interpreter_loadArguments(interpreter, constructor, &stackFrame->m_localVariableArray,
+                arguments, true);
+            zen_Interpreter_interpret(interpreter);
         }
-    }
-    else {
-        zen_Interpreter_loadArguments(interpreter, constructor, stackFrame->m_localVariableArray,
-            arguments, true);
-        zen_Interpreter_interpret(interpreter);
-    }
 
-    zen_InvocationStack_popStackFrame(interpreter->m_invocationStack);
+        zen_InvocationStack_popStackFrame(interpreter->m_invocationStack);
+    }
 }
 
 /* Invoke Native */
@@ -3756,17 +5093,29 @@ zen_Object_t* zen_Interpreter_invokeStaticFunction(zen_Interpreter_t* interprete
             entity->m_reference];
 
     zen_Object_t* result = NULL;
-    if (zen_Function_isNative(function)) {
+    if (stackFrame == NULL) {
+        zen_Interpreter_raiseStackOverflowException(interpreter);
+    }
+    else if (zen_Function_isNative(function)) {
         zen_NativeFunction_t* nativeFunction = function->m_nativeFunction;
 
         if (nativeFunction != NULL) {
-            zen_NativeFunction_InvokeFunction_t invoke = nativeFunction->m_invoke;
-            result = invoke(interpreter->m_virtualMachine, NULL, arguments);
+            int32_t handleCount = zen_Interpreter_pushNativeHandles(interpreter,
+                NULL, arguments);
+            if (ZEN_NATIVE_FUNCTION_IS_FAST(nativeFunction)) {
+                result = nativeFunction->m_fastInvoke(interpreter->m_virtualMachine, NULL,
+                    (arguments != NULL)? (zen_Object_t**)arguments->m_values : NULL);
+            }
+            else {
+                result = nativeFunction->m_invoke(interpreter->m_virtualMachine, NULL, arguments);
+            }
+            zen_MemoryManager_popHandles(interpreter->m_virtualMachine->m_memoryManager,
+                handleCount);
 
             if ((function->m_returnType != ZEN_TYPE_VOID) &&
                 ((interpreter->m_state & ZEN_INTERPRETER_STATE_EXCEPTION_THROWN) == 0) &&
                 (oldStackFrame != NULL)) {
-                zen_OperandStack_pushReference(oldStackFrame->m_operandStack, result);
+                zen_OperandStack_pushReference(&oldStackFrame->m_operandStack, result);
             }
 
             /* Always pop the stack frame of a native function, regardless of an
@@ -3785,15 +5134,15 @@ zen_Object_t* zen_Interpreter_invokeStaticFunction(zen_Interpreter_t* interprete
         }
     }
     else {
-        zen_Interpreter_loadArguments(interpreter, function, stackFrame->m_localVariableArray,
+        zen_Interpreter_loadArguments(interpreter, function, &stackFrame->m_localVariableArray,
             arguments, false);
         zen_Interpreter_interpret(interpreter);
 
         if ((interpreter->m_state & ZEN_INTERPRETER_STATE_EXCEPTION_THROWN) == 0) {
             if ((function->m_returnType != ZEN_TYPE_VOID) &&
                 (oldStackFrame != NULL)) {
-                result = zen_OperandStack_popReference(stackFrame->m_operandStack);
-                zen_OperandStack_pushReference(oldStackFrame->m_operandStack, result);
+                result = zen_OperandStack_popReference(&stackFrame->m_operandStack);
+                zen_OperandStack_pushReference(&oldStackFrame->m_operandStack, result);
             }
 
             /* Do not pop the stack frame if an exception is being thrown. The stack frames
@@ -3812,8 +5161,13 @@ void zen_Interpreter_invokeStaticFunctionEx(zen_Interpreter_t* interpreter,
 
     zen_StackFrame_t* stackFrame = zen_InvocationStack_pushStackFrame(interpreter->m_invocationStack,
         function);
-    zen_Interpreter_interpret(interpreter);
-    // zen_InvocationStack_popStackFrame(interpreter->m_invocationStack);
+    if (stackFrame == NULL) {
+        zen_Interpreter_raiseStackOverflowException(interpreter);
+    }
+    else {
+        zen_Interpreter_interpret(interpreter);
+        // zen_InvocationStack_popStackFrame(interpreter->m_invocationStack);
+    }
 }
 
 /* Invoke Virtual Function */
@@ -3824,10 +5178,6 @@ zen_Object_t* zen_Interpreter_invokeVirtualFunction(zen_Interpreter_t* interpret
     zen_StackFrame_t* stackFrame = zen_InvocationStack_pushStackFrame(interpreter->m_invocationStack,
         function);
 
-    if (!zen_Function_isNative(function)) {
-        zen_LocalVariableArray_setReference(stackFrame->m_localVariableArray, 0, object);
-    }
-
     zen_EntityFile_t* entityFile = function->m_class->m_entityFile;
     zen_Entity_t* entity = &entityFile->m_entity;
     zen_ConstantPoolUtf8_t* name =
@@ -3835,17 +5185,29 @@ zen_Object_t* zen_Interpreter_invokeVirtualFunction(zen_Interpreter_t* interpret
             entity->m_reference];
 
     zen_Object_t* result = NULL;
-    if (zen_Function_isNative(function)) {
+    if (stackFrame == NULL) {
+        zen_Interpreter_raiseStackOverflowException(interpreter);
+    }
+    else if (zen_Function_isNative(function)) {
         zen_NativeFunction_t* nativeFunction = function->m_nativeFunction;
 
         if (nativeFunction != NULL) {
-            zen_NativeFunction_InvokeFunction_t invoke = nativeFunction->m_invoke;
-            result = invoke(interpreter->m_virtualMachine, object, arguments);
+            int32_t handleCount = zen_Interpreter_pushNativeHandles(interpreter,
+                object, arguments);
+            if (ZEN_NATIVE_FUNCTION_IS_FAST(nativeFunction)) {
+                result = nativeFunction->m_fastInvoke(interpreter->m_virtualMachine, object,
+                    (arguments != NULL)? (zen_Object_t**)arguments->m_values : NULL);
+            }
+            else {
+                result = nativeFunction->m_invoke(interpreter->m_virtualMachine, object, arguments);
+            }
+            zen_MemoryManager_popHandles(interpreter->m_virtualMachine->m_memoryManager,
+                handleCount);
 
             if ((function->m_returnType != ZEN_TYPE_VOID) &&
                 ((interpreter->m_state & ZEN_INTERPRETER_STATE_EXCEPTION_THROWN) == 0) &&
                 (oldStackFrame != NULL)) {
-                zen_OperandStack_pushReference(oldStackFrame->m_operandStack, result);
+                zen_OperandStack_pushReference(&oldStackFrame->m_operandStack, result);
             }
 
             /* Always pop the stack frame of a native function, regardless of an
@@ -3864,15 +5226,17 @@ zen_Object_t* zen_Interpreter_invokeVirtualFunction(zen_Interpreter_t* interpret
         }
     }
     else {
-        zen_Interpreter_loadArguments(interpreter, function, stackFrame->m_localVariableArray,
+        zen_LocalVariableArray_setReference(&stackFrame->m_localVariableArray, 0, object);
+
+        zen_Interpreter_loadArguments(interpreter, function, &stackFrame->m_localVariableArray,
             arguments, true);
         zen_Interpreter_interpret(interpreter);
 
         if ((interpreter->m_state & ZEN_INTERPRETER_STATE_EXCEPTION_THROWN) == 0) {
             if ((function->m_returnType != ZEN_TYPE_VOID) &&
                 (oldStackFrame != NULL)) {
-                result = zen_OperandStack_popReference(stackFrame->m_operandStack);
-                zen_OperandStack_pushReference(oldStackFrame->m_operandStack, result);
+                result = zen_OperandStack_popReference(&stackFrame->m_operandStack);
+                zen_OperandStack_pushReference(&oldStackFrame->m_operandStack, result);
             }
 
             /* Do not pop the stack frame if an exception is being thrown. The stack frames
@@ -3903,7 +5267,8 @@ void zen_Interpreter_formatClassDescriptor(const uint8_t* descriptor,
 }
 
 void zen_Interpreter_invokeThreadExceptionHandler(zen_Interpreter_t* interpreter) {
-    zen_Class_t* exceptionClass = zen_Object_getClass(interpreter->m_exception);
+    zen_Class_t* exceptionClass = zen_Object_getClass(interpreter->m_virtualMachine,
+        interpreter->m_exception);
     uint8_t name[exceptionClass->m_descriptorSize + 1];
     zen_Interpreter_formatClassDescriptor(exceptionClass->m_descriptor,
         exceptionClass->m_descriptorSize, name,
@@ -3914,9 +5279,8 @@ void zen_Interpreter_invokeThreadExceptionHandler(zen_Interpreter_t* interpreter
 
     jtk_Iterator_t* iterator = jtk_DoublyLinkedList_getIterator(interpreter->m_invocationStack->m_trace);
     while (jtk_Iterator_hasNext(iterator)) {
-        zen_StackFrame_t* stackFrame = (zen_StackFrame_t*)jtk_Iterator_getNext(iterator);
-        zen_Class_t* class0 = stackFrame->m_class;
-        zen_Function_t* function = stackFrame->m_function;
+        zen_Function_t* function = (zen_Function_t*)jtk_Iterator_getNext(iterator);
+        zen_Class_t* class0 = function->m_class;
 
         uint8_t friendlyDescriptor[function->m_descriptorSize + 1];
         int32_t afterColon = -1;
@@ -3958,101 +5322,25 @@ void zen_Interpreter_invokeThreadExceptionHandler(zen_Interpreter_t* interpreter
     jtk_Iterator_delete(iterator);
 }
 
-/* Load Arguments */
+/* Unpack Arguments */
 
-void zen_Interpreter_loadArguments(zen_Interpreter_t* interpreter,
-    zen_Function_t* function, zen_LocalVariableArray_t* array,
-    jtk_Array_t* arguments, bool instance) {
-    int32_t i;
-    int32_t j;
-    /* Start from the second slot, if the specified function is an instance function.
-     * The first slot is reserved for self reference.
+void zen_Interpreter_unpackArguments(zen_Interpreter_t* interpreter,
+    zen_Function_t* function, zen_LocalVariableArray_t* array, bool instance) {
+    /* The arguments were pushed as references. Read all of them before they
+     * are overwritten by the typed local variables.
      */
-    j = instance? ZEN_LOCAL_VARIABLE_ARRAY_REFERENCE_SLOT_COUNT : 0;
-    for (i = 0; i < function->m_parameterCount; i++) {
-        zen_Type_t parameterType = (zen_Type_t)function->m_parameters[i * 2];
-        switch (parameterType) {
-            case ZEN_TYPE_BOOLEAN: {
-                // TODO: Change the arguments type from jtk_Array_t to zen_Arguments_t!
-                bool argument = (bool)jtk_Array_getValue(arguments, i);
-                zen_LocalVariableArray_setInteger(array, j, (int32_t)argument);
-                j += 1;
-                break;
-            }
-
-            case ZEN_TYPE_CHARACTER: {
-                // TODO: Change the arguments type from jtk_Array_t to zen_Arguments_t!
-                // TODO: Is character 1 byte?
-                uint8_t argument = (uint8_t)jtk_Array_getValue(arguments, i);
-                zen_LocalVariableArray_setInteger(array, j, (int32_t)argument);
-                j += 1;
-                break;
-            }
-
-            case ZEN_TYPE_INTEGER_8: {
-                // TODO: Change the arguments type from jtk_Array_t to zen_Arguments_t!
-                int8_t argument = (int8_t)jtk_Array_getValue(arguments, i);
-                zen_LocalVariableArray_setInteger(array, j, (int32_t)argument);
-                j += 1;
-                break;
-            }
-
-            case ZEN_TYPE_INTEGER_16: {
-                // TODO: Change the arguments type from jtk_Array_t to zen_Arguments_t!
-                int16_t argument = (int16_t)jtk_Array_getValue(arguments, i);
-                zen_LocalVariableArray_setInteger(array, j, (int32_t)argument);
-                j += 1;
-                break;
-            }
-
-            case ZEN_TYPE_INTEGER_32: {
-                // TODO: Change the arguments type from jtk_Array_t to zen_Arguments_t!
-                int32_t argument = (int32_t)jtk_Array_getValue(arguments, i);
-                zen_LocalVariableArray_setInteger(array, j, argument);
-                j += 1;
-                break;
-            }
-
-            case ZEN_TYPE_DECIMAL_32: {
-                // TODO: Change the arguments type from jtk_Array_t to zen_Arguments_t!
-                // NOTE: We are using bit pattern instead of float values.
-                // Otherwise, all the casting could result in loss of value.
-                int32_t argument = (int32_t)jtk_Array_getValue(arguments, i);
-                zen_LocalVariableArray_setInteger(array, j, argument);
-                j += 1;
-                break;
-            }
-
-            case ZEN_TYPE_INTEGER_64: {
-                // TODO: Change the arguments type from jtk_Array_t to zen_Arguments_t!
-                int64_t argument = (int64_t)jtk_Array_getValue(arguments, i);
-                zen_LocalVariableArray_setLong(array, j, argument);
-                j += 1;
-                break;
-            }
-
-            case ZEN_TYPE_DECIMAL_64: {
-                // TODO: Change the arguments type from jtk_Array_t to zen_Arguments_t!
-                // NOTE: We are using bit pattern instead of double values.
-                // Otherwise, all the casting could result in loss of value.
-                int64_t argument = (int64_t)jtk_Array_getValue(arguments, i);
-                zen_LocalVariableArray_setLong(array, j, argument);
-                j += 1;
-                break;
-            }
-
-            case ZEN_TYPE_REFERENCE: {
-                void* argument = jtk_Array_getValue(arguments, i);
-                zen_LocalVariableArray_setReference(array, j, argument);
-                j += ZEN_LOCAL_VARIABLE_ARRAY_REFERENCE_SLOT_COUNT;
-                break;
-            }
-
-            default: {
-                printf("[error] Invalid parameter type %d!\n", parameterType);
-            }
-        }
+    int32_t parameterCount = function->m_parameterCount;
+    void* values[parameterCount + 1];
+    int32_t* slots = array->m_values + (instance? ZEN_INTERPRETER_REFERENCE_SLOT_COUNT : 0);
+    int32_t i;
+    for (i = 0; i < parameterCount; i++) {
+        values[i] = (void*)zen_Interpreter_readReference(slots + (i * ZEN_INTERPRETER_REFERENCE_SLOT_COUNT));
     }
+
+    jtk_Array_t arguments;
+    arguments.m_values = values;
+    arguments.m_size = parameterCount;
+    zen_Interpreter_loadArguments(interpreter, function, array, &arguments, instance);
 }
 
 /* Throw */
@@ -4066,12 +5354,14 @@ bool zen_Interpreter_throw(zen_Interpreter_t* interpreter,
     zen_InvocationStack_startTracing(interpreter->m_invocationStack);
 
     /* Retrieve the class of the exception object. */
-    zen_Class_t* exceptionClass = zen_Object_getClass(exception);
+    zen_Class_t* exceptionClass = zen_Object_getClass(interpreter->m_virtualMachine, exception);
 
     /* The exception mechanism may temporarily pause when the control
      * is returned to native functions. Therefore, save the exception that is being thrown.
      */
     interpreter->m_exception = exception;
+    /* The stack frame with the exception handler is yet to be discovered. */
+    interpreter->m_handlerStackFrame = NULL;
 
     /* Recursively search the stack trace for the most appropriate
      * exception handler or native function nearest to the current
@@ -4123,14 +5413,8 @@ bool zen_Interpreter_throw(zen_Interpreter_t* interpreter,
                         */
                     if ((currentStackFrame->m_ip >= site->m_startIndex) &&
                         (currentStackFrame->m_ip <= site->m_stopIndex)) {
-                        zen_EntityFile_t* entityFile = currentStackFrame->m_class->m_entityFile;
-                        zen_ConstantPool_t* constantPool = &entityFile->m_constantPool;
-                        zen_ConstantPoolClass_t* classEntry =
-                            (zen_ConstantPoolClass_t*)constantPool->m_entries[site->m_exceptionClassIndex];
-                        zen_ConstantPoolUtf8_t* nameEntry = constantPool->m_entries[classEntry->m_nameIndex];
-
-                        zen_Class_t* filterClass = zen_VirtualMachine_getClassEx(interpreter->m_virtualMachine,
-                            nameEntry->m_bytes, nameEntry->m_length, &nameEntry->m_hashCode);
+                        zen_Class_t* filterClass = zen_Class_resolveClass(interpreter->m_virtualMachine,
+                            currentStackFrame->m_class, site->m_exceptionClassIndex);
 
                         if (exceptionClass == filterClass) {
                             found = true;
@@ -4146,7 +5430,7 @@ bool zen_Interpreter_throw(zen_Interpreter_t* interpreter,
                                 * stack belonging to the function with the suitable exception
                                 * handler. This reference is required by the "catch clause".
                                 */
-                            zen_OperandStack_pushReference(currentStackFrame->m_operandStack, exception);
+                            zen_OperandStack_pushReference(&currentStackFrame->m_operandStack, exception);
 
                             /* A suitable exception handler has been discovered. Terminate the search
                             * loop.
@@ -4182,4 +5466,540 @@ bool zen_Interpreter_throw(zen_Interpreter_t* interpreter,
     }
 
     return found;
+}
+
+/* Stack Overflow */
+
+void zen_Interpreter_raiseStackOverflowException(zen_Interpreter_t* interpreter) {
+    zen_VirtualMachine_t* virtualMachine = interpreter->m_virtualMachine;
+    zen_InvocationStack_t* invocationStack = interpreter->m_invocationStack;
+
+    if (!zen_InvocationStack_isReserveEnabled(invocationStack)) {
+        /* The constructor of the exception is invoked on the invocation stack
+         * that overflowed, therefore, it may use the reserve.
+         */
+        zen_InvocationStack_enableReserve(invocationStack);
+        zen_VirtualMachine_raiseStackOverflowException(virtualMachine);
+        zen_InvocationStack_disableReserve(invocationStack);
+    }
+    else {
+        /* The constructor of the exception overflowed the reserve, too. Instead
+         * of overflowing again, the exception is thrown without being
+         * constructed.
+         */
+        zen_Class_t* class0 = zen_VirtualMachine_getClass(virtualMachine,
+            "zen/core/StackOverflowException", 31);
+        zen_Object_t* exception = zen_VirtualMachine_allocateObject(virtualMachine, class0);
+        interpreter->m_state |= ZEN_INTERPRETER_STATE_EXCEPTION_THROWN;
+        zen_Interpreter_throw(interpreter, exception);
+    }
+}
+
+/* Virtual Function */
+
+void zen_Interpreter_linkVirtualCallSite(zen_Interpreter_t* interpreter,
+    zen_StackFrame_t* stackFrame, zen_InlineCache_t* inlineCache, int32_t index) {
+    int32_t virtualIndex = -1;
+    zen_Function_t* function = zen_Class_resolveVirtualFunction(interpreter->m_virtualMachine,
+        stackFrame->m_class, index, &virtualIndex);
+
+    /* The call site remains unlinked when the class of the function cannot be
+     * found, so that the exception is raised every time.
+     */
+    if ((interpreter->m_state & ZEN_INTERPRETER_STATE_EXCEPTION_THROWN) == 0) {
+        inlineCache->m_virtualIndex = (function != NULL)? virtualIndex : -1;
+        inlineCache->m_virtualRoot = (function != NULL)? function->m_virtualRoot : NULL;
+    }
+}
+
+zen_Function_t* zen_Interpreter_lookupVirtualFunction(zen_Interpreter_t* interpreter,
+    zen_StackFrame_t* stackFrame, zen_InlineCache_t* inlineCache,
+    zen_Class_t* selfClass, int32_t index) {
+    zen_InlineCacheStatistics_t* statistics = &interpreter->m_inlineCacheStatistics;
+
+    zen_Function_t* function = zen_InlineCache_getPolymorphicFunction(inlineCache, selfClass);
+    if (function != NULL) {
+        statistics->m_polymorphicHits++;
+    }
+    else {
+        zen_ConstantPool_t* constantPool = &stackFrame->m_class->m_entityFile->m_constantPool;
+        zen_ConstantPoolFunction_t* functionEntry =
+            (zen_ConstantPoolFunction_t*)constantPool->m_entries[index];
+
+        /* The constant pool entry of the function identifies the name and the
+         * descriptor of the function. Therefore, it is used as the selector
+         * in the megamorphic cache.
+         */
+        bool megamorphic = zen_InlineCache_isMegamorphic(inlineCache);
+        if (megamorphic) {
+            function = zen_MegamorphicCache_getFunction(interpreter->m_megamorphicCache,
+                selfClass, functionEntry);
+        }
+
+        if (function != NULL) {
+            statistics->m_megamorphicHits++;
+        }
+        else {
+            statistics->m_misses++;
+
+            zen_ConstantPoolUtf8_t* nameEntry = constantPool->m_entries[functionEntry->m_nameIndex];
+            zen_ConstantPoolUtf8_t* descriptorEntry = constantPool->m_entries[functionEntry->m_descriptorIndex];
+            function = zen_Class_getVirtualFunction(selfClass,
+                nameEntry->m_bytes, nameEntry->m_length, descriptorEntry->m_bytes,
+                descriptorEntry->m_length);
+
+            /* Unresolved functions are not cached, so that the failure is
+             * reported every time the instruction is executed.
+             */
+            if (function != NULL) {
+                if (megamorphic) {
+                    zen_MegamorphicCache_putFunction(interpreter->m_megamorphicCache,
+                        selfClass, functionEntry, function);
+                }
+                else {
+                    zen_InlineCache_add(inlineCache, selfClass, function);
+                }
+            }
+        }
+    }
+
+    return function;
+}
+
+/* Field */
+
+/* Links the specified field access site to the class of the specified
+ * instance. When the field cannot be accessed, either a NullReferenceException
+ * or an UnknownFieldException is thrown and false is returned, so that the
+ * caller can transfer the control to the exception handler.
+ */
+bool zen_Interpreter_linkInstanceField(zen_Interpreter_t* interpreter,
+    zen_StackFrame_t* stackFrame, zen_FieldCache_t* fieldCache, zen_Object_t* self,
+    int32_t index) {
+    zen_VirtualMachine_t* virtualMachine = interpreter->m_virtualMachine;
+
+    bool result = false;
+    if (self == NULL) {
+        /* A null instance is not a cache miss, the site remains linked to the
+         * class it was linked to earlier.
+         */
+        zen_VirtualMachine_raiseNullReferenceException(virtualMachine);
+    }
+    else {
+        zen_ConstantPool_t* constantPool = &stackFrame->m_class->m_entityFile->m_constantPool;
+        zen_ConstantPoolField_t* fieldEntry =
+            (zen_ConstantPoolField_t*)constantPool->m_entries[index];
+        zen_ConstantPoolUtf8_t* nameEntry =
+            (zen_ConstantPoolUtf8_t*)constantPool->m_entries[fieldEntry->m_nameIndex];
+
+        interpreter->m_inlineCacheStatistics.m_fieldMisses++;
+
+        /* The field is looked up in the class of the instance, rather than the
+         * class named by the constant pool entry, because the language is
+         * dynamically typed. Small integers have no body to hold fields.
+         */
+        zen_Class_t* class0 = NULL;
+        zen_Field_t* field = NULL;
+        if (!ZEN_OBJECT_IS_SMALL_INTEGER(self)) {
+            class0 = zen_Object_getClass(interpreter->m_virtualMachine, self);
+            field = zen_Class_findField(class0, nameEntry->m_bytes, nameEntry->m_length);
+        }
+
+        if ((field == NULL) || zen_Field_isStatic(field) || !zen_Field_isReference(field)) {
+            zen_VirtualMachine_raiseUnknownFieldException(virtualMachine,
+                nameEntry->m_bytes, nameEntry->m_length);
+        }
+        else {
+            fieldCache->m_class = class0;
+            fieldCache->m_offset = field->m_offset;
+            result = true;
+        }
+    }
+
+    return result;
+}
+
+bool zen_Interpreter_loadInstanceField(zen_Interpreter_t* interpreter,
+    zen_StackFrame_t* stackFrame, zen_FieldCache_t* fieldCache, zen_Object_t* self,
+    int32_t index, uintptr_t* value) {
+    bool result;
+    if (ZEN_OBJECT_IS_SMALL_INTEGER(self)) {
+        /* The value of a small integer is stored in the reference itself,
+         * therefore, it cannot be cached.
+         */
+        zen_ConstantPool_t* constantPool = &stackFrame->m_class->m_entityFile->m_constantPool;
+        zen_ConstantPoolField_t* fieldEntry =
+            (zen_ConstantPoolField_t*)constantPool->m_entries[index];
+        zen_ConstantPoolUtf8_t* nameEntry =
+            (zen_ConstantPoolUtf8_t*)constantPool->m_entries[fieldEntry->m_nameIndex];
+        *value = (uintptr_t)zen_VirtualMachine_getObjectField(interpreter->m_virtualMachine,
+            self, nameEntry->m_bytes, nameEntry->m_length);
+        result = (interpreter->m_state & ZEN_INTERPRETER_STATE_EXCEPTION_THROWN) == 0;
+    }
+    else {
+        result = zen_Interpreter_linkInstanceField(interpreter, stackFrame, fieldCache,
+            self, index);
+        if (result) {
+            *value = *((uintptr_t*)((uint8_t*)self + ZEN_OBJECT_HEADER_SIZE +
+                fieldCache->m_offset));
+        }
+    }
+
+    return result;
+}
+
+bool zen_Interpreter_storeInstanceField(zen_Interpreter_t* interpreter,
+    zen_StackFrame_t* stackFrame, zen_FieldCache_t* fieldCache, zen_Object_t* self,
+    int32_t index, uintptr_t value) {
+    bool result = zen_Interpreter_linkInstanceField(interpreter, stackFrame, fieldCache,
+        self, index);
+    if (result) {
+        zen_MemoryManager_t* manager = interpreter->m_virtualMachine->m_memoryManager;
+        uintptr_t* field = (uintptr_t*)((uint8_t*)self + ZEN_OBJECT_HEADER_SIZE +
+            fieldCache->m_offset);
+        ZEN_MEMORY_MANAGER_PRE_WRITE_BARRIER(manager, field);
+        *field = value;
+        ZEN_MEMORY_MANAGER_WRITE_BARRIER(manager, self, value);
+    }
+
+    return result;
+}
+
+bool zen_Interpreter_linkStaticField(zen_Interpreter_t* interpreter,
+    zen_StackFrame_t* stackFrame, zen_FieldCache_t* fieldCache, int32_t index) {
+    zen_Field_t* field = zen_Class_resolveField(interpreter->m_virtualMachine,
+        stackFrame->m_class, index);
+
+    bool result = (field != NULL) && zen_Field_isStatic(field) && zen_Field_isReference(field);
+    if (result) {
+        /* An inherited static field refers to the storage of the class that
+         * declares it.
+         */
+        fieldCache->m_address = field->m_class->m_staticFields + field->m_offset;
+    }
+    else {
+        zen_ConstantPool_t* constantPool = &stackFrame->m_class->m_entityFile->m_constantPool;
+        zen_ConstantPoolField_t* fieldEntry =
+            (zen_ConstantPoolField_t*)constantPool->m_entries[index];
+        zen_ConstantPoolUtf8_t* nameEntry =
+            (zen_ConstantPoolUtf8_t*)constantPool->m_entries[fieldEntry->m_nameIndex];
+        zen_VirtualMachine_raiseUnknownFieldException(interpreter->m_virtualMachine,
+            nameEntry->m_bytes, nameEntry->m_length);
+    }
+
+    return result;
+}
+
+/* Literal */
+
+zen_Object_t* zen_Interpreter_resolveLiteral(zen_Interpreter_t* interpreter,
+    zen_Class_t* class0, int32_t index) {
+    zen_VirtualMachine_t* virtualMachine = interpreter->m_virtualMachine;
+    zen_ConstantPool_t* constantPool = &class0->m_entityFile->m_constantPool;
+    zen_ConstantPoolEntry_t* entry = constantPool->m_entries[index];
+
+    zen_Object_t* result = NULL;
+    switch (entry->m_tag) {
+        case ZEN_CONSTANT_POOL_TAG_INTEGER: {
+            zen_ConstantPoolInteger_t* constantPoolInteger = (zen_ConstantPoolInteger_t*)entry;
+            result = zen_VirtualMachine_newInteger(virtualMachine,
+                zen_ConstantPoolInteger_getValue(constantPoolInteger));
+            break;
+        }
+
+        case ZEN_CONSTANT_POOL_TAG_LONG: {
+            zen_ConstantPoolLong_t* constantPoolLong = (zen_ConstantPoolLong_t*)entry;
+            result = zen_VirtualMachine_newInteger(virtualMachine,
+                zen_ConstantPoolLong_getValue(constantPoolLong));
+            break;
+        }
+
+        case ZEN_CONSTANT_POOL_TAG_STRING: {
+            zen_ConstantPoolString_t* constantPoolString = (zen_ConstantPoolString_t*)entry;
+            zen_ConstantPoolUtf8_t* constantPoolUtf8 =
+                (zen_ConstantPoolUtf8_t*)constantPool->m_entries[constantPoolString->m_stringIndex];
+
+            result = zen_VirtualMachine_newStringFromUtf8(virtualMachine,
+                constantPoolUtf8->m_bytes, constantPoolUtf8->m_length);
+            /* Literals live as long as their classes and are compared often,
+             * therefore, their hashes are computed upfront.
+             */
+            if (result != NULL) {
+                zen_String_getHash(result);
+            }
+
+            jtk_Logger_debug(virtualMachine->m_logger, "Resolved string literal '%.*s' (index = %d, string object at 0x%X)",
+                constantPoolUtf8->m_length, constantPoolUtf8->m_bytes, index, result);
+
+            break;
+        }
+
+        default: {
+            printf("[internal error] The constant pool entry at index %d does not denote a literal.\n",
+                index);
+        }
+    }
+
+    /* A literal whose construction failed is not remembered, so that the
+     * failure is reported every time the instruction is executed.
+     */
+    if ((interpreter->m_state & ZEN_INTERPRETER_STATE_EXCEPTION_THROWN) == 0) {
+        class0->m_resolvedEntries[index].m_object = result;
+    }
+
+    return result;
+}
+
+/* Operator */
+
+zen_Object_t* zen_Interpreter_evaluateIntegerOperator(zen_Interpreter_t* interpreter,
+    int32_t operator0, int64_t value1, int64_t value2) {
+    zen_VirtualMachine_t* virtualMachine = interpreter->m_virtualMachine;
+
+    zen_Object_t* result = NULL;
+    switch (operator0) {
+        case ZEN_OPERATOR_ADD: {
+            result = zen_VirtualMachine_newInteger(virtualMachine, value1 + value2);
+            break;
+        }
+
+        case ZEN_OPERATOR_SUBTRACT: {
+            result = zen_VirtualMachine_newInteger(virtualMachine, value1 - value2);
+            break;
+        }
+
+        case ZEN_OPERATOR_MULTIPLY: {
+            result = zen_VirtualMachine_newInteger(virtualMachine, value1 * value2);
+            break;
+        }
+
+        /* The quotient of the smallest integer and -1 overflows, which traps
+         * on some processors. Therefore, division by -1 is evaluated as
+         * negation, which wraps around like the other operators.
+         */
+        case ZEN_OPERATOR_DIVIDE: {
+            int64_t quotient = (value2 == -1)? (int64_t)(0 - (uint64_t)value1) :
+                (value1 / value2);
+            result = zen_VirtualMachine_newInteger(virtualMachine, quotient);
+            break;
+        }
+
+        case ZEN_OPERATOR_REMAINDER: {
+            int64_t remainder = (value2 == -1)? 0 : (value1 % value2);
+            result = zen_VirtualMachine_newInteger(virtualMachine, remainder);
+            break;
+        }
+
+        case ZEN_OPERATOR_EQUAL: {
+            result = zen_VirtualMachine_newBoolean(virtualMachine, value1 == value2);
+            break;
+        }
+
+        case ZEN_OPERATOR_NOT_EQUAL: {
+            result = zen_VirtualMachine_newBoolean(virtualMachine, value1 != value2);
+            break;
+        }
+
+        case ZEN_OPERATOR_GREATER: {
+            result = zen_VirtualMachine_newBoolean(virtualMachine, value1 > value2);
+            break;
+        }
+
+        case ZEN_OPERATOR_GREATER_OR_EQUAL: {
+            result = zen_VirtualMachine_newBoolean(virtualMachine, value1 >= value2);
+            break;
+        }
+
+        case ZEN_OPERATOR_LESSER: {
+            result = zen_VirtualMachine_newBoolean(virtualMachine, value1 < value2);
+            break;
+        }
+
+        case ZEN_OPERATOR_LESSER_OR_EQUAL: {
+            result = zen_VirtualMachine_newBoolean(virtualMachine, value1 <= value2);
+            break;
+        }
+    }
+
+    return result;
+}
+
+/* Intrinsic */
+
+bool zen_Interpreter_evaluateIntrinsic(zen_Interpreter_t* interpreter,
+    zen_Function_t* function, zen_Object_t* self, zen_Object_t** arguments,
+    zen_Object_t** result) {
+    zen_Class_t* class0 = function->m_class;
+    int32_t operator0 = function->m_intrinsicOperator;
+
+    bool evaluated = false;
+    switch (function->m_intrinsic) {
+        case ZEN_INTRINSIC_INTEGER: {
+            zen_Object_t* operand1 = arguments[0];
+            zen_Object_t* operand2 = arguments[1];
+            if ((ZEN_OBJECT_IS_SMALL_INTEGER(operand1) || ZEN_INTERPRETER_IS_EXACT_INSTANCE(operand1, class0)) &&
+                (ZEN_OBJECT_IS_SMALL_INTEGER(operand2) || ZEN_INTERPRETER_IS_EXACT_INSTANCE(operand2, class0))) {
+                int32_t offset = ZEN_OBJECT_HEADER_SIZE + function->m_intrinsicValueOffset;
+                int64_t value1 = ZEN_INTERPRETER_GET_INTEGER_VALUE(operand1, offset);
+                int64_t value2 = ZEN_INTERPRETER_GET_INTEGER_VALUE(operand2, offset);
+
+                /* Division by zero is left to the native function, which
+                 * raises the exception.
+                 */
+                if ((value2 != 0) || ((operator0 != ZEN_OPERATOR_DIVIDE) &&
+                    (operator0 != ZEN_OPERATOR_REMAINDER))) {
+                    *result = zen_Interpreter_evaluateIntegerOperator(interpreter,
+                        operator0, value1, value2);
+                    evaluated = true;
+                }
+            }
+            break;
+        }
+
+        case ZEN_INTRINSIC_STRING: {
+            zen_Object_t* operand1 = arguments[0];
+            zen_Object_t* operand2 = arguments[1];
+            if (ZEN_INTERPRETER_IS_EXACT_INSTANCE(operand1, class0) &&
+                ZEN_INTERPRETER_IS_EXACT_INSTANCE(operand2, class0)) {
+                bool equal = zen_String_isEqual(operand1, operand2);
+                *result = zen_VirtualMachine_newBoolean(interpreter->m_virtualMachine,
+                    equal == (operator0 == ZEN_OPERATOR_EQUAL));
+                evaluated = true;
+            }
+            break;
+        }
+
+        case ZEN_INTRINSIC_BOOLEAN_GET_VALUE: {
+            if (ZEN_INTERPRETER_IS_EXACT_INSTANCE(self, class0)) {
+                *result = *((zen_Object_t**)((uint8_t*)self + ZEN_OBJECT_HEADER_SIZE +
+                    function->m_intrinsicValueOffset));
+                evaluated = true;
+            }
+            break;
+        }
+    }
+
+    if (evaluated) {
+        interpreter->m_inlineCacheStatistics.m_intrinsicHits++;
+    }
+
+    return evaluated;
+}
+
+zen_Function_t* zen_Interpreter_lookupOperatorFunction(zen_Interpreter_t* interpreter,
+    zen_OperatorCache_t* operatorCache, int32_t operator0, zen_Class_t* class1,
+    zen_Class_t* class2) {
+    zen_InlineCacheStatistics_t* statistics = &interpreter->m_inlineCacheStatistics;
+
+    zen_Function_t* function = zen_OperatorCache_getFunction(operatorCache, class1, class2);
+    if (function != NULL) {
+        statistics->m_operatorHits++;
+    }
+    else {
+        int32_t nameSize = 0;
+        const uint8_t* name = zen_Operator_getFunctionName(operator0, &nameSize);
+
+        /* The function is looked up in the class of the first operand only.
+         * The name of the function is unique to the operator. Therefore, it is
+         * used as the selector in the megamorphic cache.
+         */
+        bool megamorphic = zen_OperatorCache_isMegamorphic(operatorCache);
+        if (megamorphic && (name != NULL)) {
+            function = zen_MegamorphicCache_getFunction(interpreter->m_megamorphicCache,
+                class1, name);
+        }
+
+        if (function != NULL) {
+            statistics->m_operatorHits++;
+        }
+        else {
+            statistics->m_operatorMisses++;
+
+            if (name != NULL) {
+                function = zen_Class_getStaticFunction(class1, name, nameSize,
+                    "(zen/core/Object):(zen/core/Object)(zen/core/Object)", 52);
+            }
+
+            /* Unresolved functions are not cached, so that the failure is
+             * reported every time the instruction is executed.
+             */
+            if (function != NULL) {
+                if (megamorphic) {
+                    zen_MegamorphicCache_putFunction(interpreter->m_megamorphicCache,
+                        class1, name, function);
+                }
+                else {
+                    if ((operatorCache->m_size == 0) && (class1 == class2)) {
+                        zen_Interpreter_linkOperatorIntrinsic(interpreter, operatorCache,
+                            class1, function);
+                    }
+                    zen_OperatorCache_add(operatorCache, class1, class2, function);
+                }
+            }
+        }
+    }
+
+    return function;
+}
+
+void zen_Interpreter_linkOperatorIntrinsic(zen_Interpreter_t* interpreter,
+    zen_OperatorCache_t* operatorCache, zen_Class_t* class0, zen_Function_t* function) {
+    zen_CoreClasses_t* coreClasses = &interpreter->m_virtualMachine->m_coreClasses;
+    if (zen_Function_isNative(function) && (function->m_nativeFunction != NULL)) {
+        if (class0 == coreClasses->m_integerClass) {
+            if (ZEN_FIELD_HANDLE_IS_RESOLVED(&coreClasses->m_integerValue)) {
+                operatorCache->m_intrinsic = ZEN_OPERATOR_INTRINSIC_INTEGER;
+                operatorCache->m_valueOffset = coreClasses->m_integerValue.m_offset;
+            }
+        }
+        else if (class0 == coreClasses->m_stringClass) {
+            operatorCache->m_intrinsic = ZEN_OPERATOR_INTRINSIC_STRING;
+        }
+    }
+}
+
+/* Statistics */
+
+void zen_Interpreter_printStatistics(zen_Interpreter_t* interpreter) {
+    jtk_Assert_assertObject(interpreter, "The specified interpreter is null.");
+
+    zen_InlineCacheStatistics_t* statistics = &interpreter->m_inlineCacheStatistics;
+    uint64_t hits = statistics->m_virtualTableHits + statistics->m_monomorphicHits +
+        statistics->m_polymorphicHits + statistics->m_megamorphicHits;
+    uint64_t total = hits + statistics->m_misses;
+    double ratio = (total > 0)? ((double)hits * 100.0) / (double)total : 0.0;
+
+    printf("[statistics] invoke_virtual: %llu calls, %.2f%% hit ratio\n"
+        "[statistics]     virtual table hits: %llu\n"
+        "[statistics]     monomorphic hits:   %llu\n"
+        "[statistics]     polymorphic hits:   %llu\n"
+        "[statistics]     megamorphic hits:   %llu\n"
+        "[statistics]     misses:             %llu\n",
+        (unsigned long long)total, ratio,
+        (unsigned long long)statistics->m_virtualTableHits,
+        (unsigned long long)statistics->m_monomorphicHits,
+        (unsigned long long)statistics->m_polymorphicHits,
+        (unsigned long long)statistics->m_megamorphicHits,
+        (unsigned long long)statistics->m_misses);
+
+    uint64_t operatorTotal = statistics->m_operatorIntrinsicHits +
+        statistics->m_operatorHits + statistics->m_operatorMisses;
+    printf("[statistics] invoke_operator: %llu calls\n"
+        "[statistics]     intrinsic hits:     %llu\n"
+        "[statistics]     cache hits:         %llu\n"
+        "[statistics]     misses:             %llu\n",
+        (unsigned long long)operatorTotal,
+        (unsigned long long)statistics->m_operatorIntrinsicHits,
+        (unsigned long long)statistics->m_operatorHits,
+        (unsigned long long)statistics->m_operatorMisses);
+
+    printf("[statistics] intrinsics: %llu native calls evaluated inline\n",
+        (unsigned long long)statistics->m_intrinsicHits);
+
+    printf("[statistics] instance fields: %llu accesses\n"
+        "[statistics]     cache hits:         %llu\n"
+        "[statistics]     misses:             %llu\n",
+        (unsigned long long)(statistics->m_fieldHits + statistics->m_fieldMisses),
+        (unsigned long long)statistics->m_fieldHits,
+        (unsigned long long)statistics->m_fieldMisses);
 }
\ No newline at end of file
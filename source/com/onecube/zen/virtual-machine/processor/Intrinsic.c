@@ -0,0 +1,84 @@
+/*
+ * Copyright 2018-2020 Samuel Rowe
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Sunday, November 15, 2020
+
+#include <jtk/core/CString.h>
+
+#include <com/onecube/zen/virtual-machine/feb/Operator.h>
+#include <com/onecube/zen/virtual-machine/processor/Intrinsic.h>
+
+/*******************************************************************************
+ * Intrinsic                                                                   *
+ *******************************************************************************/
+
+/* The descriptor shared by the operators of the core classes. */
+#define ZEN_INTRINSIC_OPERATOR_DESCRIPTOR "(zen/core/Object):(zen/core/Object)(zen/core/Object)"
+
+static const zen_IntrinsicEntry_t zen_Intrinsic_entries[] = {
+    ZEN_INTRINSIC_ENTRY("zen/core/Integer", "add", ZEN_INTRINSIC_OPERATOR_DESCRIPTOR,
+        ZEN_INTRINSIC_INTEGER, ZEN_OPERATOR_ADD),
+    ZEN_INTRINSIC_ENTRY("zen/core/Integer", "subtract", ZEN_INTRINSIC_OPERATOR_DESCRIPTOR,
+        ZEN_INTRINSIC_INTEGER, ZEN_OPERATOR_SUBTRACT),
+    ZEN_INTRINSIC_ENTRY("zen/core/Integer", "multiply", ZEN_INTRINSIC_OPERATOR_DESCRIPTOR,
+        ZEN_INTRINSIC_INTEGER, ZEN_OPERATOR_MULTIPLY),
+    ZEN_INTRINSIC_ENTRY("zen/core/Integer", "divide", ZEN_INTRINSIC_OPERATOR_DESCRIPTOR,
+        ZEN_INTRINSIC_INTEGER, ZEN_OPERATOR_DIVIDE),
+    ZEN_INTRINSIC_ENTRY("zen/core/Integer", "remainder", ZEN_INTRINSIC_OPERATOR_DESCRIPTOR,
+        ZEN_INTRINSIC_INTEGER, ZEN_OPERATOR_REMAINDER),
+    ZEN_INTRINSIC_ENTRY("zen/core/Integer", "equals", ZEN_INTRINSIC_OPERATOR_DESCRIPTOR,
+        ZEN_INTRINSIC_INTEGER, ZEN_OPERATOR_EQUAL),
+    ZEN_INTRINSIC_ENTRY("zen/core/Integer", "notEquals", ZEN_INTRINSIC_OPERATOR_DESCRIPTOR,
+        ZEN_INTRINSIC_INTEGER, ZEN_OPERATOR_NOT_EQUAL),
+    ZEN_INTRINSIC_ENTRY("zen/core/Integer", "greater", ZEN_INTRINSIC_OPERATOR_DESCRIPTOR,
+        ZEN_INTRINSIC_INTEGER, ZEN_OPERATOR_GREATER),
+    ZEN_INTRINSIC_ENTRY("zen/core/Integer", "greaterOrEqual", ZEN_INTRINSIC_OPERATOR_DESCRIPTOR,
+        ZEN_INTRINSIC_INTEGER, ZEN_OPERATOR_GREATER_OR_EQUAL),
+    ZEN_INTRINSIC_ENTRY("zen/core/Integer", "lesser", ZEN_INTRINSIC_OPERATOR_DESCRIPTOR,
+        ZEN_INTRINSIC_INTEGER, ZEN_OPERATOR_LESSER),
+    ZEN_INTRINSIC_ENTRY("zen/core/Integer", "lesserOrEqual", ZEN_INTRINSIC_OPERATOR_DESCRIPTOR,
+        ZEN_INTRINSIC_INTEGER, ZEN_OPERATOR_LESSER_OR_EQUAL),
+    ZEN_INTRINSIC_ENTRY("zen/core/String", "equals", ZEN_INTRINSIC_OPERATOR_DESCRIPTOR,
+        ZEN_INTRINSIC_STRING, ZEN_OPERATOR_EQUAL),
+    ZEN_INTRINSIC_ENTRY("zen/core/String", "notEquals", ZEN_INTRINSIC_OPERATOR_DESCRIPTOR,
+        ZEN_INTRINSIC_STRING, ZEN_OPERATOR_NOT_EQUAL),
+    ZEN_INTRINSIC_ENTRY("zen/core/Boolean", "getValue", "(zen/core/Object):v",
+        ZEN_INTRINSIC_BOOLEAN_GET_VALUE, -1)
+};
+
+#define ZEN_INTRINSIC_ENTRY_COUNT ((int32_t)(sizeof (zen_Intrinsic_entries) / sizeof (zen_IntrinsicEntry_t)))
+
+/* Find */
+
+/* The table is searched only when a native function is loaded. Therefore, a
+ * linear search suffices.
+ */
+const zen_IntrinsicEntry_t* zen_Intrinsic_find(const uint8_t* className,
+    int32_t classNameSize, const uint8_t* name, int32_t nameSize,
+    const uint8_t* descriptor, int32_t descriptorSize) {
+    const zen_IntrinsicEntry_t* result = NULL;
+    int32_t i;
+    for (i = 0; i < ZEN_INTRINSIC_ENTRY_COUNT; i++) {
+        const zen_IntrinsicEntry_t* entry = &zen_Intrinsic_entries[i];
+        if (jtk_CString_equals(entry->m_name, entry->m_nameSize, name, nameSize) &&
+            jtk_CString_equals(entry->m_className, entry->m_classNameSize, className, classNameSize) &&
+            jtk_CString_equals(entry->m_descriptor, entry->m_descriptorSize, descriptor, descriptorSize)) {
+            result = entry;
+            break;
+        }
+    }
+    return result;
+}
@@ -16,6 +16,7 @@
 
 // Tuesday, March 26, 2019
 
+#include <jtk/collection/array/Arrays.h>
 #include <com/onecube/zen/virtual-machine/processor/InvocationStack.h>
 
 /*******************************************************************************
@@ -26,9 +27,16 @@
 
 zen_InvocationStack_t* zen_InvocationStack_new() {
     zen_InvocationStack_t* invocationStack = jtk_Memory_allocate(zen_InvocationStack_t, 1);
-    invocationStack->m_stackFrames = jtk_DoublyLinkedList_new();
+    invocationStack->m_stackFrames = jtk_Memory_allocate(zen_StackFrame_t,
+        ZEN_INVOCATION_STACK_DEFAULT_FRAME_CAPACITY);
+    invocationStack->m_size = 0;
+    invocationStack->m_capacity = ZEN_INVOCATION_STACK_DEFAULT_FRAME_CAPACITY;
+    invocationStack->m_slots = jtk_Memory_allocate(int32_t,
+        ZEN_INVOCATION_STACK_DEFAULT_SLOT_CAPACITY);
+    invocationStack->m_slotCapacity = ZEN_INVOCATION_STACK_DEFAULT_SLOT_CAPACITY;
     invocationStack->m_trace = jtk_DoublyLinkedList_new();
     invocationStack->m_tracing = false;
+    invocationStack->m_reserveEnabled = false;
 
     return invocationStack;
 }
@@ -38,22 +46,9 @@ zen_InvocationStack_t* zen_InvocationStack_new() {
 void zen_InvocationStack_delete(zen_InvocationStack_t* invocationStack) {
     jtk_Assert_assertObject(invocationStack, "The specified invocation stack is null.");
 
-    jtk_Iterator_t* iterator = zen_InvocationStack_getIterator(invocationStack->m_stackFrames);
-    while (jtk_Iterator_hasNext(iterator)) {
-        zen_StackFrame_t* stackFrame = (zen_StackFrame_t*)jtk_Iterator_getNext(iterator);
-        zen_StackFrame_delete(stackFrame);
-    }
-    jtk_Iterator_delete(iterator);
-
-    iterator = zen_InvocationStack_getIterator(invocationStack->m_trace);
-    while (jtk_Iterator_hasNext(iterator)) {
-        zen_StackFrame_t* stackFrame = (zen_StackFrame_t*)jtk_Iterator_getNext(iterator);
-        zen_StackFrame_delete(stackFrame);
-    }
-    jtk_Iterator_delete(iterator);
-
     jtk_DoublyLinkedList_delete(invocationStack->m_trace);
-    jtk_DoublyLinkedList_delete(invocationStack->m_stackFrames);
+    jtk_Memory_deallocate(invocationStack->m_slots);
+    jtk_Memory_deallocate(invocationStack->m_stackFrames);
     jtk_Memory_deallocate(invocationStack);
 }
 
@@ -62,58 +57,132 @@ void zen_InvocationStack_delete(zen_InvocationStack_t* invocationStack) {
 bool zen_InvocationStack_isEmpty(zen_InvocationStack_t* invocationStack) {
     jtk_Assert_assertObject(invocationStack, "The specified invocation stack is null.");
 
-    return jtk_DoublyLinkedList_isEmpty(invocationStack->m_stackFrames);
+    return invocationStack->m_size == 0;
 }
 
-/* Iterator */
+/* Reserve */
 
-jtk_Iterator_t* zen_InvocationStack_getIterator(zen_InvocationStack_t* invocationStack) {
-    jtk_Assert_assertObject(invocationStack, "The specified invocation stack is null.");
+void zen_InvocationStack_enableReserve(zen_InvocationStack_t* invocationStack) {
+    invocationStack->m_reserveEnabled = true;
+}
+
+void zen_InvocationStack_disableReserve(zen_InvocationStack_t* invocationStack) {
+    invocationStack->m_reserveEnabled = false;
+}
 
-    return jtk_DoublyLinkedList_getIterator(invocationStack->m_stackFrames);
+bool zen_InvocationStack_isReserveEnabled(zen_InvocationStack_t* invocationStack) {
+    return invocationStack->m_reserveEnabled;
 }
 
 /* Push/Pop Stack Frame */
 
-zen_StackFrame_t* zen_InvocationStack_pushStackFrame(zen_InvocationStack_t* invocationStack,
-    zen_Function_t* function) {
+/* Pushes a stack frame, unless it does not fit within the limits. The reserve
+ * is included in the limits, only if specified.
+ */
+static zen_StackFrame_t* zen_InvocationStack_tryPushStackFrame(
+    zen_InvocationStack_t* invocationStack, zen_Function_t* function,
+    int32_t argumentSlotCount, bool reserve) {
     jtk_Assert_assertObject(invocationStack, "The specified invocation stack is null.");
     jtk_Assert_assertObject(function, "The specified function is null.");
 
     // printf("Invoking %s...\n", function->m_name);
 
-    zen_StackFrame_t* stackFrame = zen_StackFrame_new(function);
-    jtk_DoublyLinkedList_addFirst(invocationStack->m_stackFrames, stackFrame);
+    int32_t frameLimit = invocationStack->m_capacity;
+    int32_t slotLimit = invocationStack->m_slotCapacity;
+    if (!reserve) {
+        frameLimit -= ZEN_INVOCATION_STACK_RESERVED_FRAME_COUNT;
+        slotLimit -= ZEN_INVOCATION_STACK_RESERVED_SLOT_COUNT;
+    }
+
+    zen_StackFrame_t* result = NULL;
+    if (invocationStack->m_size < frameLimit) {
+        /* The new stack frame begins where the operand stack of the current
+         * stack frame ends. The arguments on top of the operand stack are
+         * handed over to the local variable array of the new stack frame.
+         */
+        int32_t* slots = invocationStack->m_slots;
+        zen_OperandStack_t* operandStack = NULL;
+        if (invocationStack->m_size > 0) {
+            zen_StackFrame_t* previousStackFrame = &invocationStack->m_stackFrames[invocationStack->m_size - 1];
+            operandStack = &previousStackFrame->m_operandStack;
+
+            jtk_Assert_assertTrue(operandStack->m_size >= argumentSlotCount, "Operand stack underflow");
+            slots = operandStack->m_values + operandStack->m_size - argumentSlotCount;
+        }
+
+        zen_StackFrame_t* stackFrame = &invocationStack->m_stackFrames[invocationStack->m_size];
+        zen_StackFrame_initialize(stackFrame, function, slots, argumentSlotCount);
+
+        /* The arguments are removed from the operand stack of the caller only
+         * when the stack frame fits, so that an overflow leaves the caller
+         * intact.
+         */
+        if (slots + zen_StackFrame_getSlotCount(stackFrame) <= invocationStack->m_slots + slotLimit) {
+            if (operandStack != NULL) {
+                operandStack->m_size -= argumentSlotCount;
+            }
+
+            /* The virtual machine does not initialize the local variables.
+             * However, the slots may hold stale values from previous
+             * invocations, which should not be mistaken for references.
+             */
+            int32_t localVariableCount = stackFrame->m_localVariableArray.m_size;
+            if (localVariableCount > argumentSlotCount) {
+                jtk_Arrays_fill_i(slots + argumentSlotCount, localVariableCount - argumentSlotCount, 0);
+            }
+
+            invocationStack->m_size++;
+            result = stackFrame;
+        }
+    }
+
+    return result;
+}
+
+/* The stack frames pushed on behalf of native code may always use the
+ * reserve, because native functions invoke each other without executing an
+ * invocation instruction.
+ */
+zen_StackFrame_t* zen_InvocationStack_pushStackFrame(zen_InvocationStack_t* invocationStack,
+    zen_Function_t* function) {
+    return zen_InvocationStack_tryPushStackFrame(invocationStack, function, 0, true);
+}
 
-    return stackFrame;
+zen_StackFrame_t* zen_InvocationStack_pushStackFrameEx(zen_InvocationStack_t* invocationStack,
+    zen_Function_t* function, int32_t argumentSlotCount) {
+    return zen_InvocationStack_tryPushStackFrame(invocationStack, function,
+        argumentSlotCount, invocationStack->m_reserveEnabled);
 }
 
 zen_StackFrame_t* zen_InvocationStack_peekStackFrame(zen_InvocationStack_t* invocationStack) {
     jtk_Assert_assertObject(invocationStack, "The specified invocation stack is null.");
 
-    return jtk_DoublyLinkedList_isEmpty(invocationStack->m_stackFrames)?
-        NULL : (zen_StackFrame_t*)jtk_DoublyLinkedList_getFirst(invocationStack->m_stackFrames);
+    return (invocationStack->m_size == 0)?
+        NULL : &invocationStack->m_stackFrames[invocationStack->m_size - 1];
+}
+
+zen_StackFrame_t* zen_InvocationStack_getStackFrame(zen_InvocationStack_t* invocationStack,
+    int32_t index) {
+    jtk_Assert_assertObject(invocationStack, "The specified invocation stack is null.");
+    jtk_Assert_assertTrue((index >= 0) && (index < invocationStack->m_size),
+        "The specified index is invalid.");
+
+    return &invocationStack->m_stackFrames[index];
 }
 
 void zen_InvocationStack_popStackFrame(zen_InvocationStack_t* invocationStack) {
-    jtk_Assert_assertTrue(!jtk_DoublyLinkedList_isEmpty(invocationStack->m_stackFrames),
+    jtk_Assert_assertTrue(invocationStack->m_size > 0,
         "The specified invocation stack is empty.");
 
-    zen_StackFrame_t* currentStackFrame =
-        (zen_StackFrame_t*)jtk_DoublyLinkedList_getFirst(invocationStack->m_stackFrames);
-    jtk_DoublyLinkedList_removeFirst(invocationStack->m_stackFrames);
+    zen_StackFrame_t* currentStackFrame = &invocationStack->m_stackFrames[--invocationStack->m_size];
 
     // printf("Leaving %s...\n", currentStackFrame->m_function->m_name);
 
+    /* The stack frame and its slots are reused by the next invocation. Therefore,
+     * only the function is remembered for the stack trace.
+     */
     if (invocationStack->m_tracing) {
-        jtk_DoublyLinkedList_addLast(invocationStack->m_trace, currentStackFrame);
-    }
-    else {
-        /* NOTE: The stack frame should not be accessible to the world outside the interpreter.
-            * Which means no reference to the stack frame will be maintained outside the interpreter.
-            * Thus, we can destroy the stack frame here.
-            */
-        zen_StackFrame_delete(currentStackFrame);
+        jtk_DoublyLinkedList_addLast(invocationStack->m_trace, currentStackFrame->m_function);
     }
 }
 
@@ -122,7 +191,7 @@ void zen_InvocationStack_popStackFrame(zen_InvocationStack_t* invocationStack) {
 int32_t zen_InvocationStack_getSize(zen_InvocationStack_t* invocationStack) {
     jtk_Assert_assertObject(invocationStack, "The specified invocation stack is null.");
 
-    return jtk_DoublyLinkedList_getSize(invocationStack->m_stackFrames);
+    return invocationStack->m_size;
 }
 
 // Tracing
@@ -133,12 +202,5 @@ void zen_InvocationStack_startTracing(zen_InvocationStack_t* invocationStack) {
 
 void zen_InvocationStack_stopTracing(zen_InvocationStack_t* invocationStack) {
     invocationStack->m_tracing = false;
-
-    jtk_Iterator_t* iterator = jtk_DoublyLinkedList_getIterator(invocationStack->m_trace);
-    while (jtk_Iterator_hasNext(iterator)) {
-        zen_StackFrame_t* stackFrame = (zen_StackFrame_t*)jtk_Iterator_getNext(iterator);
-        zen_StackFrame_delete(stackFrame);
-    }
-    jtk_Iterator_delete(iterator);
     jtk_DoublyLinkedList_clear(invocationStack->m_trace);
 }
\ No newline at end of file
@@ -59,8 +59,18 @@ zen_LocalVariableArray_t* zen_LocalVariableArray_new(int32_t size) {
 void zen_LocalVariableArray_delete(zen_LocalVariableArray_t* localVariableArray) {
     jtk_Assert_assertObject(localVariableArray, "The specified local variable array is null.");
 
-    // zen_MemoryManager_deallocate(memoryManager, localVariableArray->m_values);
-    // zen_MemoryManager_deallocate(memoryManager, localVariableArray);
+    jtk_Memory_deallocate(localVariableArray->m_values);
+    jtk_Memory_deallocate(localVariableArray);
+}
+
+/* Initialize */
+
+void zen_LocalVariableArray_initialize(zen_LocalVariableArray_t* localVariableArray,
+    int32_t* values, int32_t size) {
+    jtk_Assert_assertObject(localVariableArray, "The specified local variable array is null.");
+
+    localVariableArray->m_values = values;
+    localVariableArray->m_size = size;
 }
 
 /* Double */
@@ -60,6 +60,17 @@ void zen_OperandStack_delete(zen_OperandStack_t* stack) {
     jtk_Memory_deallocate(stack);
 }
 
+/* Initialize */
+
+void zen_OperandStack_initialize(zen_OperandStack_t* stack, int32_t* values,
+    int32_t capacity) {
+    jtk_Assert_assertObject(stack, "The specified operand stack is null.");
+
+    stack->m_values = values;
+    stack->m_size = 0;
+    stack->m_capacity = capacity;
+}
+
 /* Available */
 
 bool zen_OperandStack_isAvailable(zen_OperandStack_t* stack, int32_t required) {
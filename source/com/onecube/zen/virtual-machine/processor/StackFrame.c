@@ -26,55 +26,49 @@
  * StackFrame                                                                  *
  *******************************************************************************/
 
-// Constructor
+/* Initialize */
 
-zen_StackFrame_t* zen_StackFrame_new(zen_Function_t* function) {
+void zen_StackFrame_initialize(zen_StackFrame_t* stackFrame, zen_Function_t* function,
+    int32_t* slots, int32_t argumentSlotCount) {
+    jtk_Assert_assertObject(stackFrame, "The specified stack frame is null.");
     jtk_Assert_assertObject(function, "The specified function is null.");
 
-    zen_Class_t* class0 = function->m_class;
-    zen_EntityFile_t* entityFile = class0->m_entityFile;
-    zen_FunctionEntity_t* functionEntity = function->m_functionEntity;
-    zen_ConstantPool_t* constantPool = &entityFile->m_constantPool;
-
-    int32_t maxStackSize = 10;
+    int32_t maxStackSize = ZEN_STACK_FRAME_DEFAULT_MAX_STACK_SIZE;
     int32_t localVariableCount = 0;
 
-    // Check if the function is native or not.
-
-    /* Search in a linear fashion for the instruction attribute in the specified
-     * function. It is recommended that the compilers generate instruction attribute
-     * as the first attribute for functions in general.
-     */
+    /* Native functions do not have an instruction attribute. */
     zen_InstructionAttribute_t* instructionAttribute = function->m_instructionAttribute;
     if (!zen_Function_isNative(function)) {
-        maxStackSize = 4000; // TODO: Fix this!
-        #warning "The max stack size specified in the binary entity file should be acknowledged."
+        /* Older binary entities were generated without a max stack size. */
+        if (instructionAttribute->m_maxStackSize > 0) {
+            maxStackSize = instructionAttribute->m_maxStackSize;
+        }
         localVariableCount = instructionAttribute->m_localVariableCount;
     }
 
-    /* At this point, the instructionAttribute variable should hold a reference
-     * to an instance of zen_InstructionAttribute_t.
+    /* The arguments always live in the local variable array, even when the
+     * function does not declare enough local variables for them.
      */
+    if (localVariableCount < argumentSlotCount) {
+        localVariableCount = argumentSlotCount;
+    }
 
-    zen_StackFrame_t* stackFrame = jtk_Memory_allocate(zen_StackFrame_t, 1);
-    stackFrame->m_operandStack = zen_OperandStack_new(maxStackSize);
-    stackFrame->m_localVariableArray = zen_LocalVariableArray_new(localVariableCount);
-    stackFrame->m_class = class0;
+    zen_LocalVariableArray_initialize(&stackFrame->m_localVariableArray, slots,
+        localVariableCount);
+    zen_OperandStack_initialize(&stackFrame->m_operandStack, slots + localVariableCount,
+        maxStackSize);
+    stackFrame->m_class = function->m_class;
     stackFrame->m_function = function;
     stackFrame->m_instructionAttribute = instructionAttribute;
     stackFrame->m_ip = 0;
-
-    return stackFrame;
 }
 
-// Destructor
+/* Slot Count */
 
-void zen_StackFrame_delete(zen_StackFrame_t* stackFrame) {
+int32_t zen_StackFrame_getSlotCount(zen_StackFrame_t* stackFrame) {
     jtk_Assert_assertObject(stackFrame, "The specified stack frame is null.");
 
-    zen_OperandStack_delete(stackFrame->m_operandStack);
-    zen_LocalVariableArray_delete(stackFrame->m_localVariableArray);
-    jtk_Memory_deallocate(stackFrame);
+    return stackFrame->m_localVariableArray.m_size + stackFrame->m_operandStack.m_capacity;
 }
 
 /* Class */
@@ -98,7 +92,7 @@ zen_Function_t* zen_StackFrame_getFunction(zen_StackFrame_t* stackFrame) {
 zen_LocalVariableArray_t* zen_StackFrame_getLocalVariableArray(zen_StackFrame_t* stackFrame) {
     jtk_Assert_assertObject(stackFrame, "The specified stack frame is null.");
 
-    return stackFrame->m_localVariableArray;
+    return &stackFrame->m_localVariableArray;
 }
 
 /* Operand Stack */
@@ -106,5 +100,5 @@ zen_LocalVariableArray_t* zen_StackFrame_getLocalVariableArray(zen_StackFrame_t*
 zen_OperandStack_t* zen_StackFrame_getOperandStack(zen_StackFrame_t* stackFrame) {
     jtk_Assert_assertObject(stackFrame, "The specified stack frame is null.");
 
-    return stackFrame->m_operandStack;
+    return &stackFrame->m_operandStack;
 }
\ No newline at end of file